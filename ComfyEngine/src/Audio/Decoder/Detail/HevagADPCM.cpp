@@ -0,0 +1,318 @@
+#include "HevagADPCM.h"
+#include <future>
+#include <thread>
+
+#if COMFY_HEVAG_ADPCM_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace Comfy::Audio::Detail
+{
+	namespace
+	{
+		constexpr i16 HevagCoefficients[128][4] =
+		{
+				{      0,     0,     0,     0 }, {   7680,     0,     0,     0 }, {  14720, -6656,     0,     0 }, {  12544, -7040,     0,     0 },
+				{  15616, -7680,     0,     0 }, {  14731, -7059,     0,     0 }, {  14507, -7366,     0,     0 }, {  13920, -7522,     0,     0 },
+				{  13133, -7680,     0,     0 }, {  12028, -7680,     0,     0 }, {  10764, -7680,     0,     0 }, {   9359, -7680,     0,     0 },
+				{   7832, -7680,     0,     0 }, {   6201, -7680,     0,     0 }, {   4488, -7680,     0,     0 }, {   2717, -7680,     0,     0 },
+				{    910, -7680,     0,     0 }, {   -910, -7680,     0,     0 }, {  -2717, -7680,     0,     0 }, {  -4488, -7680,     0,     0 },
+				{  -6201, -7680,     0,     0 }, {  -7832, -7680,     0,     0 }, {  -9359, -7680,     0,     0 }, { -10764, -7680,     0,     0 },
+				{ -12028, -7680,     0,     0 }, { -13133, -7680,     0,     0 }, { -13920, -7522,     0,     0 }, { -14507, -7366,     0,     0 },
+				{ -14731, -7059,     0,     0 }, {   5376, -9216,  3328, -3072 }, {  -6400, -7168, -3328, -2304 }, { -10496, -7424, -3584, -1024 },
+				{   -167, -2722,  -494,  -541 }, {  -7430, -2221, -2298,   424 }, {  -8001, -3166, -2814,   289 }, {   6018, -4750,  2649, -1298 },
+				{   3798, -6946,  3875, -1216 }, {  -8237, -2596, -2071,   227 }, {   9199,  1982, -1382, -2316 }, {  13021, -3044, -3792,  1267 },
+				{  13112, -4487, -2250,  1665 }, {  -1668, -3744, -6456,   840 }, {   7819, -4328,  2111,  -506 }, {   9571, -1336,  -757,   487 },
+				{  10032, -2562,   300,   199 }, {  -4745, -4122, -5486, -1493 }, {  -5896,  2378, -4787, -6947 }, {  -1193, -9117, -1237, -3114 },
+				{   2783, -7108, -1575, -1447 }, {  -7334, -2062, -2212,   446 }, {   6127, -2577,  -315,   -18 }, {   9457, -1858,   102,   258 },
+				{   7876, -4483,  2126,  -538 }, {  -7172, -1795, -2069,   482 }, {  -7358, -2102, -2233,   440 }, {  -9170, -3509, -2674,  -391 },
+				{  -2638, -2647, -1929, -1637 }, {   1873,  9183,  1860, -5746 }, {   9214,  1859, -1124, -2427 }, {  13204, -3012, -4139,  1370 },
+				{  12437, -4792,  -256,   622 }, {  -2653, -1144, -3182, -6878 }, {   9331, -1048,  -828,   507 }, {   1642,  -620,  -946, -4229 },
+				{   4246, -7585,  -533, -2259 }, {  -8988, -3891, -2807,    44 }, {  -2562, -2735, -1730, -1899 }, {   3182,  -483,  -714, -1421 },
+				{   7937, -3844,  2821, -1019 }, {  10069, -2609,   314,   195 }, {   8400, -3297,  1551,  -155 }, {  -8529, -2775, -2432,  -336 },
+				{   9477, -1882,   108,   256 }, {     75, -2241,  -298, -6937 }, {  -9143, -4160, -2963,     5 }, {  -7270, -1958, -2156,   460 },
+				{  -2740,  3745,  5936, -1089 }, {   8993,  1948,  -683, -2704 }, {  13101, -2835, -3854,  1055 }, {   9543, -1961,   130,   250 },
+				{   5272, -4270,  3124, -3157 }, {  -7696, -3383, -2907,  -456 }, {   7309,  2523,   434, -2461 }, {  10275, -2867,   391,   172 },
+				{  10940, -3721,   665,    97 }, {     24,  -310, -1262,   320 }, {  -8122, -2411, -2311,  -271 }, {  -8511, -3067, -2337,   163 },
+				{    326, -3846,   419,  -933 }, {   8895,  2194,  -541, -2880 }, {  12073, -1876, -2017,  -601 }, {   8729, -3423,  1674,  -169 },
+				{  12950, -3847, -3007,  1946 }, {  10038, -2570,   302,   198 }, {   9385, -2757,  1008,    41 }, {  -4720, -5006, -2852, -1161 },
+				{   7869, -4326,  2135,  -501 }, {   2450, -8597,  1299, -2780 }, {  10192, -2763,   360,   181 }, {  11313, -4213,   833,    53 },
+				{  10154, -2716,   345,   185 }, {   9638, -1417,  -737,   482 }, {   3854, -4554,  2843, -3397 }, {   6699, -5659,  2249, -1074 },
+				{  11082, -3908,   728,    80 }, {  -1026, -9810,  -805, -3462 }, {  10396, -3746,  1367,   -96 }, {  10287,   988, -1915, -1437 },
+				{   7953,  3878,  -764, -3263 }, {  12689, -3375, -3354,  2079 }, {   6641,  3166,   231, -2089 }, {  -2348, -7354, -1944, -4122 },
+				{   9290, -4039,  1885,  -246 }, {   4633, -6403,  1748, -1619 }, {  11247, -4125,   802,    61 }, {   9807, -2284,   219,   222 },
+				{   9736, -1536,  -706,   473 }, {   8440, -3436,  1562,  -176 }, {   9307, -1021,  -835,   509 }, {   1698, -9025,   688, -3037 },
+				{  10214, -2791,   368,   179 }, {   8390,  3248,  -758, -2989 }, {   7201,  3316,    46, -2614 }, {    -88, -7809,  -538, -4571 },
+				{   6193, -5189,  2760, -1245 }, {  12325, -1290, -3284,   253 }, {  13064, -4075, -2824,  1877 }, {   5333,  2999,   775, -1132 },
+		};
+
+		constexpr i32 HighNibbleI32(u8 byte) { return ((byte & 0x70) - (byte & 0x80)) >> 4; }
+		constexpr i32 LowNibbleI32(u8 byte) { return (byte & 7) - (byte & 8); }
+
+		struct ADPCMBlockParameters
+		{
+			i32 CoefficientIndex;
+			i32 ShiftFactor;
+			bool IsSilent;
+		};
+
+		ADPCMBlockParameters GetADPCMBlockParameters(const HevagADPCMBlock& adpcmBlock)
+		{
+			i32 coefIndex = ((adpcmBlock.LoopInformation >> 0) & 0xF0) | ((adpcmBlock.DecodingCoefficient >> 4) & 0xF);
+			if (coefIndex > 127) coefIndex = 127;
+
+			i32 shiftFactor = (adpcmBlock.DecodingCoefficient >> 0) & 0xF;
+			if (shiftFactor > 12) shiftFactor = 9;
+			shiftFactor = (20 - shiftFactor);
+
+			i32 flag = (adpcmBlock.LoopInformation >> 0) & 0xF;
+			return { coefIndex, shiftFactor, (flag >= 7) };
+		}
+
+		void DecodeSingleADPCMBlock(const HevagADPCMBlock& adpcmBlock, std::array<i32, 4>& inOutADPCMHistory, i16 outSamples[SamplesPerHevagADPCMBlock])
+		{
+			const auto[coefIndex, shiftFactor, isSilent] = GetADPCMBlockParameters(adpcmBlock);
+
+			for (size_t sample = 0; sample < SamplesPerHevagADPCMBlock; sample++)
+			{
+				i32 decodedSample = 0;
+
+				if (!isSilent)
+				{
+					decodedSample = (((
+						inOutADPCMHistory[0] * HevagCoefficients[coefIndex][0] +
+						inOutADPCMHistory[1] * HevagCoefficients[coefIndex][1] +
+						inOutADPCMHistory[2] * HevagCoefficients[coefIndex][2] +
+						inOutADPCMHistory[3] * HevagCoefficients[coefIndex][3]) >> 5) +
+						((sample & 1 ? HighNibbleI32(adpcmBlock.SoundData[sample / 2]) : LowNibbleI32(adpcmBlock.SoundData[sample / 2])) << shiftFactor)) >> 8;
+				}
+
+				outSamples[sample] = Clamp<i32>(decodedSample, std::numeric_limits<i16>::min(), std::numeric_limits<i16>::max());
+
+				inOutADPCMHistory[3] = inOutADPCMHistory[2];
+				inOutADPCMHistory[2] = inOutADPCMHistory[1];
+				inOutADPCMHistory[1] = inOutADPCMHistory[0];
+				inOutADPCMHistory[0] = decodedSample;
+			}
+		}
+
+#if COMFY_HEVAG_ADPCM_SIMD
+		// NOTE: Below this the thread creation overhead outweighs decoding the channels in parallel, roughly one second of audio
+		constexpr size_t MinBlocksPerChannelForMultithreading = 2048;
+
+		// NOTE: Padded to a multiple of the vector width, the last four values are never used
+		constexpr size_t PaddedSamplesPerADPCMBlock = 32;
+
+		void UnpackShiftedNibblesSIMD(const HevagADPCMBlock& adpcmBlock, i32 shiftFactor, i32 outShiftedNibbles[PaddedSamplesPerADPCMBlock])
+		{
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+			const __m128i shiftCount = _mm_cvtsi32_si128(shiftFactor);
+
+			const __m128i soundData = _mm_srli_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&adpcmBlock)), offsetof(HevagADPCMBlock, SoundData));
+			const __m128i lowNibbles = _mm_and_si128(soundData, nibbleMask);
+			const __m128i highNibbles = _mm_and_si128(_mm_srli_epi16(soundData, 4), nibbleMask);
+
+			// NOTE: Even samples are stored in the low and odd samples in the high nibbles
+			const std::array<__m128i, 2> orderedNibbles = { _mm_unpacklo_epi8(lowNibbles, highNibbles), _mm_unpackhi_epi8(lowNibbles, highNibbles) };
+
+			for (size_t i = 0; i < orderedNibbles.size(); i++)
+			{
+				const std::array<__m128i, 2> nibbleWords = { _mm_unpacklo_epi8(zero, orderedNibbles[i]), _mm_unpackhi_epi8(zero, orderedNibbles[i]) };
+				for (size_t j = 0; j < nibbleWords.size(); j++)
+				{
+					const std::array<__m128i, 2> nibbleDWords = { _mm_unpacklo_epi16(zero, nibbleWords[j]), _mm_unpackhi_epi16(zero, nibbleWords[j]) };
+					for (size_t k = 0; k < nibbleDWords.size(); k++)
+					{
+						// NOTE: Move each 4 bit value to the very top of its lane so that an arithmetic right shift sign extends it
+						const __m128i signExtended = _mm_srai_epi32(_mm_slli_epi32(nibbleDWords[k], 4), 28);
+						_mm_store_si128(reinterpret_cast<__m128i*>(&outShiftedNibbles[(i * 16) + (j * 8) + (k * 4)]), _mm_sll_epi32(signExtended, shiftCount));
+					}
+				}
+			}
+		}
+
+		void DecodeChannelADPCMBlocksSIMD(const HevagADPCMBlock* channelBlocks, size_t channelBlockCount, u32 blockStride, i16* outChannelSamples)
+		{
+			i32 history0 = 0, history1 = 0, history2 = 0, history3 = 0;
+			alignas(16) std::array<i32, PaddedSamplesPerADPCMBlock> shiftedNibbles = {};
+			alignas(16) std::array<i32, PaddedSamplesPerADPCMBlock> decodedSamples = {};
+
+			for (size_t blockIndex = 0; blockIndex < channelBlockCount; blockIndex++)
+			{
+				const auto& adpcmBlock = channelBlocks[blockIndex * blockStride];
+				const auto[coefIndex, shiftFactor, isSilent] = GetADPCMBlockParameters(adpcmBlock);
+
+				if (isSilent)
+				{
+					decodedSamples.fill(0);
+					history0 = history1 = history2 = history3 = 0;
+				}
+				else
+				{
+					UnpackShiftedNibblesSIMD(adpcmBlock, shiftFactor, shiftedNibbles.data());
+
+					const i32 coef0 = HevagCoefficients[coefIndex][0], coef1 = HevagCoefficients[coefIndex][1];
+					const i32 coef2 = HevagCoefficients[coefIndex][2], coef3 = HevagCoefficients[coefIndex][3];
+
+					for (size_t sample = 0; sample < SamplesPerHevagADPCMBlock; sample++)
+					{
+						const i32 decodedSample = (((history0 * coef0 + history1 * coef1 + history2 * coef2 + history3 * coef3) >> 5) + shiftedNibbles[sample]) >> 8;
+						decodedSamples[sample] = decodedSample;
+
+						history3 = history2;
+						history2 = history1;
+						history1 = history0;
+						history0 = decodedSample;
+					}
+				}
+
+				// NOTE: Saturating the packed samples is equivalent to clamping them to the i16 range
+				i16* outBlockSamples = &outChannelSamples[blockIndex * SamplesPerHevagADPCMBlock];
+				for (size_t i = 0; i < 3; i++)
+				{
+					const __m128i packed = _mm_packs_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(&decodedSamples[i * 8 + 0])), _mm_load_si128(reinterpret_cast<const __m128i*>(&decodedSamples[i * 8 + 4])));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(&outBlockSamples[i * 8]), packed);
+				}
+				const __m128i packedTail = _mm_packs_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(&decodedSamples[24])), _mm_setzero_si128());
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(&outBlockSamples[24]), packedTail);
+			}
+		}
+
+		void InterleaveChannelSamplesSIMD(const i16* planarSamples, size_t samplesPerChannel, u32 channelCount, i16* outSamples)
+		{
+			auto loadChannel = [&](u32 channel, size_t sample) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(&planarSamples[(channel * samplesPerChannel) + sample])); };
+			auto storeInterleaved = [&](size_t sample, size_t vectorIndex, __m128i value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(&outSamples[(sample * channelCount) + (vectorIndex * 8)]), value); };
+
+			size_t sample = 0;
+			if (channelCount == 2)
+			{
+				for (; sample + 8 <= samplesPerChannel; sample += 8)
+				{
+					const __m128i left = loadChannel(0, sample), right = loadChannel(1, sample);
+					storeInterleaved(sample, 0, _mm_unpacklo_epi16(left, right));
+					storeInterleaved(sample, 1, _mm_unpackhi_epi16(left, right));
+				}
+			}
+			else if (channelCount == 4)
+			{
+				for (; sample + 8 <= samplesPerChannel; sample += 8)
+				{
+					const __m128i c01Low = _mm_unpacklo_epi16(loadChannel(0, sample), loadChannel(1, sample)), c01High = _mm_unpackhi_epi16(loadChannel(0, sample), loadChannel(1, sample));
+					const __m128i c23Low = _mm_unpacklo_epi16(loadChannel(2, sample), loadChannel(3, sample)), c23High = _mm_unpackhi_epi16(loadChannel(2, sample), loadChannel(3, sample));
+					storeInterleaved(sample, 0, _mm_unpacklo_epi32(c01Low, c23Low));
+					storeInterleaved(sample, 1, _mm_unpackhi_epi32(c01Low, c23Low));
+					storeInterleaved(sample, 2, _mm_unpacklo_epi32(c01High, c23High));
+					storeInterleaved(sample, 3, _mm_unpackhi_epi32(c01High, c23High));
+				}
+			}
+			else if (channelCount == 8)
+			{
+				// NOTE: Regular 8x8 transpose of 16 bit elements
+				for (; sample + 8 <= samplesPerChannel; sample += 8)
+				{
+					std::array<__m128i, 8> words, dwords;
+					for (u32 c = 0; c < 8; c += 2)
+					{
+						words[c + 0] = _mm_unpacklo_epi16(loadChannel(c, sample), loadChannel(c + 1, sample));
+						words[c + 1] = _mm_unpackhi_epi16(loadChannel(c, sample), loadChannel(c + 1, sample));
+					}
+					for (u32 c = 0; c < 8; c += 4)
+					{
+						dwords[c + 0] = _mm_unpacklo_epi32(words[c + 0], words[c + 2]);
+						dwords[c + 1] = _mm_unpackhi_epi32(words[c + 0], words[c + 2]);
+						dwords[c + 2] = _mm_unpacklo_epi32(words[c + 1], words[c + 3]);
+						dwords[c + 3] = _mm_unpackhi_epi32(words[c + 1], words[c + 3]);
+					}
+					for (size_t i = 0; i < 4; i++)
+					{
+						storeInterleaved(sample, (i * 2) + 0, _mm_unpacklo_epi64(dwords[i], dwords[i + 4]));
+						storeInterleaved(sample, (i * 2) + 1, _mm_unpackhi_epi64(dwords[i], dwords[i + 4]));
+					}
+				}
+			}
+
+			// NOTE: Remaining samples and any channel count without a dedicated shuffle pattern
+			for (; sample < samplesPerChannel; sample++)
+			{
+				for (u32 c = 0; c < channelCount; c++)
+					outSamples[(sample * channelCount) + c] = planarSamples[(c * samplesPerChannel) + sample];
+			}
+		}
+#endif
+	}
+
+	void DecodeHevagADPCMBlocksScalar(const HevagADPCMBlock* blocks, size_t blockCount, u32 channelCount, i16* outSamples)
+	{
+		std::array<std::array<i32, 4>, MaxHevagChannelCount> perChannelHistory = {};
+		std::array<std::array<i16, SamplesPerHevagADPCMBlock>, MaxHevagChannelCount> perChannelSampleBuffer = {};
+
+		i16* outWriteHead = outSamples;
+		for (size_t channelBlock = 0; channelBlock < (blockCount / channelCount); channelBlock++)
+		{
+			for (size_t c = 0; c < channelCount; c++)
+				DecodeSingleADPCMBlock(blocks[(channelBlock * channelCount) + c], perChannelHistory[c], perChannelSampleBuffer[c].data());
+
+			for (size_t sample = 0; sample < SamplesPerHevagADPCMBlock; sample++)
+			{
+				for (size_t c = 0; c < channelCount; c++)
+				{
+					*outWriteHead = perChannelSampleBuffer[c][sample];
+					outWriteHead++;
+				}
+			}
+		}
+	}
+
+#if COMFY_HEVAG_ADPCM_SIMD
+	void DecodeHevagADPCMBlocksSIMD(const HevagADPCMBlock* blocks, size_t blockCount, u32 channelCount, i16* outSamples, bool multithreaded)
+	{
+		assert(channelCount >= MinHevagChannelCount && channelCount <= MaxHevagChannelCount);
+
+		const size_t blocksPerChannel = (blockCount / channelCount);
+		const size_t samplesPerChannel = (blocksPerChannel * SamplesPerHevagADPCMBlock);
+		if (blocksPerChannel == 0)
+			return;
+
+		// NOTE: Nothing to interleave so the single channel can be decoded in place
+		if (channelCount == 1)
+		{
+			DecodeChannelADPCMBlocksSIMD(blocks, blocksPerChannel, channelCount, outSamples);
+			return;
+		}
+
+		auto planarSamples = std::unique_ptr<i16[]>(new i16[samplesPerChannel * channelCount]);
+		auto decodeChannel = [&](u32 channel) { DecodeChannelADPCMBlocksSIMD(blocks + channel, blocksPerChannel, channelCount, &planarSamples[channel * samplesPerChannel]); };
+
+		const bool decodeInParallel = multithreaded && (blocksPerChannel >= MinBlocksPerChannelForMultithreading) && (std::thread::hardware_concurrency() > 1);
+		if (decodeInParallel)
+		{
+			// NOTE: Channels don't share any decoding state so each one gets its own task, with the calling thread taking the first one itself
+			std::array<std::future<void>, MaxHevagChannelCount> channelFutures;
+			for (u32 c = 1; c < channelCount; c++)
+				channelFutures[c] = std::async(std::launch::async, decodeChannel, c);
+
+			decodeChannel(0);
+
+			for (u32 c = 1; c < channelCount; c++)
+				channelFutures[c].get();
+		}
+		else
+		{
+			for (u32 c = 0; c < channelCount; c++)
+				decodeChannel(c);
+		}
+
+		InterleaveChannelSamplesSIMD(planarSamples.get(), samplesPerChannel, channelCount, outSamples);
+	}
+#endif
+
+	void DecodeHevagADPCMBlocks(const HevagADPCMBlock* blocks, size_t blockCount, u32 channelCount, i16* outSamples)
+	{
+#if COMFY_HEVAG_ADPCM_SIMD
+		DecodeHevagADPCMBlocksSIMD(blocks, blockCount, channelCount, outSamples, true);
+#else
+		DecodeHevagADPCMBlocksScalar(blocks, blockCount, channelCount, outSamples);
+#endif
+	}
+}
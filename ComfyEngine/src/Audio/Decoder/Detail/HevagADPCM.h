@@ -0,0 +1,39 @@
+#pragma once
+#include "Types.h"
+
+// NOTE: SSE2 is part of the x64 baseline so there is no need for any runtime CPU feature detection
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define COMFY_HEVAG_ADPCM_SIMD 1
+#else
+#define COMFY_HEVAG_ADPCM_SIMD 0
+#endif
+
+namespace Comfy::Audio::Detail
+{
+	struct HevagADPCMBlock
+	{
+		u8 DecodingCoefficient;
+		u8 LoopInformation;
+		u8 SoundData[14];
+	};
+
+	static_assert(sizeof(HevagADPCMBlock) == 16);
+
+	constexpr size_t MinHevagChannelCount = 1;
+	constexpr size_t MaxHevagChannelCount = 8;
+	constexpr size_t SamplesPerHevagADPCMBlock = 28;
+
+	// NOTE: The blocks are interleaved per channel and so are the output samples, any trailing blocks that don't make up a full set of channels are skipped.
+	//		 The output has to be large enough for (blockCount / channelCount * channelCount * SamplesPerHevagADPCMBlock) samples.
+	//		 The scalar version decodes one block and one sample at a time and serves as the reference implementation
+	void DecodeHevagADPCMBlocksScalar(const HevagADPCMBlock* blocks, size_t blockCount, u32 channelCount, i16* outSamples);
+
+#if COMFY_HEVAG_ADPCM_SIMD
+	// NOTE: Bit identical to the scalar version. Unpacks and shifts all nibbles of a block at once, decodes each channel on its own thread
+	//		 and interleaves the decoded channels using shuffles. Only the prediction filter itself is inherently serial and stays scalar
+	void DecodeHevagADPCMBlocksSIMD(const HevagADPCMBlock* blocks, size_t blockCount, u32 channelCount, i16* outSamples, bool multithreaded);
+#endif
+
+	// NOTE: Uses the fastest available implementation
+	void DecodeHevagADPCMBlocks(const HevagADPCMBlock* blocks, size_t blockCount, u32 channelCount, i16* outSamples);
+}
@@ -25,11 +25,8 @@ namespace Comfy::Audio
 		if (loadFuture.valid())
 			loadFuture.get();
 
-		for (size_t i = 0; i < sfxDB.Entries.size(); i++)
-		{
-			if (const auto& entry = sfxDB.Entries[i]; entry.Name == name)
-				return std::make_pair(loadedSources[i], &entry);
-		}
+		if (const auto entry = sfxDB.GetSfxEntry(name); entry != nullptr)
+			return std::make_pair(loadedSources[std::distance(sfxDB.Entries.data(), entry)], entry);
 
 		return std::make_pair(SourceHandle::Invalid, nullptr);
 	}
@@ -86,6 +83,7 @@ namespace Comfy::Audio
 			auto fileContentBuffer = std::make_unique<u8[]>(largestFileSizeInFArc);
 			sfxDBFArcEntry->ReadIntoBuffer(fileContentBuffer.get());
 			sfxDB.Parse(fileContentBuffer.get(), sfxDBFArcEntry->OriginalSize);
+			sfxDB.BuildIndices();
 
 			auto& engine = Audio::AudioEngine::GetInstance();;
 
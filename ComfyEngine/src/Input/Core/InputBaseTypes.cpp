@@ -2,6 +2,7 @@
 #include "InputSystem.h"
 #include "Misc/StringUtil.h"
 #include "Misc/StringParseHelper.h"
+#include "Misc/PerfectHashTable.h"
 
 namespace Comfy::Input
 {
@@ -305,6 +306,58 @@ namespace Comfy::Input
 			EnumNamePair { "Button_TouchPad", "Touch Pad", "TouchPad", "Touch Click" },
 		};
 
+		enum class EnumNameLookupType : u8
+		{
+			EnumName,
+			DisplayNames,
+		};
+
+		template <size_t LookupSize>
+		constexpr size_t CountLookupNames(const std::array<EnumNamePair, LookupSize>& lookup, EnumNameLookupType type)
+		{
+			size_t nameCount = 0;
+			for (const auto& pair : lookup)
+			{
+				if (type == EnumNameLookupType::EnumName)
+					nameCount += (pair.EnumName != nullptr);
+				else
+					nameCount += (pair.DisplayName != nullptr) + (pair.DisplayNameAlt != nullptr) + (pair.DisplayNameAltAlt != nullptr);
+			}
+			return nameCount;
+		}
+
+		// NOTE: Inserted in the same order the names used to be linearly searched in so that ambiguous names still resolve to the same value
+		template <typename EnumType, size_t NameCount, size_t LookupSize>
+		constexpr auto CreateLookupNameTable(const std::array<EnumNamePair, LookupSize>& lookup, EnumNameLookupType type)
+		{
+			std::array<PerfectHashTableEntry<EnumType>, NameCount> entries = {};
+			size_t nameCount = 0;
+
+			for (size_t i = 0; i < LookupSize; i++)
+			{
+				const auto& pair = lookup[i];
+				const std::array<const char*, 3> names = (type == EnumNameLookupType::EnumName) ?
+					std::array<const char*, 3> { pair.EnumName, nullptr, nullptr } :
+					std::array<const char*, 3> { pair.DisplayName, pair.DisplayNameAlt, pair.DisplayNameAltAlt };
+
+				for (const char* name : names)
+				{
+					if (name != nullptr)
+						entries[nameCount++] = { name, static_cast<EnumType>(i) };
+				}
+			}
+
+			return PerfectHashTable<EnumType, NameCount, true>(entries);
+		}
+
+		constexpr auto KeyCodeNameTable = CreateLookupNameTable<KeyCode, CountLookupNames(KeyCodeNameLookup, EnumNameLookupType::DisplayNames)>(KeyCodeNameLookup, EnumNameLookupType::DisplayNames);
+		constexpr auto KeyCodeEnumNameTable = CreateLookupNameTable<KeyCode, CountLookupNames(KeyCodeNameLookup, EnumNameLookupType::EnumName)>(KeyCodeNameLookup, EnumNameLookupType::EnumName);
+		constexpr auto ButtonNameTable = CreateLookupNameTable<Button, CountLookupNames(ButtonNameLookup, EnumNameLookupType::DisplayNames)>(ButtonNameLookup, EnumNameLookupType::DisplayNames);
+		constexpr auto ButtonEnumNameTable = CreateLookupNameTable<Button, CountLookupNames(ButtonNameLookup, EnumNameLookupType::EnumName)>(ButtonNameLookup, EnumNameLookupType::EnumName);
+
+		static_assert(KeyCodeNameTable.IsValid() && KeyCodeEnumNameTable.IsValid());
+		static_assert(ButtonNameTable.IsValid() && ButtonEnumNameTable.IsValid());
+
 		constexpr std::string_view BindingStorageStringKeyboardPrefix = "Keyboard";
 		constexpr std::string_view BindingStorageStringCtrlModifier = "Ctrl+";
 		constexpr std::string_view BindingStorageStringCtrlModifierSpace = "Ctrl +";
@@ -327,31 +380,14 @@ namespace Comfy::Input
 		return (name != nullptr) ? name : "";
 	}
 
-	// HACK: A linear search for all of these isn't exactly the most performant but works fine enough for now...
 	KeyCode ParseKeyCodeName(std::string_view keyCodeName)
 	{
-		for (size_t i = 0; i < KeyCodeNameLookup.size(); i++)
-		{
-			if (KeyCodeNameLookup[i].DisplayName != nullptr && Util::MatchesInsensitive(keyCodeName, KeyCodeNameLookup[i].DisplayName))
-				return static_cast<KeyCode>(i);
-			if (KeyCodeNameLookup[i].DisplayNameAlt != nullptr && Util::MatchesInsensitive(keyCodeName, KeyCodeNameLookup[i].DisplayNameAlt))
-				return static_cast<KeyCode>(i);
-			if (KeyCodeNameLookup[i].DisplayNameAltAlt != nullptr && Util::MatchesInsensitive(keyCodeName, KeyCodeNameLookup[i].DisplayNameAltAlt))
-				return static_cast<KeyCode>(i);
-		}
-
-		return KeyCode_None;
+		return KeyCodeNameTable.FindOr(keyCodeName, KeyCode_None);
 	}
 
 	KeyCode ParseKeyCodeEnumName(std::string_view keyCodeEnumName)
 	{
-		for (size_t i = 0; i < KeyCodeNameLookup.size(); i++)
-		{
-			if (KeyCodeNameLookup[i].EnumName != nullptr && Util::MatchesInsensitive(keyCodeEnumName, KeyCodeNameLookup[i].EnumName))
-				return static_cast<KeyCode>(i);
-		}
-
-		return KeyCode_None;
+		return KeyCodeEnumNameTable.FindOr(keyCodeEnumName, KeyCode_None);
 	}
 
 	const char* GetButtonName(const Button button)
@@ -368,28 +404,12 @@ namespace Comfy::Input
 
 	Button ParseButtonName(std::string_view buttonName)
 	{
-		for (size_t i = 0; i < ButtonNameLookup.size(); i++)
-		{
-			if (ButtonNameLookup[i].DisplayName != nullptr && Util::MatchesInsensitive(buttonName, ButtonNameLookup[i].DisplayName))
-				return static_cast<Button>(i);
-			if (ButtonNameLookup[i].DisplayNameAlt != nullptr && Util::MatchesInsensitive(buttonName, ButtonNameLookup[i].DisplayNameAlt))
-				return static_cast<Button>(i);
-			if (ButtonNameLookup[i].DisplayNameAltAlt != nullptr && Util::MatchesInsensitive(buttonName, ButtonNameLookup[i].DisplayNameAltAlt))
-				return static_cast<Button>(i);
-		}
-
-		return Button::None;
+		return ButtonNameTable.FindOr(buttonName, Button::None);
 	}
 
 	Button ParseButtonEnumName(std::string_view buttonEnumName)
 	{
-		for (size_t i = 0; i < ButtonNameLookup.size(); i++)
-		{
-			if (ButtonNameLookup[i].EnumName != nullptr && Util::MatchesInsensitive(buttonEnumName, ButtonNameLookup[i].EnumName))
-				return static_cast<Button>(i);
-		}
-
-		return Button::None;
+		return ButtonEnumNameTable.FindOr(buttonEnumName, Button::None);
 	}
 
 	void ToStringInplace(const KeyCode keyCode, char* buffer, size_t bufferSize)
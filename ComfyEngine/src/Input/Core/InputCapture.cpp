@@ -0,0 +1,117 @@
+#include "InputCapture.h"
+#include <algorithm>
+
+namespace Comfy::Input
+{
+	SyntheticInputCaptureSource::SyntheticInputCaptureSource(std::vector<TimedInputEvent> events) : sortedEvents(std::move(events))
+	{
+		std::stable_sort(sortedEvents.begin(), sortedEvents.end(), [](const auto& a, const auto& b) { return (a.Time < b.Time); });
+	}
+
+	void SyntheticInputCaptureSource::PollState(TimeSpan time, CapturedInputState& outState)
+	{
+		for (; nextEventIndex < sortedEvents.size() && sortedEvents[nextEventIndex].Time <= time; nextEventIndex++)
+		{
+			const auto& inputEvent = sortedEvents[nextEventIndex];
+			if (inputEvent.Source.Type == BindingType::Keyboard && inputEvent.Source.Keyboard.Key < KeyCode_Count)
+				currentState.KeysDown[inputEvent.Source.Keyboard.Key] = inputEvent.IsDown;
+			else if (inputEvent.Source.Type == BindingType::Controller && inputEvent.Source.Controller.Button < Button::Count)
+				currentState.ButtonsDown[static_cast<size_t>(inputEvent.Source.Controller.Button)] = inputEvent.IsDown;
+		}
+
+		outState = currentState;
+	}
+
+	InputCaptureThread::~InputCaptureThread()
+	{
+		Stop();
+	}
+
+	void InputCaptureThread::Start(std::unique_ptr<InputCaptureSource> newSource, TimeSpan newPollInterval, ClockFunc newClock)
+	{
+		Stop();
+		if (newSource == nullptr || newClock == nullptr)
+			return;
+
+		// NOTE: Events left over from a previous run are no longer meaningful
+		for (TimedInputEvent discardedEvent; eventQueue.TryPop(discardedEvent);)
+			;
+
+		source = std::move(newSource);
+		pollInterval = newPollInterval;
+		clock = newClock;
+
+		exitRequested = false;
+		droppedEventCount = 0;
+		thread = std::thread([this] { ThreadEntryPoint(); });
+	}
+
+	void InputCaptureThread::Stop()
+	{
+		if (!thread.joinable())
+			return;
+
+		exitRequested = true;
+		thread.join();
+		source = nullptr;
+	}
+
+	bool InputCaptureThread::IsRunning() const
+	{
+		return thread.joinable();
+	}
+
+	bool InputCaptureThread::TryPopEvent(TimedInputEvent& outEvent)
+	{
+		return eventQueue.TryPop(outEvent);
+	}
+
+	TimeSpan InputCaptureThread::GetTimeNow() const
+	{
+		return (clock != nullptr) ? clock() : TimeSpan::Zero();
+	}
+
+	size_t InputCaptureThread::GetDroppedEventCount() const
+	{
+		return droppedEventCount.load(std::memory_order_relaxed);
+	}
+
+	void InputCaptureThread::ThreadEntryPoint()
+	{
+		auto lastState = std::make_unique<CapturedInputState>();
+		auto thisState = std::make_unique<CapturedInputState>();
+		source->PollState(clock(), *lastState);
+
+		const auto sleepDuration = std::chrono::microseconds(static_cast<i64>(pollInterval.TotalMilliseconds() * 1000.0));
+		while (!exitRequested.load(std::memory_order_relaxed))
+		{
+			std::this_thread::sleep_for(sleepDuration);
+
+			// NOTE: Sampled right before polling, so a transition that happened just after the previous poll is recorded up to one poll interval
+			//		 (plus any scheduler oversleep) late, while one that happened during the poll itself is recorded up to the poll duration early
+			const TimeSpan pollTime = clock();
+			*thisState = {};
+			source->PollState(pollTime, *thisState);
+
+			for (KeyCode key = 0; key < KeyCode_Count; key++)
+			{
+				if (thisState->KeysDown[key] != lastState->KeysDown[key])
+					PushEvent(TimedInputEvent { pollTime, Binding(key), thisState->KeysDown[key] });
+			}
+
+			for (size_t i = 0; i < EnumCount<Button>(); i++)
+			{
+				if (thisState->ButtonsDown[i] != lastState->ButtonsDown[i])
+					PushEvent(TimedInputEvent { pollTime, Binding(static_cast<Button>(i)), thisState->ButtonsDown[i] });
+			}
+
+			std::swap(thisState, lastState);
+		}
+	}
+
+	void InputCaptureThread::PushEvent(const TimedInputEvent& inputEvent)
+	{
+		if (!eventQueue.TryPush(inputEvent))
+			droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
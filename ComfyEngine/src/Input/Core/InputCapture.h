@@ -0,0 +1,95 @@
+#pragma once
+#include "Types.h"
+#include "InputBaseTypes.h"
+#include "Time/TimeSpan.h"
+#include "Misc/SPSCQueue.h"
+#include <thread>
+
+namespace Comfy::Input
+{
+	struct CapturedInputState
+	{
+		std::array<bool, KeyCode_Count> KeysDown;
+		std::array<bool, EnumCount<Button>()> ButtonsDown;
+	};
+
+	// NOTE: A single key or button transition, keyboard sources never have any modifiers set
+	struct TimedInputEvent
+	{
+		TimeSpan Time;
+		Binding Source;
+		bool IsDown;
+	};
+
+	// NOTE: Polled by the capture thread at a much higher rate than the frame rate, must therefore never touch any main thread only state
+	class InputCaptureSource
+	{
+	public:
+		virtual ~InputCaptureSource() = default;
+
+		virtual void PollState(TimeSpan time, CapturedInputState& outState) = 0;
+	};
+
+	// NOTE: Replays a fixed list of transitions in place of real hardware, useful for measuring the capture timing without any input devices
+	class SyntheticInputCaptureSource : public InputCaptureSource
+	{
+	public:
+		SyntheticInputCaptureSource(std::vector<TimedInputEvent> events);
+		~SyntheticInputCaptureSource() override = default;
+
+	public:
+		void PollState(TimeSpan time, CapturedInputState& outState) override;
+
+	private:
+		std::vector<TimedInputEvent> sortedEvents;
+		size_t nextEventIndex = 0;
+		CapturedInputState currentState = {};
+	};
+
+	// NOTE: Polls an InputCaptureSource on a dedicated thread and records every transition with the time it was first observed.
+	//		 Unlike the once per frame input state this doesn't quantize the timing of key presses to the frame interval
+	class InputCaptureThread : NonCopyable
+	{
+	public:
+		using ClockFunc = TimeSpan(*)();
+
+		static constexpr size_t EventQueueCapacity = 1024;
+		static constexpr TimeSpan DefaultPollInterval = TimeSpan::FromMilliseconds(1.0);
+
+	public:
+		InputCaptureThread() = default;
+		~InputCaptureThread();
+
+	public:
+		// NOTE: The clock is exposed so that it can be replaced with one that doesn't rely on the Win32 performance counter
+		void Start(std::unique_ptr<InputCaptureSource> source, TimeSpan pollInterval = DefaultPollInterval, ClockFunc clock = TimeSpan::GetTimeNow);
+		void Stop();
+		bool IsRunning() const;
+
+		// NOTE: Must only be called by a single consumer thread, events are returned in the order they were captured
+		bool TryPopEvent(TimedInputEvent& outEvent);
+
+		// NOTE: To map event times onto another clock by sampling both at the same time
+		TimeSpan GetTimeNow() const;
+
+		size_t GetDroppedEventCount() const;
+
+	private:
+		void ThreadEntryPoint();
+		void PushEvent(const TimedInputEvent& inputEvent);
+
+	private:
+		std::unique_ptr<InputCaptureSource> source;
+		TimeSpan pollInterval = DefaultPollInterval;
+		ClockFunc clock = nullptr;
+
+		std::atomic<bool> exitRequested = false;
+		std::atomic<size_t> droppedEventCount = 0;
+		SPSCQueue<TimedInputEvent, EventQueueCapacity> eventQueue;
+
+		std::thread thread;
+	};
+
+	// NOTE: Reads the keyboard and all connected controllers directly instead of going through the per frame state, returns null if the input system hasn't been initialized
+	std::unique_ptr<InputCaptureSource> CreateNativeInputCaptureSource();
+}
@@ -1,4 +1,5 @@
 #include "InputSystem.h"
+#include "InputCapture.h"
 #include "Misc/UTF8.h"
 #include "Core/Logger.h"
 #include "Time/Stopwatch.h"
@@ -9,7 +10,11 @@
 #define DIRECTINPUT_VERSION 0x0800
 #include "Core/Win32LeanWindowsHeader.h"
 #include <dinput.h>
+#include <timeapi.h>
 #include <bitset>
+#include <mutex>
+
+#pragma comment(lib, "winmm.lib")
 
 namespace Comfy::Input
 {
@@ -92,6 +97,9 @@ namespace Comfy::Input
 		const StandardControllerLayoutMappings* ExternalLayoutMappingsView;
 		std::vector<DirectInputControllerData> ConnectedControllers;
 
+		// NOTE: Held while polling or modifying the connected controllers as they are also read by the input capture thread
+		std::mutex ControllerMutex;
+
 		SimplifiedCombinedState ThisFrameState, LastFrameState;
 		SimplifiedCombinedTimingState ThisFrameTiming, LastFrameTiming;
 
@@ -133,12 +141,15 @@ namespace Comfy::Input
 			return foundController;
 		}
 
-		bool IsNativeButtonDownForKnownController(const DirectInputControllerData& controllerData, NativeButton nativeButton)
+		using NativeJoyState = decltype(DirectInputControllerData::PolledDeviceState::NativeJoy);
+		using SimplifiedControllerState = DirectInputControllerData::PolledDeviceState::SimplifiedState;
+
+		bool IsNativeButtonDownForSimplifiedState(const SimplifiedControllerState& simplifiedState, NativeButton nativeButton)
 		{
 			if (nativeButton >= NativeButton::FirstButton && nativeButton <= NativeButton::LastButton)
 			{
 				const i32 relativeIndex = static_cast<i32>(nativeButton) - static_cast<i32>(NativeButton::FirstButton);
-				return controllerData.ThisFrameState.Simplified.Buttons[static_cast<i32>(relativeIndex)];
+				return simplifiedState.Buttons[static_cast<i32>(relativeIndex)];
 			}
 			else if (nativeButton >= NativeButton::FirstDPad && nativeButton <= NativeButton::LastDPad)
 			{
@@ -146,7 +157,7 @@ namespace Comfy::Input
 				const i32 dpadIndex = (relativeIndex / static_cast<i32>(NativeButton::PerDPadSubElements));
 				const i32 directionIndex = (relativeIndex % static_cast<i32>(NativeButton::PerDPadSubElements));
 
-				return controllerData.ThisFrameState.Simplified.DPads[dpadIndex].TopLeftDownRightAreHeld[directionIndex];
+				return simplifiedState.DPads[dpadIndex].TopLeftDownRightAreHeld[directionIndex];
 			}
 			else if (nativeButton >= NativeButton::FirstAxis && nativeButton <= NativeButton::LastAxis)
 			{
@@ -154,12 +165,68 @@ namespace Comfy::Input
 				const i32 axisIndex = (relativeIndex / static_cast<i32>(NativeButton::PerAxisSubElements));
 				const i32 directionIndex = (relativeIndex % static_cast<i32>(NativeButton::PerAxisSubElements));
 
-				return controllerData.ThisFrameState.Simplified.Axes[axisIndex].NegativePositiveAreHeld[directionIndex];
+				return simplifiedState.Axes[axisIndex].NegativePositiveAreHeld[directionIndex];
 			}
 
 			return false;
 		}
 
+		bool IsNativeButtonDownForKnownController(const DirectInputControllerData& controllerData, NativeButton nativeButton)
+		{
+			return IsNativeButtonDownForSimplifiedState(controllerData.ThisFrameState.Simplified, nativeButton);
+		}
+
+		void SimplifyNativeJoyState(const NativeJoyState& nativeJoy, const DIDEVCAPS& capabilities, SimplifiedControllerState& outSimplified)
+		{
+			constexpr f32 heldThreshold = 0.5f;
+
+			for (size_t i = 0; i < Min<size_t>(std::size(outSimplified.Buttons), capabilities.dwButtons); i++)
+				outSimplified.Buttons[i] = nativeJoy.rgbButtons[i];
+
+			for (size_t i = 0; i < Min<size_t>(std::size(outSimplified.DPads), capabilities.dwPOVs); i++)
+			{
+				const auto nativePovValue = nativeJoy.rgdwPOV[i];
+				auto& simplifiedDPad = outSimplified.DPads[i];
+
+				if (nativePovValue != -1 || (LOWORD(nativePovValue) != 0xFFFF))
+				{
+					// NOTE: From { +0.0 } for Top to { +270.0 } for Left
+					const f32 clockwiseAngle = (static_cast<f32>(nativePovValue) / 100.0f);
+
+					// NOTE: { -1.0, -1.0 } for Top-Left and { +1.0, +1.0 } for Bottom-Right
+					const vec2 direction = AngleToDirectionVector(clockwiseAngle - 90.0f);
+
+					simplifiedDPad.NormalizedDirecton = direction;
+					simplifiedDPad.TopLeftDownRightAreHeld[0] = (-direction.y > heldThreshold);
+					simplifiedDPad.TopLeftDownRightAreHeld[1] = (-direction.x > heldThreshold);
+					simplifiedDPad.TopLeftDownRightAreHeld[2] = (+direction.y > heldThreshold);
+					simplifiedDPad.TopLeftDownRightAreHeld[3] = (+direction.x > heldThreshold);
+				}
+				else
+				{
+					simplifiedDPad = {};
+				}
+			}
+
+			const auto nativeAxes = std::array
+			{
+				nativeJoy.lX, nativeJoy.lY,
+				nativeJoy.lZ, nativeJoy.lRx,
+				nativeJoy.lRy, nativeJoy.lRz,
+				nativeJoy.rglSlider[0], nativeJoy.rglSlider[1],
+			};
+
+			assert(std::size(outSimplified.Axes) == std::size(nativeAxes));
+			for (size_t i = 0; i < Min<size_t>(std::size(outSimplified.Axes), capabilities.dwAxes); i++)
+			{
+				auto& simplifiedAxes = outSimplified.Axes[i];
+				simplifiedAxes.NormalizedAbsolute = static_cast<f32>(nativeAxes[i]) / std::numeric_limits<u16>::max();
+				simplifiedAxes.NormalizedAroundCenter = static_cast<f32>(nativeAxes[i]) / std::numeric_limits<u16>::max() * 2.0f - 1.0f;
+				simplifiedAxes.NegativePositiveAreHeld[0] = (glm::abs(simplifiedAxes.NormalizedAroundCenter) > heldThreshold && simplifiedAxes.NormalizedAroundCenter < 0.0f);
+				simplifiedAxes.NegativePositiveAreHeld[1] = (glm::abs(simplifiedAxes.NormalizedAroundCenter) > heldThreshold && simplifiedAxes.NormalizedAroundCenter > 0.0f);
+			}
+		}
+
 		f32 GetNativeAxisForKnownController(const DirectInputControllerData& controllerData, NativeAxis nativeAxis, bool normalizedCenter)
 		{
 			if (nativeAxis >= NativeAxis::First && nativeAxis <= NativeAxis::Last)
@@ -294,6 +361,7 @@ namespace Comfy::Input
 	{
 		if (Global.DirectInput != nullptr)
 		{
+			const auto lock = std::scoped_lock(Global.ControllerMutex);
 			for (auto& controllerData : Global.ConnectedControllers)
 			{
 				controllerData.Interface->Unacquire();
@@ -317,6 +385,7 @@ namespace Comfy::Input
 
 		Global.UpdateFrameStopwatch.Restart();
 
+		std::unique_lock controllerLock(Global.ControllerMutex);
 		bool wasAnyConnectionLost = false;
 		for (auto& controllerData : Global.ConnectedControllers)
 		{
@@ -339,53 +408,7 @@ namespace Comfy::Input
 			}
 			else
 			{
-				constexpr f32 heldThreshold = 0.5f;
-
-				for (size_t i = 0; i < Min<size_t>(std::size(controllerData.ThisFrameState.Simplified.Buttons), controllerData.Capabilities.dwButtons); i++)
-					controllerData.ThisFrameState.Simplified.Buttons[i] = controllerData.ThisFrameState.NativeJoy.rgbButtons[i];
-
-				for (size_t i = 0; i < Min<size_t>(std::size(controllerData.ThisFrameState.Simplified.DPads), controllerData.Capabilities.dwPOVs); i++)
-				{
-					const auto nativePovValue = controllerData.ThisFrameState.NativeJoy.rgdwPOV[i];
-					auto& simplifiedDPad = controllerData.ThisFrameState.Simplified.DPads[i];
-
-					if (nativePovValue != -1 || (LOWORD(nativePovValue) != 0xFFFF))
-					{
-						// NOTE: From { +0.0 } for Top to { +270.0 } for Left
-						const f32 clockwiseAngle = (static_cast<f32>(nativePovValue) / 100.0f);
-
-						// NOTE: { -1.0, -1.0 } for Top-Left and { +1.0, +1.0 } for Bottom-Right
-						const vec2 direction = Detail::AngleToDirectionVector(clockwiseAngle - 90.0f);
-
-						simplifiedDPad.NormalizedDirecton = direction;
-						simplifiedDPad.TopLeftDownRightAreHeld[0] = (-direction.y > heldThreshold);
-						simplifiedDPad.TopLeftDownRightAreHeld[1] = (-direction.x > heldThreshold);
-						simplifiedDPad.TopLeftDownRightAreHeld[2] = (+direction.y > heldThreshold);
-						simplifiedDPad.TopLeftDownRightAreHeld[3] = (+direction.x > heldThreshold);
-					}
-					else
-					{
-						simplifiedDPad = {};
-					}
-				}
-
-				const auto nativeAxes = std::array
-				{
-					controllerData.ThisFrameState.NativeJoy.lX, controllerData.ThisFrameState.NativeJoy.lY,
-					controllerData.ThisFrameState.NativeJoy.lZ, controllerData.ThisFrameState.NativeJoy.lRx,
-					controllerData.ThisFrameState.NativeJoy.lRy, controllerData.ThisFrameState.NativeJoy.lRz,
-					controllerData.ThisFrameState.NativeJoy.rglSlider[0], controllerData.ThisFrameState.NativeJoy.rglSlider[1],
-				};
-
-				assert(std::size(controllerData.ThisFrameState.Simplified.Axes) == std::size(nativeAxes));
-				for (size_t i = 0; i < Min<size_t>(std::size(controllerData.ThisFrameState.Simplified.Axes), controllerData.Capabilities.dwAxes); i++)
-				{
-					auto& simplifiedAxes = controllerData.ThisFrameState.Simplified.Axes[i];
-					simplifiedAxes.NormalizedAbsolute = static_cast<f32>(nativeAxes[i]) / std::numeric_limits<u16>::max();
-					simplifiedAxes.NormalizedAroundCenter = static_cast<f32>(nativeAxes[i]) / std::numeric_limits<u16>::max() * 2.0f - 1.0f;
-					simplifiedAxes.NegativePositiveAreHeld[0] = (glm::abs(simplifiedAxes.NormalizedAroundCenter) > heldThreshold && simplifiedAxes.NormalizedAroundCenter < 0.0f);
-					simplifiedAxes.NegativePositiveAreHeld[1] = (glm::abs(simplifiedAxes.NormalizedAroundCenter) > heldThreshold && simplifiedAxes.NormalizedAroundCenter > 0.0f);
-				}
+				Detail::SimplifyNativeJoyState(controllerData.ThisFrameState.NativeJoy, controllerData.Capabilities, controllerData.ThisFrameState.Simplified);
 			}
 		}
 
@@ -394,6 +417,7 @@ namespace Comfy::Input
 			Global.ConnectedControllers.erase(std::remove_if(Global.ConnectedControllers.begin(), Global.ConnectedControllers.end(),
 				[](auto& c) { return (c.Interface == nullptr); }), Global.ConnectedControllers.end());
 		}
+		controllerLock.unlock();
 
 		Global.LastFrameState = Global.ThisFrameState;
 		Global.ThisFrameState = {};
@@ -510,6 +534,7 @@ namespace Comfy::Input
 		if (Global.DirectInput == nullptr)
 			return;
 
+		const auto lock = std::scoped_lock(Global.ControllerMutex);
 		for (auto& controllerData : Global.ConnectedControllers)
 		{
 			controllerData.Interface->Unacquire();
@@ -576,6 +601,59 @@ namespace Comfy::Input
 	{
 		return Global.UpdateFrameStopwatchElapsed;
 	}
+
+	class NativeInputCaptureSource : public InputCaptureSource
+	{
+	public:
+		// NOTE: Otherwise the capture thread would only ever wake up once every ~15.6ms scheduler tick
+		NativeInputCaptureSource() { ::timeBeginPeriod(1); }
+		~NativeInputCaptureSource() override { ::timeEndPeriod(1); }
+
+	public:
+		void PollState(TimeSpan time, CapturedInputState& outState) override
+		{
+			if (Global.MainWindowHandle == nullptr || ::GetForegroundWindow() != Global.MainWindowHandle)
+				return;
+
+			// NOTE: Virtual key codes map directly onto key codes, the ImGui key state can't be used here because it's only updated once per frame
+			for (KeyCode i = KeyCode_None + 1; i < KeyCode_Count; i++)
+				outState.KeysDown[i] = ((::GetAsyncKeyState(i) & 0x8000) != 0);
+
+			const auto lock = std::scoped_lock(Global.ControllerMutex);
+			if (Global.ExternalLayoutMappingsView == nullptr)
+				return;
+
+			for (auto& controllerData : Global.ConnectedControllers)
+			{
+				const auto* foundMapping = FindIfOrNull(*Global.ExternalLayoutMappingsView, [&](const auto& mapping) { return Detail::ControllerIDToWindowGUID(mapping.ProductID) == controllerData.InstanceData.guidProduct; });
+				if (foundMapping == nullptr || controllerData.Interface == nullptr)
+					continue;
+
+				// NOTE: Lost connections are left for the next frame update to clean up
+				Detail::NativeJoyState nativeJoy = {};
+				controllerData.Interface->Poll();
+				if (FAILED(controllerData.Interface->GetDeviceState(sizeof(nativeJoy), &nativeJoy)))
+					continue;
+
+				Detail::SimplifiedControllerState simplifiedState = {};
+				Detail::SimplifyNativeJoyState(nativeJoy, controllerData.Capabilities, simplifiedState);
+
+				for (size_t i = 0; i < EnumCount<Button>(); i++)
+				{
+					if (Detail::IsNativeButtonDownForSimplifiedState(simplifiedState, foundMapping->StandardToNativeButtons[i]))
+						outState.ButtonsDown[i] = true;
+				}
+			}
+		}
+	};
+
+	std::unique_ptr<InputCaptureSource> CreateNativeInputCaptureSource()
+	{
+		if (Global.DirectInput == nullptr)
+			return nullptr;
+
+		return std::make_unique<NativeInputCaptureSource>();
+	}
 }
 
 namespace Comfy::Input
@@ -2,3 +2,4 @@
 
 // NOTE: This is the public include header for the rest of the Comfy::Input library, only this file should be explicitly included
 #include "Core/InputSystem.h"
+#include "Core/InputCapture.h"
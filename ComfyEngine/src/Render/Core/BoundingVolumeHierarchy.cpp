@@ -0,0 +1,398 @@
+#include "BoundingVolumeHierarchy.h"
+
+namespace Comfy::Render
+{
+	using namespace Graphics;
+
+	BoundingVolumeHierarchy::ProxyID BoundingVolumeHierarchy::Add(const AxisAlignedBox& bounds, u32 userIndex, u32 mask)
+	{
+		const ProxyID leafIndex = AllocateNode();
+
+		auto& leaf = nodes[leafIndex];
+		leaf.Bounds = CreateFatBounds(bounds);
+		leaf.UserIndex = userIndex;
+		leaf.Mask = mask;
+		leaf.Height = 0;
+
+		InsertLeaf(leafIndex);
+		proxyCount++;
+
+		return leafIndex;
+	}
+
+	void BoundingVolumeHierarchy::Remove(ProxyID proxy)
+	{
+		assert(InBounds(proxy, nodes) && nodes[proxy].IsLeaf());
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		proxyCount--;
+	}
+
+	bool BoundingVolumeHierarchy::Update(ProxyID proxy, const AxisAlignedBox& bounds)
+	{
+		assert(InBounds(proxy, nodes) && nodes[proxy].IsLeaf());
+
+		const auto newFatBounds = CreateFatBounds(bounds);
+		const auto& oldFatBounds = nodes[proxy].Bounds;
+
+		// NOTE: Also reinsert shrinking bounds so that a previously large proxy doesn't keep bloating the tree forever
+		constexpr float maxFatBoundsAreaRatio = 4.0f;
+		if (oldFatBounds.Contains(bounds) && oldFatBounds.GetSurfaceArea() <= (newFatBounds.GetSurfaceArea() * maxFatBoundsAreaRatio))
+			return false;
+
+		RemoveLeaf(proxy);
+		nodes[proxy].Bounds = newFatBounds;
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	void BoundingVolumeHierarchy::SetUserIndex(ProxyID proxy, u32 userIndex)
+	{
+		assert(InBounds(proxy, nodes) && nodes[proxy].IsLeaf());
+		nodes[proxy].UserIndex = userIndex;
+	}
+
+	u32 BoundingVolumeHierarchy::GetUserIndex(ProxyID proxy) const
+	{
+		assert(InBounds(proxy, nodes) && nodes[proxy].IsLeaf());
+		return nodes[proxy].UserIndex;
+	}
+
+	void BoundingVolumeHierarchy::SetMask(ProxyID proxy, u32 mask)
+	{
+		assert(InBounds(proxy, nodes) && nodes[proxy].IsLeaf());
+		if (nodes[proxy].Mask == mask)
+			return;
+
+		nodes[proxy].Mask = mask;
+
+		// NOTE: The tree structure stays the same so only the combined masks of the ancestors have to be updated
+		for (ProxyID nodeIndex = nodes[proxy].Parent; nodeIndex != InvalidProxyID; nodeIndex = nodes[nodeIndex].Parent)
+		{
+			auto& node = nodes[nodeIndex];
+			node.Mask = (nodes[node.Child1].Mask | nodes[node.Child2].Mask);
+		}
+	}
+
+	u32 BoundingVolumeHierarchy::GetMask(ProxyID proxy) const
+	{
+		assert(InBounds(proxy, nodes) && nodes[proxy].IsLeaf());
+		return nodes[proxy].Mask;
+	}
+
+	const AxisAlignedBox& BoundingVolumeHierarchy::GetFatBounds(ProxyID proxy) const
+	{
+		assert(InBounds(proxy, nodes) && nodes[proxy].IsLeaf());
+		return nodes[proxy].Bounds;
+	}
+
+	void BoundingVolumeHierarchy::Clear()
+	{
+		rootIndex = InvalidProxyID;
+		freeListIndex = InvalidProxyID;
+		proxyCount = 0;
+		nodes.clear();
+	}
+
+	size_t BoundingVolumeHierarchy::GetProxyCount() const
+	{
+		return proxyCount;
+	}
+
+	i32 BoundingVolumeHierarchy::GetHeight() const
+	{
+		return (rootIndex != InvalidProxyID) ? nodes[rootIndex].Height : 0;
+	}
+
+	u32 BoundingVolumeHierarchy::GetCombinedMask() const
+	{
+		return (rootIndex != InvalidProxyID) ? nodes[rootIndex].Mask : 0;
+	}
+
+	bool BoundingVolumeHierarchy::RayIntersectsBox(const vec3& rayOrigin, const vec3& inverseRayDirection, const AxisAlignedBox& box, float& outEntryDistance)
+	{
+		const vec3 distancesToMin = (box.Min - rayOrigin) * inverseRayDirection;
+		const vec3 distancesToMax = (box.Max - rayOrigin) * inverseRayDirection;
+
+		const vec3 nearDistances = glm::min(distancesToMin, distancesToMax);
+		const vec3 farDistances = glm::max(distancesToMin, distancesToMax);
+
+		const float entryDistance = Max(Max(nearDistances.x, nearDistances.y), nearDistances.z);
+		const float exitDistance = Min(Min(farDistances.x, farDistances.y), farDistances.z);
+
+		if (exitDistance < Max(entryDistance, 0.0f))
+			return false;
+
+		outEntryDistance = Max(entryDistance, 0.0f);
+		return true;
+	}
+
+	BoundingVolumeHierarchy::ProxyID BoundingVolumeHierarchy::AllocateNode()
+	{
+		ProxyID nodeIndex;
+		if (freeListIndex != InvalidProxyID)
+		{
+			nodeIndex = freeListIndex;
+			freeListIndex = nodes[nodeIndex].Parent;
+		}
+		else
+		{
+			nodeIndex = static_cast<ProxyID>(nodes.size());
+			nodes.emplace_back();
+		}
+
+		auto& node = nodes[nodeIndex];
+		node.Bounds = {};
+		node.Parent = InvalidProxyID;
+		node.Child1 = InvalidProxyID;
+		node.Child2 = InvalidProxyID;
+		node.Height = 0;
+		node.Mask = 0;
+		node.UserIndex = 0;
+		return nodeIndex;
+	}
+
+	void BoundingVolumeHierarchy::FreeNode(ProxyID nodeIndex)
+	{
+		auto& node = nodes[nodeIndex];
+		node.Parent = freeListIndex;
+		node.Height = -1;
+		freeListIndex = nodeIndex;
+	}
+
+	void BoundingVolumeHierarchy::InsertLeaf(ProxyID leafIndex)
+	{
+		if (rootIndex == InvalidProxyID)
+		{
+			rootIndex = leafIndex;
+			nodes[rootIndex].Parent = InvalidProxyID;
+			return;
+		}
+
+		// NOTE: Find the best sibling by descending into the child with the lowest surface area cost increase
+		const AxisAlignedBox leafBounds = nodes[leafIndex].Bounds;
+		ProxyID siblingIndex = rootIndex;
+
+		while (!nodes[siblingIndex].IsLeaf())
+		{
+			const auto& node = nodes[siblingIndex];
+
+			const float area = node.Bounds.GetSurfaceArea();
+			const float combinedArea = AxisAlignedBox::Union(node.Bounds, leafBounds).GetSurfaceArea();
+
+			// NOTE: Cost of creating a new parent for this node and the new leaf and the minimum cost of pushing the leaf further down
+			const float cost = 2.0f * combinedArea;
+			const float inheritanceCost = 2.0f * (combinedArea - area);
+
+			const auto getChildCost = [&](ProxyID childIndex)
+			{
+				const auto& child = nodes[childIndex];
+				const float childCombinedArea = AxisAlignedBox::Union(child.Bounds, leafBounds).GetSurfaceArea();
+
+				return child.IsLeaf() ? (childCombinedArea + inheritanceCost) : ((childCombinedArea - child.Bounds.GetSurfaceArea()) + inheritanceCost);
+			};
+
+			const float cost1 = getChildCost(node.Child1);
+			const float cost2 = getChildCost(node.Child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			siblingIndex = (cost1 < cost2) ? node.Child1 : node.Child2;
+		}
+
+		const ProxyID oldParentIndex = nodes[siblingIndex].Parent;
+		const ProxyID newParentIndex = AllocateNode();
+
+		auto& newParent = nodes[newParentIndex];
+		newParent.Parent = oldParentIndex;
+		newParent.Child1 = siblingIndex;
+		newParent.Child2 = leafIndex;
+		newParent.Bounds = AxisAlignedBox::Union(leafBounds, nodes[siblingIndex].Bounds);
+		newParent.Height = nodes[siblingIndex].Height + 1;
+		newParent.Mask = (nodes[siblingIndex].Mask | nodes[leafIndex].Mask);
+
+		if (oldParentIndex != InvalidProxyID)
+		{
+			auto& oldParent = nodes[oldParentIndex];
+			if (oldParent.Child1 == siblingIndex)
+				oldParent.Child1 = newParentIndex;
+			else
+				oldParent.Child2 = newParentIndex;
+		}
+		else
+		{
+			rootIndex = newParentIndex;
+		}
+
+		nodes[siblingIndex].Parent = newParentIndex;
+		nodes[leafIndex].Parent = newParentIndex;
+
+		RefitAncestors(newParentIndex);
+	}
+
+	void BoundingVolumeHierarchy::RemoveLeaf(ProxyID leafIndex)
+	{
+		if (leafIndex == rootIndex)
+		{
+			rootIndex = InvalidProxyID;
+			return;
+		}
+
+		const ProxyID parentIndex = nodes[leafIndex].Parent;
+		const ProxyID grandParentIndex = nodes[parentIndex].Parent;
+		const ProxyID siblingIndex = (nodes[parentIndex].Child1 == leafIndex) ? nodes[parentIndex].Child2 : nodes[parentIndex].Child1;
+
+		if (grandParentIndex != InvalidProxyID)
+		{
+			auto& grandParent = nodes[grandParentIndex];
+			if (grandParent.Child1 == parentIndex)
+				grandParent.Child1 = siblingIndex;
+			else
+				grandParent.Child2 = siblingIndex;
+
+			nodes[siblingIndex].Parent = grandParentIndex;
+			FreeNode(parentIndex);
+
+			RefitAncestors(grandParentIndex);
+		}
+		else
+		{
+			rootIndex = siblingIndex;
+			nodes[siblingIndex].Parent = InvalidProxyID;
+			FreeNode(parentIndex);
+		}
+
+		nodes[leafIndex].Parent = InvalidProxyID;
+	}
+
+	BoundingVolumeHierarchy::ProxyID BoundingVolumeHierarchy::Balance(ProxyID indexA)
+	{
+		// NOTE: AVL style tree rotation promoting the taller grandchild, following the same approach as Box2D's b2DynamicTree
+		auto& nodeA = nodes[indexA];
+		if (nodeA.IsLeaf() || nodeA.Height < 2)
+			return indexA;
+
+		const ProxyID indexB = nodeA.Child1, indexC = nodeA.Child2;
+		auto& nodeB = nodes[indexB];
+		auto& nodeC = nodes[indexC];
+
+		const i32 balance = (nodeC.Height - nodeB.Height);
+
+		const auto replaceChildOfParent = [&](ProxyID parentIndex, ProxyID oldChildIndex, ProxyID newChildIndex)
+		{
+			if (parentIndex == InvalidProxyID)
+			{
+				rootIndex = newChildIndex;
+				return;
+			}
+
+			auto& parent = nodes[parentIndex];
+			if (parent.Child1 == oldChildIndex)
+				parent.Child1 = newChildIndex;
+			else
+				parent.Child2 = newChildIndex;
+		};
+
+		const auto refit = [&](Node& node, const Node& child1, const Node& child2)
+		{
+			node.Bounds = AxisAlignedBox::Union(child1.Bounds, child2.Bounds);
+			node.Height = 1 + std::max(child1.Height, child2.Height);
+			node.Mask = (child1.Mask | child2.Mask);
+		};
+
+		// NOTE: Rotate C up
+		if (balance > 1)
+		{
+			const ProxyID indexF = nodeC.Child1, indexG = nodeC.Child2;
+			auto& nodeF = nodes[indexF];
+			auto& nodeG = nodes[indexG];
+
+			nodeC.Child1 = indexA;
+			nodeC.Parent = nodeA.Parent;
+			nodeA.Parent = indexC;
+			replaceChildOfParent(nodeC.Parent, indexA, indexC);
+
+			if (nodeF.Height > nodeG.Height)
+			{
+				nodeC.Child2 = indexF;
+				nodeA.Child2 = indexG;
+				nodeG.Parent = indexA;
+				refit(nodeA, nodeB, nodeG);
+				refit(nodeC, nodeA, nodeF);
+			}
+			else
+			{
+				nodeC.Child2 = indexG;
+				nodeA.Child2 = indexF;
+				nodeF.Parent = indexA;
+				refit(nodeA, nodeB, nodeF);
+				refit(nodeC, nodeA, nodeG);
+			}
+
+			return indexC;
+		}
+
+		// NOTE: Rotate B up
+		if (balance < -1)
+		{
+			const ProxyID indexD = nodeB.Child1, indexE = nodeB.Child2;
+			auto& nodeD = nodes[indexD];
+			auto& nodeE = nodes[indexE];
+
+			nodeB.Child1 = indexA;
+			nodeB.Parent = nodeA.Parent;
+			nodeA.Parent = indexB;
+			replaceChildOfParent(nodeB.Parent, indexA, indexB);
+
+			if (nodeD.Height > nodeE.Height)
+			{
+				nodeB.Child2 = indexD;
+				nodeA.Child1 = indexE;
+				nodeE.Parent = indexA;
+				refit(nodeA, nodeC, nodeE);
+				refit(nodeB, nodeA, nodeD);
+			}
+			else
+			{
+				nodeB.Child2 = indexE;
+				nodeA.Child1 = indexD;
+				nodeD.Parent = indexA;
+				refit(nodeA, nodeC, nodeD);
+				refit(nodeB, nodeA, nodeE);
+			}
+
+			return indexB;
+		}
+
+		return indexA;
+	}
+
+	void BoundingVolumeHierarchy::RefitAncestors(ProxyID nodeIndex)
+	{
+		while (nodeIndex != InvalidProxyID)
+		{
+			nodeIndex = Balance(nodeIndex);
+
+			auto& node = nodes[nodeIndex];
+			const auto& child1 = nodes[node.Child1];
+			const auto& child2 = nodes[node.Child2];
+
+			node.Bounds = AxisAlignedBox::Union(child1.Bounds, child2.Bounds);
+			node.Height = 1 + std::max(child1.Height, child2.Height);
+			node.Mask = (child1.Mask | child2.Mask);
+
+			nodeIndex = node.Parent;
+		}
+	}
+
+	AxisAlignedBox BoundingVolumeHierarchy::CreateFatBounds(const AxisAlignedBox& bounds) const
+	{
+		const vec3 size = (bounds.Max - bounds.Min);
+		const float margin = Max(Max(Max(size.x, size.y), size.z) * FatBoundsMarginFactor, MinFatBoundsMargin);
+
+		return AxisAlignedBox { bounds.Min - vec3(margin), bounds.Max + vec3(margin) };
+	}
+}
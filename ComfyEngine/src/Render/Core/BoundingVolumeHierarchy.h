@@ -0,0 +1,150 @@
+#pragma once
+#include "Types.h"
+#include "Camera.h"
+#include "Graphics/Auth3D/BoundingTypes.h"
+#include "Graphics/Auth3D/Ray.h"
+#include <vector>
+
+namespace Comfy::Render
+{
+	// NOTE: Dynamic axis aligned bounding box tree over world space bounds, balanced on insertion using the surface area heuristic.
+	//		 Each leaf stores a slightly enlarged ("fat") copy of its bounds so that small movements don't require the leaf to be reinserted.
+	//		 Every node also stores the combined mask of all leaves below it so that queries can skip entire subtrees not matching the requested mask
+	class BoundingVolumeHierarchy : NonCopyable
+	{
+	public:
+		using ProxyID = i32;
+		static constexpr ProxyID InvalidProxyID = -1;
+
+		// NOTE: Relative to the largest extent of the input bounds, large enough to absorb typical per frame animation movements
+		static constexpr float FatBoundsMarginFactor = 0.1f;
+		static constexpr float MinFatBoundsMargin = 0.01f;
+
+		// NOTE: The tree height of an AVL balanced tree never gets anywhere close to this for any realistic number of proxies
+		static constexpr size_t MaxQueryStackSize = 256;
+
+	public:
+		BoundingVolumeHierarchy() = default;
+		~BoundingVolumeHierarchy() = default;
+
+	public:
+		ProxyID Add(const Graphics::AxisAlignedBox& bounds, u32 userIndex, u32 mask);
+		void Remove(ProxyID proxy);
+
+		// NOTE: Only reinserts the leaf if the new bounds are no longer contained by its fat bounds, returns true if it was reinserted
+		bool Update(ProxyID proxy, const Graphics::AxisAlignedBox& bounds);
+
+		void SetUserIndex(ProxyID proxy, u32 userIndex);
+		u32 GetUserIndex(ProxyID proxy) const;
+
+		void SetMask(ProxyID proxy, u32 mask);
+		u32 GetMask(ProxyID proxy) const;
+
+		const Graphics::AxisAlignedBox& GetFatBounds(ProxyID proxy) const;
+
+		void Clear();
+
+	public:
+		size_t GetProxyCount() const;
+		i32 GetHeight() const;
+
+		// NOTE: Combined mask of all proxies, allows for constant time "is there any proxy with this flag" checks
+		u32 GetCombinedMask() const;
+
+	public:
+		// NOTE: Generic traversal, the node predicate is called with the fat bounds and the combined mask of each visited subtree.
+		//		 The callback is called with the user index of every leaf matching the mask whose bounds passed the predicate
+		template <typename NodePredicate, typename Func>
+		void Query(u32 mask, NodePredicate nodePredicate, Func func) const
+		{
+			if (rootIndex == InvalidProxyID || (nodes[rootIndex].Mask & mask) == 0)
+				return;
+
+			std::array<ProxyID, MaxQueryStackSize> stack;
+			size_t stackSize = 0;
+			stack[stackSize++] = rootIndex;
+
+			while (stackSize > 0)
+			{
+				const auto& node = nodes[stack[--stackSize]];
+				if ((node.Mask & mask) == 0 || !nodePredicate(node.Bounds, node.Mask))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					func(node.UserIndex);
+				}
+				else
+				{
+					assert(stackSize + 2 <= stack.size());
+					stack[stackSize++] = node.Child1;
+					stack[stackSize++] = node.Child2;
+				}
+			}
+		}
+
+		template <typename Func>
+		void QueryMask(u32 mask, Func func) const
+		{
+			Query(mask, [](const Graphics::AxisAlignedBox&, u32) { return true; }, func);
+		}
+
+		template <typename Func>
+		void QueryFrustum(const Camera3D& camera, u32 mask, Func func) const
+		{
+			Query(mask, [&](const Graphics::AxisAlignedBox& bounds, u32) { return camera.IntersectsViewFrustum(bounds); }, func);
+		}
+
+		// NOTE: The callback is called with the user index and the distance along the ray at which it enters the fat bounds of the leaf.
+		//		 Leaves are not visited in any particular order, the caller is expected to sort the candidates by their entry distance if needed
+		template <typename Func>
+		void QueryRay(const Graphics::Ray& ray, u32 mask, Func func) const
+		{
+			const vec3 inverseDirection = vec3(1.0f) / ray.Direction;
+			float entryDistance = 0.0f;
+
+			Query(mask, [&](const Graphics::AxisAlignedBox& bounds, u32) { return RayIntersectsBox(ray.Origin, inverseDirection, bounds, entryDistance); }, [&](u32 userIndex)
+			{
+				func(userIndex, entryDistance);
+			});
+		}
+
+		static bool RayIntersectsBox(const vec3& rayOrigin, const vec3& inverseRayDirection, const Graphics::AxisAlignedBox& box, float& outEntryDistance);
+
+	private:
+		struct Node
+		{
+			Graphics::AxisAlignedBox Bounds;
+
+			// NOTE: Doubles as the next free node index for unused nodes
+			ProxyID Parent;
+			ProxyID Child1, Child2;
+
+			// NOTE: Leaf = 0, free node = -1
+			i32 Height;
+
+			u32 Mask;
+			u32 UserIndex;
+
+			inline bool IsLeaf() const { return (Child1 == InvalidProxyID); }
+		};
+
+		ProxyID AllocateNode();
+		void FreeNode(ProxyID nodeIndex);
+
+		void InsertLeaf(ProxyID leafIndex);
+		void RemoveLeaf(ProxyID leafIndex);
+
+		ProxyID Balance(ProxyID nodeIndex);
+		void RefitAncestors(ProxyID nodeIndex);
+
+		Graphics::AxisAlignedBox CreateFatBounds(const Graphics::AxisAlignedBox& bounds) const;
+
+	private:
+		ProxyID rootIndex = InvalidProxyID;
+		ProxyID freeListIndex = InvalidProxyID;
+
+		size_t proxyCount = 0;
+		std::vector<Node> nodes;
+	};
+}
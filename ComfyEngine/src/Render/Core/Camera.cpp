@@ -45,13 +45,16 @@ namespace Comfy::Render
 
 		viewProjection = (projection * view);
 
+		// NOTE: Only normalize by the length of the plane normal so that the plane equation yields actual signed distances to compare bounding volume extents against
+		const auto normalizePlane = [](const vec4& plane) { return plane / glm::length(vec3(plane)); };
+
 		const mat4 viewProjectionRows = glm::transpose(viewProjection);
-		frustum.Planes[0] = glm::normalize(viewProjectionRows[3] + viewProjectionRows[0]);
-		frustum.Planes[1] = glm::normalize(viewProjectionRows[3] - viewProjectionRows[0]);
-		frustum.Planes[2] = glm::normalize(viewProjectionRows[3] + viewProjectionRows[1]);
-		frustum.Planes[3] = glm::normalize(viewProjectionRows[3] - viewProjectionRows[1]);
-		frustum.Planes[4] = glm::normalize(viewProjectionRows[3] + viewProjectionRows[2]);
-		frustum.Planes[5] = glm::normalize(viewProjectionRows[3] - viewProjectionRows[2]);
+		frustum.Planes[0] = normalizePlane(viewProjectionRows[3] + viewProjectionRows[0]);
+		frustum.Planes[1] = normalizePlane(viewProjectionRows[3] - viewProjectionRows[0]);
+		frustum.Planes[2] = normalizePlane(viewProjectionRows[3] + viewProjectionRows[1]);
+		frustum.Planes[3] = normalizePlane(viewProjectionRows[3] - viewProjectionRows[1]);
+		frustum.Planes[4] = normalizePlane(viewProjectionRows[3] + viewProjectionRows[2]);
+		frustum.Planes[5] = normalizePlane(viewProjectionRows[3] - viewProjectionRows[2]);
 	}
 
 	const mat4& Camera3D::GetView() const
@@ -129,6 +132,22 @@ namespace Comfy::Render
 		return true;
 	}
 
+	bool Camera3D::IntersectsViewFrustum(const Graphics::AxisAlignedBox& worldSpaceBox) const
+	{
+		const vec3 center = worldSpaceBox.GetCenter();
+		const vec3 halfExtents = worldSpaceBox.GetHalfExtents();
+
+		for (const auto& plane : frustum.Planes)
+		{
+			// NOTE: Projected "radius" of the box onto the plane normal, conservative in the same way as the sphere test
+			const float projectedRadius = glm::dot(halfExtents, glm::abs(vec3(plane.x, plane.y, plane.z)));
+			if (glm::dot(plane, vec4(center, 1.0f)) <= -projectedRadius)
+				return false;
+		}
+
+		return true;
+	}
+
 	void Camera2D::UpdateMatrices()
 	{
 		constexpr float projectionLeft = 0.0f;
@@ -46,6 +46,7 @@ namespace Comfy::Render
 		Graphics::Ray CastRay(vec2 normalizeScreenPosition) const;
 
 		bool IntersectsViewFrustum(const Graphics::Sphere& worldSpaceSphere) const;
+		bool IntersectsViewFrustum(const Graphics::AxisAlignedBox& worldSpaceBox) const;
 
 	public:
 		static vec3 ScreenToWorldSpace(const mat4& matrix, const vec3& screenSpace);
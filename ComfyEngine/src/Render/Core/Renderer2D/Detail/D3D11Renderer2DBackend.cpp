@@ -0,0 +1,516 @@
+#include "Render/Core/Renderer2D/Renderer2D.h"
+#include "Render/Core/Renderer2D/Renderer2DBackend.h"
+#include "RenderTarget2DImpl.h"
+#include "SpriteBatchBuilder.h"
+#include "TextureSamplerCache.h"
+#include "Render/D3D11/D3D11.h"
+#include "Render/D3D11/D3D11Buffer.h"
+#include "Render/D3D11/D3D11GraphicsTypeHelpers.h"
+#include "Render/D3D11/D3D11OpaqueResource.h"
+#include "Render/D3D11/D3D11Shader.h"
+#include "Render/D3D11/D3D11State.h"
+#include "Render/D3D11/D3D11Texture.h"
+#include "Render/D3D11/Shader/Bytecode/ShaderBytecode.h"
+
+namespace Comfy::Render::Detail
+{
+	using namespace Graphics;
+
+	class D3D11Renderer2DBackend final : public IRenderer2DBackend
+	{
+	public:
+		static constexpr u32 InitialQuadCapacity = SpriteBatchBuilder::InitialBatchItemCapacity;
+		static constexpr u32 MaxBatchItemSize = SpriteBatchBuilder::MaxBatchItemSize;
+
+	public:
+		struct CameraConstantData
+		{
+			mat4 ViewProjection;
+		};
+
+		struct SpriteConstantData
+		{
+			AetBlendMode BlendMode;
+			u8 BlendModePadding[3];
+
+			TextureFormat Format;
+			TextureFormat MaskFormat;
+			u32 FormatFlags;
+
+			vec4 CheckerboardSize;
+		};
+
+		struct PostProcessData
+		{
+			vec4 PostProcessParam;
+			vec4 PostProcessCoefficients[4];
+		};
+
+		static_assert(MaxSpriteTextureSlots <= (sizeof(SpriteConstantData::FormatFlags) * CHAR_BIT));
+
+	public:
+		D3D11Renderer2DBackend()
+		{
+			D3D11_SetObjectDebugName(CameraConstantBuffer.Buffer.Buffer.Get(), "Renderer2D::CameraConstantBuffer");
+			D3D11_SetObjectDebugName(SpriteConstantBuffer.Buffer.Buffer.Get(), "Renderer2D::SpriteConstantBuffer");
+			D3D11_SetObjectDebugName(PostProcessConstantBuffer.Buffer.Buffer.Get(), "Renderer2D::PostProcessConstantBuffer");
+
+			D3D11_SetObjectDebugName(RasterizerState.RasterizerState.Get(), "Renderer2D::RasterizerState");
+
+			InternalCreateQuadBuffers(InitialQuadCapacity);
+			InternalCreateInputLayout();
+		}
+
+		~D3D11Renderer2DBackend() = default;
+
+	public:
+		void Begin(Camera2D& camera, RenderTarget2D& renderTarget) override
+		{
+			D3D11_BeginDebugEvent("Renderer2D::Begin - End");
+
+			DrawCallCount = 0;
+			Camera = &camera;
+			RenderTarget = static_cast<RenderTarget2DImpl*>(&renderTarget);
+			InternalSetBeginState();
+		}
+
+		void Submit(const SpriteDrawList& drawList) override
+		{
+			if (drawList.CommandCount == 0)
+				return;
+
+			assert(drawList.QuadCount <= MaxBatchItemSize);
+			D3D11_BeginDebugEvent("Render Batches");
+
+			if (drawList.QuadCount > QuadCapacity)
+			{
+				// NOTE: Grow geometrically so that sorted and merged batches larger than the initial capacity only cause a handful of reallocations
+				InternalCreateQuadBuffers(std::min(std::max(static_cast<u32>(drawList.QuadCount), QuadCapacity * 2), MaxBatchItemSize));
+				SpriteQuadIndexBuffer->Bind(GlobalD3D11);
+			}
+
+			if (drawList.ShapeVertexCount > 0)
+			{
+				const size_t requiredByteSize = (drawList.ShapeVertexCount * sizeof(SpriteVertex));
+				if (SpriteShapeVertexBuffer == nullptr || requiredByteSize > SpriteShapeVertexBuffer->BufferDesc.ByteWidth)
+				{
+					// NOTE: Over allocate to mimic the exponential growth behavior of std::vector and avoid recreating the buffer every time it grows slightly
+					const size_t newByteSize = (SpriteShapeVertexBuffer == nullptr) ? requiredByteSize : std::max(requiredByteSize, static_cast<size_t>(SpriteShapeVertexBuffer->BufferDesc.ByteWidth) * 2);
+
+					auto initialData = std::make_unique<SpriteVertex[]>(newByteSize / sizeof(SpriteVertex));
+					std::copy(drawList.ShapeVertices, drawList.ShapeVertices + drawList.ShapeVertexCount, initialData.get());
+
+					SpriteShapeVertexBuffer = std::make_unique<D3D11VertexBuffer>(
+						GlobalD3D11,
+						newByteSize,
+						initialData.get(),
+						sizeof(SpriteVertex),
+						D3D11_USAGE_DYNAMIC);
+
+					D3D11_SetObjectDebugName(SpriteShapeVertexBuffer->Buffer.Get(), "Renderer2D::ShapeVertexBuffer");
+				}
+				else
+				{
+					SpriteShapeVertexBuffer->UploadDataIfDynamic(GlobalD3D11, requiredByteSize, drawList.ShapeVertices);
+				}
+			}
+
+			SpriteQuadVertexBuffer->UploadDataIfDynamic(GlobalD3D11, drawList.QuadCount * sizeof(SpriteQuadVertices), drawList.QuadVertices);
+
+			Camera->UpdateMatrices();
+			CameraConstantBuffer.Data.ViewProjection = glm::transpose(Camera->GetViewProjection());
+			CameraConstantBuffer.UploadData(GlobalD3D11);
+
+			const D3D11ShaderPair* lastBoundShader = nullptr;
+			const D3D11VertexBuffer* lastBoundVB = nullptr;
+
+			PrimitiveType lastPrimitive = PrimitiveType::Count;
+			AetBlendMode lastBlendMode = AetBlendMode::Count;
+
+			for (size_t commandIndex = 0; commandIndex < drawList.CommandCount; commandIndex++)
+			{
+				const SpriteDrawCommand& command = drawList.Commands[commandIndex];
+				assert(command.TexViews[0] != nullptr);
+
+				if (lastPrimitive != command.Primitive)
+				{
+					GlobalD3D11.ImmediateContext->IASetPrimitiveTopology(PrimitiveTypeToD3DTopology(command.Primitive));
+					lastPrimitive = command.Primitive;
+				}
+
+				if (lastBlendMode != command.BlendMode)
+				{
+					InternalSetBlendMode(command.BlendMode);
+					lastBlendMode = command.BlendMode;
+				}
+
+				if (const auto& commandShader = GetDrawCommandShader(command); lastBoundShader != &commandShader)
+				{
+					commandShader.Bind(GlobalD3D11);
+					lastBoundShader = &commandShader;
+				}
+
+				if (const auto& commandVB = (command.VertexSource == SpriteVertexSource::Shapes) ? SpriteShapeVertexBuffer : SpriteQuadVertexBuffer; lastBoundVB != commandVB.get())
+				{
+					commandVB->Bind(GlobalD3D11);
+					lastBoundVB = commandVB.get();
+				}
+
+				std::array<ID3D11SamplerState*, MaxSpriteTextureSlots> textureSamplers;
+				std::array<ID3D11ShaderResourceView*, MaxSpriteTextureSlots> textureResourceViews;
+				if (command.Shader == SpriteShaderType::Font)
+				{
+					textureSamplers[0] = TryGetTextureSampler(command.TexViews[0]);
+					textureResourceViews[0] = TryGetTextureResourceView(command.TexViews[0]);
+
+					GlobalD3D11.ImmediateContext->PSSetSamplers(0, 1, textureSamplers.data());
+					GlobalD3D11.ImmediateContext->PSSetShaderResources(0, 1, textureResourceViews.data());
+				}
+				else if (command.MaskTexView != nullptr)
+				{
+					textureSamplers[0] = TryGetTextureSampler(command.TexViews[0]);
+					textureSamplers[1] = TryGetTextureSampler(command.MaskTexView);
+
+					textureResourceViews[0] = TryGetTextureResourceView(command.TexViews[0]);
+					textureResourceViews[1] = TryGetTextureResourceView(command.MaskTexView);
+
+					GlobalD3D11.ImmediateContext->PSSetSamplers(0, 2, textureSamplers.data());
+					GlobalD3D11.ImmediateContext->PSSetShaderResources(0, 2, textureResourceViews.data());
+				}
+				else // NOTE: Multi texture batch
+				{
+					for (size_t i = 0; i < command.TextureSlotCount; i++)
+					{
+						textureSamplers[i] = TryGetTextureSampler(command.TexViews[i]);
+						textureResourceViews[i] = TryGetTextureResourceView(command.TexViews[i]);
+					}
+
+					GlobalD3D11.ImmediateContext->PSSetSamplers(0, static_cast<UINT>(command.TextureSlotCount), textureSamplers.data());
+					GlobalD3D11.ImmediateContext->PSSetShaderResources(0, static_cast<UINT>(command.TextureSlotCount), textureResourceViews.data());
+				}
+
+				SpriteConstantBuffer.Data.BlendMode = command.BlendMode;
+				SpriteConstantBuffer.Data.Format = command.TexViews[0].Texture->GetFormat();
+				SpriteConstantBuffer.Data.MaskFormat = (command.MaskTexView) ? command.MaskTexView.Texture->GetFormat() : TextureFormat::Unknown;
+				SpriteConstantBuffer.Data.FormatFlags = 0;
+				for (u32 i = 0; i < static_cast<u32>(MaxSpriteTextureSlots); i++)
+					SpriteConstantBuffer.Data.FormatFlags |= (static_cast<u32>(TryGetIsTexViewYCbCr(command.TexViews[i])) << i);
+				SpriteConstantBuffer.Data.CheckerboardSize = vec4(command.CheckerboardSize, 0.0f, 0.0f);
+				SpriteConstantBuffer.UploadData(GlobalD3D11);
+
+				if (command.VertexSource == SpriteVertexSource::Shapes)
+				{
+					GlobalD3D11.ImmediateContext->Draw(
+						command.ElementCount,
+						command.FirstElement);
+				}
+				else
+				{
+					GlobalD3D11.ImmediateContext->DrawIndexed(
+						command.ElementCount * SpriteQuadIndices::TotalIndices(),
+						command.FirstElement * SpriteQuadIndices::TotalIndices(),
+						0);
+				}
+
+				DrawCallCount++;
+			}
+
+			D3D11_EndDebugEvent();
+		}
+
+		void End() override
+		{
+			InternalSetEndState();
+
+			Camera = nullptr;
+			RenderTarget = nullptr;
+			D3D11_EndDebugEvent();
+		}
+
+	public:
+		void UploadToGPUFreeCPUMemory(Tex& tex) override
+		{
+			const auto* texture2D = GetD3D11Texture2D(GlobalD3D11, tex);
+			if (texture2D == nullptr)
+				return;
+
+			for (auto& mipMaps : tex.MipMapsArray)
+			{
+				for (auto& mip : mipMaps)
+				{
+					mip.DataSize = 0;
+					mip.Data = nullptr;
+				}
+			}
+		}
+
+		std::unique_ptr<RenderTarget2D> CreateRenderTarget() override
+		{
+			return std::make_unique<RenderTarget2DImpl>();
+		}
+
+	private:
+		void InternalCreateQuadBuffers(u32 quadCapacity)
+		{
+			QuadCapacity = quadCapacity;
+
+			auto indexData = std::make_unique<SpriteQuadIndices[]>(quadCapacity);
+			for (u32 i = 0, offset = 0; i < quadCapacity; i++)
+			{
+				// NOTE: Vertex index order:
+				//		 [0] TopLeft	- [1] TopRight
+				//		 [2] BottomLeft - [3] BottomRight;
+				enum { TopLeft = 0, TopRight = 1, BottomLeft = 2, BottomRight = 3 };
+
+				indexData[i] =
+				{
+					// NOTE: Used to be counter clockwise for OpenGL but D3D's winding order is clockwise by default
+					(offset + TopLeft),
+					(offset + TopRight),
+					(offset + BottomRight),
+
+					(offset + BottomRight),
+					(offset + BottomLeft),
+					(offset + TopLeft),
+				};
+
+				offset += static_cast<u32>(SpriteQuadVertices::GetVertexCount());
+			}
+
+			SpriteQuadIndexBuffer = std::make_unique<D3D11IndexBuffer>(GlobalD3D11, quadCapacity * sizeof(SpriteQuadIndices), indexData.get(), IndexFormat::U32, D3D11_USAGE_IMMUTABLE);
+			D3D11_SetObjectDebugName(SpriteQuadIndexBuffer->Buffer.Get(), "Renderer2D::QuadIndexBuffer");
+
+			SpriteQuadVertexBuffer = std::make_unique<D3D11VertexBuffer>(GlobalD3D11, quadCapacity * sizeof(SpriteQuadVertices), nullptr, sizeof(SpriteVertex), D3D11_USAGE_DYNAMIC);
+			D3D11_SetObjectDebugName(SpriteQuadVertexBuffer->Buffer.Get(), "Renderer2D::QuadVertexBuffer");
+		}
+
+		void InternalCreateInputLayout()
+		{
+			static constexpr D3D11InputElement elements[] =
+			{
+				{ "POSITION",	0, DXGI_FORMAT_R32G32_FLOAT,	offsetof(SpriteVertex, Position)				},
+				{ "TEXCOORD",	0, DXGI_FORMAT_R32G32_FLOAT,	offsetof(SpriteVertex, TextureCoordinates)		},
+				{ "TEXCOORD",	1, DXGI_FORMAT_R32G32_FLOAT,	offsetof(SpriteVertex, TextureMaskCoordinates)	},
+				{ "COLOR",		0, DXGI_FORMAT_R8G8B8A8_UNORM,	offsetof(SpriteVertex, Color)					},
+				{ "TEXINDEX",	0, DXGI_FORMAT_R32_UINT,		offsetof(SpriteVertex, TextureIndex)			},
+			};
+
+			InputLayout = std::make_unique<D3D11InputLayout>(GlobalD3D11, elements, std::size(elements), Shaders.Multi.TextureBatch[0].VS);
+			D3D11_SetObjectDebugName(InputLayout->InputLayout.Get(), "Renderer2D::InputLayout");
+		}
+
+		const D3D11ShaderPair& GetDrawCommandShader(const SpriteDrawCommand& command) const
+		{
+			switch (command.Shader)
+			{
+			case SpriteShaderType::Font:
+				return Shaders.Single.TextureFont;
+			case SpriteShaderType::Mask:
+				return Shaders.Single.TextureMask;
+			case SpriteShaderType::MaskMultiply:
+				return Shaders.Single.TextureMaskMultiply;
+			case SpriteShaderType::Checkerboard:
+				return Shaders.Single.TextureCheckerboard;
+			case SpriteShaderType::MultiTextureMultiply:
+				return Shaders.Multi.TextureBatchMultiply;
+			default:
+			case SpriteShaderType::MultiTexture:
+				assert(command.TextureSlotCount > 0 && (command.TextureSlotCount - 1) < Shaders.Multi.TextureBatch.size());
+				return Shaders.Multi.TextureBatch[command.TextureSlotCount - 1];
+			}
+		}
+
+		ID3D11SamplerState* TryGetTextureSampler(TexSamplerView texView)
+		{
+			return TextureSamplers.GetSampler(texView).SamplerState.Get();
+		}
+
+		ID3D11ShaderResourceView* TryGetTextureResourceView(TexSamplerView texView)
+		{
+			const auto* tex2D = texView ? GetD3D11Texture2D(GlobalD3D11, texView.Texture) : nullptr;
+			return (tex2D != nullptr) ? tex2D->TextureView.Get() : nullptr;
+		}
+
+		bool TryGetIsTexViewYCbCr(TexSamplerView texView) const
+		{
+			return (texView && texView.Texture->GetFormat() == TextureFormat::RGTC2);
+		}
+
+		// NOTE: This assumes that the D3D11 context does **not** change externally between the Begin() / End() call
+		void InternalSetBeginState()
+		{
+			D3D11_BeginDebugEvent("Set Begin State");
+			RenderTarget->Main.RecreateWithNewSizeIfDifferent(GlobalD3D11, RenderTarget->Param.Resolution);
+			RenderTarget->Main.RecreateWithNewMultiSampleCountIfDifferent(GlobalD3D11, RenderTarget->Param.MultiSampleCount);
+			RenderTarget->Main.BindAndSetViewport(GlobalD3D11);
+
+			RenderTarget->Output.RecreateWithNewSizeIfDifferent(GlobalD3D11, RenderTarget->Param.Resolution);
+
+			if (RenderTarget->Param.Clear)
+				RenderTarget->Main.ClearColor(GlobalD3D11, RenderTarget->Param.ClearColor);
+
+			RasterizerState.Bind(GlobalD3D11);
+			InputLayout->Bind(GlobalD3D11);
+			SpriteQuadIndexBuffer->Bind(GlobalD3D11);
+
+			CameraConstantBuffer.BindVertexShader(GlobalD3D11);
+			SpriteConstantBuffer.BindPixelShader(GlobalD3D11);
+			PostProcessConstantBuffer.BindPixelShader(GlobalD3D11);
+			D3D11_EndDebugEvent();
+		}
+
+		void InternalSetEndState()
+		{
+			D3D11_BeginDebugEvent("Set End State");
+			RenderTarget->Main.UnBind(GlobalD3D11);
+
+			if (RenderTarget->Param.MultiSampleCount > 1)
+			{
+				// TODO: Allow both MSAA and PP
+				GlobalD3D11.ImmediateContext->ResolveSubresource(RenderTarget->Output.ColorTexture.Get(), 0, RenderTarget->Main.ColorTexture.Get(), 0, RenderTarget->Main.ColorTextureDesc.Format);
+			}
+			else if (RenderTarget->Param.PostProcessingEnabled)
+			{
+				PostProcessConstantBuffer.Data.PostProcessParam[0] = RenderTarget->Param.PostProcessing.Gamma;
+				PostProcessConstantBuffer.Data.PostProcessParam[1] = RenderTarget->Param.PostProcessing.Contrast;
+				PostProcessConstantBuffer.Data.PostProcessCoefficients[0] = vec4(RenderTarget->Param.PostProcessing.ColorCoefficientsRGB[0], 0.0f);
+				PostProcessConstantBuffer.Data.PostProcessCoefficients[1] = vec4(RenderTarget->Param.PostProcessing.ColorCoefficientsRGB[1], 0.0f);
+				PostProcessConstantBuffer.Data.PostProcessCoefficients[2] = vec4(RenderTarget->Param.PostProcessing.ColorCoefficientsRGB[2], 0.0f);
+				PostProcessConstantBuffer.UploadData(GlobalD3D11);
+
+				Shaders.PostProcessing.ColorCorrection.Bind(GlobalD3D11);
+
+				RenderTarget->Output.Bind(GlobalD3D11);
+				GlobalD3D11.ImmediateContext->PSSetShaderResources(0, 1, PtrArg<ID3D11ShaderResourceView*>(RenderTarget->Main.ColorTextureView.Get()));
+				GlobalD3D11.ImmediateContext->OMSetBlendState(nullptr, nullptr, D3D11_DEFAULT_SAMPLE_MASK);
+
+				GlobalD3D11.ImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+				GlobalD3D11.ImmediateContext->Draw(6, 0);
+
+				GlobalD3D11.ImmediateContext->PSSetShaderResources(0, 1, PtrArg<ID3D11ShaderResourceView*>(nullptr));
+				RenderTarget->Output.UnBind(GlobalD3D11);
+
+				Shaders.PostProcessing.ColorCorrection.UnBind(GlobalD3D11);
+			}
+			else
+			{
+				GlobalD3D11.ImmediateContext->CopyResource(RenderTarget->Output.ColorTexture.Get(), RenderTarget->Main.ColorTexture.Get());
+			}
+
+			PostProcessConstantBuffer.UnBindPixelShader(GlobalD3D11);
+			SpriteConstantBuffer.UnBindPixelShader(GlobalD3D11);
+			CameraConstantBuffer.UnBindVertexShader(GlobalD3D11);
+
+			SpriteQuadIndexBuffer->UnBind(GlobalD3D11);
+			SpriteQuadVertexBuffer->UnBind(GlobalD3D11);
+			InputLayout->UnBind(GlobalD3D11);
+			RasterizerState.UnBind(GlobalD3D11);
+
+			D3D11_EndDebugEvent();
+		}
+
+		void InternalSetBlendMode(AetBlendMode blendMode)
+		{
+			switch (blendMode)
+			{
+			case AetBlendMode::Unknown:
+				AetBlendStates.Normal.UnBind(GlobalD3D11);
+				break;
+			default:
+			case AetBlendMode::Normal:
+				AetBlendStates.Normal.Bind(GlobalD3D11);
+				break;
+			case AetBlendMode::Add:
+				AetBlendStates.Add.Bind(GlobalD3D11);
+				break;
+			case AetBlendMode::Multiply:
+				AetBlendStates.Multiply.Bind(GlobalD3D11);
+				break;
+			case AetBlendMode::LinearDodge:
+				AetBlendStates.LinearDodge.Bind(GlobalD3D11);
+				break;
+			case AetBlendMode::Overlay:
+				AetBlendStates.Overlay.Bind(GlobalD3D11);
+				break;
+			}
+		}
+
+	private:
+		u32 DrawCallCount = 0;
+
+		struct RendererShaderPairs
+		{
+			struct MultiTextureShaders
+			{
+				// TODO: Permutation for all texture formats being the same to ~~avoid any branching~~ have a single branch
+				std::array<D3D11ShaderPair, MaxSpriteTextureSlots> TextureBatch =
+				{
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_01_PS(), "Renderer2D::SpriteMultiTextureBatch_01_PS" },
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_02_PS(), "Renderer2D::SpriteMultiTextureBatch_02_PS" },
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_03_PS(), "Renderer2D::SpriteMultiTextureBatch_03_PS" },
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_04_PS(), "Renderer2D::SpriteMultiTextureBatch_04_PS" },
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_05_PS(), "Renderer2D::SpriteMultiTextureBatch_05_PS" },
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_06_PS(), "Renderer2D::SpriteMultiTextureBatch_06_PS" },
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_07_PS(), "Renderer2D::SpriteMultiTextureBatch_07_PS" },
+					D3D11ShaderPair { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatch_08_PS(), "Renderer2D::SpriteMultiTextureBatch_08_PS" },
+				};
+				D3D11ShaderPair TextureBatchMultiply = { GlobalD3D11, SpriteMultiTexture_VS(), SpriteMultiTextureBatchBlend_08_PS(), "Renderer2D::SpriteMultiTextureBatchBlend_08" };
+			} Multi;
+
+			struct SingleTextureShaders
+			{
+				D3D11ShaderPair TextureCheckerboard = { GlobalD3D11, SpriteSingleTexture_VS(), SpriteSingleTextureCheckerboard_PS(), "Renderer2D::SpriteSingleTextureCheckerboard" };
+				D3D11ShaderPair TextureFont = { GlobalD3D11, SpriteSingleTexture_VS(), SpriteSingleTextureFont_PS(), "Renderer2D::SpriteSingleTextureFont" };
+				D3D11ShaderPair TextureMask = { GlobalD3D11, SpriteSingleTexture_VS(), SpriteSingleTextureMask_PS(), "Renderer2D::SpriteSingleTextureMask" };
+				D3D11ShaderPair TextureMaskMultiply = { GlobalD3D11, SpriteSingleTexture_VS(), SpriteSingleTextureMaskBlend_PS(), "Renderer2D::SpriteSingleTextureMaskBlend" };
+			} Single;
+
+			struct PostProcessingShaders
+			{
+				D3D11ShaderPair ColorCorrection = { GlobalD3D11, SpriteFullscreenQuad_VS(), SpriteColorCorrection_PS(), "Renderer2D::SpriteColorCorrection" };
+			} PostProcessing;
+		} Shaders;
+
+		D3D11ConstantBufferTemplate<CameraConstantData> CameraConstantBuffer = { GlobalD3D11, 0, D3D11_USAGE_DEFAULT };
+		D3D11ConstantBufferTemplate<SpriteConstantData> SpriteConstantBuffer = { GlobalD3D11, 0, D3D11_USAGE_DYNAMIC };
+		D3D11ConstantBufferTemplate<PostProcessData> PostProcessConstantBuffer = { GlobalD3D11, 1, D3D11_USAGE_DYNAMIC };
+
+		u32 QuadCapacity = 0;
+		std::unique_ptr<D3D11IndexBuffer> SpriteQuadIndexBuffer = nullptr;
+		std::unique_ptr<D3D11VertexBuffer> SpriteQuadVertexBuffer = nullptr;
+		std::unique_ptr<D3D11VertexBuffer> SpriteShapeVertexBuffer = nullptr;
+
+		std::unique_ptr<D3D11InputLayout> InputLayout = nullptr;
+
+		// NOTE: Disable backface culling for negatively scaled sprites
+		D3D11RasterizerState RasterizerState = { GlobalD3D11, D3D11_FILL_SOLID, D3D11_CULL_NONE };
+
+		TextureSamplerCache2D TextureSamplers = {};
+
+		struct AetBlendStates
+		{
+			D3D11BlendState Normal = { GlobalD3D11, AetBlendMode::Normal };
+			D3D11BlendState Add = { GlobalD3D11,AetBlendMode::Add };
+			D3D11BlendState Multiply = { GlobalD3D11,AetBlendMode::Multiply };
+			D3D11BlendState LinearDodge = { GlobalD3D11,AetBlendMode::LinearDodge };
+			D3D11BlendState Overlay = { GlobalD3D11,AetBlendMode::Overlay };
+		} AetBlendStates;
+
+		Camera2D* Camera = nullptr;
+		RenderTarget2DImpl* RenderTarget = nullptr;
+	};
+}
+
+namespace Comfy::Render
+{
+	std::unique_ptr<IRenderer2DBackend> MakeD3D11Renderer2DBackend()
+	{
+		return std::make_unique<Detail::D3D11Renderer2DBackend>();
+	}
+
+	// NOTE: Defined here instead of the backend agnostic Renderer2D.cpp because the static render target factory has always been D3D11 specific
+	std::unique_ptr<RenderTarget2D> Renderer2D::CreateRenderTarget()
+	{
+		return std::make_unique<Detail::RenderTarget2DImpl>();
+	}
+}
@@ -0,0 +1,400 @@
+#include "SpriteBatchBuilder.h"
+
+namespace Comfy::Render::Detail
+{
+	namespace
+	{
+		constexpr u32 InvalidItemIndex = std::numeric_limits<u32>::max();
+
+		// NOTE: All quads share the same camera transform so world space overlap is equivalent to screen space overlap.
+		//		 Touching edges don't count as overlapping because the rasterizer fill rules never shade the same pixel twice for them
+		template <typename BoundsType>
+		constexpr bool BoundsOverlap(const BoundsType& a, const BoundsType& b)
+		{
+			return (a.Min.x < b.Max.x && b.Min.x < a.Max.x) && (a.Min.y < b.Max.y && b.Min.y < a.Max.y);
+		}
+
+		template <typename BoundsType>
+		BoundsType GetVertexBounds(const SpriteVertex* vertices, size_t vertexCount)
+		{
+			BoundsType bounds = { vertices[0].Position, vertices[0].Position };
+			for (size_t i = 1; i < vertexCount; i++)
+			{
+				bounds.Min = glm::min(bounds.Min, vertices[i].Position);
+				bounds.Max = glm::max(bounds.Max, vertices[i].Position);
+			}
+			return bounds;
+		}
+	}
+
+	SpriteBatchBuilder::SpriteBatchBuilder()
+	{
+		batchItems.reserve(InitialBatchItemCapacity);
+		quadVertices.reserve(InitialBatchItemCapacity);
+	}
+
+	bool SpriteBatchBuilder::IsEmpty() const
+	{
+		return batchItems.empty();
+	}
+
+	bool SpriteBatchBuilder::IsFull() const
+	{
+		return (batchItems.size() >= MaxBatchItemSize);
+	}
+
+	size_t SpriteBatchBuilder::GetItemCount() const
+	{
+		return batchItems.size();
+	}
+
+	u32 SpriteBatchBuilder::GetRemainingItemCapacity() const
+	{
+		return (MaxBatchItemSize - static_cast<u32>(batchItems.size()));
+	}
+
+	SpriteBatchItemVertexView SpriteBatchBuilder::AddQuadItem()
+	{
+		assert(!IsFull());
+		return { &batchItems.emplace_back(), &quadVertices.emplace_back() };
+	}
+
+	SpriteBatchItemVertexSpan SpriteBatchBuilder::AddQuadItems(u32 count)
+	{
+		assert(count > 0 && count <= GetRemainingItemCapacity());
+
+		const size_t firstItemIndex = batchItems.size(), firstQuadIndex = quadVertices.size();
+		batchItems.resize(firstItemIndex + count);
+		quadVertices.resize(firstQuadIndex + count);
+		return { &batchItems[firstItemIndex], &quadVertices[firstQuadIndex], count };
+	}
+
+	SpriteBatchItemShapeView SpriteBatchBuilder::AddShapeItem(u32 vertexCount)
+	{
+		assert(!IsFull() && vertexCount > 0);
+
+		auto& batchItem = batchItems.emplace_back();
+		batchItem.ShapeVertexIndex = static_cast<u32>(shapeVertices.size());
+		batchItem.ShapeVertexCount = vertexCount;
+
+		shapeVertices.resize(shapeVertices.size() + vertexCount);
+		return { &batchItem, &shapeVertices[batchItem.ShapeVertexIndex] };
+	}
+
+	SpriteBatchItem& SpriteBatchBuilder::GetLastItem()
+	{
+		assert(!batchItems.empty());
+		return batchItems.back();
+	}
+
+	bool SpriteBatchBuilder::GetSortAndMerge() const
+	{
+		return sortAndMerge;
+	}
+
+	void SpriteBatchBuilder::SetSortAndMerge(bool value)
+	{
+		sortAndMerge = value;
+	}
+
+	SpriteDrawList SpriteBatchBuilder::CreateDrawList()
+	{
+		if (batchItems.empty())
+			return {};
+
+		if (sortAndMerge)
+			SortAndMergeItems();
+
+		CreateDrawCallBatchesFromItems();
+		CreateDrawCommandsFromBatches();
+
+		SpriteDrawList drawList;
+		drawList.Commands = drawCommands.data();
+		drawList.CommandCount = drawCommands.size();
+		drawList.QuadVertices = quadVertices.data();
+		drawList.QuadCount = quadVertices.size();
+		drawList.ShapeVertices = shapeVertices.data();
+		drawList.ShapeVertexCount = shapeVertices.size();
+		return drawList;
+	}
+
+	void SpriteBatchBuilder::Clear()
+	{
+		drawCallBatches.clear();
+		drawCommands.clear();
+		batchItems.clear();
+		quadVertices.clear();
+		shapeVertices.clear();
+	}
+
+	int SpriteBatchBuilder::FindAvailableTextureSlot(const SpriteDrawCallBatch& currentBatch, TexSamplerView texView) const
+	{
+		for (int i = 0; i < static_cast<int>(MaxSpriteTextureSlots); i++)
+		{
+			if (!currentBatch.TexViews[i] || currentBatch.TexViews[i] == texView)
+				return i;
+		}
+
+		return -1;
+	}
+
+	bool SpriteBatchBuilder::AreBatchItemsCompatible(const SpriteBatchItem& item, const SpriteBatchItem& lastItem) const
+	{
+		if (item.Primitive != lastItem.Primitive)
+			return false;
+
+		if (item.BlendMode != lastItem.BlendMode)
+			return false;
+
+		if (item.DrawTextBorder != lastItem.DrawTextBorder)
+			return false;
+
+		const bool textureChanged = (item.TexView != lastItem.TexView);
+		const bool textureMaskChanged = (item.MaskTexView != lastItem.MaskTexView);
+
+		if ((item.MaskTexView != nullptr || lastItem.MaskTexView != nullptr) && (textureChanged || textureMaskChanged))
+			return false;
+
+		if (item.DrawCheckerboard != lastItem.DrawCheckerboard)
+			return false;
+
+		if (item.ShapeVertexCount > 0 != lastItem.ShapeVertexCount > 0)
+			return false;
+
+		return true;
+	}
+
+	int SpriteBatchBuilder::GetUsedSpriteTextureSlotsCount(const SpriteDrawCallBatch& batch) const
+	{
+		for (int i = 0; i < static_cast<int>(MaxSpriteTextureSlots); i++)
+		{
+			if (batch.TexViews[i] == nullptr)
+				return i;
+		}
+
+		return MaxSpriteTextureSlots;
+	}
+
+	SpriteShaderType SpriteBatchBuilder::GetBatchItemShaderType(const SpriteBatchItem& item) const
+	{
+		if (item.DrawTextBorder)
+			return SpriteShaderType::Font;
+
+		if (item.MaskTexView != nullptr)
+			return (item.BlendMode == Graphics::AetBlendMode::Multiply) ? SpriteShaderType::MaskMultiply : SpriteShaderType::Mask;
+
+		if (item.DrawCheckerboard)
+			return SpriteShaderType::Checkerboard;
+
+		return (item.BlendMode == Graphics::AetBlendMode::Multiply) ? SpriteShaderType::MultiTextureMultiply : SpriteShaderType::MultiTexture;
+	}
+
+	bool SpriteBatchBuilder::CanAppendToGroup(const SortAndMergeGroup& group, const SpriteBatchItem& item) const
+	{
+		const auto& firstItem = batchItems[group.FirstItemIndex];
+		if (!AreBatchItemsCompatible(item, firstItem))
+			return false;
+
+		// NOTE: The whole draw call uses the checkerboard size of its first item
+		if (item.DrawCheckerboard && item.CheckerboardSize != firstItem.CheckerboardSize)
+			return false;
+
+		if (group.TextureCount < MaxSpriteTextureSlots)
+			return true;
+
+		return std::any_of(group.TexViews.begin(), group.TexViews.end(), [&](const auto& texView) { return (texView == item.TexView); });
+	}
+
+	void SpriteBatchBuilder::SortAndMergeItems()
+	{
+		const auto itemCount = static_cast<u32>(batchItems.size());
+
+		itemBounds.resize(itemCount);
+		itemQuadIndices.resize(itemCount);
+		for (u32 itemIndex = 0, quadIndex = 0; itemIndex < itemCount; itemIndex++)
+		{
+			const auto& item = batchItems[itemIndex];
+			if (item.ShapeVertexCount > 0)
+			{
+				itemBounds[itemIndex] = GetVertexBounds<ItemBounds>(&shapeVertices[item.ShapeVertexIndex], item.ShapeVertexCount);
+				itemQuadIndices[itemIndex] = InvalidItemIndex;
+			}
+			else
+			{
+				itemBounds[itemIndex] = GetVertexBounds<ItemBounds>(&quadVertices[quadIndex].TopLeft, SpriteQuadVertices::GetVertexCount());
+				itemQuadIndices[itemIndex] = quadIndex++;
+			}
+		}
+
+		sortAndMergeGroups.clear();
+		nextItemInGroupIndices.assign(itemCount, InvalidItemIndex);
+		bool anyItemMoved = false;
+
+		for (u32 itemIndex = 0; itemIndex < itemCount; itemIndex++)
+		{
+			const auto& item = batchItems[itemIndex];
+			const auto& bounds = itemBounds[itemIndex];
+
+			// NOTE: Walk back through the most recent groups until either a compatible one is found or an overlapping one blocks moving any further back
+			const auto groupCount = static_cast<u32>(sortAndMergeGroups.size());
+			const auto lookbackEnd = (groupCount > MaxSortAndMergeLookbackGroups) ? (groupCount - MaxSortAndMergeLookbackGroups) : 0;
+
+			u32 targetGroupIndex = InvalidItemIndex;
+			for (u32 groupIndex = groupCount; groupIndex-- > lookbackEnd;)
+			{
+				const auto& group = sortAndMergeGroups[groupIndex];
+				if (CanAppendToGroup(group, item))
+				{
+					targetGroupIndex = groupIndex;
+					break;
+				}
+
+				if (BoundsOverlap(group.Bounds, bounds))
+					break;
+			}
+
+			if (targetGroupIndex == InvalidItemIndex)
+			{
+				auto& newGroup = sortAndMergeGroups.emplace_back();
+				newGroup.FirstItemIndex = itemIndex;
+				newGroup.LastItemIndex = itemIndex;
+				newGroup.TextureCount = 1;
+				newGroup.TexViews[0] = item.TexView;
+				newGroup.Bounds = bounds;
+				continue;
+			}
+
+			auto& targetGroup = sortAndMergeGroups[targetGroupIndex];
+			nextItemInGroupIndices[targetGroup.LastItemIndex] = itemIndex;
+			targetGroup.LastItemIndex = itemIndex;
+			targetGroup.Bounds.Min = glm::min(targetGroup.Bounds.Min, bounds.Min);
+			targetGroup.Bounds.Max = glm::max(targetGroup.Bounds.Max, bounds.Max);
+
+			if (std::none_of(targetGroup.TexViews.begin(), targetGroup.TexViews.begin() + targetGroup.TextureCount, [&](const auto& texView) { return (texView == item.TexView); }))
+				targetGroup.TexViews[targetGroup.TextureCount++] = item.TexView;
+
+			anyItemMoved |= ((targetGroupIndex + 1) != groupCount);
+		}
+
+		if (!anyItemMoved)
+			return;
+
+		sortedBatchItems.clear();
+		sortedQuadVertices.clear();
+		sortedShapeVertices.clear();
+		sortedBatchItems.reserve(batchItems.size());
+		sortedQuadVertices.reserve(quadVertices.size());
+		sortedShapeVertices.reserve(shapeVertices.size());
+
+		for (const auto& group : sortAndMergeGroups)
+		{
+			for (u32 itemIndex = group.FirstItemIndex; itemIndex != InvalidItemIndex; itemIndex = nextItemInGroupIndices[itemIndex])
+			{
+				auto& sortedItem = sortedBatchItems.emplace_back(batchItems[itemIndex]);
+				if (sortedItem.ShapeVertexCount > 0)
+				{
+					const auto sourceVertices = shapeVertices.begin() + sortedItem.ShapeVertexIndex;
+					sortedItem.ShapeVertexIndex = static_cast<u32>(sortedShapeVertices.size());
+					sortedShapeVertices.insert(sortedShapeVertices.end(), sourceVertices, sourceVertices + sortedItem.ShapeVertexCount);
+				}
+				else
+				{
+					sortedQuadVertices.push_back(quadVertices[itemQuadIndices[itemIndex]]);
+				}
+			}
+		}
+
+		std::swap(batchItems, sortedBatchItems);
+		std::swap(quadVertices, sortedQuadVertices);
+		std::swap(shapeVertices, sortedShapeVertices);
+	}
+
+	void SpriteBatchBuilder::CreateDrawCallBatchesFromItems()
+	{
+		assert(!batchItems.empty());
+
+		u32 quadIndex = 0;
+		drawCallBatches.emplace_back(0, 1, quadIndex).TexViews[0] = batchItems.front().TexView;
+
+		if (batchItems.front().ShapeVertexCount == 0)
+			quadIndex++;
+
+		for (u32 itemIndex = 1; itemIndex < static_cast<u32>(batchItems.size()); itemIndex++)
+		{
+			const auto& item = batchItems[itemIndex];
+			const auto& lastItem = batchItems[drawCallBatches.back().ItemIndex];
+
+			if (int availableTextureIndex = FindAvailableTextureSlot(drawCallBatches.back(), item.TexView); availableTextureIndex >= 0)
+			{
+				if (AreBatchItemsCompatible(item, lastItem))
+				{
+					drawCallBatches.back().ItemCount++;
+				}
+				else
+				{
+					drawCallBatches.emplace_back(itemIndex, 1, quadIndex);
+					availableTextureIndex = 0;
+				}
+
+				if (item.ShapeVertexCount > 0)
+				{
+					for (size_t i = 0; i < item.ShapeVertexCount; i++)
+						shapeVertices[item.ShapeVertexIndex + i].TextureIndex = availableTextureIndex;
+
+					quadIndex--;
+				}
+				else
+				{
+					quadVertices[quadIndex].SetTextureIndices(availableTextureIndex);
+				}
+
+				drawCallBatches.back().TexViews[availableTextureIndex] = item.TexView;
+			}
+			else
+			{
+				if (item.ShapeVertexCount > 0)
+					quadIndex--;
+
+				drawCallBatches.emplace_back(itemIndex, 1, quadIndex).TexViews[0] = item.TexView;
+			}
+
+			quadIndex++;
+			assert(GetUsedSpriteTextureSlotsCount(drawCallBatches.back()) > 0);
+		}
+	}
+
+	void SpriteBatchBuilder::CreateDrawCommandsFromBatches()
+	{
+		drawCommands.reserve(drawCallBatches.size());
+		for (const auto& batch : drawCallBatches)
+		{
+			const auto& item = batchItems[batch.ItemIndex];
+			assert(item.TexView != nullptr);
+
+			auto& command = drawCommands.emplace_back();
+			command.Shader = GetBatchItemShaderType(item);
+			command.VertexSource = (item.ShapeVertexCount > 0) ? SpriteVertexSource::Shapes : SpriteVertexSource::Quads;
+			command.Primitive = item.Primitive;
+			command.BlendMode = item.BlendMode;
+			command.TextureSlotCount = static_cast<u32>(GetUsedSpriteTextureSlotsCount(batch));
+			command.TexViews = batch.TexViews;
+			command.MaskTexView = item.MaskTexView;
+			command.CheckerboardSize = item.CheckerboardSize;
+
+			if (command.VertexSource == SpriteVertexSource::Shapes)
+			{
+				u32 totalVertices = 0;
+				for (size_t i = 0; i < batch.ItemCount; i++)
+					totalVertices += batchItems[batch.ItemIndex + i].ShapeVertexCount;
+
+				command.FirstElement = item.ShapeVertexIndex;
+				command.ElementCount = totalVertices;
+			}
+			else
+			{
+				command.FirstElement = batch.QuadIndex;
+				command.ElementCount = batch.ItemCount;
+			}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "Types.h"
+#include "SpriteBatchData.h"
+#include <vector>
+
+namespace Comfy::Render::Detail
+{
+	// NOTE: Pure CPU part of the Renderer2D responsible for collecting batch items and merging them into as few draw commands as possible.
+	//		 Doesn't know about any graphics API so that the batching can be profiled and validated without a GPU
+	class SpriteBatchBuilder : NonCopyable
+	{
+	public:
+		// NOTE: The vertex storage grows on demand up to this limit, the initial capacity covers most typical frames without reallocating
+		static constexpr u32 InitialBatchItemCapacity = 2048;
+		static constexpr u32 MaxBatchItemSize = 16384;
+
+		// NOTE: Upper bound for how many draw groups an item may be moved back across while sorting, keeps the pass linear for large batches
+		static constexpr u32 MaxSortAndMergeLookbackGroups = 64;
+
+	public:
+		SpriteBatchBuilder();
+		~SpriteBatchBuilder() = default;
+
+	public:
+		bool IsEmpty() const;
+		bool IsFull() const;
+
+		size_t GetItemCount() const;
+		u32 GetRemainingItemCapacity() const;
+
+		// NOTE: The caller is expected to check IsFull() and flush beforehand
+		SpriteBatchItemVertexView AddQuadItem();
+		SpriteBatchItemShapeView AddShapeItem(u32 vertexCount);
+		// NOTE: Adds multiple consecutive quad items at once, count must not exceed GetRemainingItemCapacity()
+		SpriteBatchItemVertexSpan AddQuadItems(u32 count);
+
+		SpriteBatchItem& GetLastItem();
+
+		// NOTE: Optionally reorder items with compatible render state next to each other before batching.
+		//		 Items are only ever moved across items they don't overlap with so the painter's order of overlapping items is preserved
+		bool GetSortAndMerge() const;
+		void SetSortAndMerge(bool value);
+
+		// NOTE: Assigns the texture slots and creates the draw commands for all items added since the last Clear()
+		SpriteDrawList CreateDrawList();
+		void Clear();
+
+	private:
+		int FindAvailableTextureSlot(const SpriteDrawCallBatch& currentBatch, TexSamplerView texView) const;
+		bool AreBatchItemsCompatible(const SpriteBatchItem& item, const SpriteBatchItem& lastItem) const;
+		int GetUsedSpriteTextureSlotsCount(const SpriteDrawCallBatch& batch) const;
+		SpriteShaderType GetBatchItemShaderType(const SpriteBatchItem& item) const;
+
+		void SortAndMergeItems();
+		void CreateDrawCallBatchesFromItems();
+		void CreateDrawCommandsFromBatches();
+
+	private:
+		struct ItemBounds
+		{
+			vec2 Min, Max;
+		};
+
+		struct SortAndMergeGroup
+		{
+			u32 FirstItemIndex;
+			u32 LastItemIndex;
+
+			u32 TextureCount;
+			std::array<TexSamplerView, MaxSpriteTextureSlots> TexViews;
+
+			// NOTE: Union of all item bounds, conservative but cheap to test against
+			ItemBounds Bounds;
+		};
+
+		bool CanAppendToGroup(const SortAndMergeGroup& group, const SpriteBatchItem& item) const;
+
+	private:
+		bool sortAndMerge = false;
+
+		std::vector<ItemBounds> itemBounds;
+		std::vector<u32> itemQuadIndices;
+		std::vector<u32> nextItemInGroupIndices;
+		std::vector<SortAndMergeGroup> sortAndMergeGroups;
+
+		std::vector<SpriteBatchItem> sortedBatchItems;
+		std::vector<SpriteQuadVertices> sortedQuadVertices;
+		std::vector<SpriteVertex> sortedShapeVertices;
+
+		std::vector<SpriteDrawCallBatch> drawCallBatches;
+		std::vector<SpriteDrawCommand> drawCommands;
+		std::vector<SpriteBatchItem> batchItems;
+		std::vector<SpriteQuadVertices> quadVertices;
+		std::vector<SpriteVertex> shapeVertices;
+	};
+}
@@ -21,7 +21,11 @@ namespace Comfy::Render::Detail
 	void SpriteQuadVertices::SetValues(vec2 position, const vec4& sourceRegion, vec2 size, vec2 origin, float rotation, vec2 scale, const vec4 colors[4], bool setTexCoords, bool flipTexY)
 	{
 		SetPositions(position, vec2(sourceRegion.z, sourceRegion.w) * scale, origin * scale, rotation);
+		SetTexCoordsAndColors(sourceRegion, size, colors, setTexCoords, flipTexY);
+	}
 
+	void SpriteQuadVertices::SetTexCoordsAndColors(const vec4& sourceRegion, vec2 size, const vec4 colors[4], bool setTexCoords, bool flipTexY)
+	{
 		if (setTexCoords)
 		{
 			const vec2 topLeft = vec2(sourceRegion.x / size.x, sourceRegion.y / size.y);
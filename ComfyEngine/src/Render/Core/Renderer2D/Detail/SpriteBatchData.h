@@ -1,8 +1,7 @@
 #pragma once
 #include "Types.h"
 #include "Render/Core/Renderer2D/RenderCommand2D.h"
-#include "Render/D3D11/D3D11Texture.h"
-#include <optional>
+#include <array>
 
 namespace Comfy::Render
 {
@@ -21,16 +20,17 @@ namespace Comfy::Render::Detail
 		return ((FloatToUInt32Sat(value.x)) << 0) | ((FloatToUInt32Sat(value.y)) << 8) | ((FloatToUInt32Sat(value.z)) << 16) | ((FloatToUInt32Sat(value.w)) << 24);
 	}
 
+	// NOTE: 32-bit indices so that a single batch can exceed the 65536 vertices (16384 quads) addressable by 16-bit indices
 	struct SpriteQuadIndices
 	{
-		u16 TopLeft;
-		u16 BottomLeft;
-		u16 BottomRight;
-		u16 BottomRightCopy;
-		u16 TopRight;
-		u16 TopLeftCopy;
-
-		static constexpr u32 TotalIndices() { return sizeof(SpriteQuadIndices) / sizeof(u16); };
+		u32 TopLeft;
+		u32 BottomLeft;
+		u32 BottomRight;
+		u32 BottomRightCopy;
+		u32 TopRight;
+		u32 TopLeftCopy;
+
+		static constexpr u32 TotalIndices() { return sizeof(SpriteQuadIndices) / sizeof(u32); };
 	};
 
 	struct SpriteVertex
@@ -51,6 +51,8 @@ namespace Comfy::Render::Detail
 
 	public:
 		void SetValues(vec2 position, const vec4& sourceRegion, vec2 size, vec2 origin, float rotation, vec2 scale, const vec4 colors[4], bool setTexCoords, bool flipTexY);
+		// NOTE: Everything SetValues() does except for the positions, used when those are generated separately for many quads at once
+		void SetTexCoordsAndColors(const vec4& sourceRegion, vec2 size, const vec4 colors[4], bool setTexCoords, bool flipTexY);
 		static constexpr u32 GetVertexCount() { return sizeof(SpriteQuadVertices) / sizeof(SpriteVertex); };
 
 	public:
@@ -70,14 +72,14 @@ namespace Comfy::Render::Detail
 
 	struct SpriteDrawCallBatch
 	{
-		SpriteDrawCallBatch(u16 index, u16 count, u16 quadIndex)
+		SpriteDrawCallBatch(u32 index, u32 count, u32 quadIndex)
 			: ItemIndex(index), ItemCount(count), QuadIndex(quadIndex)
 		{
 		}
 
-		u16 ItemIndex;
-		u16 ItemCount;
-		u16 QuadIndex;
+		u32 ItemIndex;
+		u32 ItemCount;
+		u32 QuadIndex;
 
 		std::array<TexSamplerView, MaxSpriteTextureSlots> TexViews = {};
 	};
@@ -98,8 +100,8 @@ namespace Comfy::Render::Detail
 
 		vec2 CheckerboardSize;
 
-		u16 ShapeVertexIndex;
-		u16 ShapeVertexCount;
+		u32 ShapeVertexIndex;
+		u32 ShapeVertexCount;
 	};
 
 	struct SpriteBatchItemVertexView
@@ -107,4 +109,69 @@ namespace Comfy::Render::Detail
 		SpriteBatchItem* Item;
 		SpriteQuadVertices* Vertices;
 	};
+
+	struct SpriteBatchItemVertexSpan
+	{
+		SpriteBatchItem* Items;
+		SpriteQuadVertices* Vertices;
+		u32 Count;
+	};
+
+	struct SpriteBatchItemShapeView
+	{
+		SpriteBatchItem* Item;
+		SpriteVertex* Vertices;
+	};
+
+	enum class SpriteShaderType : u8
+	{
+		MultiTexture,
+		MultiTextureMultiply,
+		Font,
+		Mask,
+		MaskMultiply,
+		Checkerboard,
+		Count
+	};
+
+	enum class SpriteVertexSource : u8
+	{
+		Quads,
+		Shapes,
+		Count
+	};
+
+	// NOTE: Backend neutral description of a single draw call, all indices refer to the vertex arrays of the owning SpriteDrawList
+	struct SpriteDrawCommand
+	{
+		SpriteShaderType Shader;
+		SpriteVertexSource VertexSource;
+		Graphics::PrimitiveType Primitive;
+		Graphics::AetBlendMode BlendMode;
+
+		// NOTE: Number of leading non-null TexViews, never zero
+		u32 TextureSlotCount;
+		std::array<TexSamplerView, MaxSpriteTextureSlots> TexViews;
+
+		// NOTE: May be nullptr, only sampled by SpriteShaderType::Mask and SpriteShaderType::MaskMultiply
+		TexSamplerView MaskTexView;
+		vec2 CheckerboardSize;
+
+		// NOTE: First quad and quad count for SpriteVertexSource::Quads, first vertex and vertex count for SpriteVertexSource::Shapes
+		u32 FirstElement;
+		u32 ElementCount;
+	};
+
+	// NOTE: Non-owning view of a flushed batch, only valid until the next SpriteBatchBuilder modification
+	struct SpriteDrawList
+	{
+		const SpriteDrawCommand* Commands;
+		size_t CommandCount;
+
+		const SpriteQuadVertices* QuadVertices;
+		size_t QuadCount;
+
+		const SpriteVertex* ShapeVertices;
+		size_t ShapeVertexCount;
+	};
 }
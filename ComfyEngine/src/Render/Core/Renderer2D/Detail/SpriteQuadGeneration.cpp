@@ -0,0 +1,153 @@
+#include "SpriteQuadGeneration.h"
+
+#if COMFY_SPRITE_QUAD_GENERATION_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace Comfy::Render::Detail
+{
+	void GenerateQuadPositionsScalar(const SpriteQuadTransformsView& transforms, SpriteQuadVertices* outQuads)
+	{
+		for (size_t i = 0; i < transforms.Count; i++)
+		{
+			outQuads[i].SetPositions(
+				vec2(transforms.PositionX[i], transforms.PositionY[i]),
+				vec2(transforms.SizeX[i], transforms.SizeY[i]),
+				vec2(transforms.OriginX[i], transforms.OriginY[i]),
+				transforms.Rotation[i]);
+		}
+	}
+
+#if COMFY_SPRITE_QUAD_GENERATION_SIMD
+	namespace
+	{
+		// NOTE: Cephes style sin / cos, reduced to [-PI/4, PI/4] by quadrant with a three part Cody-Waite reduction.
+		//		 Accurate to roughly one float ULP for the angle ranges used by sprites
+		inline void SinCos4(__m128 radians, __m128& outSin, __m128& outCos)
+		{
+			const __m128 quadrant = _mm_mul_ps(radians, _mm_set1_ps(0.636619772367581343f));
+			const __m128i quadrantIndex = _mm_cvtps_epi32(quadrant);
+			const __m128 quadrantRounded = _mm_cvtepi32_ps(quadrantIndex);
+
+			__m128 x = radians;
+			x = _mm_sub_ps(x, _mm_mul_ps(quadrantRounded, _mm_set1_ps(1.5703125f)));
+			x = _mm_sub_ps(x, _mm_mul_ps(quadrantRounded, _mm_set1_ps(4.837512969970703125e-4f)));
+			x = _mm_sub_ps(x, _mm_mul_ps(quadrantRounded, _mm_set1_ps(7.54978995489188216e-8f)));
+
+			const __m128 x2 = _mm_mul_ps(x, x);
+
+			__m128 sinPoly = _mm_set1_ps(-1.9515295891e-4f);
+			sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, x2), _mm_set1_ps(8.3321608736e-3f));
+			sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, x2), _mm_set1_ps(-1.6666654611e-1f));
+			sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, x2), x), x);
+
+			__m128 cosPoly = _mm_set1_ps(2.443315711809948e-5f);
+			cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, x2), _mm_set1_ps(-1.388731625493765e-3f));
+			cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, x2), _mm_set1_ps(4.166664568298827e-2f));
+			cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, x2), x2);
+			cosPoly = _mm_add_ps(_mm_sub_ps(cosPoly, _mm_mul_ps(x2, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+			// NOTE: Odd quadrants swap sin and cos, the sign bits follow the quadrant pattern (s, c), (c, -s), (-s, -c), (-c, s)
+			const __m128 swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrantIndex, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+			const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrantIndex, _mm_set1_epi32(2)), 30));
+			const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrantIndex, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+			const __m128 sinResult = _mm_or_ps(_mm_and_ps(swapMask, cosPoly), _mm_andnot_ps(swapMask, sinPoly));
+			const __m128 cosResult = _mm_or_ps(_mm_and_ps(swapMask, sinPoly), _mm_andnot_ps(swapMask, cosPoly));
+
+			outSin = _mm_xor_ps(sinResult, sinSign);
+			outCos = _mm_xor_ps(cosResult, cosSign);
+		}
+
+		// NOTE: Interleaves four X and four Y components and writes them to the same vertex position of four consecutive quads
+		inline void StoreVertexPositions4(SpriteQuadVertices* outQuads, size_t vertexIndex, __m128 x, __m128 y)
+		{
+			const __m128 xy01 = _mm_unpacklo_ps(x, y);
+			const __m128 xy23 = _mm_unpackhi_ps(x, y);
+
+			_mm_storel_pi(reinterpret_cast<__m64*>(&(&outQuads[0].TopLeft)[vertexIndex].Position), xy01);
+			_mm_storeh_pi(reinterpret_cast<__m64*>(&(&outQuads[1].TopLeft)[vertexIndex].Position), xy01);
+			_mm_storel_pi(reinterpret_cast<__m64*>(&(&outQuads[2].TopLeft)[vertexIndex].Position), xy23);
+			_mm_storeh_pi(reinterpret_cast<__m64*>(&(&outQuads[3].TopLeft)[vertexIndex].Position), xy23);
+		}
+	}
+
+	void GenerateQuadPositionsSIMD(const SpriteQuadTransformsView& transforms, SpriteQuadVertices* outQuads)
+	{
+		enum { TopLeft = 0, TopRight = 1, BottomLeft = 2, BottomRight = 3 };
+		const __m128 degreesToRadians = _mm_set1_ps(glm::pi<f32>() / 180.0f);
+
+		size_t i = 0;
+		for (; (i + 4) <= transforms.Count; i += 4)
+		{
+			const __m128 positionX = _mm_loadu_ps(&transforms.PositionX[i]);
+			const __m128 positionY = _mm_loadu_ps(&transforms.PositionY[i]);
+			const __m128 originX = _mm_loadu_ps(&transforms.OriginX[i]);
+			const __m128 originY = _mm_loadu_ps(&transforms.OriginY[i]);
+			const __m128 sizeX = _mm_loadu_ps(&transforms.SizeX[i]);
+			const __m128 sizeY = _mm_loadu_ps(&transforms.SizeY[i]);
+			const __m128 rotation = _mm_loadu_ps(&transforms.Rotation[i]);
+
+			__m128 sin, cos;
+			SinCos4(_mm_mul_ps(rotation, degreesToRadians), sin, cos);
+
+			const __m128 left = originX, right = _mm_add_ps(originX, sizeX);
+			const __m128 top = originY, bottom = _mm_add_ps(originY, sizeY);
+
+			// NOTE: Same operation order as the scalar version
+			const __m128 leftCos = _mm_mul_ps(left, cos), leftSin = _mm_mul_ps(left, sin);
+			const __m128 rightCos = _mm_mul_ps(right, cos), rightSin = _mm_mul_ps(right, sin);
+			const __m128 topCos = _mm_mul_ps(top, cos), topSin = _mm_mul_ps(top, sin);
+			const __m128 bottomCos = _mm_mul_ps(bottom, cos), bottomSin = _mm_mul_ps(bottom, sin);
+
+			__m128 topLeftX = _mm_sub_ps(_mm_add_ps(positionX, leftCos), topSin), topLeftY = _mm_add_ps(_mm_add_ps(positionY, leftSin), topCos);
+			__m128 topRightX = _mm_sub_ps(_mm_add_ps(positionX, rightCos), topSin), topRightY = _mm_add_ps(_mm_add_ps(positionY, rightSin), topCos);
+			__m128 bottomLeftX = _mm_sub_ps(_mm_add_ps(positionX, leftCos), bottomSin), bottomLeftY = _mm_add_ps(_mm_add_ps(positionY, leftSin), bottomCos);
+			__m128 bottomRightX = _mm_sub_ps(_mm_add_ps(positionX, rightCos), bottomSin), bottomRightY = _mm_add_ps(_mm_add_ps(positionY, rightSin), bottomCos);
+
+			// NOTE: Unrotated quads (most text and UI sprites) take the SetPositionsNoRotation() route in the scalar version,
+			//		 blend in the exact same results for those lanes so that both implementations are bit identical for them
+			const __m128 unrotatedMask = _mm_cmpeq_ps(rotation, _mm_setzero_ps());
+			if (_mm_movemask_ps(unrotatedMask) != 0)
+			{
+				const __m128 unrotatedLeft = _mm_add_ps(positionX, originX), unrotatedRight = _mm_add_ps(unrotatedLeft, sizeX);
+				const __m128 unrotatedTop = _mm_add_ps(positionY, originY), unrotatedBottom = _mm_add_ps(unrotatedTop, sizeY);
+
+				const auto select = [&](__m128 unrotated, __m128 rotated) { return _mm_or_ps(_mm_and_ps(unrotatedMask, unrotated), _mm_andnot_ps(unrotatedMask, rotated)); };
+				topLeftX = select(unrotatedLeft, topLeftX); topLeftY = select(unrotatedTop, topLeftY);
+				topRightX = select(unrotatedRight, topRightX); topRightY = select(unrotatedTop, topRightY);
+				bottomLeftX = select(unrotatedLeft, bottomLeftX); bottomLeftY = select(unrotatedBottom, bottomLeftY);
+				bottomRightX = select(unrotatedRight, bottomRightX); bottomRightY = select(unrotatedBottom, bottomRightY);
+			}
+
+			StoreVertexPositions4(&outQuads[i], TopLeft, topLeftX, topLeftY);
+			StoreVertexPositions4(&outQuads[i], TopRight, topRightX, topRightY);
+			StoreVertexPositions4(&outQuads[i], BottomLeft, bottomLeftX, bottomLeftY);
+			StoreVertexPositions4(&outQuads[i], BottomRight, bottomRightX, bottomRightY);
+		}
+
+		if (i < transforms.Count)
+		{
+			SpriteQuadTransformsView remainder = transforms;
+			remainder.Count = (transforms.Count - i);
+			remainder.PositionX += i;
+			remainder.PositionY += i;
+			remainder.OriginX += i;
+			remainder.OriginY += i;
+			remainder.SizeX += i;
+			remainder.SizeY += i;
+			remainder.Rotation += i;
+			GenerateQuadPositionsScalar(remainder, &outQuads[i]);
+		}
+	}
+#endif
+
+	void GenerateQuadPositions(const SpriteQuadTransformsView& transforms, SpriteQuadVertices* outQuads)
+	{
+#if COMFY_SPRITE_QUAD_GENERATION_SIMD
+		GenerateQuadPositionsSIMD(transforms, outQuads);
+#else
+		GenerateQuadPositionsScalar(transforms, outQuads);
+#endif
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Types.h"
+#include "SpriteBatchData.h"
+#include <array>
+
+// NOTE: SSE2 is part of the x64 baseline so there is no need for any runtime CPU feature detection
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define COMFY_SPRITE_QUAD_GENERATION_SIMD 1
+#else
+#define COMFY_SPRITE_QUAD_GENERATION_SIMD 0
+#endif
+
+namespace Comfy::Render::Detail
+{
+	// NOTE: Structure of arrays view of many quad transforms, each array must contain at least Count elements.
+	//		 Sizes and origins are expected to already be scaled and the rotation is in degrees, matching SpriteQuadVertices::SetPositions()
+	struct SpriteQuadTransformsView
+	{
+		size_t Count;
+
+		const f32* PositionX;
+		const f32* PositionY;
+		const f32* OriginX;
+		const f32* OriginY;
+		const f32* SizeX;
+		const f32* SizeY;
+		const f32* Rotation;
+	};
+
+	// NOTE: Fixed size storage for gathering quad transforms before generating their vertices in a single pass
+	struct SpriteQuadTransformsBuffer
+	{
+		static constexpr size_t Capacity = 256;
+
+		alignas(16) std::array<f32, Capacity> PositionX;
+		alignas(16) std::array<f32, Capacity> PositionY;
+		alignas(16) std::array<f32, Capacity> OriginX;
+		alignas(16) std::array<f32, Capacity> OriginY;
+		alignas(16) std::array<f32, Capacity> SizeX;
+		alignas(16) std::array<f32, Capacity> SizeY;
+		alignas(16) std::array<f32, Capacity> Rotation;
+
+		void Set(size_t index, vec2 position, vec2 size, vec2 origin, float rotation)
+		{
+			PositionX[index] = position.x;
+			PositionY[index] = position.y;
+			OriginX[index] = origin.x;
+			OriginY[index] = origin.y;
+			SizeX[index] = size.x;
+			SizeY[index] = size.y;
+			Rotation[index] = rotation;
+		}
+
+		SpriteQuadTransformsView View(size_t count) const
+		{
+			assert(count <= Capacity);
+			return { count, PositionX.data(), PositionY.data(), OriginX.data(), OriginY.data(), SizeX.data(), SizeY.data(), Rotation.data() };
+		}
+	};
+
+	// NOTE: Only writes the vertex positions, leaving all other vertex attributes untouched.
+	//		 The scalar version calls SpriteQuadVertices::SetPositions() for each quad and serves as the reference implementation
+	void GenerateQuadPositionsScalar(const SpriteQuadTransformsView& transforms, SpriteQuadVertices* outQuads);
+
+#if COMFY_SPRITE_QUAD_GENERATION_SIMD
+	// NOTE: Processes four quads at a time including a vectorized sin / cos. Unrotated quads are bit identical to the scalar version,
+	//		 rotated ones may differ by a few ULPs due to the sin / cos approximation
+	void GenerateQuadPositionsSIMD(const SpriteQuadTransformsView& transforms, SpriteQuadVertices* outQuads);
+#endif
+
+	// NOTE: Uses the fastest available implementation
+	void GenerateQuadPositions(const SpriteQuadTransformsView& transforms, SpriteQuadVertices* outQuads);
+}
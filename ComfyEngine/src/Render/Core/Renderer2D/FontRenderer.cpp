@@ -34,7 +34,7 @@ namespace Comfy::Render
 		Render::RenderCommand2D command;
 		command.BlendMode = currentBlendMode;
 		command.SetColor(vec4(color, transform.Opacity));
-		DrawInternal(font, text, transform, command);
+		DrawInternal(font, FindOrCreateTextLayout(font, text), transform, command);
 	}
 
 	void FontRenderer::DrawBorder(const Graphics::BitmapFont& font, std::string_view text, const Graphics::Transform2D& transform, vec3 color)
@@ -43,7 +43,7 @@ namespace Comfy::Render
 		command.BlendMode = currentBlendMode;
 		command.DrawTextBorder = true;
 		command.SetColor(vec4(color, transform.Opacity));
-		DrawInternal(font, text, transform, command);
+		DrawInternal(font, FindOrCreateTextLayout(font, text), transform, command);
 	}
 
 	void FontRenderer::DrawShadow(const Graphics::BitmapFont& font, std::string_view text, const Graphics::Transform2D& transform, vec3 color, vec4 shadowColor, vec2 offset)
@@ -54,12 +54,14 @@ namespace Comfy::Render
 		auto shadowTransform = transform;
 		shadowTransform.Origin -= offset;
 
+		const auto& layout = FindOrCreateTextLayout(font, text);
+
 		shadowColor.a *= transform.Opacity;
 		command.SetColor(shadowColor);
-		DrawInternal(font, text, shadowTransform, command);
+		DrawInternal(font, layout, shadowTransform, command);
 
 		command.SetColor(vec4(color, transform.Opacity));
-		DrawInternal(font, text, transform, command);
+		DrawInternal(font, layout, transform, command);
 	}
 
 	Graphics::AetBlendMode FontRenderer::GetBlendMode() const
@@ -73,8 +75,105 @@ namespace Comfy::Render
 	}
 
 	vec2 FontRenderer::Measure(const Graphics::BitmapFont& font, std::string_view text) const
+	{
+		return FindOrCreateTextLayout(font, text).Size;
+	}
+
+	void FontRenderer::ClearLayoutCache()
+	{
+		layoutCacheEntries.clear();
+		layoutCacheLookup.clear();
+		layoutCacheStatistics.EntryCount = 0;
+	}
+
+	bool FontRenderer::GetLayoutCacheEnabled() const
+	{
+		return layoutCacheEnabled;
+	}
+
+	void FontRenderer::SetLayoutCacheEnabled(bool value)
+	{
+		if (!value)
+			ClearLayoutCache();
+
+		layoutCacheEnabled = value;
+	}
+
+	FontRenderer::LayoutCacheStatistics FontRenderer::GetLayoutCacheStatistics() const
+	{
+		return layoutCacheStatistics;
+	}
+
+	void FontRenderer::ResetLayoutCacheStatistics()
+	{
+		layoutCacheStatistics = {};
+		layoutCacheStatistics.EntryCount = layoutCacheEntries.size();
+	}
+
+	const FontRenderer::TextLayout& FontRenderer::FindOrCreateTextLayout(const Graphics::BitmapFont& font, std::string_view text) const
+	{
+		if (!layoutCacheEnabled)
+		{
+			LayoutText(font, text, uncachedLayout);
+			return uncachedLayout;
+		}
+
+		const auto fontSize = font.GetFontSize();
+		const auto glyphSize = font.GetGlyphSize();
+		const size_t keyHash = std::hash<std::string_view>()(text) ^ (std::hash<const void*>()(&font) * 31);
+
+		auto matchesKey = [&](const CachedTextLayout& entry)
+		{
+			return (entry.Font == &font && entry.FontSize == fontSize && entry.GlyphSize == glyphSize && entry.Text == text);
+		};
+
+		auto entryToReplace = layoutCacheEntries.end();
+		if (auto foundLookup = layoutCacheLookup.find(keyHash); foundLookup != layoutCacheLookup.end())
+		{
+			const auto foundEntry = foundLookup->second;
+			layoutCacheEntries.splice(layoutCacheEntries.begin(), layoutCacheEntries, foundEntry);
+
+			if (matchesKey(*foundEntry))
+			{
+				layoutCacheStatistics.HitCount++;
+				return foundEntry->Layout;
+			}
+
+			// NOTE: Hash collision or a different font at the same address, simply overwrite the existing entry
+			entryToReplace = foundEntry;
+		}
+		else if (layoutCacheEntries.size() >= LayoutCacheCapacity)
+		{
+			// NOTE: Recycle the least recently used entry to also reuse its allocated glyph and string storage
+			entryToReplace = std::prev(layoutCacheEntries.end());
+			layoutCacheEntries.splice(layoutCacheEntries.begin(), layoutCacheEntries, entryToReplace);
+			layoutCacheLookup.erase(entryToReplace->KeyHash);
+			layoutCacheStatistics.EvictionCount++;
+		}
+		else
+		{
+			entryToReplace = layoutCacheEntries.emplace(layoutCacheEntries.begin());
+		}
+
+		layoutCacheStatistics.MissCount++;
+		layoutCacheStatistics.EntryCount = layoutCacheEntries.size();
+
+		auto& entry = *entryToReplace;
+		entry.KeyHash = keyHash;
+		entry.Font = &font;
+		entry.FontSize = fontSize;
+		entry.GlyphSize = glyphSize;
+		entry.Text.assign(text);
+		LayoutText(font, text, entry.Layout);
+
+		layoutCacheLookup[keyHash] = entryToReplace;
+		return entry.Layout;
+	}
+
+	void FontRenderer::LayoutText(const Graphics::BitmapFont& font, std::string_view text, TextLayout& outLayout) const
 	{
 		const auto fontSize = vec2(font.GetFontSize());
+		const auto glyphSize = vec2(font.GetGlyphSize());
 
 		const std::array<vec2, 2> glpyhAdvance =
 		{
@@ -82,6 +181,8 @@ namespace Comfy::Render
 			fontSize * vec2(0.5f, 1.0f),
 		};
 
+		outLayout.Glyphs.clear();
+
 		vec2 cursorOffset = {}, textSize = {};
 		ForEachUTF8Char32(text, [&](char32_t character)
 		{
@@ -92,51 +193,41 @@ namespace Comfy::Render
 			if (glyph == nullptr)
 				return true;
 
+			auto& laidOutGlyph = outLayout.Glyphs.emplace_back();
+			laidOutGlyph.CursorOffset = cursorOffset;
+			laidOutGlyph.SourceOffset = vec2(glyphSize.x * glyph->Row, glyphSize.y * glyph->Column);
+
 			cursorOffset.x += glpyhAdvance[glyph->IsNarrow].x;
 			if (cursorOffset.x > textSize.x) textSize.x = cursorOffset.x;
 			if (cursorOffset.y > textSize.y) textSize.y = cursorOffset.y;
 			return true;
 		});
 
-		return vec2(textSize.x, textSize.y + fontSize.y);
+		outLayout.Size = vec2(textSize.x, textSize.y + fontSize.y);
 	}
 
-	void FontRenderer::DrawInternal(const Graphics::BitmapFont& font, std::string_view text, const Graphics::Transform2D& transform, RenderCommand2D& command)
+	void FontRenderer::DrawInternal(const Graphics::BitmapFont& font, const TextLayout& layout, const Graphics::Transform2D& transform, RenderCommand2D& command)
 	{
 		const auto fontSize = vec2(font.GetFontSize());
-		const auto glyphSize = vec2(font.GetGlyphSize());
 
 		command.TexView = font.Texture.get();
 		command.Rotation = transform.Rotation;
 		command.Scale = transform.Scale;
 		command.SourceRegion.z = fontSize.x;
 		command.SourceRegion.w = fontSize.y;
+		command.Position = transform.Position;
 
-		const std::array<vec2, 2> glpyhAdvance =
+		glyphCommands.resize(layout.Glyphs.size());
+		for (size_t i = 0; i < layout.Glyphs.size(); i++)
 		{
-			fontSize,
-			fontSize * vec2(0.5f, 1.0f),
-		};
-
-		vec2 cursorOffset = {};
-		ForEachUTF8Char32(text, [&](char32_t character)
-		{
-			if (ProcessControlCharacters(character, cursorOffset, fontSize))
-				return true;
-
-			const auto glyph = font.GetGlyph(character);
-			if (glyph == nullptr)
-				return true;
-
-			command.Position = transform.Position;
-			command.Origin = transform.Origin - cursorOffset;
-			command.SourceRegion.x = font.SpritePixelRegion.x + (glyphSize.x * glyph->Row);
-			command.SourceRegion.y = font.SpritePixelRegion.y + (glyphSize.y * glyph->Column);
-			renderer2D.Draw(command);
+			auto& glyphCommand = glyphCommands[i];
+			glyphCommand = command;
+			glyphCommand.Origin = transform.Origin - layout.Glyphs[i].CursorOffset;
+			glyphCommand.SourceRegion.x = font.SpritePixelRegion.x + layout.Glyphs[i].SourceOffset.x;
+			glyphCommand.SourceRegion.y = font.SpritePixelRegion.y + layout.Glyphs[i].SourceOffset.y;
+		}
 
-			cursorOffset.x += glpyhAdvance[glyph->IsNarrow].x;
-			return true;
-		});
+		renderer2D.Draw(glyphCommands.data(), glyphCommands.size());
 	}
 
 	bool FontRenderer::ProcessControlCharacters(char32_t character, vec2& cursorOffset, vec2 fontSize) const
@@ -2,11 +2,14 @@
 #include "Types.h"
 #include "Graphics/Auth2D/Font/FontMap.h"
 #include "Graphics/Auth2D/Transform2D.h"
+#include "RenderCommand2D.h"
+#include <vector>
+#include <list>
+#include <unordered_map>
 
 namespace Comfy::Render
 {
 	class Renderer2D;
-	struct RenderCommand2D;
 
 	class FontRenderer : NonCopyable
 	{
@@ -15,6 +18,17 @@ namespace Comfy::Render
 		static constexpr vec4 DefaultShadowColor = vec4(0.0f, 0.0f, 0.0f, 1.0f);
 		static constexpr vec2 DefaultShadowOffset = vec2(2.0f, 2.0f);
 
+		// NOTE: Enough for all static labels of a typical menu or HUD while still keeping the memory usage negligible
+		static constexpr size_t LayoutCacheCapacity = 512;
+
+		struct LayoutCacheStatistics
+		{
+			u64 HitCount;
+			u64 MissCount;
+			u64 EvictionCount;
+			size_t EntryCount;
+		};
+
 	public:
 		FontRenderer(Renderer2D& renderer);
 		~FontRenderer() = default;
@@ -32,12 +46,60 @@ namespace Comfy::Render
 
 		vec2 Measure(const Graphics::BitmapFont& font, std::string_view text) const;
 
+	public:
+		// NOTE: Cached layouts are keyed by the font address so the cache has to be cleared whenever a font is destroyed and another one might take its place
+		void ClearLayoutCache();
+
+		bool GetLayoutCacheEnabled() const;
+		void SetLayoutCacheEnabled(bool value);
+
+		LayoutCacheStatistics GetLayoutCacheStatistics() const;
+		void ResetLayoutCacheStatistics();
+
 	private:
-		void DrawInternal(const Graphics::BitmapFont& font, std::string_view text, const Graphics::Transform2D& transform, RenderCommand2D& command);
+		struct LaidOutGlyph
+		{
+			vec2 CursorOffset;
+			// NOTE: Relative to the font sprite region which is only added while drawing
+			vec2 SourceOffset;
+		};
+
+		// NOTE: Only depends on the font and the text itself, independent of the transform, color and draw variant
+		struct TextLayout
+		{
+			std::vector<LaidOutGlyph> Glyphs;
+			vec2 Size;
+		};
+
+		struct CachedTextLayout
+		{
+			size_t KeyHash;
+			const Graphics::BitmapFont* Font;
+			ivec2 FontSize, GlyphSize;
+			std::string Text;
+			TextLayout Layout;
+		};
+
+		const TextLayout& FindOrCreateTextLayout(const Graphics::BitmapFont& font, std::string_view text) const;
+		void LayoutText(const Graphics::BitmapFont& font, std::string_view text, TextLayout& outLayout) const;
+
+		void DrawInternal(const Graphics::BitmapFont& font, const TextLayout& layout, const Graphics::Transform2D& transform, RenderCommand2D& command);
 		bool ProcessControlCharacters(char32_t character, vec2& cursorOffset, vec2 fontSize) const;
 
 	private:
 		Renderer2D& renderer2D;
 		Graphics::AetBlendMode currentBlendMode = Graphics::AetBlendMode::Normal;
+
+		// NOTE: Reused between calls to submit all glyphs of a string as a single batch
+		std::vector<RenderCommand2D> glyphCommands;
+
+		// NOTE: Ordered from most to least recently used so that the last entry is always the one to be evicted next
+		bool layoutCacheEnabled = true;
+		mutable std::list<CachedTextLayout> layoutCacheEntries;
+		mutable std::unordered_map<size_t, std::list<CachedTextLayout>::iterator> layoutCacheLookup;
+		mutable LayoutCacheStatistics layoutCacheStatistics = {};
+
+		// NOTE: Reused for every layout while the cache is disabled
+		mutable TextLayout uncachedLayout;
 	};
 }
@@ -17,15 +17,29 @@ namespace Comfy::Render
 		vec4 Color;
 	};
 
+	struct Renderer2DDrawStatistics
+	{
+		u32 SubmitCount;
+		u32 DrawCallCount;
+		u32 QuadCount;
+		u32 ShapeVertexCount;
+	};
+
+	class IRenderer2DBackend;
+
 	class Renderer2D : NonCopyable
 	{
 	public:
 		Renderer2D();
+		// NOTE: Use a specific backend instead of the default D3D11 one, for example a RecordingRenderer2DBackend for headless benchmarking
+		explicit Renderer2D(std::unique_ptr<IRenderer2DBackend> backend);
 		~Renderer2D();
 
 	public:
 		void Begin(Camera2D& camera, RenderTarget2D& renderTarget);
 		void Draw(const RenderCommand2D& command);
+		// NOTE: Equivalent to drawing each command individually but generates the vertex positions of the whole range in SIMD batches
+		void Draw(const RenderCommand2D* commands, size_t commandCount);
 		void Draw(const RenderCommand2D& command, const RenderCommand2D& commandMask);
 
 		void DrawLine(vec2 start, vec2 end, const vec4& color, float thickness = 1.0f);
@@ -52,8 +66,19 @@ namespace Comfy::Render
 		void UploadToGPUFreeCPUMemory(Graphics::Tex& tex);
 	
 	public:
+		// NOTE: Creates a render target for the default D3D11 backend, see IRenderer2DBackend::CreateRenderTarget() for any other backend
 		static std::unique_ptr<RenderTarget2D> CreateRenderTarget();
 
+		IRenderer2DBackend& GetBackend();
+
+	public:
+		// NOTE: Reorder non overlapping sprites by render state before batching to reduce the number of draw calls, disabled by default
+		bool GetSortAndMergeBatches() const;
+		void SetSortAndMergeBatches(bool value);
+
+		// NOTE: Statistics of the last completed Begin() / End() block, independent of the backend used
+		const Renderer2DDrawStatistics& GetLastFrameStatistics() const;
+
 	public:
 		// NOTE: Only valid between a Begin() / End() call
 		const Camera2D& GetCamera() const;
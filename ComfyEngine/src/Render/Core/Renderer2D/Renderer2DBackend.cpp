@@ -0,0 +1,117 @@
+#include "Renderer2DBackend.h"
+
+namespace Comfy::Render
+{
+	namespace
+	{
+		class NullRenderTarget2D final : public RenderTarget2D
+		{
+		public:
+			NullRenderTarget2D() = default;
+			~NullRenderTarget2D() = default;
+
+		public:
+			ComfyTextureID GetTextureID() const override { return ComfyTextureID(); }
+
+		public:
+			std::unique_ptr<u8[]> TakeScreenshot() override { return nullptr; }
+		};
+	}
+
+	void RecordingRenderer2DBackend::Begin(Camera2D& camera, RenderTarget2D& renderTarget)
+	{
+		assert(!isInsideFrame);
+		isInsideFrame = true;
+
+		currentFrame = {};
+		currentFrameDrawCommands.clear();
+	}
+
+	void RecordingRenderer2DBackend::Submit(const Detail::SpriteDrawList& drawList)
+	{
+		assert(isInsideFrame);
+
+		currentFrame.SubmitCount++;
+		currentFrame.DrawCallCount += static_cast<u32>(drawList.CommandCount);
+		currentFrame.QuadCount += static_cast<u32>(drawList.QuadCount);
+		currentFrame.ShapeVertexCount += static_cast<u32>(drawList.ShapeVertexCount);
+
+#if COMFY_DEBUG
+		for (size_t i = 0; i < drawList.CommandCount; i++)
+		{
+			const auto& command = drawList.Commands[i];
+			const auto elementLimit = (command.VertexSource == Detail::SpriteVertexSource::Quads) ? drawList.QuadCount : drawList.ShapeVertexCount;
+
+			assert(command.TextureSlotCount > 0 && command.TextureSlotCount <= MaxSpriteTextureSlots);
+			assert(command.ElementCount > 0 && (command.FirstElement + command.ElementCount) <= elementLimit);
+		}
+#endif
+
+		if (recordDrawCommands)
+			currentFrameDrawCommands.insert(currentFrameDrawCommands.end(), drawList.Commands, drawList.Commands + drawList.CommandCount);
+	}
+
+	void RecordingRenderer2DBackend::End()
+	{
+		assert(isInsideFrame);
+		isInsideFrame = false;
+
+		frameCount++;
+		lastFrame = currentFrame;
+		total.SubmitCount += currentFrame.SubmitCount;
+		total.DrawCallCount += currentFrame.DrawCallCount;
+		total.QuadCount += currentFrame.QuadCount;
+		total.ShapeVertexCount += currentFrame.ShapeVertexCount;
+
+		if (recordDrawCommands)
+			std::swap(lastFrameDrawCommands, currentFrameDrawCommands);
+	}
+
+	void RecordingRenderer2DBackend::UploadToGPUFreeCPUMemory(Graphics::Tex& tex)
+	{
+		// NOTE: Intentionally left blank, there is no GPU to upload to so the CPU copy has to stay
+	}
+
+	std::unique_ptr<RenderTarget2D> RecordingRenderer2DBackend::CreateRenderTarget()
+	{
+		return std::make_unique<NullRenderTarget2D>();
+	}
+
+	const Renderer2DDrawStatistics& RecordingRenderer2DBackend::GetLastFrameStatistics() const
+	{
+		return lastFrame;
+	}
+
+	const Renderer2DDrawStatistics& RecordingRenderer2DBackend::GetTotalStatistics() const
+	{
+		return total;
+	}
+
+	u32 RecordingRenderer2DBackend::GetFrameCount() const
+	{
+		return frameCount;
+	}
+
+	void RecordingRenderer2DBackend::ResetStatistics()
+	{
+		frameCount = 0;
+		lastFrame = {};
+		total = {};
+		lastFrameDrawCommands.clear();
+	}
+
+	bool RecordingRenderer2DBackend::GetRecordDrawCommands() const
+	{
+		return recordDrawCommands;
+	}
+
+	void RecordingRenderer2DBackend::SetRecordDrawCommands(bool value)
+	{
+		recordDrawCommands = value;
+	}
+
+	const std::vector<Detail::SpriteDrawCommand>& RecordingRenderer2DBackend::GetLastFrameDrawCommands() const
+	{
+		return lastFrameDrawCommands;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "Types.h"
+#include "Renderer2D.h"
+#include "RenderTarget2D.h"
+#include "Render/Core/Camera.h"
+#include "Detail/SpriteBatchData.h"
+#include <vector>
+
+namespace Comfy::Render
+{
+	// NOTE: Graphics API specific part of the Renderer2D. All sprite batching has already been done by the front-end at this point
+	//		 so a backend only has to translate the backend neutral draw commands into the equivalent state changes and draw calls
+	class IRenderer2DBackend : NonCopyable
+	{
+	public:
+		IRenderer2DBackend() = default;
+		virtual ~IRenderer2DBackend() = default;
+
+	public:
+		virtual void Begin(Camera2D& camera, RenderTarget2D& renderTarget) = 0;
+		virtual void Submit(const Detail::SpriteDrawList& drawList) = 0;
+		virtual void End() = 0;
+
+	public:
+		virtual void UploadToGPUFreeCPUMemory(Graphics::Tex& tex) = 0;
+		virtual std::unique_ptr<RenderTarget2D> CreateRenderTarget() = 0;
+	};
+
+	// NOTE: Null backend that never touches the GPU and only records what would have been drawn.
+	//		 Used for headless benchmarking of the real AetRenderer / FontRenderer code paths and validating the batching output
+	class RecordingRenderer2DBackend final : public IRenderer2DBackend
+	{
+	public:
+		RecordingRenderer2DBackend() = default;
+		~RecordingRenderer2DBackend() = default;
+
+	public:
+		void Begin(Camera2D& camera, RenderTarget2D& renderTarget) override;
+		void Submit(const Detail::SpriteDrawList& drawList) override;
+		void End() override;
+
+	public:
+		void UploadToGPUFreeCPUMemory(Graphics::Tex& tex) override;
+		std::unique_ptr<RenderTarget2D> CreateRenderTarget() override;
+
+	public:
+		// NOTE: Statistics of the last completed Begin() / End() block
+		const Renderer2DDrawStatistics& GetLastFrameStatistics() const;
+		// NOTE: Accumulated statistics of all completed frames since the last reset
+		const Renderer2DDrawStatistics& GetTotalStatistics() const;
+		u32 GetFrameCount() const;
+		void ResetStatistics();
+
+		// NOTE: Optionally copy every submitted draw command of the current frame, disabled by default to keep the overhead minimal
+		bool GetRecordDrawCommands() const;
+		void SetRecordDrawCommands(bool value);
+		const std::vector<Detail::SpriteDrawCommand>& GetLastFrameDrawCommands() const;
+
+	private:
+		bool isInsideFrame = false;
+		bool recordDrawCommands = false;
+
+		u32 frameCount = 0;
+		Renderer2DDrawStatistics currentFrame = {}, lastFrame = {}, total = {};
+
+		std::vector<Detail::SpriteDrawCommand> currentFrameDrawCommands, lastFrameDrawCommands;
+	};
+
+	std::unique_ptr<IRenderer2DBackend> MakeD3D11Renderer2DBackend();
+}
@@ -0,0 +1,222 @@
+#include "RenderCommandPreparation.h"
+#include <future>
+#include <thread>
+
+namespace Comfy::Render::Detail
+{
+	namespace
+	{
+		template <typename T>
+		void AppendRange(std::vector<T>& destination, const std::vector<T>& source)
+		{
+			destination.insert(destination.end(), source.begin(), source.end());
+		}
+
+		u32 FloatBitsAsU32(float value)
+		{
+			u32 bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits;
+		}
+
+		// NOTE: Back to front with larger sub meshes first in case of equal depth, matching the previous std::sort comparison.
+		//		 Both the quantized depth and the (always positive) radius bit pattern are inverted so that an ascending radix sort results in descending order
+		u64 CreateDepthSortKey(float cameraDistance, float radius)
+		{
+			const float quantizedDistance = std::clamp(cameraDistance / RenderCommandPreparer::DepthQuantizationStep, 0.0f, static_cast<float>(std::numeric_limits<u32>::max() - 128));
+			const u32 depthBits = static_cast<u32>(quantizedDistance);
+			const u32 radiusBits = FloatBitsAsU32(Max(radius, 0.0f));
+
+			return (static_cast<u64>(~depthBits) << 32) | static_cast<u64>(~radiusBits);
+		}
+	}
+
+	void RenderPassDrawLists::Clear()
+	{
+		Opaque.clear();
+		Transparent.clear();
+		SubsurfaceScattering.clear();
+		ShadowCaster.clear();
+	}
+
+	void RenderCommandPreparer::Prepare(std::vector<ObjRenderCommand>& commands, const RenderCommandPreparationParam& param, RenderPassDrawLists& outLists)
+	{
+		assert(param.Camera != nullptr);
+
+		outLists.Clear();
+		lastStatistics = {};
+
+		if (commands.empty())
+			return;
+
+		const size_t maxUsefulTaskCount = Max<size_t>(1, commands.size() / MinCommandsPerTask);
+		const size_t taskCount = param.Multithreaded ? Min(Min(maxUsefulTaskCount, MaxTaskCount), Max<size_t>(1, std::thread::hardware_concurrency())) : 1;
+
+		if (taskCount <= 1)
+		{
+			PrepareCommandRange(commands.data(), commands.size(), param, outLists, lastStatistics);
+			lastStatistics.TaskCount = 1;
+		}
+		else
+		{
+			taskLists.resize(taskCount);
+			taskStatistics.assign(taskCount, {});
+
+			// NOTE: Each task writes to its own lists which are then concatenated in task order so the result is identical to the single threaded one
+			const size_t commandsPerTask = (commands.size() + taskCount - 1) / taskCount;
+			std::array<std::future<void>, MaxTaskCount> taskFutures;
+
+			for (size_t taskIndex = 0; taskIndex < taskCount; taskIndex++)
+			{
+				const size_t rangeStart = Min(taskIndex * commandsPerTask, commands.size());
+				const size_t rangeCount = Min(commandsPerTask, commands.size() - rangeStart);
+
+				auto& lists = taskLists[taskIndex];
+				lists.Clear();
+
+				auto prepareRange = [this, &commands, &param, &lists, &statistics = taskStatistics[taskIndex], rangeStart, rangeCount]
+				{
+					PrepareCommandRange(commands.data() + rangeStart, rangeCount, param, lists, statistics);
+				};
+
+				// NOTE: Let the calling thread do its share of the work instead of idling
+				if (taskIndex == 0)
+					continue;
+
+				taskFutures[taskIndex] = std::async(std::launch::async, prepareRange);
+			}
+
+			PrepareCommandRange(commands.data(), Min(commandsPerTask, commands.size()), param, taskLists[0], taskStatistics[0]);
+
+			for (size_t taskIndex = 1; taskIndex < taskCount; taskIndex++)
+				taskFutures[taskIndex].get();
+
+			for (size_t taskIndex = 0; taskIndex < taskCount; taskIndex++)
+			{
+				const auto& lists = taskLists[taskIndex];
+				AppendRange(outLists.Opaque, lists.Opaque);
+				AppendRange(outLists.Transparent, lists.Transparent);
+				AppendRange(outLists.SubsurfaceScattering, lists.SubsurfaceScattering);
+				AppendRange(outLists.ShadowCaster, lists.ShadowCaster);
+
+				const auto& statistics = taskStatistics[taskIndex];
+				lastStatistics.ObjectsCulled += statistics.ObjectsCulled;
+				lastStatistics.MeshesCulled += statistics.MeshesCulled;
+				lastStatistics.SubMeshesCulled += statistics.SubMeshesCulled;
+			}
+
+			lastStatistics.TaskCount = static_cast<u32>(taskCount);
+		}
+
+		if (param.AlphaSort)
+			SortTransparentBackToFront(outLists.Transparent);
+	}
+
+	const RenderCommandPreparationStatistics& RenderCommandPreparer::GetLastStatistics() const
+	{
+		return lastStatistics;
+	}
+
+	void RenderCommandPreparer::PrepareCommandRange(ObjRenderCommand* commands, size_t commandCount, const RenderCommandPreparationParam& param, RenderPassDrawLists& outLists, RenderCommandPreparationStatistics& outStatistics) const
+	{
+		const Camera3D& camera = *param.Camera;
+		const auto isVisible = [&](const Graphics::Sphere& transformedSphere)
+		{
+			return (!param.FrustumCulling || camera.IntersectsViewFrustum(transformedSphere));
+		};
+
+		for (size_t commandIndex = 0; commandIndex < commandCount; commandIndex++)
+		{
+			auto& command = commands[commandIndex];
+			const auto& sourceCommand = command.SourceCommand;
+			const auto& transform = sourceCommand.Transform;
+
+			const bool objVisible = isVisible(sourceCommand.SourceObj->BoundingSphere * transform);
+			if (!objVisible)
+				outStatistics.ObjectsCulled++;
+
+			IterateCommandMeshes(sourceCommand, [&](const Graphics::Mesh& mesh)
+			{
+				const bool meshVisible = objVisible && isVisible(mesh.BoundingSphere * transform);
+				if (objVisible && !meshVisible)
+					outStatistics.MeshesCulled++;
+
+				IterateCommandSubMeshes(sourceCommand, mesh, [&](const Graphics::SubMesh& subMesh, const Graphics::Material& material)
+				{
+					// NOTE: Shadow casters are independent of the camera view and therefore have to be classified before culling
+					if (param.PrepareShadowCasters && CastsShadow(sourceCommand, mesh, subMesh, material))
+						outLists.ShadowCaster.push_back({ &command, &mesh, &subMesh, &material, 0.0f });
+
+					if (!meshVisible)
+						return;
+
+					const Graphics::Sphere transformedSphere = (subMesh.BoundingSphere * transform);
+					if (!isVisible(transformedSphere))
+					{
+						outStatistics.SubMeshesCulled++;
+						return;
+					}
+
+					if (param.PrepareSubsurfaceScattering && (UsesSSSSkin(material) || UsesSSSSkinConst(material)))
+						outLists.SubsurfaceScattering.push_back({ &command, &mesh, &subMesh, &material, 0.0f });
+
+					if (IsMeshTransparent(mesh, subMesh, material))
+						outLists.Transparent.push_back({ &command, &mesh, &subMesh, &material, glm::distance(transformedSphere.Center, camera.ViewPoint) });
+					else
+						outLists.Opaque.push_back({ &command, &mesh, &subMesh, &material, 0.0f });
+				});
+			});
+		}
+	}
+
+	void RenderCommandPreparer::SortTransparentBackToFront(std::vector<SubMeshRenderCommand>& transparent)
+	{
+		if (transparent.size() < 2)
+			return;
+
+		const size_t count = transparent.size();
+		sortEntries.resize(count);
+		sortEntriesScratch.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+			sortEntries[i] = { CreateDepthSortKey(transparent[i].CameraDistance, transparent[i].SubMesh->BoundingSphere.Radius), static_cast<u32>(i) };
+
+		// NOTE: Stable LSD radix sort over all eight key bytes, building every histogram in a single pass up front
+		constexpr size_t radixBits = 8, radixSize = (1 << radixBits), passCount = (sizeof(u64) * 8 / radixBits);
+		std::array<std::array<u32, radixSize>, passCount> histograms = {};
+
+		for (const auto& entry : sortEntries)
+		{
+			for (size_t pass = 0; pass < passCount; pass++)
+				histograms[pass][(entry.Key >> (pass * radixBits)) & (radixSize - 1)]++;
+		}
+
+		for (size_t pass = 0; pass < passCount; pass++)
+		{
+			auto& histogram = histograms[pass];
+
+			// NOTE: Skip passes where all keys share the same digit, this is the case for most of the upper depth bytes
+			if (histogram[(sortEntries[0].Key >> (pass * radixBits)) & (radixSize - 1)] == count)
+				continue;
+
+			u32 offset = 0;
+			for (auto& bucket : histogram)
+			{
+				const u32 bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (const auto& entry : sortEntries)
+				sortEntriesScratch[histogram[(entry.Key >> (pass * radixBits)) & (radixSize - 1)]++] = entry;
+
+			std::swap(sortEntries, sortEntriesScratch);
+		}
+
+		sortedScratch.resize(count);
+		for (size_t i = 0; i < count; i++)
+			sortedScratch[i] = transparent[sortEntries[i].Index];
+
+		std::swap(transparent, sortedScratch);
+	}
+}
@@ -0,0 +1,215 @@
+#pragma once
+#include "Types.h"
+#include "Render/Core/Camera.h"
+#include "Render/Core/Renderer3D/RenderCommand3D.h"
+#include "MeshTransparency.h"
+#include "SubsurfaceScatteringMaterial.h"
+#include <vector>
+
+namespace Comfy::Render
+{
+	inline const Graphics::Material& GetSubMeshMaterial(const Graphics::SubMesh& subMesh, const RenderCommand3D& command)
+	{
+		if (command.Dynamic != nullptr)
+		{
+			for (auto& materialOverride : command.Dynamic->MaterialOverrides)
+			{
+				if (&subMesh == materialOverride.SubMeshToReplace && materialOverride.NewMaterial != nullptr)
+					return *materialOverride.NewMaterial;
+			}
+		}
+
+		const auto& parentObj = *command.SourceObj;
+
+		if (InBounds(subMesh.MaterialIndex, parentObj.Materials))
+			return parentObj.Materials[subMesh.MaterialIndex];
+
+		static const Graphics::Material dummyMaterial = {};
+		return dummyMaterial;
+	}
+
+	constexpr bool IsMeshOrSubMeshIndexSpecified(int index)
+	{
+		return (index >= 0);
+	}
+
+	template <typename Func>
+	void IterateCommandMeshes(const RenderCommand3D& command, Func func)
+	{
+		if (IsMeshOrSubMeshIndexSpecified(command.Flags.MeshIndex))
+		{
+			func(command.SourceObj->Meshes[command.Flags.MeshIndex]);
+		}
+		else
+		{
+			for (auto& mesh : command.SourceObj->Meshes)
+				func(mesh);
+		}
+	}
+
+	template <typename Func>
+	void IterateCommandSubMeshes(const RenderCommand3D& command, const Graphics::Mesh& mesh, Func func)
+	{
+		if (IsMeshOrSubMeshIndexSpecified(command.Flags.SubMeshIndex) && IsMeshOrSubMeshIndexSpecified(command.Flags.MeshIndex))
+		{
+			auto& specifiedSubMesh = mesh.SubMeshes[command.Flags.SubMeshIndex];
+			func(specifiedSubMesh, GetSubMeshMaterial(specifiedSubMesh, command));
+		}
+		else
+		{
+			for (auto& subMesh : mesh.SubMeshes)
+				func(subMesh, GetSubMeshMaterial(subMesh, command));
+		}
+	}
+
+	template <typename Func>
+	void IterateCommandMeshesAndSubMeshes(const RenderCommand3D& command, Func func)
+	{
+		IterateCommandMeshes(command, [&](auto& mesh)
+		{
+			IterateCommandSubMeshes(command, mesh, [&](auto& subMesh, auto& material)
+			{
+				func(mesh, subMesh, material);
+			});
+		});
+	}
+
+	constexpr bool CastsShadow(const RenderCommand3D& command, const Graphics::Mesh& mesh, const Graphics::SubMesh& subMesh, const Graphics::Material& material)
+	{
+		if (!command.Flags.CastsShadow)
+			return false;
+
+		if (command.Flags.IgnoreShadowCastObjFlags)
+			return true;
+
+		if (subMesh.Flags.CastsShadows || material.ShaderFlags.CastsShadows)
+			return true;
+
+		return false;
+	}
+
+	inline bool AllSubMeshesCastShadows(const RenderCommand3D& command)
+	{
+		if (!command.Flags.CastsShadow)
+			return false;
+
+		if (command.Flags.IgnoreShadowCastObjFlags)
+			return true;
+
+		bool allCastShaows = true;
+		IterateCommandMeshesAndSubMeshes(command, [&](auto& mesh, auto& subMesh, auto& material)
+		{
+			allCastShaows &= (subMesh.Flags.CastsShadows || material.ShaderFlags.CastsShadows);
+		});
+		return allCastShaows;
+	}
+
+	constexpr bool ReceivesShadows(const RenderCommand3D& command, const Graphics::Mesh& mesh, const Graphics::SubMesh& subMesh)
+	{
+		return (command.Flags.ReceivesShadow && subMesh.Flags.ReceivesShadows);
+	}
+
+	constexpr bool ReceivesSelfShadow(const RenderCommand3D& command, const Graphics::Mesh& mesh, const Graphics::SubMesh& subMesh)
+	{
+		return (command.Flags.ReceivesShadow);
+	}
+
+	struct ObjRenderCommand
+	{
+		RenderCommand3D SourceCommand;
+
+		// NOTE: To avoid needlessly calculating them multiple times
+		mat4 ModelMatrix;
+		Graphics::Sphere TransformedBoundingSphere;
+	};
+
+	struct SubMeshRenderCommand
+	{
+		ObjRenderCommand* ObjCommand;
+		const Graphics::Mesh* ParentMesh;
+		const Graphics::SubMesh* SubMesh;
+		// NOTE: Resolved once during preparation instead of searching the material overrides again for every pass
+		const Graphics::Material* Material;
+		float CameraDistance;
+	};
+}
+
+namespace Comfy::Render::Detail
+{
+	// NOTE: Flat lists of everything a render pass has to draw, already culled and classified so the submission loop only has to bind and draw.
+	//		 The sub meshes of each list are grouped by object and mesh command to minimize vertex buffer rebinds
+	struct RenderPassDrawLists
+	{
+		// NOTE: Visible non transparent sub meshes in submission order, also used for the silhouette pass
+		std::vector<SubMeshRenderCommand> Opaque;
+		// NOTE: Visible transparent sub meshes, sorted back to front if alpha sorting is enabled
+		std::vector<SubMeshRenderCommand> Transparent;
+		// NOTE: Visible sub meshes using one of the SSS materials, including transparent ones
+		std::vector<SubMeshRenderCommand> SubsurfaceScattering;
+		// NOTE: Never frustum culled because objects outside the camera view can still cast visible shadows
+		std::vector<SubMeshRenderCommand> ShadowCaster;
+
+		void Clear();
+	};
+
+	struct RenderCommandPreparationParam
+	{
+		const Camera3D* Camera;
+
+		bool FrustumCulling;
+		bool AlphaSort;
+
+		bool PrepareShadowCasters;
+		bool PrepareSubsurfaceScattering;
+
+		bool Multithreaded;
+	};
+
+	struct RenderCommandPreparationStatistics
+	{
+		u32 ObjectsCulled;
+		u32 MeshesCulled;
+		u32 SubMeshesCulled;
+		u32 TaskCount;
+	};
+
+	// NOTE: CPU only stage turning the submitted object commands into per pass draw lists.
+	//		 Doesn't touch any graphics API state and can therefore be run and validated without a GPU
+	class RenderCommandPreparer : NonCopyable
+	{
+	public:
+		// NOTE: Splitting up fewer commands than this isn't worth the overhead of launching another task
+		static constexpr size_t MinCommandsPerTask = 64;
+		static constexpr size_t MaxTaskCount = 8;
+
+		// NOTE: Transparent sub meshes closer together than this are considered to be at the same distance and ordered by their radius instead
+		static constexpr float DepthQuantizationStep = (1.0f / 1024.0f);
+
+	public:
+		RenderCommandPreparer() = default;
+		~RenderCommandPreparer() = default;
+
+	public:
+		void Prepare(std::vector<ObjRenderCommand>& commands, const RenderCommandPreparationParam& param, RenderPassDrawLists& outLists);
+		const RenderCommandPreparationStatistics& GetLastStatistics() const;
+
+	private:
+		void PrepareCommandRange(ObjRenderCommand* commands, size_t commandCount, const RenderCommandPreparationParam& param, RenderPassDrawLists& outLists, RenderCommandPreparationStatistics& outStatistics) const;
+		void SortTransparentBackToFront(std::vector<SubMeshRenderCommand>& transparent);
+
+	private:
+		struct DepthSortEntry
+		{
+			u64 Key;
+			u32 Index;
+		};
+
+		RenderCommandPreparationStatistics lastStatistics = {};
+
+		std::vector<RenderPassDrawLists> taskLists;
+		std::vector<RenderCommandPreparationStatistics> taskStatistics;
+
+		std::vector<DepthSortEntry> sortEntries, sortEntriesScratch;
+		std::vector<SubMeshRenderCommand> sortedScratch;
+	};
+}
@@ -2,36 +2,13 @@
 #include "Types.h"
 #include "Render/Core/Camera.h"
 #include "ConstantData.h"
+#include "SubsurfaceScatteringMaterial.h"
 #include "Graphics/Auth3D/ObjSet.h"
 
 namespace Comfy::Render::Detail
 {
 	constexpr float DefaultSSSParameter = 0.6f;
 
-	inline bool UsesSSSSkin(const Graphics::Material& material)
-	{
-		if (material.ShaderType == Graphics::Material::ShaderIdentifiers::Skin ||
-			material.ShaderType == Graphics::Material::ShaderIdentifiers::EyeBall ||
-			material.ShaderType == Graphics::Material::ShaderIdentifiers::Cloth ||
-			material.ShaderType == Graphics::Material::ShaderIdentifiers::EyeLens)
-			return true;
-
-		return false;
-	}
-
-	inline bool UsesSSSSkinConst(const Graphics::Material& material)
-	{
-		if (material.ShaderType == Graphics::Material::ShaderIdentifiers::Hair ||
-			material.ShaderType == Graphics::Material::ShaderIdentifiers::Tights)
-			return true;
-
-		// NOTE: The Ambient alpha is used to determine the SSS strength so this is really just an optimization to avoid using the more expensive non cost shader
-		if (material.ShaderType == Graphics::Material::ShaderIdentifiers::Cloth && material.Color.Ambient.a >= 1.0f)
-			return true;
-
-		return false;
-	}
-
 	inline float RootMeanSquare(const vec3 value)
 	{
 		const vec3 squared = (value * value);
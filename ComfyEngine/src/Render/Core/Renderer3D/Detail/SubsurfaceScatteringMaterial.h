@@ -0,0 +1,31 @@
+#pragma once
+#include "Types.h"
+#include "Graphics/Auth3D/ObjSet.h"
+
+namespace Comfy::Render::Detail
+{
+	// NOTE: Kept separate from the rest of the SSS code so that it can be used for classifying sub meshes without depending on any graphics API
+	inline bool UsesSSSSkin(const Graphics::Material& material)
+	{
+		if (material.ShaderType == Graphics::Material::ShaderIdentifiers::Skin ||
+			material.ShaderType == Graphics::Material::ShaderIdentifiers::EyeBall ||
+			material.ShaderType == Graphics::Material::ShaderIdentifiers::Cloth ||
+			material.ShaderType == Graphics::Material::ShaderIdentifiers::EyeLens)
+			return true;
+
+		return false;
+	}
+
+	inline bool UsesSSSSkinConst(const Graphics::Material& material)
+	{
+		if (material.ShaderType == Graphics::Material::ShaderIdentifiers::Hair ||
+			material.ShaderType == Graphics::Material::ShaderIdentifiers::Tights)
+			return true;
+
+		// NOTE: The Ambient alpha is used to determine the SSS strength so this is really just an optimization to avoid using the more expensive non cost shader
+		if (material.ShaderType == Graphics::Material::ShaderIdentifiers::Cloth && material.Color.Ambient.a >= 1.0f)
+			return true;
+
+		return false;
+	}
+}
@@ -3,6 +3,7 @@
 #include "Detail/GaussianBlur.h"
 #include "Detail/LensFlare.h"
 #include "Detail/MeshTransparency.h"
+#include "Detail/RenderCommandPreparation.h"
 #include "Detail/RenderTarget3DImpl.h"
 #include "Detail/ShaderFlags.h"
 #include "Detail/ShaderPairs.h"
@@ -33,112 +34,6 @@ namespace Comfy::Render
 
 	constexpr u32 MorphVertexAttributeOffset = VertexAttribute_Count;
 
-	const Material& GetSubMeshMaterial(const SubMesh& subMesh, const RenderCommand3D& command)
-	{
-		if (command.Dynamic != nullptr)
-		{
-			for (auto& materialOverride : command.Dynamic->MaterialOverrides)
-			{
-				if (&subMesh == materialOverride.SubMeshToReplace && materialOverride.NewMaterial != nullptr)
-					return *materialOverride.NewMaterial;
-			}
-		}
-
-		const auto& parentObj = *command.SourceObj;
-
-		if (InBounds(subMesh.MaterialIndex, parentObj.Materials))
-			return parentObj.Materials[subMesh.MaterialIndex];
-
-		static const Material dummyMaterial = {};
-		return dummyMaterial;
-	}
-
-	constexpr bool IsMeshOrSubMeshIndexSpecified(int index)
-	{
-		return (index >= 0);
-	}
-
-	template <typename Func>
-	void IterateCommandMeshes(const RenderCommand3D& command, Func func)
-	{
-		if (IsMeshOrSubMeshIndexSpecified(command.Flags.MeshIndex))
-		{
-			func(command.SourceObj->Meshes[command.Flags.MeshIndex]);
-		}
-		else
-		{
-			for (auto& mesh : command.SourceObj->Meshes)
-				func(mesh);
-		}
-	}
-
-	template <typename Func>
-	void IterateCommandSubMeshes(const RenderCommand3D& command, const Mesh& mesh, Func func)
-	{
-		if (IsMeshOrSubMeshIndexSpecified(command.Flags.SubMeshIndex) && IsMeshOrSubMeshIndexSpecified(command.Flags.MeshIndex))
-		{
-			auto& specifiedSubMesh = mesh.SubMeshes[command.Flags.SubMeshIndex];
-			func(specifiedSubMesh, GetSubMeshMaterial(specifiedSubMesh, command));
-		}
-		else
-		{
-			for (auto& subMesh : mesh.SubMeshes)
-				func(subMesh, GetSubMeshMaterial(subMesh, command));
-		}
-	}
-
-	template <typename Func>
-	void IterateCommandMeshesAndSubMeshes(const RenderCommand3D& command, Func func)
-	{
-		IterateCommandMeshes(command, [&](auto& mesh)
-		{
-			IterateCommandSubMeshes(command, mesh, [&](auto& subMesh, auto& material)
-			{
-				func(mesh, subMesh, material);
-			});
-		});
-	}
-
-	constexpr bool CastsShadow(const RenderCommand3D& command, const Mesh& mesh, const SubMesh& subMesh, const Material& material)
-	{
-		if (!command.Flags.CastsShadow)
-			return false;
-
-		if (command.Flags.IgnoreShadowCastObjFlags)
-			return true;
-
-		if (subMesh.Flags.CastsShadows || material.ShaderFlags.CastsShadows)
-			return true;
-
-		return false;
-	}
-
-	bool AllSubMeshesCastShadows(const RenderCommand3D& command)
-	{
-		if (!command.Flags.CastsShadow)
-			return false;
-
-		if (command.Flags.IgnoreShadowCastObjFlags)
-			return true;
-
-		bool allCastShaows = true;
-		IterateCommandMeshesAndSubMeshes(command, [&](auto& mesh, auto& subMesh, auto& material)
-		{
-			allCastShaows &= (subMesh.Flags.CastsShadows || material.ShaderFlags.CastsShadows);
-		});
-		return allCastShaows;
-	}
-
-	constexpr bool ReceivesShadows(const RenderCommand3D& command, const Mesh& mesh, const SubMesh& subMesh)
-	{
-		return (command.Flags.ReceivesShadow && subMesh.Flags.ReceivesShadows);
-	}
-
-	constexpr bool ReceivesSelfShadow(const RenderCommand3D& command, const Mesh& mesh, const SubMesh& subMesh)
-	{
-		return (command.Flags.ReceivesShadow);
-	}
-
 	const Mesh* GetMorphMesh(const Obj& obj, const Obj* morphObj, const Mesh& mesh)
 	{
 		if (morphObj == nullptr)
@@ -248,26 +143,6 @@ namespace Comfy::Render
 		RenderFlags_NoFrustumCulling = (1 << 7),
 	};
 
-	struct ObjRenderCommand
-	{
-		RenderCommand3D SourceCommand;
-
-		// NOTE: To avoid needlessly calculating them multiple times
-		mat4 ModelMatrix;
-		Sphere TransformedBoundingSphere;
-
-		// NOTE: To avoid needlessly binding buffers during the opaque render pass
-		bool AreAllMeshesTransparent;
-	};
-
-	struct SubMeshRenderCommand
-	{
-		ObjRenderCommand* ObjCommand;
-		const Mesh* ParentMesh;
-		const SubMesh* SubMesh;
-		float CameraDistance;
-	};
-
 	struct Renderer3D::Impl
 	{
 	public:
@@ -322,9 +197,11 @@ namespace Comfy::Render
 		struct RenderPassCommandLists
 		{
 			std::vector<ObjRenderCommand> OpaqueAndTransparent;
-			std::vector<SubMeshRenderCommand> Transparent;
+			Detail::RenderPassDrawLists DrawLists;
 		} DefaultCommandList, ReflectionCommandList;
 
+		Detail::RenderCommandPreparer CommandPreparer;
+
 		struct Statistics
 		{
 			size_t VerticesRendered = 0;
@@ -386,10 +263,12 @@ namespace Comfy::Render
 
 			constexpr size_t reasonableInitialCapacity = 64;
 			DefaultCommandList.OpaqueAndTransparent.reserve(reasonableInitialCapacity);
-			DefaultCommandList.Transparent.reserve(reasonableInitialCapacity);
+			DefaultCommandList.DrawLists.Opaque.reserve(reasonableInitialCapacity);
+			DefaultCommandList.DrawLists.Transparent.reserve(reasonableInitialCapacity);
 
 			ReflectionCommandList.OpaqueAndTransparent.reserve(reasonableInitialCapacity);
-			ReflectionCommandList.Transparent.reserve(reasonableInitialCapacity);
+			ReflectionCommandList.DrawLists.Opaque.reserve(reasonableInitialCapacity);
+			ReflectionCommandList.DrawLists.Transparent.reserve(reasonableInitialCapacity);
 		}
 
 		void UpdateIsAnyCommandFlags(const RenderCommand3D& command)
@@ -430,8 +309,11 @@ namespace Comfy::Render
 
 		void Flush()
 		{
-			PrepareRenderCommands(DefaultCommandList);
-			PrepareRenderCommands(ReflectionCommandList);
+			const bool renderShadowMap = (Current.RenderTarget->Param.ShadowMapping && IsAnyCommand.CastsShadow && IsAnyCommand.ReceiveShadow);
+			const bool renderSubsurfaceScattering = (Current.RenderTarget->Param.RenderSubsurfaceScattering && IsAnyCommand.SubsurfaceScattering);
+
+			PrepareRenderCommands(DefaultCommandList, renderShadowMap, renderSubsurfaceScattering);
+			PrepareRenderCommands(ReflectionCommandList, false, false);
 
 			RenderScene();
 			RenderPostProcessing();
@@ -440,50 +322,26 @@ namespace Comfy::Render
 				RenderSilhouetteOutlineOverlay();
 
 			DefaultCommandList.OpaqueAndTransparent.clear();
-			DefaultCommandList.Transparent.clear();
+			DefaultCommandList.DrawLists.Clear();
 
 			ReflectionCommandList.OpaqueAndTransparent.clear();
-			ReflectionCommandList.Transparent.clear();
+			ReflectionCommandList.DrawLists.Clear();
 		}
 
-		void PrepareRenderCommands(RenderPassCommandLists& commandList)
+		void PrepareRenderCommands(RenderPassCommandLists& commandList, bool prepareShadowCasters, bool prepareSubsurfaceScattering)
 		{
 			if (commandList.OpaqueAndTransparent.empty())
 				return;
 
-			for (auto& command : commandList.OpaqueAndTransparent)
-			{
-				command.AreAllMeshesTransparent = true;
+			Detail::RenderCommandPreparationParam param;
+			param.Camera = Current.Camera;
+			param.FrustumCulling = Current.RenderTarget->Param.FrustumCulling;
+			param.AlphaSort = Current.RenderTarget->Param.AlphaSort;
+			param.PrepareShadowCasters = prepareShadowCasters;
+			param.PrepareSubsurfaceScattering = prepareSubsurfaceScattering;
+			param.Multithreaded = true;
 
-				IterateCommandMeshesAndSubMeshes(command.SourceCommand, [&](auto& mesh, auto& subMesh, auto& material)
-				{
-					if (Detail::IsMeshTransparent(mesh, subMesh, material))
-					{
-						const auto boundingSphere = (subMesh.BoundingSphere * command.SourceCommand.Transform);
-						const float cameraDistance = glm::distance(boundingSphere.Center, Current.Camera->ViewPoint);
-
-						commandList.Transparent.push_back({ &command, &mesh, &subMesh, cameraDistance });
-					}
-					else
-					{
-						command.AreAllMeshesTransparent = false;
-					}
-				});
-			}
-
-			if (Current.RenderTarget->Param.AlphaSort)
-			{
-				std::sort(commandList.Transparent.begin(), commandList.Transparent.end(), [](SubMeshRenderCommand& a, SubMeshRenderCommand& b)
-				{
-					constexpr float comparisonThreshold = 0.001f;
-					const bool sameDistance = std::abs(a.CameraDistance - b.CameraDistance) < comparisonThreshold;
-
-					if (sameDistance)
-						return a.SubMesh->BoundingSphere.Radius > b.SubMesh->BoundingSphere.Radius;
-
-					return (a.CameraDistance > b.CameraDistance);
-				});
-			}
+			CommandPreparer.Prepare(commandList.OpaqueAndTransparent, param, commandList.DrawLists);
 		}
 
 		void RenderScene()
@@ -534,8 +392,7 @@ namespace Comfy::Render
 			{
 				D3D11.ImmediateContext->OMSetBlendState(nullptr, nullptr, D3D11_DEFAULT_SAMPLE_MASK);
 
-				for (auto& command : DefaultCommandList.OpaqueAndTransparent)
-					RenderOpaqueObjCommand(command);
+				RenderSubMeshCommands(DefaultCommandList.DrawLists.Opaque);
 
 				if (Current.RenderTarget->Param.RenderLensFlare && Current.SceneParam->Light.Sun.Type == LightSourceType::Parallel)
 					QueryRenderLensFlareSun();
@@ -543,11 +400,11 @@ namespace Comfy::Render
 			D3D11_EndDebugEvent();
 
 			D3D11_BeginDebugEvent("Transparent Geometry");
-			if (Current.RenderTarget->Param.RenderTransparent && !DefaultCommandList.Transparent.empty())
+			if (Current.RenderTarget->Param.RenderTransparent && !DefaultCommandList.DrawLists.Transparent.empty())
 			{
 				TransparencyPassDepthStencilState.Bind(D3D11);
 
-				for (auto& command : DefaultCommandList.Transparent)
+				for (auto& command : DefaultCommandList.DrawLists.Transparent)
 					RenderTransparentSubMeshCommand(command);
 
 				TransparencyPassDepthStencilState.UnBind(D3D11);
@@ -739,10 +596,7 @@ namespace Comfy::Render
 			D3D11.ImmediateContext->OMSetBlendState(nullptr, nullptr, D3D11_DEFAULT_SAMPLE_MASK);
 
 			Shaders.Silhouette.Bind(D3D11);
-			for (auto& command : DefaultCommandList.OpaqueAndTransparent)
-			{
-				RenderOpaqueObjCommand(command, RenderFlags_ShadowPass | RenderFlags_NoMaterialShader | RenderFlags_NoRasterizerState | RenderFlags_NoFrustumCulling | RenderFlags_DiffuseTextureOnly);
-			}
+			RenderSubMeshCommands(DefaultCommandList.DrawLists.ShadowCaster, RenderFlags_ShadowPass | RenderFlags_NoMaterialShader | RenderFlags_NoRasterizerState | RenderFlags_NoFrustumCulling | RenderFlags_DiffuseTextureOnly);
 
 			Current.RenderTarget->Shadow.RenderTarget.UnBind(D3D11);
 
@@ -872,15 +726,14 @@ namespace Comfy::Render
 				{
 					D3D11.ImmediateContext->OMSetBlendState(nullptr, nullptr, D3D11_DEFAULT_SAMPLE_MASK);
 
-					for (auto& command : ReflectionCommandList.OpaqueAndTransparent)
-						RenderOpaqueObjCommand(command);
+					RenderSubMeshCommands(ReflectionCommandList.DrawLists.Opaque);
 				}
 
-				if (Current.RenderTarget->Param.RenderTransparent && !ReflectionCommandList.Transparent.empty())
+				if (Current.RenderTarget->Param.RenderTransparent && !ReflectionCommandList.DrawLists.Transparent.empty())
 				{
 					TransparencyPassDepthStencilState.Bind(D3D11);
 
-					for (auto& command : ReflectionCommandList.Transparent)
+					for (auto& command : ReflectionCommandList.DrawLists.Transparent)
 						RenderTransparentSubMeshCommand(command);
 
 					TransparencyPassDepthStencilState.UnBind(D3D11);
@@ -899,12 +752,11 @@ namespace Comfy::Render
 			Current.RenderTarget->SubsurfaceScattering.RenderTarget.BindAndSetViewport(D3D11);
 			Current.RenderTarget->SubsurfaceScattering.RenderTarget.ClearColorAndDepth(D3D11, vec4(0.0f));
 
-			if (!DefaultCommandList.OpaqueAndTransparent.empty())
+			if (!DefaultCommandList.DrawLists.SubsurfaceScattering.empty())
 			{
 				D3D11.ImmediateContext->OMSetBlendState(nullptr, nullptr, D3D11_DEFAULT_SAMPLE_MASK);
 
-				for (auto& command : DefaultCommandList.OpaqueAndTransparent)
-					RenderOpaqueObjCommand(command, RenderFlags_SSSPass);
+				RenderSubMeshCommands(DefaultCommandList.DrawLists.SubsurfaceScattering, RenderFlags_SSSPass);
 			}
 
 			Current.RenderTarget->SubsurfaceScattering.RenderTarget.UnBind(D3D11);
@@ -945,65 +797,45 @@ namespace Comfy::Render
 			D3D11_EndDebugEvent();
 		}
 
-		void RenderOpaqueObjCommand(ObjRenderCommand& command, RenderFlags flags = RenderFlags_None)
+		void RenderSubMeshCommands(const std::vector<SubMeshRenderCommand>& commands, RenderFlags flags = RenderFlags_None)
 		{
-			if (command.AreAllMeshesTransparent && !(flags & RenderFlags_ShadowPass) && !(flags & RenderFlags_SSSPass))
-				return;
+			const ObjRenderCommand* lastObjCommand = nullptr;
+			const Mesh* lastMesh = nullptr;
 
-			if (!(flags & RenderFlags_NoFrustumCulling) && !IntersectsCameraFrustum(command.SourceCommand.SourceObj->BoundingSphere, command))
-				return;
-
-			IterateCommandMeshes(command.SourceCommand, [&](auto& mesh)
+			for (const auto& command : commands)
 			{
-				if (!(flags & RenderFlags_NoFrustumCulling) && !IntersectsCameraFrustum(mesh.BoundingSphere, command))
-					return;
-
-				D3D11_BeginDebugEvent("Draw Mesh");
-				BindMeshVertexBuffers(mesh, GetMorphMesh(*command.SourceCommand.SourceObj, command.SourceCommand, mesh));
-
-				IterateCommandSubMeshes(command.SourceCommand, mesh, [&](auto& subMesh, auto& material)
+				// NOTE: Sub meshes of the same mesh are always stored next to each other so the vertex buffers only have to be bound once per mesh
+				if (command.ObjCommand != lastObjCommand || command.ParentMesh != lastMesh)
 				{
-					if (!(flags & RenderFlags_ShadowPass) && !(flags & RenderFlags_SSSPass))
-					{
-						if (Detail::IsMeshTransparent(mesh, subMesh, material))
-							return;
-					}
+					if (lastMesh != nullptr)
+						D3D11_EndDebugEvent();
 
-					if ((flags & RenderFlags_ShadowPass) && !CastsShadow(command.SourceCommand, mesh, subMesh, material))
-						return;
+					lastObjCommand = command.ObjCommand;
+					lastMesh = command.ParentMesh;
 
-					if ((flags & RenderFlags_SSSPass) && !(Detail::UsesSSSSkin(material) || Detail::UsesSSSSkinConst(material)))
-						return;
+					D3D11_BeginDebugEvent("Draw Mesh");
+					BindMeshVertexBuffers(*lastMesh, GetMorphMesh(*lastObjCommand->SourceCommand.SourceObj, lastObjCommand->SourceCommand, *lastMesh));
+				}
 
-					if (!(flags & RenderFlags_NoFrustumCulling) && !IntersectsCameraFrustum(subMesh.BoundingSphere, command))
-						return;
+				PrepareAndRenderSubMesh(*command.ObjCommand, *command.ParentMesh, *command.SubMesh, *command.Material, flags);
+			}
 
-					PrepareAndRenderSubMesh(command, mesh, subMesh, material, flags);
-				});
+			if (lastMesh != nullptr)
 				D3D11_EndDebugEvent();
-			});
 		}
 
-		void RenderTransparentSubMeshCommand(SubMeshRenderCommand& command)
+		void RenderTransparentSubMeshCommand(const SubMeshRenderCommand& command)
 		{
-			auto& objCommand = command.ObjCommand;
-			auto& transform = objCommand->SourceCommand.Transform;
-			auto& obj = *objCommand->SourceCommand.SourceObj;
+			auto& objCommand = *command.ObjCommand;
 			auto& mesh = *command.ParentMesh;
-			auto& subMesh = *command.SubMesh;
-
-			if (!IntersectsCameraFrustum(obj.BoundingSphere, command)
-				|| !IntersectsCameraFrustum(mesh.BoundingSphere, command)
-				|| !IntersectsCameraFrustum(subMesh.BoundingSphere, command))
-				return;
+			auto& material = *command.Material;
 
 			D3D11_BeginDebugEvent("Draw Sub Mesh");
-			BindMeshVertexBuffers(mesh, GetMorphMesh(obj, objCommand->SourceCommand, mesh));
+			BindMeshVertexBuffers(mesh, GetMorphMesh(*objCommand.SourceCommand.SourceObj, objCommand.SourceCommand, mesh));
 
-			auto& material = GetSubMeshMaterial(subMesh, command.ObjCommand->SourceCommand);
 			Current.RenderTarget->BlendStates.GetState(material.BlendFlags.SrcBlendFactor, material.BlendFlags.DstBlendFactor).Bind(D3D11);
 
-			PrepareAndRenderSubMesh(*command.ObjCommand, mesh, subMesh, material);
+			PrepareAndRenderSubMesh(objCommand, mesh, *command.SubMesh, material);
 			D3D11_EndDebugEvent();
 		}
 
@@ -1014,12 +846,11 @@ namespace Comfy::Render
 			Current.RenderTarget->Silhouette.RenderTarget.BindAndSetViewport(D3D11);
 			Current.RenderTarget->Silhouette.RenderTarget.ClearColorAndDepth(D3D11, vec4(0.0f));
 
-			if (!DefaultCommandList.OpaqueAndTransparent.empty())
+			if (!DefaultCommandList.DrawLists.Opaque.empty())
 			{
 				D3D11.ImmediateContext->OMSetBlendState(nullptr, nullptr, D3D11_DEFAULT_SAMPLE_MASK);
 
-				for (auto& command : DefaultCommandList.OpaqueAndTransparent)
-					RenderOpaqueObjCommand(command, RenderFlags_SilhouetteOutlinePass | RenderFlags_NoMaterialShader | RenderFlags_NoMaterialTextures);
+				RenderSubMeshCommands(DefaultCommandList.DrawLists.Opaque, RenderFlags_SilhouetteOutlinePass | RenderFlags_NoMaterialShader | RenderFlags_NoMaterialTextures);
 			}
 
 			Current.RenderTarget->Silhouette.RenderTarget.UnBind(D3D11);
@@ -1928,27 +1759,6 @@ namespace Comfy::Render
 			return Sphere { (min + size), (Max(size.x, Max(size.y, size.z))) + radiusPadding };
 		}
 
-		bool IntersectsCameraFrustum(const ObjRenderCommand& command) const
-		{
-			if (!Current.RenderTarget->Param.FrustumCulling)
-				return true;
-
-			return Current.Camera->IntersectsViewFrustum(command.TransformedBoundingSphere);
-		}
-
-		bool IntersectsCameraFrustum(const Sphere& boundingSphere, const ObjRenderCommand& command) const
-		{
-			if (!Current.RenderTarget->Param.FrustumCulling)
-				return true;
-
-			return Current.Camera->IntersectsViewFrustum(boundingSphere * command.SourceCommand.Transform);
-		}
-
-		bool IntersectsCameraFrustum(const Sphere& boundingSphere, const SubMeshRenderCommand& command) const
-		{
-			return IntersectsCameraFrustum(boundingSphere, *command.ObjCommand);
-		}
-
 		bool IsDebugRenderFlagSet(int bitIndex) const
 		{
 			return Current.RenderTarget->Param.DebugFlags & (1 << bitIndex);
@@ -1997,7 +1807,6 @@ namespace Comfy::Render
 
 		ObjRenderCommand& newRenderCommand = commandList.OpaqueAndTransparent.emplace_back();
 		newRenderCommand.SourceCommand = command;
-		newRenderCommand.AreAllMeshesTransparent = false;
 		newRenderCommand.ModelMatrix = command.Transform.CalculateMatrix();
 		newRenderCommand.TransformedBoundingSphere = command.SourceObj->BoundingSphere;
 		newRenderCommand.TransformedBoundingSphere.Transform(newRenderCommand.ModelMatrix, command.Transform.Scale);
@@ -4,4 +4,5 @@
 #include "Core/Camera.h"
 #include "Core/RenderSnapshot.h"
 #include "Core/Renderer2D/Renderer2D.h"
+#include "Core/Renderer2D/Renderer2DBackend.h"
 #include "Core/Renderer3D/Renderer3D.h"
@@ -0,0 +1,119 @@
+#include "BenchmarkRunner.h"
+#include "ImGui/Gui.h"
+#include "ImGui/Extensions/PropertyEditor.h"
+#include "Core/Logger.h"
+
+namespace Comfy::System
+{
+	void BenchmarkRunner::Add(std::string name, TimeSpan elapsed, size_t iterations)
+	{
+		results.push_back({ std::move(name), elapsed, iterations });
+	}
+
+	void BenchmarkRunner::Clear()
+	{
+		results.clear();
+		checks.clear();
+	}
+
+	const std::vector<BenchmarkResult>& BenchmarkRunner::GetResults() const
+	{
+		return results;
+	}
+
+	bool BenchmarkRunner::Check(std::string name, bool passed)
+	{
+		if (!passed)
+			Logger::LogErrorLine(__FUNCTION__"(): Benchmark check '%s' failed", name.c_str());
+
+		checks.push_back({ std::move(name), passed ? BenchmarkCheckResult::Passed : BenchmarkCheckResult::Failed });
+		return passed;
+	}
+
+	void BenchmarkRunner::SkipCheck(std::string name)
+	{
+		checks.push_back({ std::move(name), BenchmarkCheckResult::Skipped });
+	}
+
+	bool BenchmarkRunner::AllChecksPassed() const
+	{
+		return std::none_of(checks.begin(), checks.end(), [](const auto& check) { return (check.Result == BenchmarkCheckResult::Failed); });
+	}
+
+	const std::vector<BenchmarkCheck>& BenchmarkRunner::GetChecks() const
+	{
+		return checks;
+	}
+
+	bool BenchmarkRunner::RunButtonGui() const
+	{
+		return Gui::Button("Run Benchmark", vec2(Gui::GetContentRegionAvail().x, 0.0f));
+	}
+
+	void BenchmarkRunner::ChecksGui() const
+	{
+		constexpr u32 failedTextColor = 0xFF2424E3;
+
+		for (const auto& check : checks)
+		{
+			if (check.Result == BenchmarkCheckResult::Failed)
+				Gui::PushStyleColor(ImGuiCol_Text, failedTextColor);
+			else if (check.Result == BenchmarkCheckResult::Skipped)
+				Gui::PushStyleColor(ImGuiCol_Text, Gui::GetColorU32(ImGuiCol_TextDisabled));
+
+			const char* resultText = (check.Result == BenchmarkCheckResult::Passed) ? "Passed" : (check.Result == BenchmarkCheckResult::Failed) ? "FAILED" : "Skipped";
+			Gui::Text("%s: %s", check.Name.c_str(), resultText);
+
+			if (check.Result != BenchmarkCheckResult::Passed)
+				Gui::PopStyleColor();
+		}
+	}
+
+	void BenchmarkRunner::ResultsTableGui() const
+	{
+		Gui::BeginChild("ResultsChild", vec2(0.0f, 0.0f), true);
+		Gui::BeginColumns(nullptr, 4, ImGuiOldColumnFlags_NoResize);
+		{
+			Gui::TextUnformatted("Benchmark"); Gui::NextColumn();
+			Gui::TextUnformatted("Total"); Gui::NextColumn();
+			Gui::TextUnformatted("Iterations"); Gui::NextColumn();
+			Gui::TextUnformatted("Per Iteration"); Gui::NextColumn();
+			Gui::Separator();
+
+			for (const auto& result : results)
+			{
+				const auto perIteration = (result.Iterations > 0) ? (result.Elapsed.TotalMilliseconds() / static_cast<f64>(result.Iterations)) : 0.0;
+
+				Gui::TextUnformatted(Gui::StringViewStart(result.Name), Gui::StringViewEnd(result.Name)); Gui::NextColumn();
+				Gui::Text("%.3f ms", result.Elapsed.TotalMilliseconds()); Gui::NextColumn();
+				Gui::Text("%zu", result.Iterations); Gui::NextColumn();
+				Gui::Text("%.6f ms", perIteration); Gui::NextColumn();
+			}
+		}
+		Gui::EndColumns();
+		Gui::EndChild();
+	}
+
+	void BenchmarkRunner::WindowGui(const char* windowName, const std::function<void()>& paramGui, const std::function<void()>& runFunc, const std::function<void()>& summaryGui)
+	{
+		if (Gui::Begin(windowName))
+		{
+			{
+				const auto columns = GuiPropertyRAII::PropertyValueColumns();
+				paramGui();
+			}
+
+			if (RunButtonGui())
+			{
+				Clear();
+				runFunc();
+			}
+
+			ChecksGui();
+			summaryGui();
+
+			ResultsTableGui();
+		}
+		Gui::End();
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "Types.h"
+#include "Time/TimeSpan.h"
+#include "Time/Stopwatch.h"
+#include <functional>
+#include <optional>
+#include <variant>
+
+namespace Comfy::System
+{
+	// NOTE: Fixed seed so that consecutive runs operate on the exact same data
+	constexpr u32 BenchmarkRandomSeed = 0xC0FFEE;
+
+	struct BenchmarkResult
+	{
+		std::string Name;
+		TimeSpan Elapsed;
+		size_t Iterations;
+	};
+
+	enum class BenchmarkCheckResult : u8
+	{
+		Passed,
+		Failed,
+		Skipped,
+	};
+
+	struct BenchmarkCheck
+	{
+		std::string Name;
+		BenchmarkCheckResult Result;
+	};
+
+	// NOTE: Collects the results of a single benchmark run, every run is expected to start by clearing the previous results
+	class BenchmarkRunner
+	{
+	public:
+		// NOTE: Returns the elapsed time so that callers can derive their own throughput summaries
+		template <typename Func>
+		TimeSpan Run(std::string name, size_t iterations, Func func)
+		{
+			const auto stopwatch = Stopwatch::StartNew();
+			func();
+			const auto elapsed = stopwatch.GetElapsed();
+
+			Add(std::move(name), elapsed, iterations);
+			return elapsed;
+		}
+
+		// NOTE: For timings accumulated over multiple interleaved sections
+		void Add(std::string name, TimeSpan elapsed, size_t iterations);
+		void Clear();
+
+		const std::vector<BenchmarkResult>& GetResults() const;
+
+		// NOTE: Correctness checks of the benchmarked code, unlike asserts these are evaluated in release builds too and failures are logged as errors
+		bool Check(std::string name, bool passed);
+		void SkipCheck(std::string name);
+
+		bool AllChecksPassed() const;
+		const std::vector<BenchmarkCheck>& GetChecks() const;
+
+	public:
+		// NOTE: Full width button, returns true when clicked
+		bool RunButtonGui() const;
+		void ChecksGui() const;
+		void ResultsTableGui() const;
+
+		// NOTE: Common benchmark window layout of parameter property columns, run button, checks, summary and results table.
+		//		 The results and checks of the previous run are cleared before the run func is called
+		void WindowGui(const char* windowName, const std::function<void()>& paramGui, const std::function<void()>& runFunc, const std::function<void()>& summaryGui);
+
+	private:
+		std::vector<BenchmarkResult> results;
+		std::vector<BenchmarkCheck> checks;
+	};
+
+	// NOTE: Adjustable parameters, runner and summary of the last run of a single sandbox / debug benchmark
+	template <typename ParamType, typename SummaryType = std::monostate>
+	struct Benchmark
+	{
+		ParamType Param = {};
+		BenchmarkRunner Runner;
+		std::optional<SummaryType> Summary;
+
+		// NOTE: The param gui func receives the mutable params, the run func is expected to assign the new summary
+		//		 and the summary gui func is only called once a summary exists, which for std::monostate is after every completed run
+		template <typename ParamGuiFunc, typename RunFunc, typename SummaryGuiFunc>
+		void WindowGui(const char* windowName, ParamGuiFunc paramGui, RunFunc runFunc, SummaryGuiFunc summaryGui)
+		{
+			Runner.WindowGui(windowName,
+				[&] { paramGui(Param); },
+				[&]
+				{
+					Summary.reset();
+					runFunc();
+
+					if constexpr (std::is_same_v<SummaryType, std::monostate>)
+						Summary = std::monostate {};
+				},
+				[&] { if (Summary.has_value()) summaryGui(Summary.value()); });
+		}
+	};
+}
@@ -31,5 +31,20 @@ namespace Comfy::Undo
 
 		// NOTE: To be displayed in a GUI
 		virtual std::string_view GetName() const = 0;
+
+	public:
+		// NOTE: Estimated number of heap allocated bytes owned by the command in addition to its fixed size object,
+		//		 used for keeping the memory usage of the undo history within its budget
+		virtual size_t GetDynamicMemoryUsage() const { return 0; }
+
+		// NOTE: Called once the command has been pushed down the undo stack and will no longer be merged into.
+		//		 Allows for converting stored data into a more compact representation that only needs to support Undo() and Redo()
+		virtual void Compact() {}
 	};
+
+	template <typename T>
+	inline size_t GetVectorMemoryUsage(const std::vector<T>& vector)
+	{
+		return vector.capacity() * sizeof(T);
+	}
 }
@@ -13,6 +13,10 @@ namespace Comfy::Undo
 
 			return popped;
 		}
+
+		// NOTE: Rough estimate for the fixed size command object itself, its heap allocation overhead and its unique_ptr stack entry
+		//		 because the exact size of the derived command type isn't known here
+		constexpr size_t EstimatedFixedCommandMemoryUsage = 64;
 	}
 
 	UndoManager::UndoManager()
@@ -56,12 +60,31 @@ namespace Comfy::Undo
 		commandMergeTimeThreshold = value;
 	}
 
+	size_t UndoManager::GetMemoryBudget() const
+	{
+		return memoryStatistics.MemoryBudget;
+	}
+
+	void UndoManager::SetMemoryBudget(size_t value)
+	{
+		if (memoryStatistics.MemoryBudget == value)
+			return;
+
+		memoryStatistics.MemoryBudget = value;
+		EvictCommandsExceedingMemoryBudget();
+	}
+
+	const UndoHistoryMemoryStatistics& UndoManager::GetMemoryStatistics() const
+	{
+		return memoryStatistics;
+	}
+
 	void UndoManager::TryMergeOrExecute(std::unique_ptr<Command> commandToExecute)
 	{
 		assert(commandToExecute != nullptr);
 		hasPendingChanges = true;
 
-		redoStack.clear();
+		ClearRedoStack();
 		auto* lastCommand = (!undoStack.empty() ? undoStack.back().get() : nullptr);
 
 		const bool mergeDisallowedByType = (lastCommand == nullptr || !CommandsAreOfSameType(*commandToExecute, *lastCommand));
@@ -76,21 +99,43 @@ namespace Comfy::Undo
 		if (numberOfCommandsToDisallowMergesFor > 0)
 			numberOfCommandsToDisallowMergesFor--;
 
+		auto pushAndExecuteNewCommand = [&]()
+		{
+			// NOTE: Compacting before pushing so that the last command (now no longer at the top of the stack) won't be merged into anymore
+			if (lastCommand != nullptr)
+				CompactCommand(*lastCommand);
+
+			auto& newCommand = undoStack.emplace_back(std::move(commandToExecute));
+			newCommand->Redo();
+			memoryStatistics.UndoStackMemoryUsage += GetCommandMemoryUsage(*newCommand);
+		};
+
 		if (!mergeDisallowedByType && !mergeDisallowedByTime && !mergeDisallowedByCounter)
 		{
+			const size_t lastCommandMemoryUsage = GetCommandMemoryUsage(*lastCommand);
 			const auto mergeResult = lastCommand->TryMerge(*commandToExecute);
 
 			if (mergeResult == MergeResult::Failed)
-				undoStack.emplace_back(std::move(commandToExecute))->Redo();
+			{
+				pushAndExecuteNewCommand();
+			}
 			else if (mergeResult == MergeResult::ValueUpdated)
+			{
 				lastCommand->Redo();
+				memoryStatistics.UndoStackMemoryUsage -= lastCommandMemoryUsage;
+				memoryStatistics.UndoStackMemoryUsage += GetCommandMemoryUsage(*lastCommand);
+			}
 			else
+			{
 				assert(false);
+			}
 		}
 		else
 		{
-			undoStack.emplace_back(std::move(commandToExecute))->Redo();
+			pushAndExecuteNewCommand();
 		}
+
+		EvictCommandsExceedingMemoryBudget();
 	}
 
 	bool UndoManager::CommandsAreOfSameType(const Command& commandA, const Command& commandB) const
@@ -98,6 +143,64 @@ namespace Comfy::Undo
 		return Hacks::CompareVirtualFunctionTablePointers(commandA, commandB);
 	}
 
+	size_t UndoManager::GetCommandMemoryUsage(const Command& command) const
+	{
+		return EstimatedFixedCommandMemoryUsage + command.GetDynamicMemoryUsage();
+	}
+
+	void UndoManager::CompactCommand(Command& command)
+	{
+		const size_t memoryUsageBefore = GetCommandMemoryUsage(command);
+		command.Compact();
+		const size_t memoryUsageAfter = GetCommandMemoryUsage(command);
+
+		// NOTE: Compacting an already compacted command is expected to be a no-op, only count the ones that actually shrunk
+		if (memoryUsageAfter < memoryUsageBefore)
+		{
+			memoryStatistics.CompactedCommandCount++;
+			memoryStatistics.CompactedBytesSaved += (memoryUsageBefore - memoryUsageAfter);
+		}
+
+		memoryStatistics.UndoStackMemoryUsage -= memoryUsageBefore;
+		memoryStatistics.UndoStackMemoryUsage += memoryUsageAfter;
+	}
+
+	void UndoManager::ClearRedoStack()
+	{
+		if (redoStack.empty())
+			return;
+
+		redoStack.clear();
+		memoryStatistics.RedoStackMemoryUsage = 0;
+	}
+
+	void UndoManager::EvictCommandsExceedingMemoryBudget()
+	{
+		const size_t budget = memoryStatistics.MemoryBudget;
+		if (budget == 0 || undoStack.size() <= 1)
+			return;
+
+		// NOTE: The redo stack is cleared by the next executed command anyway so only the undo stack is evicted from
+		size_t totalMemoryUsage = (memoryStatistics.UndoStackMemoryUsage + memoryStatistics.RedoStackMemoryUsage);
+		if (totalMemoryUsage <= budget)
+			return;
+
+		size_t evictionCount = 0, evictedBytes = 0;
+		while (totalMemoryUsage > budget && evictionCount < (undoStack.size() - 1))
+		{
+			const size_t commandMemoryUsage = GetCommandMemoryUsage(*undoStack[evictionCount++]);
+			totalMemoryUsage -= commandMemoryUsage;
+			evictedBytes += commandMemoryUsage;
+		}
+
+		// NOTE: Erasing the oldest commands from the front in a single batch to only shift the remaining stack once
+		undoStack.erase(undoStack.begin(), undoStack.begin() + evictionCount);
+
+		memoryStatistics.UndoStackMemoryUsage -= evictedBytes;
+		memoryStatistics.EvictedCommandCount += evictionCount;
+		memoryStatistics.EvictedBytes += evictedBytes;
+	}
+
 	void UndoManager::Undo(size_t count)
 	{
 		for (size_t i = 0; i < count; i++)
@@ -106,7 +209,12 @@ namespace Comfy::Undo
 				break;
 
 			hasPendingChanges = true;
-			redoStack.emplace_back(VectorPop(undoStack))->Undo();
+			auto& undoneCommand = redoStack.emplace_back(VectorPop(undoStack));
+			undoneCommand->Undo();
+
+			const size_t commandMemoryUsage = GetCommandMemoryUsage(*undoneCommand);
+			memoryStatistics.UndoStackMemoryUsage -= commandMemoryUsage;
+			memoryStatistics.RedoStackMemoryUsage += commandMemoryUsage;
 		}
 	}
 
@@ -118,7 +226,12 @@ namespace Comfy::Undo
 				break;
 
 			hasPendingChanges = true;
-			undoStack.emplace_back(VectorPop(redoStack))->Redo();
+			auto& redoneCommand = undoStack.emplace_back(VectorPop(redoStack));
+			redoneCommand->Redo();
+
+			const size_t commandMemoryUsage = GetCommandMemoryUsage(*redoneCommand);
+			memoryStatistics.RedoStackMemoryUsage -= commandMemoryUsage;
+			memoryStatistics.UndoStackMemoryUsage += commandMemoryUsage;
 		}
 	}
 
@@ -134,6 +247,9 @@ namespace Comfy::Undo
 
 		if (!redoStack.empty())
 			redoStack.clear();
+
+		// NOTE: Reset all statistics but keep the budget
+		memoryStatistics = UndoHistoryMemoryStatistics { memoryStatistics.MemoryBudget };
 	}
 
 	void UndoManager::SetChangesWereMade()
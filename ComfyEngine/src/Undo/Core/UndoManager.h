@@ -5,6 +5,20 @@
 
 namespace Comfy::Undo
 {
+	struct UndoHistoryMemoryStatistics
+	{
+		// NOTE: Zero for an unlimited budget
+		size_t MemoryBudget;
+		size_t UndoStackMemoryUsage;
+		size_t RedoStackMemoryUsage;
+
+		size_t CompactedCommandCount;
+		size_t CompactedBytesSaved;
+
+		size_t EvictedCommandCount;
+		size_t EvictedBytes;
+	};
+
 	class UndoManager : NonCopyable
 	{
 	public:
@@ -54,10 +68,21 @@ namespace Comfy::Undo
 		TimeSpan GetCommandMergeTimeThreshold() const;
 		void SetCommandMergeTimeThreshold(TimeSpan value);
 
+		// NOTE: Once exceeded the oldest commands at the bottom of the undo stack are evicted first, the most recent command is always kept
+		size_t GetMemoryBudget() const;
+		void SetMemoryBudget(size_t value);
+
+		const UndoHistoryMemoryStatistics& GetMemoryStatistics() const;
+
 	private:
 		void TryMergeOrExecute(std::unique_ptr<Command> commandToExecute);
 		bool CommandsAreOfSameType(const Command& commandA, const Command& commandB) const;
 
+		size_t GetCommandMemoryUsage(const Command& command) const;
+		void CompactCommand(Command& command);
+		void ClearRedoStack();
+		void EvictCommandsExceedingMemoryBudget();
+
 	private:
 		bool hasPendingChanges = false;
 
@@ -70,5 +95,7 @@ namespace Comfy::Undo
 		std::vector<std::unique_ptr<Command>> endOfFrameCommands;
 
 		std::vector<std::unique_ptr<Command>> undoStack, redoStack;
+
+		UndoHistoryMemoryStatistics memoryStatistics = {};
 	};
 }
@@ -1,11 +1,711 @@
 #include "Logger.h"
-#include <stdarg.h>
+#include "Misc/SPSCQueue.h"
+#include "Misc/UTF8.h"
+#include <condition_variable>
+#include <thread>
+#include <algorithm>
+#include <limits>
 
 namespace Comfy
 {
+	namespace
+	{
+		constexpr size_t LogRecordPayloadSize = 480;
+		constexpr size_t MaxFormatSpecifierLength = 32;
+		constexpr int MaxFormatPrecision = (std::numeric_limits<int>::max() - 9);
+
+		// NOTE: The payload either holds the captured arguments of the format string or, if they couldn't be captured, the already formatted text.
+		//		 Formatted text too large for the payload is moved to a separate heap allocation that is owned by the record
+		struct LogRecord
+		{
+			u64 SequenceIndex;
+			const char* Format;
+			char* OverflowText;
+			LogLevel Level;
+			bool AppendNewLine;
+			u16 PayloadSize;
+			std::array<char, LogRecordPayloadSize> Payload;
+		};
+
+		static_assert(sizeof(LogRecord) == 512);
+
+		enum class FormatLengthModifier : u8
+		{
+			None,
+			Char,
+			Short,
+			Long,
+			LongLong,
+			Size,
+			IntMax,
+			PtrDiff,
+			LongDouble,
+		};
+
+		struct FormatSpecifier
+		{
+			const char* Begin;
+			const char* End;
+			u8 StarCount;
+			bool HasPrecision;
+			bool PrecisionStar;
+			int Precision;
+			FormatLengthModifier Length;
+			char Conversion;
+		};
+
+		bool IsFormatDigit(char character)
+		{
+			return (character >= '0' && character <= '9');
+		}
+
+		// NOTE: Expects the format to point to the '%' character of the specifier
+		bool ParseFormatSpecifier(const char* format, FormatSpecifier& outSpecifier)
+		{
+			outSpecifier = {};
+			outSpecifier.Begin = format;
+
+			const char* it = (format + 1);
+			while (*it == '-' || *it == '+' || *it == ' ' || *it == '#' || *it == '0')
+				it++;
+
+			if (*it == '*') { outSpecifier.StarCount++; it++; }
+			else { while (IsFormatDigit(*it)) it++; }
+
+			if (*it == '.')
+			{
+				it++;
+				outSpecifier.HasPrecision = true;
+				if (*it == '*') { outSpecifier.StarCount++; outSpecifier.PrecisionStar = true; it++; }
+				else { for (; IsFormatDigit(*it); it++) outSpecifier.Precision = std::min(outSpecifier.Precision, MaxFormatPrecision / 10) * 10 + (*it - '0'); }
+			}
+
+			switch (*it)
+			{
+			case 'h': it++; if (*it == 'h') { outSpecifier.Length = FormatLengthModifier::Char; it++; } else { outSpecifier.Length = FormatLengthModifier::Short; } break;
+			case 'l': it++; if (*it == 'l') { outSpecifier.Length = FormatLengthModifier::LongLong; it++; } else { outSpecifier.Length = FormatLengthModifier::Long; } break;
+			case 'z': it++; outSpecifier.Length = FormatLengthModifier::Size; break;
+			case 'j': it++; outSpecifier.Length = FormatLengthModifier::IntMax; break;
+			case 't': it++; outSpecifier.Length = FormatLengthModifier::PtrDiff; break;
+			case 'L': it++; outSpecifier.Length = FormatLengthModifier::LongDouble; break;
+			case 'I':
+				// NOTE: MSVC specific "I64", "I32" and "I" size prefixes
+				it++;
+				if (it[0] == '6' && it[1] == '4') { outSpecifier.Length = FormatLengthModifier::LongLong; it += 2; }
+				else if (it[0] == '3' && it[1] == '2') { outSpecifier.Length = FormatLengthModifier::None; it += 2; }
+				else { outSpecifier.Length = FormatLengthModifier::Size; }
+				break;
+			}
+
+			if (*it == '\0')
+				return false;
+
+			outSpecifier.Conversion = *it;
+			outSpecifier.End = (it + 1);
+			return (static_cast<size_t>(outSpecifier.End - outSpecifier.Begin) < MaxFormatSpecifierLength);
+		}
+
+		bool TryCaptureFormatArguments(const char* format, va_list arguments, LogRecord& outRecord)
+		{
+			size_t payloadSize = 0;
+			auto writePayload = [&](const void* data, size_t dataSize)
+			{
+				if ((payloadSize + dataSize) > outRecord.Payload.size())
+					return false;
+
+				memcpy(&outRecord.Payload[payloadSize], data, dataSize);
+				payloadSize += dataSize;
+				return true;
+			};
+			auto writeValue = [&](auto value) { return writePayload(&value, sizeof(value)); };
+
+			for (const char* it = format; *it != '\0'; it++)
+			{
+				if (*it != '%')
+					continue;
+
+				if (it[1] == '%')
+				{
+					it++;
+					continue;
+				}
+
+				FormatSpecifier specifier;
+				if (!ParseFormatSpecifier(it, specifier))
+					return false;
+
+				int precision = specifier.Precision;
+				for (u8 i = 0; i < specifier.StarCount; i++)
+				{
+					const int starArgument = va_arg(arguments, int);
+					if (!writeValue(starArgument))
+						return false;
+
+					// NOTE: The precision star always follows the width star
+					if (specifier.PrecisionStar && (i + 1) == specifier.StarCount)
+						precision = starArgument;
+				}
+
+				bool captured = false;
+				switch (specifier.Conversion)
+				{
+				case 'd':
+				case 'i':
+				{
+					i64 value = 0;
+					switch (specifier.Length)
+					{
+					case FormatLengthModifier::Long: value = va_arg(arguments, long); break;
+					case FormatLengthModifier::LongLong: value = va_arg(arguments, long long); break;
+					case FormatLengthModifier::Size: value = va_arg(arguments, ptrdiff_t); break;
+					case FormatLengthModifier::IntMax: value = va_arg(arguments, intmax_t); break;
+					case FormatLengthModifier::PtrDiff: value = va_arg(arguments, ptrdiff_t); break;
+					case FormatLengthModifier::LongDouble: return false;
+					default: value = va_arg(arguments, int); break;
+					}
+					captured = writeValue(value);
+					break;
+				}
+				case 'u':
+				case 'o':
+				case 'x':
+				case 'X':
+				{
+					u64 value = 0;
+					switch (specifier.Length)
+					{
+					case FormatLengthModifier::Long: value = va_arg(arguments, unsigned long); break;
+					case FormatLengthModifier::LongLong: value = va_arg(arguments, unsigned long long); break;
+					case FormatLengthModifier::Size: value = va_arg(arguments, size_t); break;
+					case FormatLengthModifier::IntMax: value = va_arg(arguments, uintmax_t); break;
+					case FormatLengthModifier::PtrDiff: value = va_arg(arguments, size_t); break;
+					case FormatLengthModifier::LongDouble: return false;
+					default: value = va_arg(arguments, unsigned int); break;
+					}
+					captured = writeValue(value);
+					break;
+				}
+				case 'c':
+				{
+					if (specifier.Length != FormatLengthModifier::None)
+						return false;
+					captured = writeValue(va_arg(arguments, int));
+					break;
+				}
+				case 'f':
+				case 'F':
+				case 'e':
+				case 'E':
+				case 'g':
+				case 'G':
+				case 'a':
+				case 'A':
+				{
+					const f64 value = (specifier.Length == FormatLengthModifier::LongDouble) ? static_cast<f64>(va_arg(arguments, long double)) : va_arg(arguments, double);
+					captured = writeValue(value);
+					break;
+				}
+				case 'p':
+				{
+					captured = writeValue(va_arg(arguments, const void*));
+					break;
+				}
+				case 's':
+				{
+					// NOTE: Wide strings would have to be converted, these are rare enough to simply be formatted immediately
+					if (specifier.Length != FormatLengthModifier::None)
+						return false;
+
+					const char* value = va_arg(arguments, const char*);
+					if (value == nullptr)
+						value = "(null)";
+
+					// NOTE: With a precision the string may be a view that isn't null terminated, so only the characters that will be printed may be read.
+					//		 A negative precision star argument is treated as if the precision was omitted
+					const size_t length = (specifier.HasPrecision && precision >= 0) ? strnlen(value, static_cast<size_t>(precision)) : strlen(value);
+					captured = writePayload(value, length) && writeValue('\0');
+					break;
+				}
+				default:
+					return false;
+				}
+
+				if (!captured)
+					return false;
+
+				it = (specifier.End - 1);
+			}
+
+			outRecord.Format = format;
+			outRecord.PayloadSize = static_cast<u16>(payloadSize);
+			return true;
+		}
+
+		void FormatImmediately(const char* format, va_list arguments, LogRecord& outRecord)
+		{
+			va_list argumentsCopy;
+			va_copy(argumentsCopy, arguments);
+			const int length = vsnprintf(outRecord.Payload.data(), outRecord.Payload.size(), format, argumentsCopy);
+			va_end(argumentsCopy);
+
+			outRecord.Format = nullptr;
+			outRecord.PayloadSize = static_cast<u16>(std::max(length, 0));
+
+			if (length >= static_cast<int>(outRecord.Payload.size()))
+			{
+				outRecord.OverflowText = new char[length + 1];
+				vsnprintf(outRecord.OverflowText, length + 1, format, arguments);
+			}
+		}
+
+		void FormatImmediately(const char* format, va_list arguments, std::string& outText)
+		{
+			va_list argumentsCopy;
+			va_copy(argumentsCopy, arguments);
+			const int length = vsnprintf(nullptr, 0, format, argumentsCopy);
+			va_end(argumentsCopy);
+
+			if (length <= 0)
+				return;
+
+			const size_t offset = outText.size();
+			outText.resize(offset + length + 1);
+			vsnprintf(&outText[offset], length + 1, format, arguments);
+			outText.resize(offset + length);
+		}
+
+		void FormatCapturedArguments(const LogRecord& record, std::string& outText)
+		{
+			size_t payloadOffset = 0;
+			auto readValue = [&](auto& outValue)
+			{
+				memcpy(&outValue, &record.Payload[payloadOffset], sizeof(outValue));
+				payloadOffset += sizeof(outValue);
+			};
+
+			const char* literalBegin = record.Format;
+			for (const char* it = record.Format; *it != '\0'; it++)
+			{
+				if (*it != '%')
+					continue;
+
+				outText.append(literalBegin, it);
+				if (it[1] == '%')
+				{
+					outText += '%';
+					literalBegin = (++it + 1);
+					continue;
+				}
+
+				// NOTE: Already validated when the arguments were captured
+				FormatSpecifier specifier;
+				ParseFormatSpecifier(it, specifier);
+
+				std::array<int, 2> starArguments = {};
+				for (u8 i = 0; i < specifier.StarCount; i++)
+					readValue(starArguments[i]);
+
+				std::array<char, MaxFormatSpecifierLength> specifierString = {};
+				std::copy(specifier.Begin, specifier.End, specifierString.begin());
+
+				auto appendFormatted = [&](auto value)
+				{
+					auto formatValue = [&](char* buffer, size_t bufferSize)
+					{
+						switch (specifier.StarCount)
+						{
+						case 0: return snprintf(buffer, bufferSize, specifierString.data(), value);
+						case 1: return snprintf(buffer, bufferSize, specifierString.data(), starArguments[0], value);
+						default: return snprintf(buffer, bufferSize, specifierString.data(), starArguments[0], starArguments[1], value);
+						}
+					};
+
+					char buffer[256];
+					const int length = formatValue(buffer, sizeof(buffer));
+					if (length < 0)
+						return;
+
+					if (length < static_cast<int>(sizeof(buffer)))
+					{
+						outText.append(buffer, length);
+					}
+					else
+					{
+						const size_t offset = outText.size();
+						outText.resize(offset + length + 1);
+						formatValue(&outText[offset], length + 1);
+						outText.resize(offset + length);
+					}
+				};
+
+				switch (specifier.Conversion)
+				{
+				case 'd':
+				case 'i':
+				{
+					i64 value;
+					readValue(value);
+					switch (specifier.Length)
+					{
+					case FormatLengthModifier::Long: appendFormatted(static_cast<long>(value)); break;
+					case FormatLengthModifier::LongLong: appendFormatted(static_cast<long long>(value)); break;
+					case FormatLengthModifier::Size: appendFormatted(static_cast<ptrdiff_t>(value)); break;
+					case FormatLengthModifier::IntMax: appendFormatted(static_cast<intmax_t>(value)); break;
+					case FormatLengthModifier::PtrDiff: appendFormatted(static_cast<ptrdiff_t>(value)); break;
+					default: appendFormatted(static_cast<int>(value)); break;
+					}
+					break;
+				}
+				case 'u':
+				case 'o':
+				case 'x':
+				case 'X':
+				{
+					u64 value;
+					readValue(value);
+					switch (specifier.Length)
+					{
+					case FormatLengthModifier::Long: appendFormatted(static_cast<unsigned long>(value)); break;
+					case FormatLengthModifier::LongLong: appendFormatted(static_cast<unsigned long long>(value)); break;
+					case FormatLengthModifier::Size: appendFormatted(static_cast<size_t>(value)); break;
+					case FormatLengthModifier::IntMax: appendFormatted(static_cast<uintmax_t>(value)); break;
+					case FormatLengthModifier::PtrDiff: appendFormatted(static_cast<size_t>(value)); break;
+					default: appendFormatted(static_cast<unsigned int>(value)); break;
+					}
+					break;
+				}
+				case 'c':
+				{
+					int value;
+					readValue(value);
+					appendFormatted(value);
+					break;
+				}
+				case 'p':
+				{
+					const void* value;
+					readValue(value);
+					appendFormatted(value);
+					break;
+				}
+				case 's':
+				{
+					// NOTE: Always null terminated by the capture, including precision limited views
+					const char* value = &record.Payload[payloadOffset];
+					payloadOffset += (strlen(value) + 1);
+					appendFormatted(value);
+					break;
+				}
+				default:
+				{
+					f64 value;
+					readValue(value);
+					if (specifier.Length == FormatLengthModifier::LongDouble)
+						appendFormatted(static_cast<long double>(value));
+					else
+						appendFormatted(value);
+					break;
+				}
+				}
+
+				it = (specifier.End - 1);
+				literalBegin = specifier.End;
+			}
+
+			outText.append(literalBegin);
+		}
+
+		void FormatLogRecord(const LogRecord& record, std::string& outText)
+		{
+			outText.clear();
+			if (record.Format != nullptr)
+				FormatCapturedArguments(record, outText);
+			else if (record.OverflowText != nullptr)
+				outText.append(record.OverflowText);
+			else
+				outText.append(record.Payload.data(), record.PayloadSize);
+
+			if (record.AppendNewLine)
+				outText += '\n';
+		}
+
+		struct ThreadLogBuffer
+		{
+			SPSCQueue<LogRecord, Logger::ThreadBufferCapacity> Queue;
+		};
+
+		struct GlobalLoggerState
+		{
+			std::atomic<LogLevel> MinLevel = LogLevel::Debug;
+			std::atomic<bool> AsyncEnabled = false;
+			std::atomic<u64> NextSequenceIndex = 0;
+
+			// NOTE: Held while writing to any of the sinks
+			std::mutex SinkMutex;
+			std::vector<std::shared_ptr<LogSink>> Sinks = { std::make_shared<ConsoleLogSink>() };
+
+			// NOTE: Only locked once per thread when its buffer is first created and by the flush thread
+			std::mutex ThreadBufferMutex;
+			std::vector<std::shared_ptr<ThreadLogBuffer>> ThreadBuffers;
+
+			std::mutex FlushMutex;
+			std::condition_variable FlushRequestCondition;
+			std::condition_variable DrainCompletedCondition;
+			u64 CompletedDrainCount = 0;
+			bool ExitRequested = false;
+			std::thread FlushThread;
+
+			~GlobalLoggerState();
+		};
+
+		GlobalLoggerState& GetGlobalState()
+		{
+			// NOTE: Function local so that logging during static initialization is still safe
+			static GlobalLoggerState state;
+			return state;
+		}
+
+		ThreadLogBuffer& GetThisThreadLogBuffer()
+		{
+			// NOTE: The registered reference keeps the buffer alive after its thread has exited until all of its messages have been written
+			thread_local std::shared_ptr<ThreadLogBuffer> thisThreadBuffer = []
+			{
+				auto& state = GetGlobalState();
+				auto newBuffer = std::make_shared<ThreadLogBuffer>();
+
+				const auto lock = std::scoped_lock(state.ThreadBufferMutex);
+				state.ThreadBuffers.push_back(newBuffer);
+				return newBuffer;
+			}();
+
+			return *thisThreadBuffer;
+		}
+
+		// NOTE: Caller must hold the sink lock
+		void WriteToAllSinks(GlobalLoggerState& state, LogLevel level, std::string_view text)
+		{
+			for (const auto& sink : state.Sinks)
+				sink->Write(level, text);
+		}
+
+		struct FlushThreadData
+		{
+			std::vector<std::shared_ptr<ThreadLogBuffer>> ThreadBuffers;
+			std::vector<LogRecord> DrainedRecords;
+			std::vector<u32> SortedRecordIndices;
+			std::string FormattedText;
+		};
+
+		// NOTE: Returns the number of records written, each thread buffer is drained at most once so that a fast producer can't stall the others
+		size_t DrainAndWriteThreadBuffers(GlobalLoggerState& state, FlushThreadData& data)
+		{
+			{
+				const auto lock = std::scoped_lock(state.ThreadBufferMutex);
+				data.ThreadBuffers.assign(state.ThreadBuffers.begin(), state.ThreadBuffers.end());
+			}
+
+			data.DrainedRecords.clear();
+			for (const auto& threadBuffer : data.ThreadBuffers)
+			{
+				for (size_t i = 0; i < Logger::ThreadBufferCapacity; i++)
+				{
+					if (!threadBuffer->Queue.TryPop(data.DrainedRecords.emplace_back()))
+					{
+						data.DrainedRecords.pop_back();
+						break;
+					}
+				}
+			}
+
+			// NOTE: Each thread buffer is already in order so only the interleaving between threads has to be restored
+			data.SortedRecordIndices.resize(data.DrainedRecords.size());
+			for (u32 i = 0; i < static_cast<u32>(data.SortedRecordIndices.size()); i++)
+				data.SortedRecordIndices[i] = i;
+			std::sort(data.SortedRecordIndices.begin(), data.SortedRecordIndices.end(), [&](u32 a, u32 b) { return (data.DrainedRecords[a].SequenceIndex < data.DrainedRecords[b].SequenceIndex); });
+
+			if (!data.DrainedRecords.empty())
+			{
+				const auto lock = std::scoped_lock(state.SinkMutex);
+				for (const u32 recordIndex : data.SortedRecordIndices)
+				{
+					auto& record = data.DrainedRecords[recordIndex];
+					FormatLogRecord(record, data.FormattedText);
+					WriteToAllSinks(state, record.Level, data.FormattedText);
+					delete[] record.OverflowText;
+				}
+
+				for (const auto& sink : state.Sinks)
+					sink->Flush();
+			}
+
+			{
+				// NOTE: Once only the registry holds a reference the owning thread has exited and can no longer push any new records
+				const auto lock = std::scoped_lock(state.ThreadBufferMutex);
+				auto& buffers = state.ThreadBuffers;
+				buffers.erase(std::remove_if(buffers.begin(), buffers.end(), [](const auto& buffer) { return (buffer.use_count() == 1) && (buffer->Queue.ApproximateSize() == 0); }), buffers.end());
+			}
+
+			data.ThreadBuffers.clear();
+			return data.DrainedRecords.size();
+		}
+
+		void FlushThreadEntryPoint()
+		{
+			auto& state = GetGlobalState();
+			auto data = std::make_unique<FlushThreadData>();
+
+			while (true)
+			{
+				bool exitRequested = false;
+				{
+					auto lock = std::unique_lock(state.FlushMutex);
+					exitRequested = state.ExitRequested;
+				}
+
+				const size_t writtenCount = DrainAndWriteThreadBuffers(state, *data);
+
+				{
+					auto lock = std::unique_lock(state.FlushMutex);
+					state.CompletedDrainCount++;
+					state.DrainCompletedCondition.notify_all();
+
+					if (exitRequested && writtenCount == 0)
+						break;
+
+					// NOTE: Keep draining without waiting while the producers are still filling up the buffers
+					if (writtenCount == 0 && !state.ExitRequested)
+						state.FlushRequestCondition.wait_for(lock, std::chrono::milliseconds(Logger::FlushIntervalMS));
+				}
+			}
+		}
+
+		void StopFlushThread(GlobalLoggerState& state)
+		{
+			state.AsyncEnabled.store(false, std::memory_order_release);
+
+			std::thread flushThread;
+			{
+				const auto lock = std::scoped_lock(state.FlushMutex);
+				state.ExitRequested = true;
+				flushThread = std::move(state.FlushThread);
+			}
+
+			if (!flushThread.joinable())
+				return;
+
+			state.FlushRequestCondition.notify_one();
+			flushThread.join();
+
+			// NOTE: Pick up anything pushed by threads that were still in the middle of logging while the flush thread was exiting
+			auto data = std::make_unique<FlushThreadData>();
+			DrainAndWriteThreadBuffers(state, *data);
+
+			const auto lock = std::scoped_lock(state.FlushMutex);
+			state.DrainCompletedCondition.notify_all();
+		}
+
+		GlobalLoggerState::~GlobalLoggerState()
+		{
+			// NOTE: In case the owner forgot to stop it, otherwise destroying the joinable thread would terminate the program
+			StopFlushThread(*this);
+		}
+	}
+
+	void ConsoleLogSink::Write(LogLevel level, std::string_view text)
+	{
+		fwrite(text.data(), sizeof(char), text.size(), (level >= LogLevel::Error) ? stderr : stdout);
+	}
+
+	void ConsoleLogSink::Flush()
+	{
+		fflush(stdout);
+		fflush(stderr);
+	}
+
+	FileLogSink::FileLogSink(std::string_view filePath)
+	{
+		if (::_wfopen_s(&file, UTF8::WideArg(filePath).c_str(), L"wb") != 0)
+			file = nullptr;
+	}
+
+	FileLogSink::~FileLogSink()
+	{
+		if (file != nullptr)
+			fclose(file);
+	}
+
+	void FileLogSink::Write(LogLevel level, std::string_view text)
+	{
+		if (file != nullptr)
+			fwrite(text.data(), sizeof(char), text.size(), file);
+	}
+
+	void FileLogSink::Flush()
+	{
+		if (file != nullptr)
+			fflush(file);
+	}
+
+	bool FileLogSink::IsOpen() const
+	{
+		return (file != nullptr);
+	}
+
+	MemoryLogSink::MemoryLogSink(size_t maxLineCount) : maxLineCount(std::max<size_t>(maxLineCount, 1))
+	{
+	}
+
+	void MemoryLogSink::Write(LogLevel level, std::string_view text)
+	{
+		const auto lock = std::scoped_lock(mutex);
+
+		// NOTE: Messages logged without a trailing new line are joined together with the ones that follow
+		while (!text.empty())
+		{
+			const size_t newLineIndex = text.find('\n');
+			const auto lineText = text.substr(0, newLineIndex);
+
+			if (!lastLineComplete && !lines.empty())
+			{
+				lines.back().Text += lineText;
+				lines.back().Level = std::max(lines.back().Level, level);
+			}
+			else
+			{
+				if (lines.size() >= maxLineCount)
+					lines.pop_front();
+				lines.push_back(Line { level, std::string(lineText) });
+			}
+
+			lastLineComplete = (newLineIndex != std::string_view::npos);
+			text = lastLineComplete ? text.substr(newLineIndex + 1) : std::string_view();
+		}
+
+		version.fetch_add(1, std::memory_order_release);
+	}
+
+	u32 MemoryLogSink::GetVersion() const
+	{
+		return version.load(std::memory_order_acquire);
+	}
+
+	void MemoryLogSink::CopyLines(std::vector<Line>& outLines) const
+	{
+		const auto lock = std::scoped_lock(mutex);
+		outLines.assign(lines.begin(), lines.end());
+	}
+
+	void MemoryLogSink::Clear()
+	{
+		const auto lock = std::scoped_lock(mutex);
+		lines.clear();
+		lastLineComplete = true;
+		version.fetch_add(1, std::memory_order_release);
+	}
+
 	void Logger::NewLine()
 	{
-		putc('\n', GetStream());
+		Log(LogLevel::Info, "\n");
 	}
 
 	void Logger::Log(_Printf_format_string_ char const* const format, ...)
@@ -13,7 +713,7 @@ namespace Comfy
 		va_list arguments;
 
 		va_start(arguments, format);
-		vfprintf(GetStream(), format, arguments);
+		LogInternal(LogLevel::Info, false, format, arguments);
 		va_end(arguments);
 	}
 
@@ -22,9 +722,8 @@ namespace Comfy
 		va_list arguments;
 
 		va_start(arguments, format);
-		vfprintf(GetStream(), format, arguments);
+		LogInternal(LogLevel::Info, true, format, arguments);
 		va_end(arguments);
-		putchar('\n');
 	}
 
 	void Logger::LogError(_Printf_format_string_ char const* const format, ...)
@@ -32,7 +731,7 @@ namespace Comfy
 		va_list arguments;
 
 		va_start(arguments, format);
-		vfprintf(GetErrorStream(), format, arguments);
+		LogInternal(LogLevel::Error, false, format, arguments);
 		va_end(arguments);
 	}
 
@@ -41,18 +740,166 @@ namespace Comfy
 		va_list arguments;
 
 		va_start(arguments, format);
-		vfprintf(GetErrorStream(), format, arguments);
+		LogInternal(LogLevel::Error, true, format, arguments);
+		va_end(arguments);
+	}
+
+	void Logger::Log(LogLevel level, _Printf_format_string_ char const* const format, ...)
+	{
+		va_list arguments;
+
+		va_start(arguments, format);
+		LogInternal(level, false, format, arguments);
+		va_end(arguments);
+	}
+
+	void Logger::LogLine(LogLevel level, _Printf_format_string_ char const* const format, ...)
+	{
+		va_list arguments;
+
+		va_start(arguments, format);
+		LogInternal(level, true, format, arguments);
 		va_end(arguments);
-		putchar('\n');
 	}
 
-	FILE* Logger::GetStream()
+	void Logger::StartAsyncFlushThread()
+	{
+		auto& state = GetGlobalState();
+		{
+			const auto lock = std::scoped_lock(state.FlushMutex);
+			if (state.FlushThread.joinable())
+				return;
+
+			state.ExitRequested = false;
+			state.FlushThread = std::thread(FlushThreadEntryPoint);
+		}
+
+		state.AsyncEnabled.store(true, std::memory_order_release);
+	}
+
+	void Logger::StopAsyncFlushThread()
+	{
+		StopFlushThread(GetGlobalState());
+	}
+
+	bool Logger::IsAsyncFlushThreadRunning()
+	{
+		return GetGlobalState().AsyncEnabled.load(std::memory_order_acquire);
+	}
+
+	void Logger::Flush()
+	{
+		auto& state = GetGlobalState();
+		if (state.AsyncEnabled.load(std::memory_order_acquire))
+		{
+			auto lock = std::unique_lock(state.FlushMutex);
+			if (state.FlushThread.joinable())
+			{
+				// NOTE: The drain currently in progress might have already passed this thread's buffer so wait for the one after
+				const u64 targetDrainCount = (state.CompletedDrainCount + 2);
+				state.FlushRequestCondition.notify_one();
+				state.DrainCompletedCondition.wait(lock, [&] { return (state.CompletedDrainCount >= targetDrainCount) || !state.FlushThread.joinable(); });
+				return;
+			}
+		}
+
+		const auto lock = std::scoped_lock(state.SinkMutex);
+		for (const auto& sink : state.Sinks)
+			sink->Flush();
+	}
+
+	void Logger::SetMinLevel(LogLevel level)
+	{
+		GetGlobalState().MinLevel.store(level, std::memory_order_relaxed);
+	}
+
+	LogLevel Logger::GetMinLevel()
 	{
-		return stdout;
+		return GetGlobalState().MinLevel.load(std::memory_order_relaxed);
 	}
 
-	FILE* Logger::GetErrorStream()
+	void Logger::AddSink(std::shared_ptr<LogSink> sink)
 	{
-		return stderr;
+		if (sink == nullptr)
+			return;
+
+		auto& state = GetGlobalState();
+		const auto lock = std::scoped_lock(state.SinkMutex);
+		state.Sinks.push_back(std::move(sink));
+	}
+
+	void Logger::RemoveSink(const LogSink* sink)
+	{
+		auto& state = GetGlobalState();
+		const auto lock = std::scoped_lock(state.SinkMutex);
+		state.Sinks.erase(std::remove_if(state.Sinks.begin(), state.Sinks.end(), [&](const auto& s) { return (s.get() == sink); }), state.Sinks.end());
+	}
+
+	std::vector<std::shared_ptr<LogSink>> Logger::GetSinks()
+	{
+		auto& state = GetGlobalState();
+		const auto lock = std::scoped_lock(state.SinkMutex);
+		return state.Sinks;
+	}
+
+	void Logger::SetSinks(std::vector<std::shared_ptr<LogSink>> sinks)
+	{
+		auto& state = GetGlobalState();
+		const auto lock = std::scoped_lock(state.SinkMutex);
+		state.Sinks = std::move(sinks);
+	}
+
+	void Logger::LogInternal(LogLevel level, bool appendNewLine, char const* const format, va_list arguments)
+	{
+		auto& state = GetGlobalState();
+		if (level < state.MinLevel.load(std::memory_order_relaxed))
+			return;
+
+		if (!state.AsyncEnabled.load(std::memory_order_acquire))
+		{
+			std::string formattedText;
+			FormatImmediately(format, arguments, formattedText);
+			if (appendNewLine)
+				formattedText += '\n';
+
+			const auto lock = std::scoped_lock(state.SinkMutex);
+			WriteToAllSinks(state, level, formattedText);
+			return;
+		}
+
+		LogRecord record;
+		record.SequenceIndex = state.NextSequenceIndex.fetch_add(1, std::memory_order_relaxed);
+		record.OverflowText = nullptr;
+		record.Level = level;
+		record.AppendNewLine = appendNewLine;
+
+		va_list argumentsCopy;
+		va_copy(argumentsCopy, arguments);
+		if (!TryCaptureFormatArguments(format, argumentsCopy, record))
+			FormatImmediately(format, arguments, record);
+		va_end(argumentsCopy);
+
+		auto& threadBuffer = GetThisThreadLogBuffer();
+		while (!threadBuffer.Queue.TryPush(record))
+		{
+			// NOTE: Rather than dropping messages wait for the flush thread to catch up, unless it has already been stopped in the meantime
+			if (!state.AsyncEnabled.load(std::memory_order_acquire))
+			{
+				std::string formattedText;
+				FormatLogRecord(record, formattedText);
+				delete[] record.OverflowText;
+
+				const auto lock = std::scoped_lock(state.SinkMutex);
+				WriteToAllSinks(state, level, formattedText);
+				return;
+			}
+
+			state.FlushRequestCondition.notify_one();
+			std::this_thread::yield();
+		}
+
+		// NOTE: Errors should become visible as soon as possible, in case the program is about to crash
+		if (level >= LogLevel::Error || threadBuffer.Queue.ApproximateSize() >= (ThreadBufferCapacity / 2))
+			state.FlushRequestCondition.notify_one();
 	}
 }
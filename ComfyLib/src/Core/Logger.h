@@ -1,11 +1,113 @@
 #pragma once
 #include "Types.h"
 #include <stdio.h>
+#include <stdarg.h>
+#include <atomic>
+#include <mutex>
+#include <deque>
 
 namespace Comfy
 {
+	enum class LogLevel : u8
+	{
+		Debug,
+		Info,
+		Warning,
+		Error,
+		Count
+	};
+
+	constexpr std::array<const char*, EnumCount<LogLevel>()> LogLevelNames =
+	{
+		"Debug",
+		"Info",
+		"Warning",
+		"Error",
+	};
+
+	// NOTE: Receives fully formatted text including any trailing new line characters.
+	//		 Never called by more than one thread at a time, though not necessarily always by the same thread
+	class LogSink
+	{
+	public:
+		virtual ~LogSink() = default;
+
+		virtual void Write(LogLevel level, std::string_view text) = 0;
+		virtual void Flush() {}
+	};
+
+	// NOTE: Writes errors to stderr and everything else to stdout
+	class ConsoleLogSink : public LogSink
+	{
+	public:
+		ConsoleLogSink() = default;
+		~ConsoleLogSink() override = default;
+
+	public:
+		void Write(LogLevel level, std::string_view text) override;
+		void Flush() override;
+	};
+
+	class FileLogSink : public LogSink, NonCopyable
+	{
+	public:
+		// NOTE: Truncates any existing file
+		FileLogSink(std::string_view filePath);
+		~FileLogSink() override;
+
+	public:
+		void Write(LogLevel level, std::string_view text) override;
+		void Flush() override;
+
+		bool IsOpen() const;
+
+	private:
+		FILE* file = nullptr;
+	};
+
+	// NOTE: Keeps the most recent lines in memory to be displayed inside the editor, unlike the writing side the lines may be read from any thread
+	class MemoryLogSink : public LogSink
+	{
+	public:
+		static constexpr size_t DefaultMaxLineCount = 2048;
+
+		struct Line
+		{
+			LogLevel Level;
+			std::string Text;
+		};
+
+	public:
+		MemoryLogSink(size_t maxLineCount = DefaultMaxLineCount);
+		~MemoryLogSink() override = default;
+
+	public:
+		void Write(LogLevel level, std::string_view text) override;
+
+		// NOTE: Incremented every time the lines change so that readers only have to copy them when needed
+		u32 GetVersion() const;
+		void CopyLines(std::vector<Line>& outLines) const;
+		void Clear();
+
+	private:
+		const size_t maxLineCount;
+		std::atomic<u32> version = 0;
+
+		mutable std::mutex mutex;
+		std::deque<Line> lines;
+		bool lastLineComplete = true;
+	};
+
+	// NOTE: Until the async flush thread is started every message is formatted and written to all sinks on the calling thread while holding the sink lock.
+	//		 Afterwards a message only copies its format string pointer and arguments into a lock-free per thread ring buffer,
+	//		 formatting and writing is then deferred to the flush thread which merges all thread buffers back into their original order.
+	//		 Format strings are therefore required to be string literals, any "%s" argument is copied at the time of the call
 	class Logger
 	{
+	public:
+		static constexpr size_t ThreadBufferCapacity = 256;
+		static constexpr i32 FlushIntervalMS = 10;
+
 	public:
 		static void NewLine();
 		static void Log(_Printf_format_string_ char const* const format, ...);
@@ -13,8 +115,31 @@ namespace Comfy
 		static void LogError(_Printf_format_string_ char const* const format, ...);
 		static void LogErrorLine(_Printf_format_string_ char const* const format, ...);
 
+		static void Log(LogLevel level, _Printf_format_string_ char const* const format, ...);
+		static void LogLine(LogLevel level, _Printf_format_string_ char const* const format, ...);
+
+	public:
+		static void StartAsyncFlushThread();
+		// NOTE: Writes out all remaining messages before returning
+		static void StopAsyncFlushThread();
+		static bool IsAsyncFlushThreadRunning();
+
+		// NOTE: Blocks until every message logged before the call has been written and flushes all sinks
+		static void Flush();
+
+	public:
+		// NOTE: Messages below the min level are discarded on the calling thread before any of their arguments are read
+		static void SetMinLevel(LogLevel level);
+		static LogLevel GetMinLevel();
+
+		static void AddSink(std::shared_ptr<LogSink> sink);
+		static void RemoveSink(const LogSink* sink);
+
+		// NOTE: A console sink is registered by default
+		static std::vector<std::shared_ptr<LogSink>> GetSinks();
+		static void SetSinks(std::vector<std::shared_ptr<LogSink>> sinks);
+
 	private:
-		static FILE* GetStream();
-		static FILE* GetErrorStream();
+		static void LogInternal(LogLevel level, bool appendNewLine, char const* const format, va_list arguments);
 	};
 }
@@ -6,14 +6,45 @@ namespace Comfy::Database
 {
 	using namespace IO;
 
+	namespace
+	{
+		constexpr auto AetSceneEntryIDKey = [](const AetSceneEntry& e) { return e.ID; };
+		constexpr auto AetSceneEntryNameKey = [](const AetSceneEntry& e) { return std::string_view(e.Name); };
+
+		constexpr auto AetSetEntryIDKey = [](const AetSetEntry& e) { return e.ID; };
+		constexpr auto AetSetEntryNameKey = [](const AetSetEntry& e) { return std::string_view(e.Name); };
+	}
+
+	AetSceneEntry* AetSetEntry::GetSceneEntry(AetSceneID id)
+	{
+		return sceneIDIndex.Find(SceneEntries, id, AetSceneEntryIDKey);
+	}
+
 	AetSceneEntry* AetSetEntry::GetSceneEntry(std::string_view name)
 	{
-		return FindIfOrNull(SceneEntries, [&](const auto& e) { return e.Name == name; });
+		return sceneNameIndex.Find(SceneEntries, name, AetSceneEntryNameKey);
+	}
+
+	void AetSetEntry::InvalidateIndices()
+	{
+		sceneIDIndex.Invalidate();
+		sceneNameIndex.Invalidate();
+	}
+
+	AetSetEntry* AetDB::GetAetSetEntry(AetSetID id)
+	{
+		return setIDIndex.Find(Entries, id, AetSetEntryIDKey);
 	}
 
 	AetSetEntry* AetDB::GetAetSetEntry(std::string_view name)
 	{
-		return FindIfOrNull(Entries, [&](const auto& e) { return e.Name == name; });
+		return setNameIndex.Find(Entries, name, AetSetEntryNameKey);
+	}
+
+	void AetDB::InvalidateIndices()
+	{
+		setIDIndex.Invalidate();
+		setNameIndex.Invalidate();
 	}
 
 	StreamResult AetDB::Read(StreamReader& reader)
@@ -30,6 +61,8 @@ namespace Comfy::Database
 				reader.PushBaseOffset();
 		}
 
+		InvalidateIndices();
+
 		const auto setEntryCount = reader.ReadU32();
 		if (reader.GetPointerMode() == PtrMode::Mode64Bit)
 			reader.Skip(static_cast<FileAddr>(sizeof(u32)));
@@ -50,6 +83,7 @@ namespace Comfy::Database
 			{
 				for (auto& setEntry : Entries)
 				{
+					setEntry.InvalidateIndices();
 					setEntry.ID = AetSetID(reader.ReadU32());
 					if (reader.GetPointerMode() == PtrMode::Mode64Bit)
 						reader.Skip(static_cast<FileAddr>(sizeof(u32)));
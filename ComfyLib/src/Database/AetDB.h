@@ -18,7 +18,15 @@ namespace Comfy::Database
 		std::vector<AetSceneEntry> SceneEntries;
 		std::string FileName;
 
+		AetSceneEntry* GetSceneEntry(AetSceneID id);
 		AetSceneEntry* GetSceneEntry(std::string_view name);
+
+		// NOTE: Must be called after modifying the ID or Name of an existing AetSceneEntry
+		void InvalidateIndices();
+
+	private:
+		LazyEntryIndex<AetSceneID> sceneIDIndex;
+		LazyEntryIndex<std::string_view> sceneNameIndex;
 	};
 
 	class AetDB final : public BinaryDatabase
@@ -27,12 +35,19 @@ namespace Comfy::Database
 		std::vector<AetSetEntry> Entries;
 
 	public:
+		AetSetEntry* GetAetSetEntry(AetSetID id);
 		AetSetEntry* GetAetSetEntry(std::string_view name);
 
 	public:
 		IO::StreamResult Read(IO::StreamReader& reader) override;
 		IO::StreamResult Write(IO::StreamWriter& writer) override;
 
+	public:
+		// NOTE: Must be called after modifying the ID or Name of an existing AetSetEntry, does not invalidate the indices of the individual AetSetEntries
+		void InvalidateIndices();
+
 	private:
+		LazyEntryIndex<AetSetID> setIDIndex;
+		LazyEntryIndex<std::string_view> setNameIndex;
 	};
 }
@@ -2,11 +2,108 @@
 #include "Types.h"
 #include "Resource/IDTypes.h"
 #include "IO/Stream/FileInterfaces.h"
+#include <unordered_map>
 
 namespace Comfy::Database
 {
 	struct DateEntry { i32 Year, Month, Day; };
 
+	// NOTE: Lazily built hash index mapping the key hash of each entry to its position inside an entry vector, for duplicate keys the first entry wins same as a linear search.
+	//		 Only hashes are stored so no key can ever dangle and every hit is verified against the key of the entry itself, a verification revealing a stale index triggers a rebuild.
+	//		 Every mutation of the entries (including in place edits of an indexed key) should be followed by an Invalidate() call which increments the mutation counter.
+	//		 Building happens on first use so lookups from multiple threads require the index to be built up front
+	template <typename KeyType>
+	class LazyEntryIndex
+	{
+	public:
+		// NOTE: Small vectors are faster to search linearly than to hash and aren't worth the extra memory
+		static constexpr size_t LinearSearchThreshold = 16;
+
+	public:
+		template <typename EntryType, typename KeyFunc>
+		EntryType* Find(std::vector<EntryType>& entries, const KeyType& key, KeyFunc keyFunc) const
+		{
+			return const_cast<EntryType*>(Find(static_cast<const std::vector<EntryType>&>(entries), key, keyFunc));
+		}
+
+		template <typename EntryType, typename KeyFunc>
+		const EntryType* Find(const std::vector<EntryType>& entries, const KeyType& key, KeyFunc keyFunc) const
+		{
+			if (entries.size() < LinearSearchThreshold)
+				return FindIfOrNull(entries, [&](const auto& e) { return (keyFunc(e) == key); });
+
+			BuildIfNeeded(entries, keyFunc);
+
+			bool isStale = false;
+			const auto* found = FindInIndex(entries, key, keyFunc, isStale);
+			if (!isStale)
+				return found;
+
+			// NOTE: Only reachable if the entries were mutated without a following Invalidate() call
+			mutationCounter++;
+			BuildIfNeeded(entries, keyFunc);
+			return FindInIndex(entries, key, keyFunc, isStale);
+		}
+
+		template <typename EntryType, typename KeyFunc>
+		void BuildIfNeeded(const std::vector<EntryType>& entries, KeyFunc keyFunc) const
+		{
+			if (indexedMutationCounter == mutationCounter && indexedEntryCount == entries.size())
+				return;
+
+			hashToIndex.clear();
+			hashToIndex.reserve(entries.size());
+			for (size_t i = 0; i < entries.size(); i++)
+				hashToIndex.emplace(std::hash<KeyType> {}(keyFunc(entries[i])), static_cast<u32>(i));
+
+			indexedMutationCounter = mutationCounter;
+			indexedEntryCount = entries.size();
+		}
+
+		void Invalidate()
+		{
+			mutationCounter++;
+		}
+
+	private:
+		template <typename EntryType, typename KeyFunc>
+		const EntryType* FindInIndex(const std::vector<EntryType>& entries, const KeyType& key, KeyFunc keyFunc, bool& outIsStale) const
+		{
+			const size_t keyHash = std::hash<KeyType> {}(key);
+			const auto[rangeBegin, rangeEnd] = hashToIndex.equal_range(keyHash);
+
+			const EntryType* firstFound = nullptr;
+			for (auto it = rangeBegin; it != rangeEnd; it++)
+			{
+				if (it->second >= entries.size())
+				{
+					outIsStale = true;
+					continue;
+				}
+
+				const auto& entry = entries[it->second];
+				const auto entryKey = keyFunc(entry);
+
+				if (entryKey == key)
+				{
+					if (firstFound == nullptr || &entry < firstFound)
+						firstFound = &entry;
+				}
+				else if (std::hash<KeyType> {}(entryKey) != keyHash)
+				{
+					outIsStale = true;
+				}
+			}
+			return firstFound;
+		}
+
+	private:
+		mutable std::unordered_multimap<size_t, u32> hashToIndex;
+		mutable u32 mutationCounter = 1;
+		mutable u32 indexedMutationCounter = 0;
+		mutable size_t indexedEntryCount = 0;
+	};
+
 	class BinaryDatabase : public IO::IStreamReadable, public IO::IStreamWritable
 	{
 	public:
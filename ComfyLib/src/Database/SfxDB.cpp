@@ -9,6 +9,8 @@ namespace Comfy::Database
 
 	namespace
 	{
+		constexpr auto SfxEntryNameKey = [](const SfxEntry& e) { return std::string_view(e.Name); };
+
 		struct SfxDBParser final : public StringParsing::TextDatabaseParser
 		{
 		private:
@@ -64,7 +66,24 @@ namespace Comfy::Database
 		const char* const startOfTextBuffer = reinterpret_cast<const char*>(buffer);
 		const char* const endOfTextBuffer = reinterpret_cast<const char*>(buffer + bufferSize);
 
+		InvalidateIndices();
+
 		SfxDBParser parser;
 		parser.Parse(*this, startOfTextBuffer, endOfTextBuffer);
 	}
+
+	const SfxEntry* SfxDB::GetSfxEntry(std::string_view name) const
+	{
+		return nameIndex.Find(Entries, name, SfxEntryNameKey);
+	}
+
+	void SfxDB::InvalidateIndices()
+	{
+		nameIndex.Invalidate();
+	}
+
+	void SfxDB::BuildIndices() const
+	{
+		nameIndex.BuildIfNeeded(Entries, SfxEntryNameKey);
+	}
 }
@@ -25,6 +25,14 @@ namespace Comfy::Database
 	public:
 		void Parse(const u8* buffer, size_t bufferSize) override;
 
+		const SfxEntry* GetSfxEntry(std::string_view name) const;
+
+		// NOTE: Must be called after modifying the Name of an existing entry
+		void InvalidateIndices();
+		// NOTE: Builds all lazy indices up front so that the database can safely be shared between threads as long as it isn't modified
+		void BuildIndices() const;
+
 	private:
+		LazyEntryIndex<std::string_view> nameIndex;
 	};
 }
@@ -7,24 +7,86 @@ namespace Comfy::Database
 {
 	using namespace IO;
 
+	namespace
+	{
+		constexpr auto SprEntryIDKey = [](const SprEntry& e) { return e.ID; };
+		constexpr auto SprEntryNameKey = [](const SprEntry& e) { return std::string_view(e.Name); };
+
+		constexpr auto SprSetEntryIDKey = [](const SprSetEntry& e) { return e.ID; };
+		constexpr auto SprSetEntryNameKey = [](const SprSetEntry& e) { return std::string_view(e.Name); };
+	}
+
 	SprEntry* SprSetEntry::GetSprEntry(SprID id)
 	{
-		return FindIfOrNull(SprEntries, [&](const auto& e) { return (e.ID == id); });
+		return sprIDIndex.Find(SprEntries, id, SprEntryIDKey);
 	}
 
 	SprEntry* SprSetEntry::GetSprEntry(std::string_view name)
 	{
-		return FindIfOrNull(SprEntries, [&](const auto& e) { return (e.Name == name); });
+		return sprNameIndex.Find(SprEntries, name, SprEntryNameKey);
 	}
 
 	SprEntry* SprSetEntry::GetSprTexEntry(std::string_view name)
 	{
-		return FindIfOrNull(SprTexEntries, [&](const auto& e) { return (e.Name == name); });
+		return sprTexNameIndex.Find(SprTexEntries, name, SprEntryNameKey);
+	}
+
+	void SprSetEntry::InvalidateIndices()
+	{
+		sprIDIndex.Invalidate();
+		sprNameIndex.Invalidate();
+		sprTexNameIndex.Invalidate();
+	}
+
+	SprSetEntry* SprDB::GetSprSetEntry(SprSetID id)
+	{
+		return setIDIndex.Find(Entries, id, SprSetEntryIDKey);
 	}
 
 	SprSetEntry* SprDB::GetSprSetEntry(std::string_view name)
 	{
-		return FindIfOrNull(Entries, [&](const auto& e) { return (e.Name == name); });
+		return setNameIndex.Find(Entries, name, SprSetEntryNameKey);
+	}
+
+	SprEntry* SprDB::GetSprEntry(SprID id)
+	{
+		if (sprIDIndexedMutationCounter != mutationCounter || sprIDIndexedEntryCount != Entries.size())
+		{
+			sprIDToLocation.clear();
+			sprIDToLocation.reserve(GetSprEntryCount());
+
+			for (u32 setIndex = 0; setIndex < static_cast<u32>(Entries.size()); setIndex++)
+			{
+				const auto& sprEntries = Entries[setIndex].SprEntries;
+				for (u32 sprIndex = 0; sprIndex < static_cast<u32>(sprEntries.size()); sprIndex++)
+					sprIDToLocation.emplace(sprEntries[sprIndex].ID, SprEntryLocation { setIndex, sprIndex });
+			}
+
+			sprIDIndexedMutationCounter = mutationCounter;
+			sprIDIndexedEntryCount = Entries.size();
+		}
+
+		const auto found = sprIDToLocation.find(id);
+		if (found == sprIDToLocation.end())
+			return nullptr;
+
+		// NOTE: Guard against nested edits that weren't followed by an InvalidateIndices() call, a freshly rebuilt index is always up to date so this only recurses once
+		const auto[setIndex, sprIndex] = found->second;
+		if (!InBounds(setIndex, Entries) || !InBounds(sprIndex, Entries[setIndex].SprEntries) || Entries[setIndex].SprEntries[sprIndex].ID != id)
+		{
+			mutationCounter++;
+			return GetSprEntry(id);
+		}
+
+		return &Entries[setIndex].SprEntries[sprIndex];
+	}
+
+	void SprDB::InvalidateIndices()
+	{
+		setIDIndex.Invalidate();
+		setNameIndex.Invalidate();
+
+		mutationCounter++;
 	}
 
 	u32 SprDB::GetSprSetEntryCount()
@@ -54,6 +116,8 @@ namespace Comfy::Database
 				reader.PushBaseOffset();
 		}
 
+		InvalidateIndices();
+
 		const auto sprSetEntryCount = reader.ReadU32();
 		if (reader.GetPointerMode() == PtrMode::Mode64Bit)
 			reader.Skip(static_cast<FileAddr>(sizeof(u32)));
@@ -74,6 +138,7 @@ namespace Comfy::Database
 			{
 				for (auto& sprSetEntry : Entries)
 				{
+					sprSetEntry.InvalidateIndices();
 					sprSetEntry.ID = SprSetID(reader.ReadU32());
 					if (reader.GetPointerMode() == PtrMode::Mode64Bit)
 						reader.Skip(static_cast<FileAddr>(sizeof(u32)));
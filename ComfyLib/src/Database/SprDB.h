@@ -22,6 +22,14 @@ namespace Comfy::Database
 		SprEntry* GetSprEntry(SprID id);
 		SprEntry* GetSprEntry(std::string_view name);
 		SprEntry* GetSprTexEntry(std::string_view name);
+
+		// NOTE: Must be called after modifying the ID or Name of an existing SprEntry or SprTexEntry
+		void InvalidateIndices();
+
+	private:
+		LazyEntryIndex<SprID> sprIDIndex;
+		LazyEntryIndex<std::string_view> sprNameIndex;
+		LazyEntryIndex<std::string_view> sprTexNameIndex;
 	};
 
 	class SprDB final : public BinaryDatabase
@@ -30,8 +38,12 @@ namespace Comfy::Database
 		std::vector<SprSetEntry> Entries;
 
 	public:
+		SprSetEntry* GetSprSetEntry(SprSetID id);
 		SprSetEntry* GetSprSetEntry(std::string_view name);
 
+		// NOTE: Searches the SprEntries of all sets
+		SprEntry* GetSprEntry(SprID id);
+
 		u32 GetSprSetEntryCount();
 		u32 GetSprEntryCount();
 	
@@ -39,6 +51,21 @@ namespace Comfy::Database
 		IO::StreamResult Read(IO::StreamReader& reader) override;
 		IO::StreamResult Write(IO::StreamWriter& writer) override;
 
+	public:
+		// NOTE: Must be called after modifying the ID or Name of an existing SprSetEntry or after adding or removing SprEntries of an existing set.
+		//		 Does not invalidate the indices of the individual SprSetEntries
+		void InvalidateIndices();
+
 	private:
+		struct SprEntryLocation { u32 SetIndex, SprIndex; };
+
+		LazyEntryIndex<SprSetID> setIDIndex;
+		LazyEntryIndex<std::string_view> setNameIndex;
+
+		// NOTE: Spans the nested SprEntries of all sets so nested edits are only detected through InvalidateIndices() or by verifying the entry of a hit
+		std::unordered_map<SprID, SprEntryLocation> sprIDToLocation;
+		u32 mutationCounter = 1;
+		u32 sprIDIndexedMutationCounter = 0;
+		size_t sprIDIndexedEntryCount = 0;
 	};
 }
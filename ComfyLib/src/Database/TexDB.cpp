@@ -6,8 +6,16 @@ namespace Comfy::Database
 {
 	using namespace IO;
 
+	namespace
+	{
+		constexpr auto TexEntryIDKey = [](const TexEntry& e) { return e.ID; };
+		constexpr auto TexEntryNameKey = [](const TexEntry& e) { return std::string_view(e.Name); };
+	}
+
 	StreamResult TexDB::Read(StreamReader& reader)
 	{
+		InvalidateIndices();
+
 		const auto texEntryCount = reader.ReadU32();
 		const auto texOffset = reader.ReadPtr();
 
@@ -56,11 +64,23 @@ namespace Comfy::Database
 	
 	const TexEntry* TexDB::GetTexEntry(TexID id) const
 	{
-		return FindIfOrNull(Entries, [&](const auto& e) { return (e.ID == id); });
+		return idIndex.Find(Entries, id, TexEntryIDKey);
 	}
 
 	const TexEntry* TexDB::GetTexEntry(std::string_view name) const
 	{
-		return FindIfOrNull(Entries, [&](const auto& e) { return (e.Name == name); });
+		return nameIndex.Find(Entries, name, TexEntryNameKey);
+	}
+
+	void TexDB::InvalidateIndices()
+	{
+		idIndex.Invalidate();
+		nameIndex.Invalidate();
+	}
+
+	void TexDB::BuildIndices() const
+	{
+		idIndex.BuildIfNeeded(Entries, TexEntryIDKey);
+		nameIndex.BuildIfNeeded(Entries, TexEntryNameKey);
 	}
 }
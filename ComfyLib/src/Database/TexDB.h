@@ -20,6 +20,13 @@ namespace Comfy::Database
 		const TexEntry* GetTexEntry(TexID id) const;
 		const TexEntry* GetTexEntry(std::string_view name) const;
 
+		// NOTE: Must be called after modifying the ID or Name of an existing entry
+		void InvalidateIndices();
+		// NOTE: Builds all lazy indices up front so that the database can safely be shared between threads as long as it isn't modified
+		void BuildIndices() const;
+
 	private:
+		LazyEntryIndex<TexID> idIndex;
+		LazyEntryIndex<std::string_view> nameIndex;
 	};
 }
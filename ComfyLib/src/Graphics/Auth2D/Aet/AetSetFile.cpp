@@ -705,6 +705,8 @@ namespace Comfy::Graphics::Aet
 		reader.ReadAt(spriteInfoOffset, [&](StreamReader& reader)
 		{
 			std::vector<std::string> spriteNames;
+			std::vector<std::string_view> spriteNameViews;
+			std::vector<SprID> spriteIDs;
 			for (auto& scene : scenes)
 			{
 				const auto spriteNamesOffset = reader.ReadPtr();
@@ -733,6 +735,11 @@ namespace Comfy::Graphics::Aet
 					});
 				}
 
+				// NOTE: Hash every name only once and all of them together instead of once per referencing source
+				spriteNameViews.assign(spriteNames.begin(), spriteNames.end());
+				spriteIDs.resize(spriteNames.size());
+				HashIDStringBatch<SprID>(spriteNameViews.data(), spriteIDs.data(), spriteNameViews.size());
+
 				for (auto& video : scene->Videos)
 				{
 					for (auto& source : video->Sources)
@@ -741,7 +748,7 @@ namespace Comfy::Graphics::Aet
 						if (InBounds(nameIndex, spriteNames))
 						{
 							source.Name = spriteNames[nameIndex];
-							source.ID = HashIDString<SprID>(source.Name);
+							source.ID = spriteIDs[nameIndex];
 						}
 					}
 				}
@@ -55,4 +55,47 @@ namespace Comfy::Graphics
 		vec3 Center;
 		vec3 Size;
 	};
+
+	// NOTE: Min / Max representation used by spatial acceleration structures where unions and overlap tests are far more common than transforms
+	struct AxisAlignedBox
+	{
+		vec3 Min;
+		vec3 Max;
+
+		static inline AxisAlignedBox FromSphere(const Sphere& sphere)
+		{
+			return AxisAlignedBox { sphere.Center - vec3(sphere.Radius), sphere.Center + vec3(sphere.Radius) };
+		}
+
+		static inline AxisAlignedBox Union(const AxisAlignedBox& boxA, const AxisAlignedBox& boxB)
+		{
+			return AxisAlignedBox { glm::min(boxA.Min, boxB.Min), glm::max(boxA.Max, boxB.Max) };
+		}
+
+		inline bool Contains(const AxisAlignedBox& other) const
+		{
+			return (Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z && Max.x >= other.Max.x && Max.y >= other.Max.y && Max.z >= other.Max.z);
+		}
+
+		inline bool Overlaps(const AxisAlignedBox& other) const
+		{
+			return (Min.x <= other.Max.x && Min.y <= other.Max.y && Min.z <= other.Max.z && Max.x >= other.Min.x && Max.y >= other.Min.y && Max.z >= other.Min.z);
+		}
+
+		inline vec3 GetCenter() const
+		{
+			return (Min + Max) * 0.5f;
+		}
+
+		inline vec3 GetHalfExtents() const
+		{
+			return (Max - Min) * 0.5f;
+		}
+
+		inline float GetSurfaceArea() const
+		{
+			const vec3 size = (Max - Min);
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+	};
 }
@@ -0,0 +1,759 @@
+#include "MeshOptimization.h"
+#include <unordered_map>
+
+namespace Comfy::Graphics
+{
+	namespace
+	{
+		constexpr u32 InvalidVertexIndex = std::numeric_limits<u32>::max();
+
+		struct VertexStream
+		{
+			u8* Data;
+			size_t ElementSize;
+		};
+
+		template <typename Func>
+		void ForEachVertexAttributeVector(decltype(Mesh::VertexData)& vertexData, Func func)
+		{
+			func(vertexData.Positions);
+			func(vertexData.Normals);
+			func(vertexData.Tangents);
+			for (auto& textureCoordinates : vertexData.TextureCoordinates)
+				func(textureCoordinates);
+			for (auto& colors : vertexData.Colors)
+				func(colors);
+			func(vertexData.BoneWeights);
+			func(vertexData.BoneIndices);
+		}
+
+		bool AllVertexAttributeSizesMatch(Mesh& mesh)
+		{
+			bool allMatch = true;
+			ForEachVertexAttributeVector(mesh.VertexData, [&](auto& attributeVector) { allMatch &= (attributeVector.empty() || attributeVector.size() == mesh.VertexData.VertexCount); });
+			return allMatch;
+		}
+
+		std::vector<VertexStream> GetPresentVertexStreams(Mesh& mesh)
+		{
+			std::vector<VertexStream> streams;
+			ForEachVertexAttributeVector(mesh.VertexData, [&](auto& attributeVector)
+			{
+				if (!attributeVector.empty())
+					streams.push_back({ reinterpret_cast<u8*>(attributeVector.data()), sizeof(attributeVector[0]) });
+			});
+			return streams;
+		}
+
+		size_t GetVertexDataByteSize(decltype(Mesh::VertexData)& vertexData)
+		{
+			size_t byteSize = 0;
+			ForEachVertexAttributeVector(vertexData, [&](auto& attributeVector) { byteSize += attributeVector.size() * sizeof(attributeVector[0]); });
+			return byteSize;
+		}
+
+		u32 GetRestartIndex(IndexFormat format)
+		{
+			switch (format)
+			{
+			case IndexFormat::U8: return std::numeric_limits<u8>::max();
+			case IndexFormat::U16: return std::numeric_limits<u16>::max();
+			case IndexFormat::U32: return std::numeric_limits<u32>::max();
+			default: return InvalidVertexIndex;
+			}
+		}
+
+		std::vector<u32> GetSubMeshIndicesU32(const SubMesh& subMesh)
+		{
+			std::vector<u32> result;
+			std::visit([&](const auto& indices) { result.assign(indices.begin(), indices.end()); }, subMesh.Indices);
+			return result;
+		}
+
+		void SetSubMeshIndicesU32(SubMesh& subMesh, const std::vector<u32>& indices)
+		{
+			// NOTE: The vertex count never increases so the original index format is always large enough
+			std::visit([&](auto& outIndices)
+			{
+				using IndexType = typename std::remove_reference_t<decltype(outIndices)>::value_type;
+				outIndices.resize(indices.size());
+				for (size_t i = 0; i < indices.size(); i++)
+					outIndices[i] = static_cast<IndexType>(indices[i]);
+			}, subMesh.Indices);
+		}
+
+		// NOTE: Calls the func with the three indices of every non degenerate triangle, strips are split at restart indices
+		template <typename Func>
+		void ForEachTriangle(const std::vector<u32>& indices, PrimitiveType primitive, u32 restartIndex, Func func)
+		{
+			if (primitive == PrimitiveType::Triangles)
+			{
+				for (size_t i = 0; i + 2 < indices.size(); i += 3)
+					func(indices[i + 0], indices[i + 1], indices[i + 2]);
+			}
+			else if (primitive == PrimitiveType::TriangleStrip)
+			{
+				size_t stripStart = 0;
+				for (size_t i = 0; i + 2 < indices.size(); i++)
+				{
+					const u32 a = indices[i + 0], b = indices[i + 1], c = indices[i + 2];
+					if (a == restartIndex || b == restartIndex || c == restartIndex)
+					{
+						if (c == restartIndex)
+							stripStart = i + 3;
+						continue;
+					}
+
+					if (a == b || b == c || a == c)
+						continue;
+
+					if ((i - stripStart) % 2 == 0)
+						func(a, b, c);
+					else
+						func(c, b, a);
+				}
+			}
+		}
+
+		u32 CountTriangles(const std::vector<u32>& indices, PrimitiveType primitive, u32 restartIndex)
+		{
+			u32 triangleCount = 0;
+			ForEachTriangle(indices, primitive, restartIndex, [&](u32, u32, u32) { triangleCount++; });
+			return triangleCount;
+		}
+
+		u32 SimulateFIFOCacheMisses(const std::vector<u32>& indices, PrimitiveType primitive, u32 restartIndex, u32 cacheSize)
+		{
+			std::vector<u32> cache(cacheSize, InvalidVertexIndex);
+			size_t cacheHead = 0;
+			u32 cacheMisses = 0;
+
+			auto processIndex = [&](u32 index)
+			{
+				if (std::find(cache.begin(), cache.end(), index) != cache.end())
+					return;
+
+				cache[cacheHead] = index;
+				cacheHead = (cacheHead + 1) % cache.size();
+				cacheMisses++;
+			};
+
+			// NOTE: Strips are simulated as submitted because every strip index is only transformed once when it hits the cache
+			if (primitive == PrimitiveType::TriangleStrip)
+			{
+				for (const u32 index : indices)
+				{
+					if (index != restartIndex)
+						processIndex(index);
+				}
+			}
+			else
+			{
+				ForEachTriangle(indices, primitive, restartIndex, [&](u32 a, u32 b, u32 c) { processIndex(a); processIndex(b); processIndex(c); });
+			}
+
+			return cacheMisses;
+		}
+
+		std::vector<u32> ConvertTriangleStripToList(const std::vector<u32>& indices, u32 restartIndex)
+		{
+			std::vector<u32> result;
+			result.reserve(indices.size() * 3);
+			ForEachTriangle(indices, PrimitiveType::TriangleStrip, restartIndex, [&](u32 a, u32 b, u32 c) { result.insert(result.end(), { a, b, c }); });
+			return result;
+		}
+
+		// NOTE: Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" using an LRU cache model
+		class ForsythVertexCacheOptimizer
+		{
+		public:
+			static constexpr float CacheDecayPower = 1.5f;
+			static constexpr float LastTriangleScore = 0.75f;
+			static constexpr float ValenceBoostScale = 2.0f;
+			static constexpr float ValenceBoostPower = 0.5f;
+
+		public:
+			void Optimize(std::vector<u32>& inOutIndices, u32 vertexCount)
+			{
+				const size_t triangleCount = inOutIndices.size() / 3;
+				if (triangleCount == 0)
+					return;
+
+				vertices.assign(vertexCount, {});
+				for (const u32 index : inOutIndices)
+					vertices[index].TriangleCount++;
+
+				u32 offset = 0;
+				for (auto& vertex : vertices)
+				{
+					vertex.TriangleOffset = offset;
+					offset += vertex.TriangleCount;
+					vertex.RemainingTriangles = vertex.TriangleCount;
+					vertex.Score = CalculateVertexScore(vertex);
+				}
+
+				vertexTriangles.resize(offset);
+				{
+					std::vector<u32> writeOffsets(vertexCount, 0);
+					for (size_t triangle = 0; triangle < triangleCount; triangle++)
+					{
+						for (size_t corner = 0; corner < 3; corner++)
+						{
+							const u32 index = inOutIndices[triangle * 3 + corner];
+							vertexTriangles[vertices[index].TriangleOffset + writeOffsets[index]++] = static_cast<u32>(triangle);
+						}
+					}
+				}
+
+				triangleScores.resize(triangleCount);
+				triangleAdded.assign(triangleCount, false);
+				for (size_t triangle = 0; triangle < triangleCount; triangle++)
+					triangleScores[triangle] = GetTriangleScore(inOutIndices, static_cast<u32>(triangle));
+
+				std::vector<u32> outIndices;
+				outIndices.reserve(inOutIndices.size());
+
+				std::array<u32, MeshOptimizationVertexCacheSize + 3> cache, newCache;
+				size_t cacheSize = 0;
+
+				size_t linearScanCursor = 0;
+				u32 bestTriangle = FindBestTriangleLinear(linearScanCursor);
+
+				while (bestTriangle != InvalidVertexIndex)
+				{
+					triangleAdded[bestTriangle] = true;
+
+					const std::array<u32, 3> triangleIndices = { inOutIndices[bestTriangle * 3 + 0], inOutIndices[bestTriangle * 3 + 1], inOutIndices[bestTriangle * 3 + 2] };
+					outIndices.insert(outIndices.end(), triangleIndices.begin(), triangleIndices.end());
+
+					for (const u32 index : triangleIndices)
+						vertices[index].RemainingTriangles--;
+
+					// NOTE: Move the triangle vertices to the front of the LRU cache, everything pushed beyond the cache size is evicted
+					size_t newCacheSize = 0;
+					for (const u32 index : triangleIndices)
+						newCache[newCacheSize++] = index;
+					for (size_t i = 0; i < cacheSize; i++)
+					{
+						if (cache[i] != triangleIndices[0] && cache[i] != triangleIndices[1] && cache[i] != triangleIndices[2])
+							newCache[newCacheSize++] = cache[i];
+					}
+
+					for (size_t i = 0; i < newCacheSize; i++)
+					{
+						auto& vertex = vertices[newCache[i]];
+						vertex.CachePosition = (i < MeshOptimizationVertexCacheSize) ? static_cast<i32>(i) : -1;
+						vertex.Score = CalculateVertexScore(vertex);
+					}
+
+					bestTriangle = InvalidVertexIndex;
+					float bestScore = -1.0f;
+
+					for (size_t i = 0; i < newCacheSize; i++)
+					{
+						const auto& vertex = vertices[newCache[i]];
+						for (u32 t = 0; t < vertex.TriangleCount; t++)
+						{
+							const u32 triangle = vertexTriangles[vertex.TriangleOffset + t];
+							if (triangleAdded[triangle])
+								continue;
+
+							triangleScores[triangle] = GetTriangleScore(inOutIndices, triangle);
+							if (triangleScores[triangle] > bestScore)
+							{
+								bestScore = triangleScores[triangle];
+								bestTriangle = triangle;
+							}
+						}
+					}
+
+					cacheSize = std::min<size_t>(newCacheSize, MeshOptimizationVertexCacheSize);
+					std::copy(newCache.begin(), newCache.begin() + cacheSize, cache.begin());
+
+					if (bestTriangle == InvalidVertexIndex)
+						bestTriangle = FindBestTriangleLinear(linearScanCursor);
+				}
+
+				inOutIndices = std::move(outIndices);
+			}
+
+		private:
+			struct VertexInfo
+			{
+				i32 CachePosition = -1;
+				u32 TriangleOffset = 0;
+				u32 TriangleCount = 0;
+				u32 RemainingTriangles = 0;
+				float Score = 0.0f;
+			};
+
+			static float CalculateVertexScore(const VertexInfo& vertex)
+			{
+				if (vertex.RemainingTriangles == 0)
+					return -1.0f;
+
+				float score = 0.0f;
+				if (vertex.CachePosition >= 0)
+				{
+					// NOTE: The vertices of the last triangle are given a fixed score so that the optimizer doesn't favor immediately reusing the same edge
+					if (vertex.CachePosition < 3)
+					{
+						score = LastTriangleScore;
+					}
+					else
+					{
+						const float scaler = 1.0f / static_cast<float>(MeshOptimizationVertexCacheSize - 3);
+						score = std::pow(1.0f - static_cast<float>(vertex.CachePosition - 3) * scaler, CacheDecayPower);
+					}
+				}
+
+				// NOTE: Boost vertices with only a few remaining triangles so that lone triangles don't get left behind
+				score += ValenceBoostScale * std::pow(static_cast<float>(vertex.RemainingTriangles), -ValenceBoostPower);
+				return score;
+			}
+
+			float GetTriangleScore(const std::vector<u32>& indices, u32 triangle) const
+			{
+				return vertices[indices[triangle * 3 + 0]].Score + vertices[indices[triangle * 3 + 1]].Score + vertices[indices[triangle * 3 + 2]].Score;
+			}
+
+			// NOTE: Only reached when the cache doesn't contain any vertex with remaining triangles, the cursor keeps the total cost linear
+			u32 FindBestTriangleLinear(size_t& inOutCursor) const
+			{
+				while (inOutCursor < triangleAdded.size() && triangleAdded[inOutCursor])
+					inOutCursor++;
+
+				return (inOutCursor < triangleAdded.size()) ? static_cast<u32>(inOutCursor) : InvalidVertexIndex;
+			}
+
+		private:
+			std::vector<VertexInfo> vertices;
+			std::vector<u32> vertexTriangles;
+			std::vector<float> triangleScores;
+			std::vector<bool> triangleAdded;
+		};
+
+		// NOTE: Returns the remapped index of every vertex, duplicates map to the index of their first occurrence
+		std::vector<u32> FindDuplicateVertices(const std::vector<VertexStream>& streams, u32 vertexCount)
+		{
+			auto hashVertex = [&](u32 vertex)
+			{
+				// NOTE: FNV-1a over the raw bytes of all attributes, -0.0f and 0.0f are intentionally treated as different values
+				u64 hash = 0xCBF29CE484222325;
+				for (const auto& stream : streams)
+				{
+					const u8* bytes = stream.Data + stream.ElementSize * vertex;
+					for (size_t i = 0; i < stream.ElementSize; i++)
+						hash = (hash ^ bytes[i]) * 0x100000001B3;
+				}
+				return hash;
+			};
+
+			auto verticesEqual = [&](u32 a, u32 b)
+			{
+				return std::all_of(streams.begin(), streams.end(), [&](const auto& stream)
+				{
+					return std::memcmp(stream.Data + stream.ElementSize * a, stream.Data + stream.ElementSize * b, stream.ElementSize) == 0;
+				});
+			};
+
+			std::vector<u32> remap(vertexCount);
+			std::unordered_multimap<u64, u32> uniqueVertices;
+			uniqueVertices.reserve(vertexCount);
+
+			for (u32 vertex = 0; vertex < vertexCount; vertex++)
+			{
+				const u64 hash = hashVertex(vertex);
+				const auto[begin, end] = uniqueVertices.equal_range(hash);
+
+				const auto existing = std::find_if(begin, end, [&](const auto& pair) { return verticesEqual(pair.second, vertex); });
+				if (existing != end)
+				{
+					remap[vertex] = existing->second;
+				}
+				else
+				{
+					remap[vertex] = vertex;
+					uniqueVertices.emplace(hash, vertex);
+				}
+			}
+
+			return remap;
+		}
+
+		template <typename T>
+		void ReorderVertexAttribute(std::vector<T>& attributes, const std::vector<u32>& newToOldIndices)
+		{
+			if (attributes.empty())
+				return;
+
+			std::vector<T> reordered(newToOldIndices.size());
+			for (size_t i = 0; i < newToOldIndices.size(); i++)
+				reordered[i] = attributes[newToOldIndices[i]];
+			attributes = std::move(reordered);
+		}
+
+		float RoundTripSnorm16(float value)
+		{
+			const float clamped = std::clamp(value, -1.0f, 1.0f);
+			return static_cast<float>(static_cast<i16>(std::round(clamped * 32767.0f))) / 32767.0f;
+		}
+
+		float RoundTripUnorm8(float value)
+		{
+			const float clamped = std::clamp(value, 0.0f, 1.0f);
+			return static_cast<float>(static_cast<u8>(std::round(clamped * 255.0f))) / 255.0f;
+		}
+
+		float RoundTripHalf(float value)
+		{
+			// NOTE: Round to the nearest representable half precision value, denormals are flushed to zero and the range is clamped to the largest finite half
+			constexpr float maxHalf = 65504.0f;
+			constexpr float minNormalHalf = 6.10351562e-05f;
+
+			const float magnitude = std::abs(value);
+			if (magnitude < minNormalHalf)
+				return 0.0f;
+
+			int exponent;
+			const float mantissa = std::frexp(std::min(magnitude, maxHalf), &exponent);
+			const float rounded = std::ldexp(std::round(std::ldexp(mantissa, 11)), exponent - 11);
+			return std::copysign(std::min(rounded, maxHalf), value);
+		}
+
+		void CalculateQuantizationReport(Mesh& mesh, MeshOptimizationReport& outReport)
+		{
+			const auto& vertexData = mesh.VertexData;
+
+			// NOTE: Normals and tangents are padded to four components since there is no three component 16 bit vertex format
+			constexpr size_t quantizedNormalSize = sizeof(i16) * 4;
+			constexpr size_t quantizedTangentSize = sizeof(i16) * 4;
+			constexpr size_t quantizedTextureCoordinateSize = sizeof(u16) * 2;
+			constexpr size_t quantizedColorSize = sizeof(u8) * 4;
+
+			outReport.QuantizedVertexBytes += vertexData.Positions.size() * sizeof(vec3);
+			outReport.QuantizedVertexBytes += vertexData.Normals.size() * quantizedNormalSize;
+			outReport.QuantizedVertexBytes += vertexData.Tangents.size() * quantizedTangentSize;
+			for (const auto& textureCoordinates : vertexData.TextureCoordinates)
+				outReport.QuantizedVertexBytes += textureCoordinates.size() * quantizedTextureCoordinateSize;
+			for (const auto& colors : vertexData.Colors)
+				outReport.QuantizedVertexBytes += colors.size() * quantizedColorSize;
+			outReport.QuantizedVertexBytes += vertexData.BoneWeights.size() * sizeof(vec4);
+			outReport.QuantizedVertexBytes += vertexData.BoneIndices.size() * sizeof(vec4);
+
+			auto updateMaxError = [](float& inOutMaxError, const auto& values, auto roundTripFunc)
+			{
+				for (const auto& value : values)
+				{
+					for (int i = 0; i < static_cast<int>(value.length()); i++)
+						inOutMaxError = std::max(inOutMaxError, std::abs(value[i] - roundTripFunc(value[i])));
+				}
+			};
+
+			updateMaxError(outReport.MaxNormalQuantizationError, vertexData.Normals, RoundTripSnorm16);
+			updateMaxError(outReport.MaxNormalQuantizationError, vertexData.Tangents, RoundTripSnorm16);
+			for (const auto& textureCoordinates : vertexData.TextureCoordinates)
+				updateMaxError(outReport.MaxTextureCoordinateQuantizationError, textureCoordinates, RoundTripHalf);
+			for (const auto& colors : vertexData.Colors)
+				updateMaxError(outReport.MaxColorQuantizationError, colors, RoundTripUnorm8);
+		}
+
+		void RequestGPUReupload(Mesh& mesh)
+		{
+			for (auto& vertexBuffer : mesh.GPU_VertexBuffers)
+				vertexBuffer.RequestReupload = true;
+			for (auto& subMesh : mesh.SubMeshes)
+				subMesh.GPU_IndexBuffer.RequestReupload = true;
+		}
+
+		bool ObjVertexCountsMatch(const Obj& objA, const Obj& objB)
+		{
+			if (objA.Meshes.empty() || objA.Meshes.size() != objB.Meshes.size())
+				return false;
+
+			for (size_t i = 0; i < objA.Meshes.size(); i++)
+			{
+				if (objA.Meshes[i].VertexData.VertexCount != objB.Meshes[i].VertexData.VertexCount)
+					return false;
+			}
+
+			return true;
+		}
+
+		// NOTE: All meshes end up with the exact same vertex order so that the vertices at each index still correspond to one another, as required by morph targets.
+		//		 Vertices are only welded if they are duplicates within every mesh and the vertex fetch order is determined by the sub meshes of the first mesh
+		MeshOptimizationReport OptimizeMeshesSharingVertexOrder(const std::vector<Mesh*>& meshes, const MeshOptimizationParam& param)
+		{
+			assert(!meshes.empty());
+			const u32 vertexCount = meshes.front()->VertexData.VertexCount;
+
+			std::vector<MeshOptimizationReport> meshReports(meshes.size());
+			std::vector<std::vector<std::vector<u32>>> meshSubMeshIndices(meshes.size());
+
+			bool validMeshes = true;
+			for (size_t m = 0; m < meshes.size(); m++)
+			{
+				auto& mesh = *meshes[m];
+				auto& report = meshReports[m];
+				auto& subMeshIndices = meshSubMeshIndices[m];
+
+				report.MeshCount = 1;
+				report.SubMeshCount = static_cast<u32>(mesh.SubMeshes.size());
+				report.VertexCountBefore = mesh.VertexData.VertexCount;
+				report.VertexBytesBefore = GetVertexDataByteSize(mesh.VertexData);
+
+				subMeshIndices.reserve(mesh.SubMeshes.size());
+				for (const auto& subMesh : mesh.SubMeshes)
+				{
+					subMeshIndices.push_back(GetSubMeshIndicesU32(subMesh));
+					const auto& indices = subMeshIndices.back();
+					const u32 restartIndex = GetRestartIndex(subMesh.GetIndexFormat());
+
+					report.IndexCountBefore += static_cast<u32>(indices.size());
+					report.IndexBytesBefore += subMesh.GetRawIndicesByteSize();
+					report.TriangleCount += CountTriangles(indices, subMesh.Primitive, restartIndex);
+					report.CacheMissesBefore += SimulateFIFOCacheMisses(indices, subMesh.Primitive, restartIndex, MeshOptimizationSimulatedCacheSize);
+
+					const bool supportedPrimitive = (subMesh.Primitive == PrimitiveType::Triangles || subMesh.Primitive == PrimitiveType::TriangleStrip);
+					if (!supportedPrimitive || std::any_of(indices.begin(), indices.end(), [&](u32 index) { return index != restartIndex && index >= vertexCount; }))
+						validMeshes = false;
+				}
+
+				if (mesh.VertexData.VertexCount != vertexCount || !AllVertexAttributeSizesMatch(mesh))
+					validMeshes = false;
+			}
+
+			MeshOptimizationReport combinedReport = {};
+
+			// NOTE: Leave meshes with out of bounds indices, unsupported primitives or mismatching attribute sizes untouched, the report then only contains the current state
+			if (!validMeshes || vertexCount == 0)
+			{
+				for (size_t m = 0; m < meshes.size(); m++)
+				{
+					auto& report = meshReports[m];
+					report.VertexCountAfter = report.VertexCountBefore;
+					report.IndexCountAfter = report.IndexCountBefore;
+					report.VertexBytesAfter = report.VertexBytesBefore;
+					report.IndexBytesAfter = report.IndexBytesBefore;
+					report.CacheMissesAfter = report.CacheMissesBefore;
+					CalculateQuantizationReport(*meshes[m], report);
+					combinedReport.Accumulate(report);
+				}
+				return combinedReport;
+			}
+
+			std::vector<u32> remap(vertexCount);
+			if (param.WeldDuplicateVertices)
+			{
+				std::vector<VertexStream> combinedStreams;
+				for (auto* mesh : meshes)
+				{
+					const auto meshStreams = GetPresentVertexStreams(*mesh);
+					combinedStreams.insert(combinedStreams.end(), meshStreams.begin(), meshStreams.end());
+				}
+				remap = FindDuplicateVertices(combinedStreams, vertexCount);
+			}
+			else
+			{
+				for (u32 vertex = 0; vertex < vertexCount; vertex++)
+					remap[vertex] = vertex;
+			}
+
+			for (size_t m = 0; m < meshes.size(); m++)
+			{
+				for (size_t i = 0; i < meshes[m]->SubMeshes.size(); i++)
+				{
+					auto& subMesh = meshes[m]->SubMeshes[i];
+					auto& indices = meshSubMeshIndices[m][i];
+					const u32 restartIndex = GetRestartIndex(subMesh.GetIndexFormat());
+
+					for (auto& index : indices)
+						index = (index != restartIndex) ? remap[index] : restartIndex;
+
+					if (param.ConvertTriangleStrips && subMesh.Primitive == PrimitiveType::TriangleStrip)
+					{
+						indices = ConvertTriangleStripToList(indices, restartIndex);
+						subMesh.Primitive = PrimitiveType::Triangles;
+					}
+
+					if (param.OptimizeVertexCache && subMesh.Primitive == PrimitiveType::Triangles)
+						ForsythVertexCacheOptimizer().Optimize(indices, vertexCount);
+				}
+			}
+
+			// NOTE: Compact the vertex data by dropping welded duplicates, either in order of first use or in the original order
+			std::vector<u32> oldToNewIndices(vertexCount, InvalidVertexIndex);
+			std::vector<u32> newToOldIndices;
+			newToOldIndices.reserve(vertexCount);
+
+			if (param.OptimizeVertexFetch)
+			{
+				const auto& firstMesh = *meshes.front();
+				for (size_t i = 0; i < firstMesh.SubMeshes.size(); i++)
+				{
+					const u32 restartIndex = GetRestartIndex(firstMesh.SubMeshes[i].GetIndexFormat());
+					for (const u32 index : meshSubMeshIndices.front()[i])
+					{
+						if (index != restartIndex && oldToNewIndices[index] == InvalidVertexIndex)
+						{
+							oldToNewIndices[index] = static_cast<u32>(newToOldIndices.size());
+							newToOldIndices.push_back(index);
+						}
+					}
+				}
+			}
+
+			// NOTE: Unreferenced vertices that aren't duplicates are kept at the end to not lose any data
+			for (u32 vertex = 0; vertex < vertexCount; vertex++)
+			{
+				if (remap[vertex] == vertex && oldToNewIndices[vertex] == InvalidVertexIndex)
+				{
+					oldToNewIndices[vertex] = static_cast<u32>(newToOldIndices.size());
+					newToOldIndices.push_back(vertex);
+				}
+			}
+
+			for (size_t m = 0; m < meshes.size(); m++)
+			{
+				auto& mesh = *meshes[m];
+				auto& report = meshReports[m];
+
+				ForEachVertexAttributeVector(mesh.VertexData, [&](auto& attributeVector) { ReorderVertexAttribute(attributeVector, newToOldIndices); });
+				mesh.VertexData.VertexCount = static_cast<u32>(newToOldIndices.size());
+
+				for (size_t i = 0; i < mesh.SubMeshes.size(); i++)
+				{
+					auto& subMesh = mesh.SubMeshes[i];
+					auto& indices = meshSubMeshIndices[m][i];
+					const u32 restartIndex = GetRestartIndex(subMesh.GetIndexFormat());
+
+					for (auto& index : indices)
+						index = (index != restartIndex) ? oldToNewIndices[index] : restartIndex;
+
+					SetSubMeshIndicesU32(subMesh, indices);
+
+					report.IndexCountAfter += static_cast<u32>(indices.size());
+					report.IndexBytesAfter += subMesh.GetRawIndicesByteSize();
+					report.CacheMissesAfter += SimulateFIFOCacheMisses(indices, subMesh.Primitive, restartIndex, MeshOptimizationSimulatedCacheSize);
+				}
+
+				report.VertexCountAfter = mesh.VertexData.VertexCount;
+				report.VertexBytesAfter = GetVertexDataByteSize(mesh.VertexData);
+				CalculateQuantizationReport(mesh, report);
+
+				RequestGPUReupload(mesh);
+				combinedReport.Accumulate(report);
+			}
+
+			return combinedReport;
+		}
+	}
+
+	void MeshOptimizationReport::Accumulate(const MeshOptimizationReport& other)
+	{
+		MeshCount += other.MeshCount;
+		SubMeshCount += other.SubMeshCount;
+		TriangleCount += other.TriangleCount;
+		VertexCountBefore += other.VertexCountBefore;
+		VertexCountAfter += other.VertexCountAfter;
+		IndexCountBefore += other.IndexCountBefore;
+		IndexCountAfter += other.IndexCountAfter;
+		VertexBytesBefore += other.VertexBytesBefore;
+		VertexBytesAfter += other.VertexBytesAfter;
+		IndexBytesBefore += other.IndexBytesBefore;
+		IndexBytesAfter += other.IndexBytesAfter;
+		CacheMissesBefore += other.CacheMissesBefore;
+		CacheMissesAfter += other.CacheMissesAfter;
+		QuantizedVertexBytes += other.QuantizedVertexBytes;
+		MaxNormalQuantizationError = std::max(MaxNormalQuantizationError, other.MaxNormalQuantizationError);
+		MaxTextureCoordinateQuantizationError = std::max(MaxTextureCoordinateQuantizationError, other.MaxTextureCoordinateQuantizationError);
+		MaxColorQuantizationError = std::max(MaxColorQuantizationError, other.MaxColorQuantizationError);
+	}
+
+	float MeshOptimizationReport::GetACMRBefore() const
+	{
+		return (TriangleCount > 0) ? static_cast<float>(CacheMissesBefore) / static_cast<float>(TriangleCount) : 0.0f;
+	}
+
+	float MeshOptimizationReport::GetACMRAfter() const
+	{
+		return (TriangleCount > 0) ? static_cast<float>(CacheMissesAfter) / static_cast<float>(TriangleCount) : 0.0f;
+	}
+
+	float MeshOptimizationReport::GetATVRBefore() const
+	{
+		return (VertexCountBefore > 0) ? static_cast<float>(CacheMissesBefore) / static_cast<float>(VertexCountBefore) : 0.0f;
+	}
+
+	float MeshOptimizationReport::GetATVRAfter() const
+	{
+		return (VertexCountAfter > 0) ? static_cast<float>(CacheMissesAfter) / static_cast<float>(VertexCountAfter) : 0.0f;
+	}
+
+	size_t MeshOptimizationReport::GetTotalBytesBefore() const
+	{
+		return VertexBytesBefore + IndexBytesBefore;
+	}
+
+	size_t MeshOptimizationReport::GetTotalBytesAfter() const
+	{
+		return VertexBytesAfter + IndexBytesAfter;
+	}
+
+	MeshOptimizationReport OptimizeMesh(Mesh& mesh, const MeshOptimizationParam& param)
+	{
+		return OptimizeMeshesSharingVertexOrder({ &mesh }, param);
+	}
+
+	MeshOptimizationReport OptimizeObj(Obj& obj, const MeshOptimizationParam& param)
+	{
+		MeshOptimizationReport report = {};
+		for (auto& mesh : obj.Meshes)
+			report.Accumulate(OptimizeMesh(mesh, param));
+		return report;
+	}
+
+	MeshOptimizationReport OptimizeObjSet(ObjSet& objSet, const MeshOptimizationParam& param)
+	{
+		MeshOptimizationReport report = {};
+		auto& objs = objSet.Objects;
+
+		for (size_t groupStart = 0; groupStart < objs.size();)
+		{
+			size_t groupEnd = groupStart + 1;
+			while (groupEnd < objs.size() && ObjVertexCountsMatch(objs[groupEnd - 1], objs[groupEnd]))
+				groupEnd++;
+
+			if ((groupEnd - groupStart) == 1)
+			{
+				report.Accumulate(OptimizeObj(objs[groupStart], param));
+			}
+			else
+			{
+				std::vector<Mesh*> meshesSharingVertexOrder;
+				for (size_t meshIndex = 0; meshIndex < objs[groupStart].Meshes.size(); meshIndex++)
+				{
+					meshesSharingVertexOrder.clear();
+					for (size_t objIndex = groupStart; objIndex < groupEnd; objIndex++)
+						meshesSharingVertexOrder.push_back(&objs[objIndex].Meshes[meshIndex]);
+
+					report.Accumulate(OptimizeMeshesSharingVertexOrder(meshesSharingVertexOrder, param));
+				}
+			}
+
+			groupStart = groupEnd;
+		}
+
+		return report;
+	}
+
+	float CalculateSubMeshACMR(const SubMesh& subMesh, u32 cacheSize)
+	{
+		const auto indices = GetSubMeshIndicesU32(subMesh);
+		const u32 restartIndex = GetRestartIndex(subMesh.GetIndexFormat());
+
+		const u32 triangleCount = CountTriangles(indices, subMesh.Primitive, restartIndex);
+		const u32 cacheMisses = SimulateFIFOCacheMisses(indices, subMesh.Primitive, restartIndex, cacheSize);
+		return (triangleCount > 0) ? static_cast<float>(cacheMisses) / static_cast<float>(triangleCount) : 0.0f;
+	}
+}
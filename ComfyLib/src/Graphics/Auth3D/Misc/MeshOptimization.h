@@ -0,0 +1,66 @@
+#pragma once
+#include "Types.h"
+#include "Graphics/Auth3D/ObjSet.h"
+
+namespace Comfy::Graphics
+{
+	// NOTE: Size of the LRU cache modelled while reordering the triangles, larger than any real post transform cache so that the result stays good across different GPUs
+	constexpr u32 MeshOptimizationVertexCacheSize = 32;
+	// NOTE: Size of the FIFO cache used to compute the ACMR / ATVR statistics, roughly matches the post transform cache of typical hardware
+	constexpr u32 MeshOptimizationSimulatedCacheSize = 16;
+
+	struct MeshOptimizationParam
+	{
+		// NOTE: Merge vertices whose attributes are bitwise identical across all present vertex attributes
+		bool WeldDuplicateVertices = true;
+		// NOTE: Triangle strips can't be reordered so they are first converted into triangle lists, which often increases the index count
+		bool ConvertTriangleStrips = true;
+		// NOTE: Reorder the triangles of each triangle list sub mesh to improve post transform vertex cache hits (Forsyth)
+		bool OptimizeVertexCache = true;
+		// NOTE: Reorder the vertices of each mesh in the order they are first referenced by its sub meshes to improve pre transform memory locality
+		bool OptimizeVertexFetch = true;
+	};
+
+	struct MeshOptimizationReport
+	{
+		u32 MeshCount;
+		u32 SubMeshCount;
+		u32 TriangleCount;
+
+		u32 VertexCountBefore, VertexCountAfter;
+		u32 IndexCountBefore, IndexCountAfter;
+
+		size_t VertexBytesBefore, VertexBytesAfter;
+		size_t IndexBytesBefore, IndexBytesAfter;
+
+		// NOTE: Simulated post transform cache misses, divided by the triangle and vertex count to get the ACMR and ATVR
+		u32 CacheMissesBefore, CacheMissesAfter;
+
+		// NOTE: Size of the optimized vertex data if it were stored using snorm16 normals and tangents, half precision texture coordinates and unorm8 colors.
+		//		 Only reported for now because the renderer input layouts still expect full precision float attributes
+		size_t QuantizedVertexBytes;
+		float MaxNormalQuantizationError;
+		float MaxTextureCoordinateQuantizationError;
+		float MaxColorQuantizationError;
+
+		void Accumulate(const MeshOptimizationReport& other);
+
+		float GetACMRBefore() const;
+		float GetACMRAfter() const;
+		float GetATVRBefore() const;
+		float GetATVRAfter() const;
+
+		size_t GetTotalBytesBefore() const;
+		size_t GetTotalBytesAfter() const;
+	};
+
+	// NOTE: Offline / import time optimization pass, entirely CPU side. Requests a reupload of the GPU buffers of every modified mesh.
+	//		 Consecutive objs of an obj set with matching vertex counts are optimized using one shared vertex order, because A3D morph targets are stored
+	//		 as the obj following the base obj and have to keep their vertices at the same indices
+	MeshOptimizationReport OptimizeMesh(Mesh& mesh, const MeshOptimizationParam& param = {});
+	MeshOptimizationReport OptimizeObj(Obj& obj, const MeshOptimizationParam& param = {});
+	MeshOptimizationReport OptimizeObjSet(ObjSet& objSet, const MeshOptimizationParam& param = {});
+
+	// NOTE: Average cache miss ratio of the sub mesh indices using a FIFO cache simulation, also handles triangle strips
+	float CalculateSubMeshACMR(const SubMesh& subMesh, u32 cacheSize = MeshOptimizationSimulatedCacheSize);
+}
@@ -1,7 +1,6 @@
 #include "FArc.h"
 #include "Core/Logger.h"
 #include "Misc/EndianHelper.h"
-#include "IO/Crypto/Crypto.h"
 #include "Misc/StringUtil.h"
 #include <zlib.h>
 
@@ -200,6 +199,10 @@ namespace Comfy::IO
 
 			encryptionFormat = (flags & FArcFlags_Encrypted) ? (encryptedEntries ? FArcEncryptionFormat::Modern : FArcEncryptionFormat::Classic) : FArcEncryptionFormat::None;
 
+			// NOTE: Expanded once here instead of for every single decrypted entry
+			if (encryptionFormat != FArcEncryptionFormat::None)
+				aesKey = Crypto::CreateAesDecryptionKey((encryptionFormat == FArcEncryptionFormat::Modern) ? FArcEncryption::ModernKey : FArcEncryption::ClassicKey);
+
 			if (encryptedEntries)
 			{
 				stream.Seek(stream.GetPosition() - FileAddr(sizeof(parsedNextData)));
@@ -356,11 +359,11 @@ namespace Comfy::IO
 	{
 		if (encryptionFormat == FArcEncryptionFormat::Classic)
 		{
-			return Crypto::DecryptAesEcb(encryptedData, decryptedData, dataSize, FArcEncryption::ClassicKey);
+			return Crypto::DecryptAesEcb(encryptedData, decryptedData, dataSize, aesKey);
 		}
 		else if (encryptionFormat == FArcEncryptionFormat::Modern)
 		{
-			return Crypto::DecryptAesCbc(encryptedData, decryptedData, dataSize, FArcEncryption::ModernKey, aesIV);
+			return Crypto::DecryptAesCbc(encryptedData, decryptedData, dataSize, aesKey, aesIV);
 		}
 		else
 		{
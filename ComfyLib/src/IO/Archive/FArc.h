@@ -1,6 +1,7 @@
 #pragma once
 #include "Types.h"
 #include "IO/Stream/FileStream.h"
+#include "IO/Crypto/Crypto.h"
 
 namespace Comfy::IO
 {
@@ -95,6 +96,7 @@ namespace Comfy::IO
 
 		FArcEncryptionFormat encryptionFormat = FArcEncryptionFormat::None;
 		std::array<u8, FArcEncryption::IVSize> aesIV = FArcEncryption::DummyIV;
+		Crypto::AesDecryptionKey aesKey = {};
 
 	protected:
 		bool OpenStream(std::string_view filePath);
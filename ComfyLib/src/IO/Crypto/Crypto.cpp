@@ -1,15 +1,44 @@
 #include "Crypto.h"
-#include "Detail/Win32Crypto.h"
+#include "Detail/Aes128.h"
 
 namespace Comfy::IO::Crypto
 {
+	AesDecryptionKey CreateAesDecryptionKey(const std::array<u8, KeySize>& key)
+	{
+		return Detail::Aes128ExpandDecryptionKey(key);
+	}
+
+	bool DecryptAesEcb(const u8* encryptedData, u8* decryptedData, size_t dataSize, const AesDecryptionKey& key)
+	{
+		if ((dataSize % BlockSize) != 0)
+			return false;
+
+		if (Detail::IsAesNISupported())
+			Detail::Aes128DecryptEcbAesNI(encryptedData, decryptedData, dataSize / BlockSize, key);
+		else
+			Detail::Aes128DecryptEcbPortable(encryptedData, decryptedData, dataSize / BlockSize, key);
+		return true;
+	}
+
+	bool DecryptAesCbc(const u8* encryptedData, u8* decryptedData, size_t dataSize, const AesDecryptionKey& key, const std::array<u8, IVSize>& iv)
+	{
+		if ((dataSize % BlockSize) != 0)
+			return false;
+
+		if (Detail::IsAesNISupported())
+			Detail::Aes128DecryptCbcAesNI(encryptedData, decryptedData, dataSize / BlockSize, key, iv);
+		else
+			Detail::Aes128DecryptCbcPortable(encryptedData, decryptedData, dataSize / BlockSize, key, iv);
+		return true;
+	}
+
 	bool DecryptAesEcb(const u8* encryptedData, u8* decryptedData, size_t dataSize, const std::array<u8, KeySize>& key)
 	{
-		return Detail::Win32DecryptAesEcb(encryptedData, decryptedData, dataSize, key);
+		return DecryptAesEcb(encryptedData, decryptedData, dataSize, CreateAesDecryptionKey(key));
 	}
 
 	bool DecryptAesCbc(const u8* encryptedData, u8* decryptedData, size_t dataSize, const std::array<u8, KeySize>& key, const std::array<u8, IVSize>& iv)
 	{
-		return Detail::Win32DecryptAesCbc(encryptedData, decryptedData, dataSize, key, iv);
+		return DecryptAesCbc(encryptedData, decryptedData, dataSize, CreateAesDecryptionKey(key), iv);
 	}
 }
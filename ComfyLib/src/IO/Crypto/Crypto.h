@@ -5,12 +5,27 @@ namespace Comfy::IO::Crypto
 {
 	static constexpr size_t IVSize = 16;
 	static constexpr size_t KeySize = 16;
+	static constexpr size_t BlockSize = 16;
 
 	enum class BlockCipherMode : u32
 	{
 		CBC, ECB,
 	};
 
+	// NOTE: Expanded AES-128 round keys in the order they are used for decryption.
+	//		 Expanding a key costs more than decrypting a few blocks with it so it should be created once and reused for every decryption using the same key
+	struct AesDecryptionKey
+	{
+		static constexpr size_t RoundCount = 10;
+		std::array<std::array<u8, BlockSize>, RoundCount + 1> RoundKeys;
+	};
+
+	AesDecryptionKey CreateAesDecryptionKey(const std::array<u8, KeySize>& key);
+
+	// NOTE: The data size has to be a multiple of the block size, the encrypted and decrypted data may point to the same buffer
+	bool DecryptAesEcb(const u8* encryptedData, u8* decryptedData, size_t dataSize, const AesDecryptionKey& key);
+	bool DecryptAesCbc(const u8* encryptedData, u8* decryptedData, size_t dataSize, const AesDecryptionKey& key, const std::array<u8, IVSize>& iv);
+
 	bool DecryptAesEcb(const u8* encryptedData, u8* decryptedData, size_t dataSize, const std::array<u8, KeySize>& key);
 	bool DecryptAesCbc(const u8* encryptedData, u8* decryptedData, size_t dataSize, const std::array<u8, KeySize>& key, const std::array<u8, IVSize>& iv);
 }
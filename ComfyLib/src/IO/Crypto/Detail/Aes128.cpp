@@ -0,0 +1,354 @@
+#include "Aes128.h"
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__x86_64__)
+#define COMFY_AES_NI 1
+#include <wmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define COMFY_AES_NI 0
+#endif
+
+// NOTE: Unlike MSVC, GCC and Clang only allow using intrinsics of instruction sets that have been enabled for the function they are used in
+#if defined(__GNUC__) || defined(__clang__)
+#define COMFY_TARGET_AES_NI __attribute__((target("aes,sse4.1")))
+#else
+#define COMFY_TARGET_AES_NI
+#endif
+
+namespace Comfy::IO::Crypto::Detail
+{
+	namespace
+	{
+		constexpr u8 RotateLeft8(u8 value, u32 shift)
+		{
+			return static_cast<u8>((value << shift) | (value >> (8 - shift)));
+		}
+
+		constexpr u32 RotateLeft32(u32 value, u32 shift)
+		{
+			return (shift == 0) ? value : ((value << shift) | (value >> (32 - shift)));
+		}
+
+		constexpr u8 GaloisMultiply(u8 a, u8 b)
+		{
+			u8 result = 0;
+			while (b != 0)
+			{
+				if (b & 1)
+					result ^= a;
+				a = static_cast<u8>((a << 1) ^ ((a & 0x80) ? 0x1B : 0x00));
+				b >>= 1;
+			}
+			return result;
+		}
+
+		struct AesTables
+		{
+			std::array<u8, 256> SBox;
+			std::array<u8, 256> InverseSBox;
+
+			// NOTE: Combined InvSubBytes and InvMixColumns for each of the four rows, with the state stored as four little endian column words
+			std::array<std::array<u32, 256>, 4> InverseT;
+		};
+
+		constexpr AesTables CreateAesTables()
+		{
+			AesTables tables = {};
+
+			// NOTE: Walks through all non zero field elements by multiplying with the generator 3 while dividing by 3 in lockstep to get their multiplicative inverse
+			u8 element = 1, inverse = 1;
+			do
+			{
+				element = static_cast<u8>(element ^ (element << 1) ^ ((element & 0x80) ? 0x1B : 0x00));
+
+				inverse = static_cast<u8>(inverse ^ (inverse << 1));
+				inverse = static_cast<u8>(inverse ^ (inverse << 2));
+				inverse = static_cast<u8>(inverse ^ (inverse << 4));
+				inverse = static_cast<u8>(inverse ^ ((inverse & 0x80) ? 0x09 : 0x00));
+
+				tables.SBox[element] = static_cast<u8>(inverse ^ RotateLeft8(inverse, 1) ^ RotateLeft8(inverse, 2) ^ RotateLeft8(inverse, 3) ^ RotateLeft8(inverse, 4) ^ 0x63);
+			} while (element != 1);
+			tables.SBox[0] = 0x63;
+
+			for (size_t i = 0; i < 256; i++)
+				tables.InverseSBox[tables.SBox[i]] = static_cast<u8>(i);
+
+			for (size_t i = 0; i < 256; i++)
+			{
+				const u8 value = tables.InverseSBox[i];
+				const u32 column =
+					(static_cast<u32>(GaloisMultiply(value, 0x0E)) << 0) |
+					(static_cast<u32>(GaloisMultiply(value, 0x09)) << 8) |
+					(static_cast<u32>(GaloisMultiply(value, 0x0D)) << 16) |
+					(static_cast<u32>(GaloisMultiply(value, 0x0B)) << 24);
+
+				for (u32 row = 0; row < 4; row++)
+					tables.InverseT[row][i] = RotateLeft32(column, row * 8);
+			}
+
+			return tables;
+		}
+
+		constexpr AesTables Tables = CreateAesTables();
+		static_assert(Tables.SBox[0x00] == 0x63 && Tables.SBox[0x53] == 0xED && Tables.InverseSBox[0x63] == 0x00);
+
+		using ColumnWords = std::array<u32, 4>;
+
+		ColumnWords LoadColumnWords(const u8* data)
+		{
+			ColumnWords words;
+			std::memcpy(words.data(), data, sizeof(words));
+			return words;
+		}
+
+		void StoreColumnWords(u8* data, const ColumnWords& words)
+		{
+			std::memcpy(data, words.data(), sizeof(words));
+		}
+
+		u32 SubWord(u32 word)
+		{
+			return
+				(static_cast<u32>(Tables.SBox[(word >> 0) & 0xFF]) << 0) |
+				(static_cast<u32>(Tables.SBox[(word >> 8) & 0xFF]) << 8) |
+				(static_cast<u32>(Tables.SBox[(word >> 16) & 0xFF]) << 16) |
+				(static_cast<u32>(Tables.SBox[(word >> 24) & 0xFF]) << 24);
+		}
+
+		u32 InverseMixColumnWord(u32 word)
+		{
+			// NOTE: The inverse T tables also undo the SubBytes step so it first has to be applied here to cancel out
+			return
+				Tables.InverseT[0][Tables.SBox[(word >> 0) & 0xFF]] ^
+				Tables.InverseT[1][Tables.SBox[(word >> 8) & 0xFF]] ^
+				Tables.InverseT[2][Tables.SBox[(word >> 16) & 0xFF]] ^
+				Tables.InverseT[3][Tables.SBox[(word >> 24) & 0xFF]];
+		}
+
+		void DecryptBlockPortable(const u8* encryptedBlock, u8* decryptedBlock, const AesDecryptionKey& key)
+		{
+			ColumnWords state = LoadColumnWords(encryptedBlock);
+			const ColumnWords firstRoundKey = LoadColumnWords(key.RoundKeys[0].data());
+			for (size_t column = 0; column < 4; column++)
+				state[column] ^= firstRoundKey[column];
+
+			for (size_t round = 1; round < AesDecryptionKey::RoundCount; round++)
+			{
+				const ColumnWords roundKey = LoadColumnWords(key.RoundKeys[round].data());
+
+				// NOTE: InvShiftRows moves row r of column c to column (c + r), so each output column reads row r from column (c - r)
+				ColumnWords nextState;
+				for (size_t column = 0; column < 4; column++)
+				{
+					nextState[column] =
+						Tables.InverseT[0][(state[column] >> 0) & 0xFF] ^
+						Tables.InverseT[1][(state[(column + 3) & 3] >> 8) & 0xFF] ^
+						Tables.InverseT[2][(state[(column + 2) & 3] >> 16) & 0xFF] ^
+						Tables.InverseT[3][(state[(column + 1) & 3] >> 24) & 0xFF] ^
+						roundKey[column];
+				}
+				state = nextState;
+			}
+
+			const ColumnWords lastRoundKey = LoadColumnWords(key.RoundKeys[AesDecryptionKey::RoundCount].data());
+			ColumnWords result;
+			for (size_t column = 0; column < 4; column++)
+			{
+				result[column] =
+					(static_cast<u32>(Tables.InverseSBox[(state[column] >> 0) & 0xFF]) << 0) |
+					(static_cast<u32>(Tables.InverseSBox[(state[(column + 3) & 3] >> 8) & 0xFF]) << 8) |
+					(static_cast<u32>(Tables.InverseSBox[(state[(column + 2) & 3] >> 16) & 0xFF]) << 16) |
+					(static_cast<u32>(Tables.InverseSBox[(state[(column + 1) & 3] >> 24) & 0xFF]) << 24);
+				result[column] ^= lastRoundKey[column];
+			}
+
+			StoreColumnWords(decryptedBlock, result);
+		}
+
+#if COMFY_AES_NI
+		// NOTE: Enough independent blocks in flight to hide the latency of the AESDEC instruction
+		constexpr size_t AesNIInterleaveCount = 8;
+
+		using AesNIRoundKeys = std::array<__m128i, AesDecryptionKey::RoundCount + 1>;
+
+		AesNIRoundKeys LoadAesNIRoundKeys(const AesDecryptionKey& key)
+		{
+			AesNIRoundKeys roundKeys;
+			for (size_t round = 0; round < roundKeys.size(); round++)
+				roundKeys[round] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key.RoundKeys[round].data()));
+			return roundKeys;
+		}
+
+		template <size_t BlockCount>
+		COMFY_TARGET_AES_NI void DecryptBlocksAesNI(std::array<__m128i, BlockCount>& blocks, const AesNIRoundKeys& roundKeys)
+		{
+			for (auto& block : blocks)
+				block = _mm_xor_si128(block, roundKeys[0]);
+
+			for (size_t round = 1; round < AesDecryptionKey::RoundCount; round++)
+			{
+				for (auto& block : blocks)
+					block = _mm_aesdec_si128(block, roundKeys[round]);
+			}
+
+			for (auto& block : blocks)
+				block = _mm_aesdeclast_si128(block, roundKeys[AesDecryptionKey::RoundCount]);
+		}
+#endif
+	}
+
+	AesDecryptionKey Aes128ExpandDecryptionKey(const std::array<u8, KeySize>& key)
+	{
+		constexpr size_t wordsPerRound = 4;
+		std::array<u32, (AesDecryptionKey::RoundCount + 1) * wordsPerRound> encryptionWords;
+		std::memcpy(encryptionWords.data(), key.data(), key.size());
+
+		u8 roundConstant = 0x01;
+		for (size_t i = wordsPerRound; i < encryptionWords.size(); i++)
+		{
+			u32 word = encryptionWords[i - 1];
+			if ((i % wordsPerRound) == 0)
+			{
+				word = SubWord(RotateLeft32(word, 24)) ^ roundConstant;
+				roundConstant = GaloisMultiply(roundConstant, 0x02);
+			}
+			encryptionWords[i] = encryptionWords[i - wordsPerRound] ^ word;
+		}
+
+		// NOTE: Reversed round order with InvMixColumns applied to all inner round keys to allow for the "equivalent inverse cipher",
+		//		 this is the same layout expected by the AESDEC instruction
+		AesDecryptionKey decryptionKey;
+		for (size_t round = 0; round <= AesDecryptionKey::RoundCount; round++)
+		{
+			const size_t encryptionRound = (AesDecryptionKey::RoundCount - round);
+			const bool isInnerRound = (round != 0 && round != AesDecryptionKey::RoundCount);
+
+			ColumnWords roundKey;
+			for (size_t column = 0; column < 4; column++)
+			{
+				const u32 word = encryptionWords[encryptionRound * wordsPerRound + column];
+				roundKey[column] = isInnerRound ? InverseMixColumnWord(word) : word;
+			}
+			StoreColumnWords(decryptionKey.RoundKeys[round].data(), roundKey);
+		}
+
+		return decryptionKey;
+	}
+
+	bool IsAesNISupported()
+	{
+#if COMFY_AES_NI
+		static const bool aesNISupported = []
+		{
+#if defined(_MSC_VER)
+			std::array<int, 4> cpuInfo = {};
+			__cpuid(cpuInfo.data(), 1);
+			return (cpuInfo[2] & (1 << 25)) != 0;
+#else
+			u32 eax, ebx, ecx, edx;
+			return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1 << 25)) != 0;
+#endif
+		}();
+		return aesNISupported;
+#else
+		return false;
+#endif
+	}
+
+	void Aes128DecryptEcbPortable(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key)
+	{
+		for (size_t block = 0; block < blockCount; block++)
+			DecryptBlockPortable(&encryptedData[block * BlockSize], &decryptedData[block * BlockSize], key);
+	}
+
+	void Aes128DecryptCbcPortable(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key, const std::array<u8, IVSize>& iv)
+	{
+		std::array<u8, BlockSize> previousBlock = iv, encryptedBlock;
+		for (size_t block = 0; block < blockCount; block++)
+		{
+			// NOTE: Copied first in case the data is decrypted in place
+			std::memcpy(encryptedBlock.data(), &encryptedData[block * BlockSize], BlockSize);
+
+			u8* decryptedBlock = &decryptedData[block * BlockSize];
+			DecryptBlockPortable(encryptedBlock.data(), decryptedBlock, key);
+
+			for (size_t i = 0; i < BlockSize; i++)
+				decryptedBlock[i] ^= previousBlock[i];
+			previousBlock = encryptedBlock;
+		}
+	}
+
+	COMFY_TARGET_AES_NI void Aes128DecryptEcbAesNI(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key)
+	{
+#if COMFY_AES_NI
+		const auto roundKeys = LoadAesNIRoundKeys(key);
+		const auto loadBlock = [&](size_t block) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(&encryptedData[block * BlockSize])); };
+		const auto storeBlock = [&](size_t block, __m128i value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(&decryptedData[block * BlockSize]), value); };
+
+		size_t block = 0;
+		for (; (block + AesNIInterleaveCount) <= blockCount; block += AesNIInterleaveCount)
+		{
+			std::array<__m128i, AesNIInterleaveCount> blocks;
+			for (size_t i = 0; i < AesNIInterleaveCount; i++)
+				blocks[i] = loadBlock(block + i);
+
+			DecryptBlocksAesNI(blocks, roundKeys);
+
+			for (size_t i = 0; i < AesNIInterleaveCount; i++)
+				storeBlock(block + i, blocks[i]);
+		}
+
+		for (; block < blockCount; block++)
+		{
+			std::array<__m128i, 1> singleBlock = { loadBlock(block) };
+			DecryptBlocksAesNI(singleBlock, roundKeys);
+			storeBlock(block, singleBlock[0]);
+		}
+#else
+		Aes128DecryptEcbPortable(encryptedData, decryptedData, blockCount, key);
+#endif
+	}
+
+	COMFY_TARGET_AES_NI void Aes128DecryptCbcAesNI(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key, const std::array<u8, IVSize>& iv)
+	{
+#if COMFY_AES_NI
+		const auto roundKeys = LoadAesNIRoundKeys(key);
+		const auto loadBlock = [&](size_t block) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(&encryptedData[block * BlockSize])); };
+		const auto storeBlock = [&](size_t block, __m128i value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(&decryptedData[block * BlockSize]), value); };
+
+		// NOTE: Unlike encryption, CBC decryption only depends on the previous *encrypted* block so multiple blocks can still be decrypted in parallel.
+		//		 All encrypted blocks of a group are loaded before any of them are overwritten in case the data is decrypted in place
+		__m128i previousBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv.data()));
+
+		size_t block = 0;
+		for (; (block + AesNIInterleaveCount) <= blockCount; block += AesNIInterleaveCount)
+		{
+			std::array<__m128i, AesNIInterleaveCount> encryptedBlocks, blocks;
+			for (size_t i = 0; i < AesNIInterleaveCount; i++)
+				blocks[i] = encryptedBlocks[i] = loadBlock(block + i);
+
+			DecryptBlocksAesNI(blocks, roundKeys);
+
+			for (size_t i = 0; i < AesNIInterleaveCount; i++)
+				storeBlock(block + i, _mm_xor_si128(blocks[i], (i == 0) ? previousBlock : encryptedBlocks[i - 1]));
+			previousBlock = encryptedBlocks[AesNIInterleaveCount - 1];
+		}
+
+		for (; block < blockCount; block++)
+		{
+			const __m128i encryptedBlock = loadBlock(block);
+			std::array<__m128i, 1> singleBlock = { encryptedBlock };
+			DecryptBlocksAesNI(singleBlock, roundKeys);
+
+			storeBlock(block, _mm_xor_si128(singleBlock[0], previousBlock));
+			previousBlock = encryptedBlock;
+		}
+#else
+		Aes128DecryptCbcPortable(encryptedData, decryptedData, blockCount, key, iv);
+#endif
+	}
+}
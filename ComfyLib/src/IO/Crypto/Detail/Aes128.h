@@ -0,0 +1,19 @@
+#pragma once
+#include "Types.h"
+#include "../Crypto.h"
+
+namespace Comfy::IO::Crypto::Detail
+{
+	AesDecryptionKey Aes128ExpandDecryptionKey(const std::array<u8, KeySize>& key);
+
+	// NOTE: Checked once at runtime, AES-NI isn't part of the x64 baseline
+	bool IsAesNISupported();
+
+	// NOTE: Table based implementation that works on any CPU
+	void Aes128DecryptEcbPortable(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key);
+	void Aes128DecryptCbcPortable(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key, const std::array<u8, IVSize>& iv);
+
+	// NOTE: Must only be called if IsAesNISupported() returned true
+	void Aes128DecryptEcbAesNI(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key);
+	void Aes128DecryptCbcAesNI(const u8* encryptedData, u8* decryptedData, size_t blockCount, const AesDecryptionKey& key, const std::array<u8, IVSize>& iv);
+}
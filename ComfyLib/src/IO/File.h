@@ -2,6 +2,7 @@
 #include "Types.h"
 #include "Stream/FileStream.h"
 #include "Stream/MemoryStream.h"
+#include "Stream/MemoryWriteStream.h"
 #include "Stream/Manipulator/StreamReader.h"
 #include "Stream/Manipulator/StreamWriter.h"
 #include "Stream/FileInterfaces.h"
@@ -93,6 +94,22 @@ namespace Comfy::IO
 			return true;
 		}
 
+		// NOTE: Serializes into memory first and then writes out the entire file at once instead of issuing a separate file write for every single value
+		template <typename Writable>
+		bool SaveBuffered(std::string_view filePath, Writable& writable)
+		{
+			static_assert(std::is_base_of_v<IStreamWritable, Writable>);
+
+			std::unique_ptr<u8[]> dataBuffer;
+			auto memoryStream = MemoryWriteStream(dataBuffer);
+
+			auto writer = StreamWriter(memoryStream);
+			if (const auto streamResult = writable.Write(writer); streamResult != StreamResult::Success)
+				return false;
+
+			return WriteAllBytes(filePath, dataBuffer.get(), static_cast<size_t>(memoryStream.GetLength()));
+		}
+
 		template <typename Loadable>
 		COMFY_NODISCARD std::future<std::unique_ptr<Loadable>> LoadAsync(std::string_view filePath)
 		{
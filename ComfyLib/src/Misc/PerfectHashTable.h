@@ -0,0 +1,201 @@
+#pragma once
+#include "Types.h"
+#include "StringUtil.h"
+
+namespace Comfy
+{
+	template <typename ValueType>
+	struct PerfectHashTableEntry
+	{
+		std::string_view Key = {};
+		ValueType Value = {};
+	};
+
+	// NOTE: Collision free (string -> value) lookup table for a fixed set of keys known at compile time using the "hash and displace" scheme.
+	//		 Keys are first distributed into buckets, then every bucket searches for a displacement value that maps all of its keys into still unused slots
+	//		 so that a lookup only ever has to hash the input once and compare it against a single candidate key.
+	//		 For duplicate keys the first entry wins, same as a linear search. Always check IsValid() inside a static_assert after construction
+	template <typename ValueType, size_t KeyCount, bool CaseInsensitive = false>
+	class PerfectHashTable
+	{
+	public:
+		static_assert(KeyCount > 0);
+
+		static constexpr size_t NextPowerOfTwo(size_t value)
+		{
+			size_t result = 1;
+			while (result < value)
+				result <<= 1;
+			return result;
+		}
+
+		// NOTE: Kept at a load factor of at most 0.5 so that the displacement search always finishes quickly, even inside the constexpr step limit
+		static constexpr size_t SlotCount = NextPowerOfTwo(KeyCount * 2);
+		static constexpr size_t BucketCount = NextPowerOfTwo((KeyCount + 3) / 4);
+		static constexpr u32 MaxDisplacement = 0xFFFF;
+		static constexpr size_t MaxBucketSize = 32;
+
+		using EntryType = PerfectHashTableEntry<ValueType>;
+
+	public:
+		constexpr PerfectHashTable(const std::array<EntryType, KeyCount>& entries) : displacements(), slots(), slotUsed(), valid(false)
+		{
+			std::array<u32, KeyCount> keyHashes = {};
+			for (size_t i = 0; i < KeyCount; i++)
+				keyHashes[i] = HashKey(entries[i].Key);
+
+			// NOTE: Counting sort the key indices by bucket while preserving their original order inside each bucket
+			std::array<u32, BucketCount + 1> bucketOffsets = {};
+			for (size_t i = 0; i < KeyCount; i++)
+				bucketOffsets[GetBucketIndex(keyHashes[i]) + 1]++;
+			for (size_t bucket = 0; bucket < BucketCount; bucket++)
+				bucketOffsets[bucket + 1] += bucketOffsets[bucket];
+
+			std::array<u32, KeyCount> bucketKeyIndices = {};
+			std::array<u32, BucketCount> bucketFillCounts = {};
+			for (size_t i = 0; i < KeyCount; i++)
+			{
+				const u32 bucket = GetBucketIndex(keyHashes[i]);
+				bucketKeyIndices[bucketOffsets[bucket] + bucketFillCounts[bucket]++] = static_cast<u32>(i);
+			}
+
+			u32 largestBucketSize = 0;
+			for (size_t bucket = 0; bucket < BucketCount; bucket++)
+				largestBucketSize = (bucketFillCounts[bucket] > largestBucketSize) ? bucketFillCounts[bucket] : largestBucketSize;
+			if (largestBucketSize > MaxBucketSize)
+				return;
+
+			// NOTE: Place the largest buckets first while there are still plenty of free slots.
+			//		 Iterating over the few possible sizes is a lot cheaper to evaluate at compile time than sorting the buckets
+			std::array<bool, KeyCount> isDuplicate = {};
+			std::array<u32, MaxBucketSize> tentativeSlots = {};
+			for (u32 bucketSize = largestBucketSize; bucketSize > 0; bucketSize--)
+			{
+				for (u32 bucket = 0; bucket < static_cast<u32>(BucketCount); bucket++)
+				{
+					if (bucketFillCounts[bucket] != bucketSize)
+						continue;
+
+					const u32 bucketBegin = bucketOffsets[bucket], bucketEnd = bucketOffsets[bucket + 1];
+
+					// NOTE: Identical keys always share a bucket so duplicates only have to be searched for locally
+					for (u32 i = bucketBegin; i < bucketEnd; i++)
+					{
+						for (u32 j = bucketBegin; j < i && !isDuplicate[bucketKeyIndices[i]]; j++)
+						{
+							const u32 keyA = bucketKeyIndices[i], keyB = bucketKeyIndices[j];
+							isDuplicate[keyA] = (keyHashes[keyA] == keyHashes[keyB] && KeysMatch(entries[keyA].Key, entries[keyB].Key));
+						}
+					}
+
+					bool bucketPlaced = false;
+					for (u32 displacement = 0; displacement <= MaxDisplacement && !bucketPlaced; displacement++)
+					{
+						u32 tentativeCount = 0;
+
+						bucketPlaced = true;
+						for (u32 i = bucketBegin; i < bucketEnd && bucketPlaced; i++)
+						{
+							if (isDuplicate[bucketKeyIndices[i]])
+								continue;
+
+							const u32 slot = GetSlotIndex(keyHashes[bucketKeyIndices[i]], displacement);
+							bucketPlaced = !slotUsed[slot];
+							for (u32 t = 0; t < tentativeCount && bucketPlaced; t++)
+								bucketPlaced = (tentativeSlots[t] != slot);
+
+							tentativeSlots[tentativeCount++] = slot;
+						}
+
+						if (!bucketPlaced)
+							continue;
+
+						displacements[bucket] = static_cast<u16>(displacement);
+						tentativeCount = 0;
+						for (u32 i = bucketBegin; i < bucketEnd; i++)
+						{
+							if (isDuplicate[bucketKeyIndices[i]])
+								continue;
+
+							const u32 slot = tentativeSlots[tentativeCount++];
+							slots[slot] = entries[bucketKeyIndices[i]];
+							slotUsed[slot] = true;
+						}
+					}
+
+					if (!bucketPlaced)
+						return;
+				}
+			}
+
+			valid = true;
+		}
+
+	public:
+		constexpr bool IsValid() const
+		{
+			return valid;
+		}
+
+		constexpr const ValueType* Find(std::string_view key) const
+		{
+			const u32 hash = HashKey(key);
+			const u32 slot = GetSlotIndex(hash, displacements[GetBucketIndex(hash)]);
+
+			return (slotUsed[slot] && KeysMatch(slots[slot].Key, key)) ? &slots[slot].Value : nullptr;
+		}
+
+		constexpr ValueType FindOr(std::string_view key, ValueType defaultValue) const
+		{
+			const auto found = Find(key);
+			return (found != nullptr) ? *found : defaultValue;
+		}
+
+	private:
+		static constexpr u32 HashKey(std::string_view key)
+		{
+			// NOTE: FNV-1a over the lower case characters for case insensitive tables
+			u32 hash = 0x811C9DC5;
+			for (const char character : key)
+			{
+				hash ^= static_cast<u8>(CaseInsensitive ? ASCII::ToLowerCase(character) : character);
+				hash *= 0x01000193;
+			}
+			return hash;
+		}
+
+		static constexpr u32 MixHash(u32 hash)
+		{
+			hash ^= hash >> 16;
+			hash *= 0x85EBCA6B;
+			hash ^= hash >> 13;
+			hash *= 0xC2B2AE35;
+			hash ^= hash >> 16;
+			return hash;
+		}
+
+		static constexpr u32 GetBucketIndex(u32 keyHash)
+		{
+			return (keyHash & static_cast<u32>(BucketCount - 1));
+		}
+
+		static constexpr u32 GetSlotIndex(u32 keyHash, u32 displacement)
+		{
+			return (MixHash(keyHash ^ (displacement * 0x9E3779B9)) & static_cast<u32>(SlotCount - 1));
+		}
+
+		static constexpr bool KeysMatch(std::string_view keyA, std::string_view keyB)
+		{
+			if constexpr (CaseInsensitive)
+				return Util::MatchesInsensitive(keyA, keyB);
+			else
+				return (keyA == keyB);
+		}
+
+	private:
+		std::array<u16, BucketCount> displacements;
+		std::array<EntryType, SlotCount> slots;
+		std::array<bool, SlotCount> slotUsed;
+		bool valid;
+	};
+}
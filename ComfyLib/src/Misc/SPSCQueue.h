@@ -0,0 +1,72 @@
+#pragma once
+#include "Types.h"
+#include <atomic>
+
+namespace Comfy
+{
+	// NOTE: Fixed capacity lock-free ring buffer for exactly one producer thread and one consumer thread.
+	//		 The producer only ever writes the tail and the consumer only ever writes the head so neither side has to wait for the other,
+	//		 pushing into a full queue fails instead of blocking
+	template <typename ValueType, size_t Capacity>
+	class SPSCQueue : NonCopyable
+	{
+	public:
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+		static_assert(std::is_trivially_copyable_v<ValueType>);
+
+		// NOTE: Keep the indices written by different threads on separate cache lines to avoid false sharing
+		static constexpr size_t CacheLineSize = 64;
+
+	public:
+		SPSCQueue() = default;
+		~SPSCQueue() = default;
+
+	public:
+		// NOTE: Producer thread only
+		bool TryPush(const ValueType& value)
+		{
+			const size_t tail = tailIndex.load(std::memory_order_relaxed);
+			if ((tail - cachedHeadIndex) >= Capacity)
+			{
+				cachedHeadIndex = headIndex.load(std::memory_order_acquire);
+				if ((tail - cachedHeadIndex) >= Capacity)
+					return false;
+			}
+
+			items[tail & (Capacity - 1)] = value;
+			tailIndex.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		// NOTE: Consumer thread only
+		bool TryPop(ValueType& outValue)
+		{
+			const size_t head = headIndex.load(std::memory_order_relaxed);
+			if (head == cachedTailIndex)
+			{
+				cachedTailIndex = tailIndex.load(std::memory_order_acquire);
+				if (head == cachedTailIndex)
+					return false;
+			}
+
+			outValue = items[head & (Capacity - 1)];
+			headIndex.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// NOTE: Only an approximation while the other thread is still active
+		size_t ApproximateSize() const
+		{
+			return (tailIndex.load(std::memory_order_acquire) - headIndex.load(std::memory_order_acquire));
+		}
+
+	private:
+		alignas(CacheLineSize) std::atomic<size_t> headIndex = 0;
+		size_t cachedTailIndex = 0;
+
+		alignas(CacheLineSize) std::atomic<size_t> tailIndex = 0;
+		size_t cachedHeadIndex = 0;
+
+		alignas(CacheLineSize) std::array<ValueType, Capacity> items = {};
+	};
+}
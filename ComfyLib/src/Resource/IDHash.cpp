@@ -0,0 +1,162 @@
+#include "IDHash.h"
+
+// NOTE: Unlike SSE2, AVX2 isn't part of the x64 baseline so its support has to be checked at runtime before the wider code path is taken
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__x86_64__)
+#define COMFY_MURMUR_HASH_BATCH_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define COMFY_MURMUR_HASH_BATCH_AVX2 0
+#endif
+
+// NOTE: Unlike MSVC, GCC and Clang only allow using intrinsics of instruction sets that have been enabled for the function they are used in
+#if defined(__GNUC__) || defined(__clang__)
+#define COMFY_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define COMFY_TARGET_AVX2
+#endif
+
+namespace Comfy
+{
+	namespace
+	{
+		void MurmurHashBatchScalar(const std::string_view* strings, u32* outHashes, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+				outHashes[i] = MurmurHash(strings[i]);
+		}
+
+#if COMFY_MURMUR_HASH_BATCH_AVX2
+		constexpr size_t AVX2LaneCount = 8;
+
+		// NOTE: EAX, EBX, ECX and EDX of the given CPUID leaf
+		std::array<u32, 4> CpuID(u32 leaf, u32 subLeaf = 0)
+		{
+			std::array<u32, 4> registers = {};
+#if defined(_MSC_VER)
+			__cpuidex(reinterpret_cast<int*>(registers.data()), static_cast<int>(leaf), static_cast<int>(subLeaf));
+#else
+			__get_cpuid_count(leaf, subLeaf, &registers[0], &registers[1], &registers[2], &registers[3]);
+#endif
+			return registers;
+		}
+
+		u64 ReadExtendedControlRegister0()
+		{
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			u32 low, high;
+			__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+			return (static_cast<u64>(high) << 32) | low;
+#endif
+		}
+
+		bool IsAVX2Supported()
+		{
+			if (CpuID(0)[0] < 7)
+				return false;
+
+			// NOTE: The OS also has to save the upper halves of the YMM registers on context switches
+			const auto features = CpuID(1);
+			const bool osxsaveSupported = (features[2] & (1 << 27)), avxSupported = (features[2] & (1 << 28));
+			if (!osxsaveSupported || !avxSupported || (ReadExtendedControlRegister0() & 0x6) != 0x6)
+				return false;
+
+			return (CpuID(7, 0)[1] & (1 << 5));
+		}
+
+		COMFY_TARGET_AVX2 __m256i MurmurHashMixAVX2(__m256i hash, __m256i hashM)
+		{
+			hash = _mm256_mullo_epi32(hash, hashM);
+			return _mm256_xor_si256(hash, _mm256_srli_epi32(hash, MurmurHashR));
+		}
+
+		COMFY_TARGET_AVX2 void MurmurHashBatchAVX2(const std::string_view* strings, u32* outHashes)
+		{
+			std::array<u32, AVX2LaneCount> blockCounts, tailBlocks, tailMasks;
+			u32 maxBlockCount = 0;
+
+			for (size_t lane = 0; lane < AVX2LaneCount; lane++)
+			{
+				const auto string = strings[lane];
+				blockCounts[lane] = static_cast<u32>(string.size() / sizeof(u32));
+				maxBlockCount = std::max(maxBlockCount, blockCounts[lane]);
+
+				// NOTE: Has to exactly match the (sign extending) scalar implementation for non ASCII characters
+				const char* data = string.data() + (blockCounts[lane] * sizeof(u32));
+				u32 tail = 0;
+				switch (string.size() % sizeof(u32))
+				{
+				case 3:
+					tail += static_cast<u32>(data[2] << 16);
+				case 2:
+					tail += static_cast<u32>(data[1] << 8);
+				case 1:
+					tail += static_cast<u32>(data[0] << 0);
+					break;
+				}
+				tailBlocks[lane] = tail;
+				tailMasks[lane] = ((string.size() % sizeof(u32)) != 0) ? 0xFFFFFFFF : 0;
+			}
+
+			const __m256i hashM = _mm256_set1_epi32(static_cast<int>(MurmurHashM));
+			const __m256i laneBlockCounts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blockCounts.data()));
+			__m256i hash = _mm256_set1_epi32(static_cast<int>(MurmurHashSeed));
+
+			// NOTE: Gather the next block of every string directly from their absolute addresses, lanes of shorter strings are masked out once they run out of blocks
+			//		 without reading past the end of their string, so similar length strings make the best use of the batch
+			const __m256i laneAddressesLow = _mm256_setr_epi64x(
+				reinterpret_cast<i64>(strings[0].data()), reinterpret_cast<i64>(strings[1].data()), reinterpret_cast<i64>(strings[2].data()), reinterpret_cast<i64>(strings[3].data()));
+			const __m256i laneAddressesHigh = _mm256_setr_epi64x(
+				reinterpret_cast<i64>(strings[4].data()), reinterpret_cast<i64>(strings[5].data()), reinterpret_cast<i64>(strings[6].data()), reinterpret_cast<i64>(strings[7].data()));
+
+			for (u32 blockIndex = 0; blockIndex < maxBlockCount; blockIndex++)
+			{
+				const __m256i activeMask = _mm256_cmpgt_epi32(laneBlockCounts, _mm256_set1_epi32(static_cast<int>(blockIndex)));
+				const __m256i blockOffset = _mm256_set1_epi64x(static_cast<i64>(blockIndex * sizeof(u32)));
+
+				const __m128i blocksLow = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), nullptr, _mm256_add_epi64(laneAddressesLow, blockOffset), _mm256_castsi256_si128(activeMask), 1);
+				const __m128i blocksHigh = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), nullptr, _mm256_add_epi64(laneAddressesHigh, blockOffset), _mm256_extracti128_si256(activeMask, 1), 1);
+				const __m256i blocks = _mm256_inserti128_si256(_mm256_castsi128_si256(blocksLow), blocksHigh, 1);
+
+				hash = _mm256_blendv_epi8(hash, MurmurHashMixAVX2(_mm256_add_epi32(hash, blocks), hashM), activeMask);
+			}
+
+			const __m256i tailMask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailMasks.data()));
+			const __m256i tailHash = MurmurHashMixAVX2(_mm256_add_epi32(hash, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tailBlocks.data()))), hashM);
+			hash = _mm256_blendv_epi8(hash, tailHash, tailMask);
+
+			hash = _mm256_mullo_epi32(hash, hashM);
+			hash = _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 10));
+			hash = _mm256_mullo_epi32(hash, hashM);
+			hash = _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 17));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(outHashes), hash);
+		}
+#endif
+	}
+
+	void MurmurHashBatch(const std::string_view* strings, u32* outHashes, size_t count)
+	{
+#if COMFY_MURMUR_HASH_BATCH_AVX2
+		static const bool avx2Supported = IsAVX2Supported();
+		if (avx2Supported)
+		{
+			const size_t batchCount = (count / AVX2LaneCount);
+			for (size_t batch = 0; batch < batchCount; batch++)
+				MurmurHashBatchAVX2(&strings[batch * AVX2LaneCount], &outHashes[batch * AVX2LaneCount]);
+
+			const size_t remainingIndex = (batchCount * AVX2LaneCount);
+			MurmurHashBatchScalar(&strings[remainingIndex], &outHashes[remainingIndex], count - remainingIndex);
+			return;
+		}
+#endif
+
+		MurmurHashBatchScalar(strings, outHashes, count);
+	}
+}
@@ -54,4 +54,15 @@ namespace Comfy
 	{
 		return static_cast<IDType>(MurmurHash(string));
 	}
+
+	// NOTE: Produces the exact same hashes as calling MurmurHash() for every string individually.
+	//		 Eight strings are hashed in parallel using AVX2 if supported by the CPU, otherwise falls back to the scalar version
+	void MurmurHashBatch(const std::string_view* strings, u32* outHashes, size_t count);
+
+	template <typename IDType>
+	void HashIDStringBatch(const std::string_view* strings, IDType* outIDs, size_t count)
+	{
+		static_assert(sizeof(IDType) == sizeof(u32));
+		MurmurHashBatch(strings, reinterpret_cast<u32*>(outIDs), count);
+	}
 }
@@ -3,21 +3,32 @@
 
 namespace Comfy
 {
-	// NOTE: High performance container to map between (ID -> Resource) using CachedResourceIDs
+	// NOTE: High performance container to map between (ID -> Resource) using CachedResourceIDs.
+	//		 Stored as parallel sorted arrays so that searches only touch the densely packed IDs and lookups return the raw resource pointer
+	//		 without going through the shared_ptr, the owning shared_ptrs are only accessed when adding, removing or iterating
 	template <typename IDType, typename ResourceType>
 	class ResourceIDMap
 	{
-		// NOTE: Completly arbitrary threshold, might wanna do some real performance testing
-		static constexpr size_t LinearSearchThreshold = 32;
 		static constexpr bool OverideDuplicateIDs = true;
 
 	public:
+		// NOTE: Measured using the Comfy::Sandbox::Tests::ResourceIDMapTest benchmark for both sequential and hashed IDs,
+		//		 the early out linear search over the packed IDs stays ahead of the binary search until somewhere between 48 and 64 entries
+		static constexpr size_t LinearSearchThreshold = 48;
+
 		struct ResourceIDPair
 		{
 			IDType ID;
-			std::shared_ptr<ResourceType> Resource;
+			const std::shared_ptr<ResourceType>& Resource;
 		};
 
+		struct FindIndexResult
+		{
+			int IndexOrClosest;
+			bool WasFound;
+		};
+
+	public:
 		bool Contains(IDType id) const
 		{
 			return FindIndex(id).WasFound;
@@ -25,6 +36,8 @@ namespace Comfy
 
 		void ReservedAdditional(size_t count)
 		{
+			sortedIDs.reserve(sortedIDs.size() + count);
+			sortedRawResources.reserve(sortedRawResources.size() + count);
 			sortedResources.reserve(sortedResources.size() + count);
 		}
 
@@ -36,45 +49,95 @@ namespace Comfy
 			if (const auto[indexOrClosest, wasFound] = FindIndex(id); wasFound)
 			{
 				if (OverideDuplicateIDs)
-					sortedResources[indexOrClosest].Resource = resource;
+				{
+					sortedRawResources[indexOrClosest] = resource.get();
+					sortedResources[indexOrClosest] = resource;
+				}
 			}
 			else
 			{
-				sortedResources.insert(sortedResources.begin() + indexOrClosest, { id, resource });
+				sortedIDs.insert(sortedIDs.begin() + indexOrClosest, id);
+				sortedRawResources.insert(sortedRawResources.begin() + indexOrClosest, resource.get());
+				sortedResources.insert(sortedResources.begin() + indexOrClosest, resource);
 			}
 		}
 
+		// NOTE: Appends all resources and sorts only once instead of shifting the arrays for every single insertion,
+		//		 duplicate IDs are resolved the same way as a sequence of Add() calls would
+		template <typename CollectionType, typename GetIDFunc>
+		void AddRange(const CollectionType& resources, GetIDFunc getID)
+		{
+			const size_t previousCount = sortedIDs.size();
+			ReservedAdditional(std::size(resources));
+
+			for (const std::shared_ptr<ResourceType>& resource : resources)
+			{
+				if (const IDType id = getID(resource); id != IDType::Invalid)
+				{
+					sortedIDs.push_back(id);
+					sortedRawResources.push_back(resource.get());
+					sortedResources.push_back(resource);
+				}
+			}
+
+			if (sortedIDs.size() > previousCount)
+				SortAllResources();
+		}
+
 		void Remove(IDType id)
 		{
-			RemoveIf([id](auto& pair) { return pair.ID == id; });
+			if (const auto[index, wasFound] = FindIndex(id); wasFound)
+			{
+				sortedIDs.erase(sortedIDs.begin() + index);
+				sortedRawResources.erase(sortedRawResources.begin() + index);
+				sortedResources.erase(sortedResources.begin() + index);
+			}
 		}
 
 		template <typename Func>
 		void RemoveIf(Func func)
 		{
-			sortedResources.erase(
-				std::remove_if(
-					sortedResources.begin(),
-					sortedResources.end(),
-					func),
-				sortedResources.end());
+			size_t writeIndex = 0;
+			for (size_t readIndex = 0; readIndex < sortedIDs.size(); readIndex++)
+			{
+				ResourceIDPair pair { sortedIDs[readIndex], sortedResources[readIndex] };
+				if (func(pair))
+					continue;
+
+				if (writeIndex != readIndex)
+				{
+					sortedIDs[writeIndex] = sortedIDs[readIndex];
+					sortedRawResources[writeIndex] = sortedRawResources[readIndex];
+					sortedResources[writeIndex] = std::move(sortedResources[readIndex]);
+				}
+				writeIndex++;
+			}
+
+			sortedIDs.resize(writeIndex);
+			sortedRawResources.resize(writeIndex);
+			sortedResources.resize(writeIndex);
 		}
 
 		template <typename Func>
 		void Iterate(Func func)
 		{
-			for (auto& resource : sortedResources)
-				func(resource);
+			for (size_t i = 0; i < sortedIDs.size(); i++)
+			{
+				ResourceIDPair pair { sortedIDs[i], sortedResources[i] };
+				func(pair);
+			}
 		}
 
 		void Clear()
 		{
+			sortedIDs.clear();
+			sortedRawResources.clear();
 			sortedResources.clear();
 		}
 
 		size_t Size() const
 		{
-			return sortedResources.size();
+			return sortedIDs.size();
 		}
 
 		ResourceType* Find(const IDType* rawID) const = delete;
@@ -86,10 +149,10 @@ namespace Comfy
 			if (cachedID == nullptr || *cachedID == IDType::Invalid)
 				return nullptr;
 
-			if (cachedID->CachedIndex < sortedResources.size())
+			if (cachedID->CachedIndex < sortedIDs.size())
 			{
-				if (sortedResources[cachedID->CachedIndex].ID == cachedID->ID)
-					return sortedResources[cachedID->CachedIndex].Resource.get();
+				if (sortedIDs[cachedID->CachedIndex] == cachedID->ID)
+					return sortedRawResources[cachedID->CachedIndex];
 				else
 					cachedID->CachedIndex = std::numeric_limits<decltype(cachedID->CachedIndex)>::max();
 			}
@@ -97,32 +160,22 @@ namespace Comfy
 			if (const auto[index, wasFound] = FindIndex(cachedID->ID); wasFound)
 			{
 				cachedID->CachedIndex = static_cast<decltype(cachedID->CachedIndex)>(index);
-				return sortedResources[index].Resource.get();
+				return sortedRawResources[index];
 			}
 
 			return nullptr;
 		}
 
-	private:
-		struct FindIndexResult
-		{
-			int IndexOrClosest;
-			bool WasFound;
-		};
-
-		FindIndexResult FindIndex(IDType id) const
-		{
-			return (sortedResources.size() < LinearSearchThreshold) ? FindIndexLinearSearch(id) : FindIndexBinarySearch(id);
-		}
-
+	public:
+		// NOTE: Exposed separately so that the threshold between the two can be benchmarked
 		FindIndexResult FindIndexLinearSearch(IDType id) const
 		{
-			const int resourceCount = static_cast<int>(sortedResources.size());
+			const int resourceCount = static_cast<int>(sortedIDs.size());
 			for (int i = 0; i < resourceCount; i++)
 			{
-				if (sortedResources[i].ID == id)
+				if (sortedIDs[i] == id)
 					return { i, true };
-				else if (sortedResources[i].ID > id)
+				else if (sortedIDs[i] > id)
 					return { i, false };
 			}
 			return { resourceCount, false };
@@ -130,17 +183,17 @@ namespace Comfy
 
 		FindIndexResult FindIndexBinarySearch(IDType id) const
 		{
-			if (sortedResources.size() < 1)
+			if (sortedIDs.size() < 1)
 				return { 0, false };
 
-			int left = 0, right = static_cast<int>(sortedResources.size()) - 1;
+			int left = 0, right = static_cast<int>(sortedIDs.size()) - 1;
 			while (left <= right)
 			{
 				const int mid = (left + right) / 2;
 
-				if (id < sortedResources[mid].ID)
+				if (id < sortedIDs[mid])
 					right = (mid - 1);
-				else if (id > sortedResources[mid].ID)
+				else if (id > sortedIDs[mid])
 					left = (mid + 1);
 				else
 					return { mid, true };
@@ -149,11 +202,51 @@ namespace Comfy
 			return { left, false };
 		}
 
+	private:
+		FindIndexResult FindIndex(IDType id) const
+		{
+			return (sortedIDs.size() < LinearSearchThreshold) ? FindIndexLinearSearch(id) : FindIndexBinarySearch(id);
+		}
+
 		void SortAllResources()
 		{
-			std::sort(sortedResources.begin(), sortedResources.end(), [](auto& a, auto& b) { return a.ID < b.ID; });
+			// NOTE: Stable so that for duplicate IDs the last added resource ends up last and can then override the others the same way Add() would
+			std::vector<u32> sortedOrder(sortedIDs.size());
+			for (u32 i = 0; i < static_cast<u32>(sortedOrder.size()); i++)
+				sortedOrder[i] = i;
+			std::stable_sort(sortedOrder.begin(), sortedOrder.end(), [&](u32 a, u32 b) { return sortedIDs[a] < sortedIDs[b]; });
+
+			std::vector<IDType> newIDs;
+			std::vector<ResourceType*> newRawResources;
+			std::vector<std::shared_ptr<ResourceType>> newResources;
+			newIDs.reserve(sortedIDs.capacity());
+			newRawResources.reserve(sortedRawResources.capacity());
+			newResources.reserve(sortedResources.capacity());
+
+			for (const u32 index : sortedOrder)
+			{
+				if (!newIDs.empty() && newIDs.back() == sortedIDs[index])
+				{
+					if (OverideDuplicateIDs)
+					{
+						newRawResources.back() = sortedRawResources[index];
+						newResources.back() = std::move(sortedResources[index]);
+					}
+					continue;
+				}
+
+				newIDs.push_back(sortedIDs[index]);
+				newRawResources.push_back(sortedRawResources[index]);
+				newResources.push_back(std::move(sortedResources[index]));
+			}
+
+			sortedIDs = std::move(newIDs);
+			sortedRawResources = std::move(newRawResources);
+			sortedResources = std::move(newResources);
 		}
 
-		std::vector<ResourceIDPair> sortedResources;
+		std::vector<IDType> sortedIDs;
+		std::vector<ResourceType*> sortedRawResources;
+		std::vector<std::shared_ptr<ResourceType>> sortedResources;
 	};
 }
@@ -1,37 +1,44 @@
 #include "PVScript.h"
 #include "IO/Stream/Manipulator/StreamWriter.h"
-#include <numeric>
+#include <algorithm>
 
 namespace Comfy
 {
+	void PVScriptBuilder::Reserve(size_t commandCount)
+	{
+		timedCommands.reserve(commandCount);
+	}
+
 	void PVScriptBuilder::Add(TimeSpan time, const PVCommand& command, i32 branch)
 	{
 		// TODO: Correcetly handle branches
 		assert(branch == 0);
 
-		timedCommandGroups[PVCommandLayout::Time(time)].push_back(command);
+		timedCommands.push_back(TimedCommand { PVCommandLayout::Time(time), command });
 	}
 
 	std::vector<PVCommand> PVScriptBuilder::Create()
 	{
-		std::vector<PVCommand> outCommands;
+		std::stable_sort(timedCommands.begin(), timedCommands.end(), [](const TimedCommand& a, const TimedCommand& b) { return (a.Time < b.Time); });
 
-		const size_t expectedCommandCount = std::accumulate(
-			timedCommandGroups.begin(),
-			timedCommandGroups.end(),
-			size_t {},
-			[&](size_t count, auto& group) { return (count + group.second.size() + 1); });
+		size_t uniqueTimeCount = 0;
+		for (size_t i = 0; i < timedCommands.size(); i++)
+		{
+			if (i == 0 || timedCommands[i - 1].Time < timedCommands[i].Time)
+				uniqueTimeCount++;
+		}
 
-		outCommands.reserve(expectedCommandCount);
+		std::vector<PVCommand> outCommands;
+		outCommands.reserve(timedCommands.size() + uniqueTimeCount);
 
-		for (const auto&[timeCommand, commandGroup] : timedCommandGroups)
+		for (size_t i = 0; i < timedCommands.size(); i++)
 		{
-			outCommands.push_back(timeCommand);
-			for (const auto& command : commandGroup)
-				outCommands.push_back(command);
+			if (i == 0 || timedCommands[i - 1].Time < timedCommands[i].Time)
+				outCommands.push_back(timedCommands[i].Time);
+			outCommands.push_back(timedCommands[i].Command);
 		}
 
-		assert(outCommands.size() == expectedCommandCount);
+		assert(outCommands.size() == (timedCommands.size() + uniqueTimeCount));
 		return outCommands;
 	}
 
@@ -56,39 +63,50 @@ namespace Comfy
 
 	void PVScript::Parse(const u8* buffer, size_t bufferSize)
 	{
+		ParseResult = PVScriptParseResult::Success;
+		InvalidCommandByteOffset = 0;
+
 		if (bufferSize < sizeof(u32))
+		{
+			ParseResult = PVScriptParseResult::MissingHeader;
 			return;
+		}
 
 		Version = static_cast<PVScriptVersion>(*reinterpret_cast<const u32*>(buffer));
-		size_t commandCount = 0;
 
 		const u32* commandsStart = reinterpret_cast<const u32*>(buffer + sizeof(u32));
-		const u32* commandsEnd = reinterpret_cast<const u32*>(buffer + bufferSize);
+		const u32* commandsEnd = commandsStart + ((bufferSize - sizeof(u32)) / sizeof(u32));
+
+		// NOTE: Rough estimate based on the average parameter count of typical scripts to avoid a separate counting pass over the entire buffer
+		constexpr size_t estimatedWordsPerCommand = 4;
+		Commands.reserve(Commands.size() + static_cast<size_t>(commandsEnd - commandsStart) / estimatedWordsPerCommand);
 
 		const u32* readHead = commandsStart;
 		while (readHead < commandsEnd)
 		{
-			const auto commandType = *reinterpret_cast<const PVCommandType*>(readHead);
-			const auto paramCount = GetPVCommandParamCount(commandType);
-
-			readHead += (1 + paramCount);
-			commandCount++;
-		}
-
-		readHead = commandsStart;
+			const u32 commandTypeIndex = *readHead;
+			if (commandTypeIndex >= static_cast<u32>(PVCommandType::Count))
+			{
+				ParseResult = PVScriptParseResult::UnknownCommand;
+				break;
+			}
 
-		Commands.reserve(commandCount);
-		for (size_t i = 0; i < commandCount; i++)
-		{
-			const auto commandType = *reinterpret_cast<const PVCommandType*>(readHead);
-			const auto paramCount = GetPVCommandParamCount(commandType);
+			const u32 paramCount = PVCommandInfoTable[commandTypeIndex].ParamCount;
+			if (paramCount > static_cast<size_t>(commandsEnd - (readHead + 1)))
+			{
+				ParseResult = PVScriptParseResult::TruncatedCommand;
+				break;
+			}
 
 			auto& command = Commands.emplace_back();
-			command.Type = commandType;
-			std::memcpy(command.Param.data(), (readHead + 1), paramCount * sizeof(i32));
+			command.Type = static_cast<PVCommandType>(commandTypeIndex);
+			std::memcpy(command.Param.data(), (readHead + 1), paramCount * sizeof(u32));
 
 			readHead += (1 + paramCount);
 		}
+
+		if (ParseResult != PVScriptParseResult::Success)
+			InvalidCommandByteOffset = static_cast<size_t>(reinterpret_cast<const u8*>(readHead) - buffer);
 	}
 
 	IO::StreamResult PVScript::Write(IO::StreamWriter& writer)
@@ -2,8 +2,6 @@
 #include "Types.h"
 #include "IO/Stream/FileInterfaces.h"
 #include "Time/TimeSpan.h"
-#include <memory_resource>
-#include <map>
 
 namespace Comfy
 {
@@ -464,6 +462,26 @@ namespace Comfy
 		Current = 0x14050921,
 	};
 
+	enum class PVScriptParseResult : u8
+	{
+		Success,
+		// NOTE: The buffer is too small to contain the version header
+		MissingHeader,
+		// NOTE: A command type outside of the known command table, after which the remaining buffer can't be interpreted anymore
+		UnknownCommand,
+		// NOTE: The last command extends past the end of the buffer
+		TruncatedCommand,
+		Count
+	};
+
+	constexpr std::array<const char*, EnumCount<PVScriptParseResult>()> PVScriptParseResultNames =
+	{
+		"Success",
+		"Missing Header",
+		"Unknown Command",
+		"Truncated Command",
+	};
+
 	class PVScript : public IO::IBufferParsable, public IO::IStreamWritable
 	{
 	public:
@@ -475,6 +493,10 @@ namespace Comfy
 		PVScriptVersion Version = PVScriptVersion::Current;
 		std::vector<PVCommand> Commands;
 
+		// NOTE: All commands up until the first invalid one are kept so partially corrupted scripts can still be imported
+		PVScriptParseResult ParseResult = PVScriptParseResult::Success;
+		size_t InvalidCommandByteOffset = 0;
+
 	public:
 		void Parse(const u8* buffer, size_t bufferSize) override;
 		IO::StreamResult Write(IO::StreamWriter& writer) override;
@@ -484,14 +506,22 @@ namespace Comfy
 		void AppendToString(std::string& outString) const;
 	};
 
+	// NOTE: Commands are appended to a single flat buffer in any order and only sorted once by their time when creating the final command list.
+	//		 The sort is stable so commands sharing the same time point keep their insertion order
 	class PVScriptBuilder
 	{
 	public:
+		void Reserve(size_t commandCount);
 		void Add(TimeSpan time, const PVCommand& command, i32 branch = 0);
 		std::vector<PVCommand> Create();
 
 	private:
-		std::pmr::monotonic_buffer_resource bufferResource {};
-		std::pmr::map<PVCommandLayout::Time, std::pmr::vector<PVCommand>> timedCommandGroups { &bufferResource };
+		struct TimedCommand
+		{
+			PVCommandLayout::Time Time;
+			PVCommand Command;
+		};
+
+		std::vector<TimedCommand> timedCommands;
 	};
 }
@@ -3,10 +3,17 @@
 // NOTE: Make sure *not* to include these inline classes in the project
 #include "Tests/AetRendererTest.cpp"
 #include "Tests/AudioTest.cpp"
+#include "Tests/CryptoTest.cpp"
+#include "Tests/DatabaseTest.cpp"
 #include "Tests/FontRendererTest.cpp"
+#include "Tests/InputCaptureTest.cpp"
+#include "Tests/LoggerTest.cpp"
+#include "Tests/MeshOptimizationTest.cpp"
 #include "Tests/MenuTest.cpp"
 #include "Tests/Renderer2DTest.cpp"
 #include "Tests/Renderer3DTest.cpp"
+#include "Tests/ResourceIDMapTest.cpp"
+#include "Tests/StringHashingTest.cpp"
 
 namespace Comfy::Sandbox::Tests
 {
@@ -16,10 +23,17 @@ namespace Comfy::Sandbox::Tests
 		{
 			TestTaskInitializer::Create<AetRendererTest>("Comfy::Sandbox::Tests::AetRendererTest"),
 			TestTaskInitializer::Create<AudioTest>("Comfy::Sandbox::Tests::AudioTest"),
+			TestTaskInitializer::Create<CryptoTest>("Comfy::Sandbox::Tests::CryptoTest"),
+			TestTaskInitializer::Create<DatabaseTest>("Comfy::Sandbox::Tests::DatabaseTest"),
 			TestTaskInitializer::Create<FontRendererTest>("Comfy::Sandbox::Tests::FontRendererTest"),
+			TestTaskInitializer::Create<InputCaptureTest>("Comfy::Sandbox::Tests::InputCaptureTest"),
+			TestTaskInitializer::Create<LoggerTest>("Comfy::Sandbox::Tests::LoggerTest"),
+			TestTaskInitializer::Create<MeshOptimizationTest>("Comfy::Sandbox::Tests::MeshOptimizationTest"),
 			TestTaskInitializer::Create<MenuTest>("Comfy::Sandbox::Tests::MenuTest"),
 			TestTaskInitializer::Create<Renderer2DTest>("Comfy::Sandbox::Tests::Renderer2DTest"),
 			TestTaskInitializer::Create<Renderer3DTest>("Comfy::Sandbox::Tests::Renderer3DTest"),
+			TestTaskInitializer::Create<ResourceIDMapTest>("Comfy::Sandbox::Tests::ResourceIDMapTest"),
+			TestTaskInitializer::Create<StringHashingTest>("Comfy::Sandbox::Tests::StringHashingTest"),
 		};
 	}
 }
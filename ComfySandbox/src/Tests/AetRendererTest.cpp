@@ -21,6 +21,10 @@ namespace Comfy::Sandbox::Tests
 					renderer.Aet().DrawLayerLooped(*selectedLayer, playback.CurrentFrame, playback.Transform);
 				}
 				renderer.End();
+				batchStatistics.LastFrame = renderer.GetLastFrameStatistics();
+
+				if (batchStatistics.CompareSortAndMerge)
+					UpdateSortAndMergeComparison();
 
 				if (playback.Playback)
 					playback.CurrentFrame += Gui::GetIO().DeltaTime * playback.PlaybackFrameRate;
@@ -30,6 +34,11 @@ namespace Comfy::Sandbox::Tests
 			{
 				return Render::SprSetNameStringSprGetter(source, sprSet.get());
 			});
+
+			headless.Renderer.Aet().SetSprGetter([&](const Graphics::Aet::VideoSource& source)
+			{
+				return Render::SprSetNameStringSprGetter(source, sprSet.get());
+			});
 		}
 
 		void Update() override
@@ -60,6 +69,47 @@ namespace Comfy::Sandbox::Tests
 				}
 				Gui::End();
 
+				if (Gui::Begin("Renderer2D Batch Statistics"))
+				{
+					auto columns = GuiPropertyRAII::PropertyValueColumns();
+
+					bool sortAndMerge = renderer.GetSortAndMergeBatches();
+					if (GuiProperty::Checkbox("Sort and Merge Batches", sortAndMerge))
+						renderer.SetSortAndMergeBatches(sortAndMerge);
+
+					GuiProperty::PropertyLabelValueFunc("Last Frame", [&]
+					{
+						const auto& lastFrame = batchStatistics.LastFrame;
+						Gui::Text("%u Draw Call(s), %u Quad(s), %u Shape Vertices", lastFrame.DrawCallCount, lastFrame.QuadCount, lastFrame.ShapeVertexCount);
+						return false;
+					});
+
+					GuiProperty::Checkbox("Compare Headless", batchStatistics.CompareSortAndMerge);
+					if (batchStatistics.CompareSortAndMerge)
+					{
+						GuiProperty::PropertyLabelValueFunc("In Order", [&]
+						{
+							Gui::Text("%u Draw Call(s)", batchStatistics.InOrderDrawCalls);
+							return false;
+						});
+
+						GuiProperty::PropertyLabelValueFunc("Sorted and Merged", [&]
+						{
+							Gui::Text("%u Draw Call(s)", batchStatistics.SortedDrawCalls);
+							return false;
+						});
+
+						GuiProperty::PropertyLabelValueFunc("Reduction", [&]
+						{
+							const auto inOrder = static_cast<float>(batchStatistics.InOrderDrawCalls);
+							const auto sorted = static_cast<float>(batchStatistics.SortedDrawCalls);
+							Gui::Text("%.2f %%", (inOrder > 0.0f) ? ((1.0f - (sorted / inOrder)) * 100.0f) : 0.0f);
+							return false;
+						});
+					}
+				}
+				Gui::End();
+
 				if (Gui::Begin("Test SprSet Loader"))
 				{
 					if (sprFileViewer.DrawGui() && IO::Path::GetExtension(sprFileViewer.GetFileToOpen()) == ".bin")
@@ -156,6 +206,27 @@ namespace Comfy::Sandbox::Tests
 			}
 		}
 
+	private:
+		void UpdateSortAndMergeComparison()
+		{
+			const auto selectedLayer = GetSelectedLayer();
+			if (selectedLayer == nullptr)
+				return;
+
+			// NOTE: Draw the exact same frame once in submission order and once sorted without touching the GPU so the two can be compared directly
+			const auto drawFrame = [&](bool sortAndMerge)
+			{
+				headless.Renderer.SetSortAndMergeBatches(sortAndMerge);
+				headless.Renderer.Begin(camera, *headless.RenderTarget);
+				headless.Renderer.Aet().DrawLayerLooped(*selectedLayer, playback.CurrentFrame, playback.Transform);
+				headless.Renderer.End();
+				return headless.Renderer.GetLastFrameStatistics().DrawCallCount;
+			};
+
+			batchStatistics.InOrderDrawCalls = drawFrame(false);
+			batchStatistics.SortedDrawCalls = drawFrame(true);
+		}
+
 	private:
 		Graphics::Aet::Scene* GetSelectedScene() const
 		{
@@ -199,6 +270,21 @@ namespace Comfy::Sandbox::Tests
 		CallbackRenderWindow2D renderWindow = {};
 		bool fullscreen = false;
 
+		struct HeadlessData
+		{
+			Render::Renderer2D Renderer { std::make_unique<Render::RecordingRenderer2DBackend>() };
+			std::unique_ptr<Render::RenderTarget2D> RenderTarget = Renderer.GetBackend().CreateRenderTarget();
+		} headless;
+
+		struct BatchStatisticsData
+		{
+			Render::Renderer2DDrawStatistics LastFrame = {};
+
+			bool CompareSortAndMerge = false;
+			u32 InOrderDrawCalls = 0;
+			u32 SortedDrawCalls = 0;
+		} batchStatistics;
+
 		struct PreviewData
 		{
 			Render::Camera2D Camera = {};
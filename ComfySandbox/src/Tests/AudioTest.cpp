@@ -1,4 +1,7 @@
 #include "TestTask.h"
+#include "Audio/Decoder/Detail/HevagADPCM.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
 
 namespace Comfy::Sandbox::Tests
 {
@@ -25,9 +28,74 @@ namespace Comfy::Sandbox::Tests
 				if (Gui::Button("WASAPI (Exclusive)")) Audio::AudioEngine::GetInstance().SetAudioBackend(Audio::AudioBackend::WASAPIExclusive);
 			}
 			Gui::End();
+
+			hevagBenchmark.WindowGui("HEVAG Decoding Benchmark",
+				[&](auto& param) { GuiProperty::Input("Duration (seconds)", param.DurationSeconds, 1.0f, ivec2(1, 600)); },
+				[&] { RunHevagDecodingBenchmark(); },
+				[&](const auto&) { Gui::TextDisabled("Decodes synthetic 48 kHz ADPCM data, iterations are counted in seconds of audio so the time per iteration is the time per decoded second"); });
+		}
+
+	private:
+		void RunHevagDecodingBenchmark()
+		{
+			using namespace Audio::Detail;
+
+			auto& runner = hevagBenchmark.Runner;
+			const auto& param = hevagBenchmark.Param;
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+
+			for (const u32 channelCount : { 2u, 8u })
+			{
+				constexpr size_t sampleRate = 48000;
+				const size_t blocksPerChannel = (static_cast<size_t>(param.DurationSeconds) * sampleRate) / SamplesPerHevagADPCMBlock;
+				const size_t blockCount = (blocksPerChannel * channelCount);
+
+				// NOTE: Random nibbles with every coefficient and shift factor, a small portion of blocks use a flag that silences them
+				std::vector<HevagADPCMBlock> blocks(blockCount);
+				for (auto& block : blocks)
+				{
+					block.DecodingCoefficient = static_cast<u8>(random());
+					block.LoopInformation = static_cast<u8>((random() & 0x70) | ((random() % 16 == 0) ? 7 : 0));
+					for (auto& soundByte : block.SoundData)
+						soundByte = static_cast<u8>(random());
+				}
+
+				const size_t sampleCount = (blockCount * SamplesPerHevagADPCMBlock);
+				std::vector<i16> scalarOutput(sampleCount), simdOutput(sampleCount);
+
+				char nameBuffer[64];
+				sprintf_s(nameBuffer, "Scalar (%u channels)", channelCount);
+				runner.Run(nameBuffer, param.DurationSeconds, [&] { DecodeHevagADPCMBlocksScalar(blocks.data(), blockCount, channelCount, scalarOutput.data()); });
+
+	#if COMFY_HEVAG_ADPCM_SIMD
+				sprintf_s(nameBuffer, "SIMD (%u channels)", channelCount);
+				runner.Run(nameBuffer, param.DurationSeconds, [&] { DecodeHevagADPCMBlocksSIMD(blocks.data(), blockCount, channelCount, simdOutput.data(), false); });
+
+				sprintf_s(nameBuffer, "SIMD results match scalar (%u channels)", channelCount);
+				runner.Check(nameBuffer, scalarOutput == simdOutput);
+
+				std::fill(simdOutput.begin(), simdOutput.end(), static_cast<i16>(0));
+				sprintf_s(nameBuffer, "SIMD multithreaded (%u channels)", channelCount);
+				runner.Run(nameBuffer, param.DurationSeconds, [&] { DecodeHevagADPCMBlocksSIMD(blocks.data(), blockCount, channelCount, simdOutput.data(), true); });
+
+				sprintf_s(nameBuffer, "SIMD multithreaded results match scalar (%u channels)", channelCount);
+				runner.Check(nameBuffer, scalarOutput == simdOutput);
+	#else
+				sprintf_s(nameBuffer, "SIMD results match scalar (%u channels)", channelCount);
+				runner.SkipCheck(nameBuffer);
+	#endif
+			}
 		}
 
 	private:
 		Audio::SourceHandle buttonSound = Audio::AudioEngine::GetInstance().LoadSource("dev_ram/sound/button/01_button1.wav");
+
+		struct HevagBenchmarkParam
+		{
+			i32 DurationSeconds = 60;
+		};
+
+		System::Benchmark<HevagBenchmarkParam> hevagBenchmark;
 	};
 }
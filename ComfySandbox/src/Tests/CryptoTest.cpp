@@ -0,0 +1,138 @@
+#include "TestTask.h"
+#include "IO/Archive/FArc.h"
+#include "IO/Crypto/Detail/Aes128.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
+
+namespace Comfy::Sandbox::Tests
+{
+	class CryptoTest : public ITestTask
+	{
+	public:
+		CryptoTest() = default;
+
+		void Update() override
+		{
+			decryptionBenchmark.WindowGui("AES Decryption Benchmark",
+				[&](auto& param) { GuiProperty::Input("Data Size (MB)", param.DataSizeMB, 1.0f, ivec2(1, 1024)); },
+				[&] { RunDecryptionBenchmark(); },
+				[&](const auto& summary)
+				{
+					Gui::Text("AES-NI supported: %s", summary.AesNISupported ? "Yes" : "No");
+					Gui::TextDisabled("Decryption iterations are counted in MB so the time per iteration is the time per MB");
+				});
+		}
+
+	private:
+		void RunDecryptionBenchmark()
+		{
+			using namespace IO::Crypto;
+
+			auto& runner = decryptionBenchmark.Runner;
+			const auto& param = decryptionBenchmark.Param;
+
+			DecryptionSummary summary = {};
+			summary.AesNISupported = Detail::IsAesNISupported();
+
+			// NOTE: Known answer tests from FIPS-197 appendix C.1 and NIST SP 800-38A F.1.2 and F.2.2
+			{
+				const std::array<u8, KeySize> fipsKey = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F };
+				const std::array<u8, BlockSize> fipsEncrypted = { 0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30, 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A };
+				const std::array<u8, BlockSize> fipsDecrypted = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+
+				const std::array<u8, KeySize> nistKey = { 0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C };
+				const std::array<u8, IVSize> nistIV = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F };
+				const std::array<u8, BlockSize * 4> nistDecrypted =
+				{
+					0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+					0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+					0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+					0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10,
+				};
+				const std::array<u8, BlockSize * 4> nistEcbEncrypted =
+				{
+					0x3A, 0xD7, 0x7B, 0xB4, 0x0D, 0x7A, 0x36, 0x60, 0xA8, 0x9E, 0xCA, 0xF3, 0x24, 0x66, 0xEF, 0x97,
+					0xF5, 0xD3, 0xD5, 0x85, 0x03, 0xB9, 0x69, 0x9D, 0xE7, 0x85, 0x89, 0x5A, 0x96, 0xFD, 0xBA, 0xAF,
+					0x43, 0xB1, 0xCD, 0x7F, 0x59, 0x8E, 0xCE, 0x23, 0x88, 0x1B, 0x00, 0xE3, 0xED, 0x03, 0x06, 0x88,
+					0x7B, 0x0C, 0x78, 0x5E, 0x27, 0xE8, 0xAD, 0x3F, 0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5D, 0xD4,
+				};
+				const std::array<u8, BlockSize * 4> nistCbcEncrypted =
+				{
+					0x76, 0x49, 0xAB, 0xAC, 0x81, 0x19, 0xB2, 0x46, 0xCE, 0xE9, 0x8E, 0x9B, 0x12, 0xE9, 0x19, 0x7D,
+					0x50, 0x86, 0xCB, 0x9B, 0x50, 0x72, 0x19, 0xEE, 0x95, 0xDB, 0x11, 0x3A, 0x91, 0x76, 0x78, 0xB2,
+					0x73, 0xBE, 0xD6, 0xB8, 0xE3, 0xC1, 0x74, 0x3B, 0x71, 0x16, 0xE6, 0x9E, 0x22, 0x22, 0x95, 0x16,
+					0x3F, 0xF1, 0xCA, 0xA1, 0x68, 0x1F, 0xAC, 0x09, 0x12, 0x0E, 0xCA, 0x30, 0x75, 0x86, 0xE1, 0xA7,
+				};
+
+				const auto fipsDecryptionKey = CreateAesDecryptionKey(fipsKey);
+				const auto nistDecryptionKey = CreateAesDecryptionKey(nistKey);
+
+				const auto runKnownAnswerTests = [&](auto decryptEcb, auto decryptCbc)
+				{
+					std::array<u8, BlockSize> fipsOutput;
+					decryptEcb(fipsEncrypted.data(), fipsOutput.data(), 1, fipsDecryptionKey);
+
+					std::array<u8, BlockSize * 4> nistEcbOutput, nistCbcOutput;
+					decryptEcb(nistEcbEncrypted.data(), nistEcbOutput.data(), 4, nistDecryptionKey);
+					decryptCbc(nistCbcEncrypted.data(), nistCbcOutput.data(), 4, nistDecryptionKey, nistIV);
+
+					return (fipsOutput == fipsDecrypted) && (nistEcbOutput == nistDecrypted) && (nistCbcOutput == nistDecrypted);
+				};
+
+				runner.Check("Portable known answer tests", runKnownAnswerTests(Detail::Aes128DecryptEcbPortable, Detail::Aes128DecryptCbcPortable));
+				if (summary.AesNISupported)
+					runner.Check("AES-NI known answer tests", runKnownAnswerTests(Detail::Aes128DecryptEcbAesNI, Detail::Aes128DecryptCbcAesNI));
+				else
+					runner.SkipCheck("AES-NI known answer tests");
+			}
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+
+			const size_t dataSize = static_cast<size_t>(param.DataSizeMB) * 1024 * 1024;
+			const size_t blockCount = (dataSize / BlockSize);
+
+			std::vector<u8> encryptedData(dataSize), portableOutput(dataSize), aesNIOutput(dataSize);
+			for (auto& byte : encryptedData)
+				byte = static_cast<u8>(random());
+
+			const auto key = CreateAesDecryptionKey(IO::FArcEncryption::ModernKey);
+			const auto iv = IO::FArcEncryption::DummyIV;
+
+			constexpr size_t keyExpansionCount = 10000;
+			runner.Run("CreateAesDecryptionKey()", keyExpansionCount, [&]
+			{
+				for (size_t i = 0; i < keyExpansionCount; i++)
+					(void)CreateAesDecryptionKey(IO::FArcEncryption::ModernKey);
+			});
+
+			runner.Run("ECB portable", param.DataSizeMB, [&] { Detail::Aes128DecryptEcbPortable(encryptedData.data(), portableOutput.data(), blockCount, key); });
+			if (summary.AesNISupported)
+			{
+				runner.Run("ECB AES-NI", param.DataSizeMB, [&] { Detail::Aes128DecryptEcbAesNI(encryptedData.data(), aesNIOutput.data(), blockCount, key); });
+				runner.Check("ECB portable and AES-NI results match", portableOutput == aesNIOutput);
+			}
+
+			runner.Run("CBC portable", param.DataSizeMB, [&] { Detail::Aes128DecryptCbcPortable(encryptedData.data(), portableOutput.data(), blockCount, key, iv); });
+			if (summary.AesNISupported)
+			{
+				runner.Run("CBC AES-NI", param.DataSizeMB, [&] { Detail::Aes128DecryptCbcAesNI(encryptedData.data(), aesNIOutput.data(), blockCount, key, iv); });
+				runner.Check("CBC portable and AES-NI results match", portableOutput == aesNIOutput);
+			}
+
+			decryptionBenchmark.Summary = summary;
+		}
+
+	private:
+		struct DecryptionParam
+		{
+			i32 DataSizeMB = 64;
+		};
+
+		struct DecryptionSummary
+		{
+			bool AesNISupported;
+		};
+
+		System::Benchmark<DecryptionParam, DecryptionSummary> decryptionBenchmark;
+	};
+}
@@ -0,0 +1,163 @@
+#include "TestTask.h"
+#include "Database/SprDB.h"
+#include "Database/AetDB.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
+
+namespace Comfy::Sandbox::Tests
+{
+	class DatabaseTest : public ITestTask
+	{
+	public:
+		DatabaseTest() = default;
+
+		void Update() override
+		{
+			lookupBenchmark.WindowGui("Database Lookup Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Spr Set Count", param.SprSetCount, 1.0f, ivec2(1, 100000));
+					GuiProperty::Input("Sprites Per Set", param.SprPerSetCount, 1.0f, ivec2(1, 10000));
+					GuiProperty::Input("Video Source Count", param.VideoSourceCount, 1.0f, ivec2(1, 1000000));
+				},
+				[&] { RunLookupBenchmark(); },
+				[&](const auto& summary) { Gui::Text("%zu spr entries, %zu video sources resolved", summary.SprEntryCount, summary.ResolvedCount); });
+		}
+
+	private:
+		void RunLookupBenchmark()
+		{
+			auto& runner = lookupBenchmark.Runner;
+			const auto& param = lookupBenchmark.Param;
+
+			// NOTE: Roughly resembling the game spr_db / aet_db with one aet set per spr set, every aet video source referencing a sprite of its own set
+			Database::SprDB sprDB;
+			Database::AetDB aetDB;
+			sprDB.Entries.resize(param.SprSetCount);
+			aetDB.Entries.resize(param.SprSetCount);
+
+			char nameBuffer[64];
+			const auto formatName = [&](const char* format, auto... args) -> std::string { sprintf_s(nameBuffer, format, args...); return nameBuffer; };
+
+			u32 nextSprID = 0;
+			for (i32 setIndex = 0; setIndex < param.SprSetCount; setIndex++)
+			{
+				auto& sprSetEntry = sprDB.Entries[setIndex];
+				sprSetEntry.ID = static_cast<SprSetID>(0x1000 + setIndex);
+				sprSetEntry.Name = formatName("SPR_SET_%04d", setIndex);
+				sprSetEntry.FileName = formatName("spr_set_%04d.bin", setIndex);
+
+				sprSetEntry.SprEntries.resize(param.SprPerSetCount);
+				for (i32 sprIndex = 0; sprIndex < param.SprPerSetCount; sprIndex++)
+				{
+					auto& sprEntry = sprSetEntry.SprEntries[sprIndex];
+					sprEntry.ID = static_cast<SprID>(nextSprID++);
+					sprEntry.Name = formatName("SPR_SET_%04d_SPRITE_%04d", setIndex, sprIndex);
+					sprEntry.Index = static_cast<i16>(sprIndex);
+				}
+
+				auto& aetSetEntry = aetDB.Entries[setIndex];
+				aetSetEntry.ID = static_cast<AetSetID>(0x1000 + setIndex);
+				aetSetEntry.Name = formatName("AET_SET_%04d", setIndex);
+				aetSetEntry.SprSetID = sprSetEntry.ID;
+			}
+
+			struct SyntheticVideoSource { AetSetID AetSetID; SprID SprID; std::string SprName; };
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+			auto setDistribution = std::uniform_int_distribution<i32>(0, param.SprSetCount - 1);
+			auto sprDistribution = std::uniform_int_distribution<i32>(0, param.SprPerSetCount - 1);
+
+			std::vector<SyntheticVideoSource> sources(param.VideoSourceCount);
+			for (auto& source : sources)
+			{
+				const auto setIndex = setDistribution(random);
+				const auto& sprEntry = sprDB.Entries[setIndex].SprEntries[sprDistribution(random)];
+
+				source.AetSetID = aetDB.Entries[setIndex].ID;
+				source.SprID = sprEntry.ID;
+				source.SprName = sprEntry.Name;
+			}
+
+			LookupSummary summary = {};
+			summary.SprEntryCount = sprDB.GetSprEntryCount();
+
+			std::vector<const Database::SprEntry*> linearResults(sources.size()), indexedResults(sources.size());
+			const auto resolveLinear = [&](const SyntheticVideoSource& source, bool byName) -> const Database::SprEntry*
+			{
+				const auto aetSetEntry = FindIfOrNull(aetDB.Entries, [&](const auto& e) { return (e.ID == source.AetSetID); });
+				const auto sprSetEntry = (aetSetEntry != nullptr) ? FindIfOrNull(sprDB.Entries, [&](const auto& e) { return (e.ID == aetSetEntry->SprSetID); }) : nullptr;
+				if (sprSetEntry == nullptr)
+					return nullptr;
+
+				return byName ?
+					FindIfOrNull(sprSetEntry->SprEntries, [&](const auto& e) { return (e.Name == source.SprName); }) :
+					FindIfOrNull(sprSetEntry->SprEntries, [&](const auto& e) { return (e.ID == source.SprID); });
+			};
+
+			const auto resolveIndexed = [&](const SyntheticVideoSource& source, bool byName) -> const Database::SprEntry*
+			{
+				const auto aetSetEntry = aetDB.GetAetSetEntry(source.AetSetID);
+				const auto sprSetEntry = (aetSetEntry != nullptr) ? sprDB.GetSprSetEntry(aetSetEntry->SprSetID) : nullptr;
+				if (sprSetEntry == nullptr)
+					return nullptr;
+
+				return byName ? sprSetEntry->GetSprEntry(source.SprName) : sprSetEntry->GetSprEntry(source.SprID);
+			};
+
+			for (const bool byName : { false, true })
+			{
+				const auto suffix = std::string(byName ? " (by name)" : " (by ID)");
+
+				runner.Run("Resolve video sources, linear scans" + suffix, sources.size(), [&]
+				{
+					for (size_t i = 0; i < sources.size(); i++)
+						linearResults[i] = resolveLinear(sources[i], byName);
+				});
+
+				// NOTE: The first pass includes building the lazy indices, the second one only measures the lookups
+				for (const bool warm : { false, true })
+				{
+					runner.Run("Resolve video sources, hash indices" + suffix + (warm ? " (warm)" : " (cold)"), sources.size(), [&]
+					{
+						for (size_t i = 0; i < sources.size(); i++)
+							indexedResults[i] = resolveIndexed(sources[i], byName);
+					});
+
+					runner.Check("Hash index results match linear scans" + suffix + (warm ? " (warm)" : " (cold)"), linearResults == indexedResults);
+				}
+
+				sprDB.InvalidateIndices();
+				aetDB.InvalidateIndices();
+				for (auto& sprSetEntry : sprDB.Entries)
+					sprSetEntry.InvalidateIndices();
+			}
+
+			runner.Run("Resolve sprites by ID across all sets (SprDB::GetSprEntry)", sources.size(), [&]
+			{
+				for (size_t i = 0; i < sources.size(); i++)
+					indexedResults[i] = sprDB.GetSprEntry(sources[i].SprID);
+			});
+			runner.Check("SprDB::GetSprEntry() results match linear scans", linearResults == indexedResults);
+
+			summary.ResolvedCount = std::count_if(indexedResults.begin(), indexedResults.end(), [](const auto* e) { return (e != nullptr); });
+			lookupBenchmark.Summary = summary;
+		}
+
+	private:
+		struct LookupParam
+		{
+			i32 SprSetCount = 500;
+			i32 SprPerSetCount = 60;
+			i32 VideoSourceCount = 20000;
+		};
+
+		struct LookupSummary
+		{
+			size_t SprEntryCount;
+			size_t ResolvedCount;
+		};
+
+		System::Benchmark<LookupParam, LookupSummary> lookupBenchmark;
+	};
+}
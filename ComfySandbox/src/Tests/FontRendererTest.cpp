@@ -1,6 +1,7 @@
 ﻿#include "TestTask.h"
 #include "Misc/ImageHelper.h"
 #include "Time/TimeUtilities.h"
+#include "System/Profiling/BenchmarkRunner.h"
 #include <future>
 
 namespace Comfy::Sandbox::Tests
@@ -351,6 +352,32 @@ namespace Comfy::Sandbox::Tests
 				}
 				Gui::End();
 
+				layoutCacheBenchmark.WindowGui("Font Layout Cache Benchmark",
+					[&](auto& param)
+					{
+						const auto statistics = renderer.Font().GetLayoutCacheStatistics();
+
+						bool cacheEnabled = renderer.Font().GetLayoutCacheEnabled();
+						if (GuiProperty::Checkbox("Layout Cache Enabled", cacheEnabled))
+							renderer.Font().SetLayoutCacheEnabled(cacheEnabled);
+
+						GuiProperty::PropertyLabelValueFunc("Layout Cache", [&]
+						{
+							const u64 lookupCount = (statistics.HitCount + statistics.MissCount);
+							const f64 hitRate = (lookupCount > 0) ? (static_cast<f64>(statistics.HitCount) / lookupCount * 100.0) : 0.0;
+							Gui::Text("%zu entries, %.2f%% hit rate (%llu hits, %llu misses, %llu evictions)", statistics.EntryCount, hitRate, statistics.HitCount, statistics.MissCount, statistics.EvictionCount);
+							return false;
+						});
+
+						GuiProperty::Input("Frame Count", param.FrameCount, 1.0f, ivec2(1, 10000));
+					},
+					[&] { RunLayoutCacheBenchmark(); },
+					[&](const auto& summary)
+					{
+						Gui::Text("Cached hit rate: %.2f%%", summary.CachedHitRate * 100.0);
+						Gui::TextDisabled("Draws every line of the test text using all draw variants plus a changing counter each frame");
+					});
+
 				if (Gui::Begin("Test SprSet Loader"))
 				{
 					if (sprFileViewer.DrawGui() && IO::Path::GetExtension(sprFileViewer.GetFileToOpen()) == ".bin")
@@ -361,7 +388,11 @@ namespace Comfy::Sandbox::Tests
 				if (Gui::Begin("Test FontMap Loader"))
 				{
 					if (fontMapFileViewer.DrawGui() && IO::Path::GetExtension(fontMapFileViewer.GetFileToOpen()) == ".bin")
+					{
+						renderer.Font().ClearLayoutCache();
+						layoutCacheRenderer.Font().ClearLayoutCache();
 						fontMap = IO::File::Load<Graphics::FontMap>(fontMapFileViewer.GetFileToOpen());
+					}
 				}
 				Gui::End();
 
@@ -436,6 +467,80 @@ namespace Comfy::Sandbox::Tests
 		}
 
 	private:
+		void RunLayoutCacheBenchmark()
+		{
+			auto& runner = layoutCacheBenchmark.Runner;
+			const auto& param = layoutCacheBenchmark.Param;
+
+			const auto selectedFont = GetSelectedFont();
+			if (selectedFont == nullptr)
+			{
+				runner.SkipCheck("Cached and uncached frames draw the same quads");
+				return;
+			}
+
+			// NOTE: Mostly static labels similar to a menu screen with the occasional frequently changing text
+			std::vector<std::string_view> labels;
+			for (size_t lineStart = 0; lineStart < FontTestText.size();)
+			{
+				const size_t lineEnd = Min(FontTestText.find('\n', lineStart), FontTestText.size());
+				if (lineEnd > lineStart)
+					labels.push_back(FontTestText.substr(lineStart, lineEnd - lineStart));
+				lineStart = (lineEnd + 1);
+			}
+
+			auto& headlessRenderer = layoutCacheRenderer;
+			auto& recordingBackend = static_cast<Render::RecordingRenderer2DBackend&>(headlessRenderer.GetBackend());
+			auto& fontRenderer = headlessRenderer.Font();
+			auto camera = Render::Camera2D();
+			camera.ProjectionSize = vec2(1920.0f, 1080.0f);
+
+			LayoutCacheSummary summary = {};
+			auto runFrames = [&](std::string name, bool cacheEnabled)
+			{
+				fontRenderer.SetLayoutCacheEnabled(cacheEnabled);
+				fontRenderer.ClearLayoutCache();
+				fontRenderer.ResetLayoutCacheStatistics();
+				recordingBackend.ResetStatistics();
+
+				char counterBuffer[32];
+				const auto stopwatch = Stopwatch::StartNew();
+				for (i32 frame = 0; frame < param.FrameCount; frame++)
+				{
+					headlessRenderer.Begin(camera, *layoutCacheRenderTarget);
+					for (size_t i = 0; i < labels.size(); i++)
+					{
+						const auto transform = Graphics::Transform2D(vec2(0.0f, static_cast<f32>(i) * 36.0f));
+						const auto measuredSize = fontRenderer.Measure(*selectedFont, labels[i]);
+
+						if (i % 3 == 0)
+							fontRenderer.Draw(*selectedFont, labels[i], Graphics::Transform2D(transform.Position + vec2(measuredSize.x, 0.0f)));
+						else if (i % 3 == 1)
+							fontRenderer.DrawBorder(*selectedFont, labels[i], transform);
+						else
+							fontRenderer.DrawShadow(*selectedFont, labels[i], transform);
+					}
+
+					sprintf_s(counterBuffer, "%07d", frame * 1234);
+					fontRenderer.DrawBorder(*selectedFont, counterBuffer, Graphics::Transform2D(vec2(0.0f)));
+					headlessRenderer.End();
+				}
+				runner.Add(std::move(name), stopwatch.GetElapsed(), static_cast<size_t>(param.FrameCount));
+
+				const auto statistics = fontRenderer.GetLayoutCacheStatistics();
+				const u64 lookupCount = (statistics.HitCount + statistics.MissCount);
+				summary.CachedHitRate = (lookupCount > 0) ? (static_cast<f64>(statistics.HitCount) / lookupCount) : 0.0;
+
+				return recordingBackend.GetTotalStatistics().QuadCount;
+			};
+
+			const u32 uncachedQuadCount = runFrames("Frames (layout cache disabled)", false);
+			const u32 cachedQuadCount = runFrames("Frames (layout cache enabled)", true);
+			runner.Check("Cached and uncached frames draw the same quads", cachedQuadCount == uncachedQuadCount);
+
+			layoutCacheBenchmark.Summary = summary;
+		}
+
 		std::shared_ptr<Graphics::Tex> GetSelectedTexture() const
 		{
 			if (sprSet == nullptr)
@@ -473,6 +578,21 @@ namespace Comfy::Sandbox::Tests
 
 		std::future<void> saveScreenshotFuture;
 
+		Render::Renderer2D layoutCacheRenderer { std::make_unique<Render::RecordingRenderer2DBackend>() };
+		std::unique_ptr<Render::RenderTarget2D> layoutCacheRenderTarget = layoutCacheRenderer.GetBackend().CreateRenderTarget();
+
+		struct LayoutCacheParam
+		{
+			i32 FrameCount = 500;
+		};
+
+		struct LayoutCacheSummary
+		{
+			f64 CachedHitRate;
+		};
+
+		System::Benchmark<LayoutCacheParam, LayoutCacheSummary> layoutCacheBenchmark;
+
 		struct RenderData
 		{
 			static constexpr size_t TextBufferSize = (8192);
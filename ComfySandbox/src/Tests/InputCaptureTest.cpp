@@ -0,0 +1,138 @@
+#include "TestTask.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
+#include <thread>
+
+namespace Comfy::Sandbox::Tests
+{
+	class InputCaptureTest : public ITestTask
+	{
+	public:
+		InputCaptureTest() = default;
+
+		void Update() override
+		{
+			latencyBenchmark.WindowGui("Input Capture Latency Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Press Count", param.PressCount, 1.0f, ivec2(1, 2000));
+					GuiProperty::Input("Duration (ms)", param.DurationMS, 1.0f, ivec2(100, 10000));
+				},
+				[&] { RunLatencyBenchmark(); },
+				[&](const auto& summary)
+				{
+					Gui::Text("Captured presses: %zu / %zu (%zu events dropped)", summary.CapturedPressCount, summary.ExpectedPressCount, summary.DroppedEventCount);
+					Gui::Text("Capture thread error: %.3f ms mean, %.3f ms max", summary.MeanCaptureError.TotalMilliseconds(), summary.MaxCaptureError.TotalMilliseconds());
+					Gui::Text("60 FPS frame polling error: %.3f ms mean, %.3f ms max", summary.MeanFrameError.TotalMilliseconds(), summary.MaxFrameError.TotalMilliseconds());
+					Gui::TextDisabled("Runs in real time, the error is the delay between a synthetic press and the time it was recorded at");
+				});
+		}
+
+	private:
+		void RunLatencyBenchmark()
+		{
+			auto& runner = latencyBenchmark.Runner;
+			const auto& param = latencyBenchmark.Param;
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+			auto offsetDistribution = std::uniform_real_distribution<f64>(0.0, static_cast<f64>(param.DurationMS));
+
+			// NOTE: Small lead in so that the thread has already started polling before the first press
+			const TimeSpan startTime = TimeSpan::GetTimeNow() + TimeSpan::FromMilliseconds(50.0);
+			const TimeSpan endTime = startTime + TimeSpan::FromMilliseconds(static_cast<f64>(param.DurationMS));
+			const TimeSpan holdDuration = TimeSpan::FromMilliseconds(8.0);
+
+			std::vector<TimeSpan> pressOffsets(param.PressCount);
+			for (auto& offset : pressOffsets)
+				offset = TimeSpan::FromMilliseconds(offsetDistribution(random));
+			std::sort(pressOffsets.begin(), pressOffsets.end());
+
+			// NOTE: Cycling through the letter keys so that the same key is never pressed again before being released
+			constexpr size_t keyCycleCount = ('Z' - 'A' + 1);
+			std::array<std::vector<TimeSpan>, keyCycleCount> perKeyPressTimes;
+
+			std::vector<Input::TimedInputEvent> syntheticEvents;
+			syntheticEvents.reserve(pressOffsets.size() * 2);
+			for (size_t i = 0; i < pressOffsets.size(); i++)
+			{
+				const auto key = static_cast<Input::KeyCode>(Input::KeyCode_A + (i % keyCycleCount));
+				syntheticEvents.push_back({ startTime + pressOffsets[i], Input::Binding(key), true });
+				syntheticEvents.push_back({ startTime + pressOffsets[i] + holdDuration, Input::Binding(key), false });
+				perKeyPressTimes[i % keyCycleCount].push_back(startTime + pressOffsets[i]);
+			}
+
+			Input::InputCaptureThread inputCapture;
+			inputCapture.Start(std::make_unique<Input::SyntheticInputCaptureSource>(std::move(syntheticEvents)));
+
+			std::vector<Input::TimedInputEvent> capturedPresses;
+			while (TimeSpan::GetTimeNow() < (endTime + holdDuration + TimeSpan::FromMilliseconds(50.0)))
+			{
+				for (Input::TimedInputEvent inputEvent; inputCapture.TryPopEvent(inputEvent);)
+				{
+					if (inputEvent.IsDown)
+						capturedPresses.push_back(inputEvent);
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			inputCapture.Stop();
+			for (Input::TimedInputEvent inputEvent; inputCapture.TryPopEvent(inputEvent);)
+			{
+				if (inputEvent.IsDown)
+					capturedPresses.push_back(inputEvent);
+			}
+
+			LatencySummary summary = {};
+			summary.ExpectedPressCount = pressOffsets.size();
+			summary.CapturedPressCount = capturedPresses.size();
+			summary.DroppedEventCount = inputCapture.GetDroppedEventCount();
+
+			runner.Check("All presses captured", summary.CapturedPressCount == summary.ExpectedPressCount);
+			runner.Check("No events dropped", summary.DroppedEventCount == 0);
+
+			// NOTE: Each captured press belongs to the latest press of the same key that happened before it
+			f64 captureErrorSumMS = 0.0;
+			for (const auto& capturedPress : capturedPresses)
+			{
+				const auto& pressTimes = perKeyPressTimes[capturedPress.Source.Keyboard.Key - Input::KeyCode_A];
+				const auto pressIt = std::upper_bound(pressTimes.begin(), pressTimes.end(), capturedPress.Time);
+				if (pressIt == pressTimes.begin())
+					continue;
+
+				const TimeSpan captureError = (capturedPress.Time - *std::prev(pressIt));
+				captureErrorSumMS += captureError.TotalMilliseconds();
+				summary.MaxCaptureError = std::max(summary.MaxCaptureError, captureError);
+			}
+			summary.MeanCaptureError = TimeSpan::FromMilliseconds(capturedPresses.empty() ? 0.0 : (captureErrorSumMS / capturedPresses.size()));
+
+			// NOTE: Without the capture thread a press is only seen by the first frame update after it happened
+			const f64 frameIntervalMS = (1000.0 / 60.0);
+			f64 frameErrorSumMS = 0.0;
+			for (const auto& offset : pressOffsets)
+			{
+				const f64 frameErrorMS = (glm::ceil(offset.TotalMilliseconds() / frameIntervalMS) * frameIntervalMS) - offset.TotalMilliseconds();
+				frameErrorSumMS += frameErrorMS;
+				summary.MaxFrameError = std::max(summary.MaxFrameError, TimeSpan::FromMilliseconds(frameErrorMS));
+			}
+			summary.MeanFrameError = TimeSpan::FromMilliseconds(frameErrorSumMS / pressOffsets.size());
+
+			latencyBenchmark.Summary = summary;
+		}
+
+	private:
+		struct LatencyParam
+		{
+			i32 PressCount = 200;
+			i32 DurationMS = 2000;
+		};
+
+		struct LatencySummary
+		{
+			size_t ExpectedPressCount, CapturedPressCount, DroppedEventCount;
+			TimeSpan MeanCaptureError, MaxCaptureError;
+			TimeSpan MeanFrameError, MaxFrameError;
+		};
+
+		System::Benchmark<LatencyParam, LatencySummary> latencyBenchmark;
+	};
+}
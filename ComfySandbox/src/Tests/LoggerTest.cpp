@@ -0,0 +1,186 @@
+#include "TestTask.h"
+#include "Core/Logger.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <future>
+#include <cstdio>
+
+namespace Comfy::Sandbox::Tests
+{
+	// NOTE: Stands in for a file sink without leaving behind any files
+	class TempFileCountingLogSink : public LogSink, NonCopyable
+	{
+	public:
+		TempFileCountingLogSink() { if (::tmpfile_s(&file) != 0) file = nullptr; }
+		~TempFileCountingLogSink() override { if (file != nullptr) fclose(file); }
+
+	public:
+		void Write(LogLevel level, std::string_view text) override
+		{
+			if (file != nullptr)
+				fwrite(text.data(), sizeof(char), text.size(), file);
+			lineCount += std::count(text.begin(), text.end(), '\n');
+		}
+
+		void Flush() override
+		{
+			if (file != nullptr)
+				fflush(file);
+		}
+
+		size_t GetLineCount() const { return lineCount; }
+
+	private:
+		FILE* file = nullptr;
+		size_t lineCount = 0;
+	};
+
+	class StringLogSink : public LogSink
+	{
+	public:
+		void Write(LogLevel level, std::string_view text) override { Text += text; }
+
+	public:
+		std::string Text;
+	};
+
+	class LoggerTest : public ITestTask
+	{
+	public:
+		LoggerTest()
+		{
+			// NOTE: Unlike the studio the sandbox doesn't start the flush thread by itself
+			if (!Logger::IsAsyncFlushThreadRunning())
+			{
+				Logger::StartAsyncFlushThread();
+				ownsAsyncFlushThread = true;
+			}
+		}
+
+		~LoggerTest()
+		{
+			if (ownsAsyncFlushThread)
+				Logger::StopAsyncFlushThread();
+		}
+
+		void Update() override
+		{
+			loggingBenchmark.WindowGui("Logging Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Thread Count", param.ThreadCount, 1.0f, ivec2(1, 16));
+					GuiProperty::Input("Lines per Thread", param.LinesPerThread, 1.0f, ivec2(1, 1000000));
+				},
+				[&] { RunLoggingBenchmark(); },
+				[&](const auto& summary)
+				{
+					if (summary.AsyncFlushThreadRunning)
+						Gui::Text("Lines written by the flush thread: %zu / %zu", summary.WrittenLineCount, summary.ExpectedLineCount);
+					else
+						Gui::Text("Async flush thread not running, Logger results skipped");
+
+					Gui::TextDisabled("Iterations are counted in lines, messages from other threads are redirected while running");
+				});
+		}
+
+	private:
+		void RunLoggingBenchmark()
+		{
+			auto& runner = loggingBenchmark.Runner;
+			const auto& param = loggingBenchmark.Param;
+
+			const size_t threadCount = static_cast<size_t>(param.ThreadCount);
+			const size_t linesPerThread = static_cast<size_t>(param.LinesPerThread);
+
+			// NOTE: Same split as a typical loader, the calling thread takes part instead of just waiting
+			auto runOnAllThreads = [&](auto logLines)
+			{
+				std::vector<std::future<void>> futures;
+				futures.reserve(threadCount);
+				for (size_t threadIndex = 1; threadIndex < threadCount; threadIndex++)
+					futures.push_back(std::async(std::launch::async, logLines, threadIndex));
+
+				logLines(0);
+				for (auto& future : futures)
+					future.get();
+			};
+
+			LoggingSummary summary = {};
+			summary.AsyncFlushThreadRunning = Logger::IsAsyncFlushThreadRunning();
+			summary.ExpectedLineCount = (threadCount * linesPerThread);
+
+			// NOTE: Equivalent to what every Logger call used to do, formatting and writing to a shared stream directly on the calling threads
+			if (FILE* sharedFile = nullptr; ::tmpfile_s(&sharedFile) == 0)
+			{
+				runner.Run("fprintf() shared stream", summary.ExpectedLineCount, [&]
+				{
+					runOnAllThreads([&](size_t threadIndex)
+					{
+						for (size_t i = 0; i < linesPerThread; i++)
+							fprintf(sharedFile, "Loaded entry %zu on thread %zu in %.3f ms: '%s'\n", i, threadIndex, (i * 0.001), "benchmark_entry");
+					});
+				});
+				fclose(sharedFile);
+			}
+
+			if (summary.AsyncFlushThreadRunning)
+			{
+				// NOTE: Write out anything still pending so that only the benchmark lines are redirected
+				Logger::Flush();
+				const auto originalSinks = Logger::GetSinks();
+				const auto countingSink = std::make_shared<TempFileCountingLogSink>();
+				Logger::SetSinks({ countingSink });
+
+				runner.Run("Logger::LogLine() calling threads", summary.ExpectedLineCount, [&]
+				{
+					runOnAllThreads([&](size_t threadIndex)
+					{
+						for (size_t i = 0; i < linesPerThread; i++)
+							Logger::LogLine(LogLevel::Info, "Loaded entry %zu on thread %zu in %.3f ms: '%s'", i, threadIndex, (i * 0.001), "benchmark_entry");
+					});
+				});
+
+				runner.Run("Logger::Flush() remaining lines", summary.ExpectedLineCount, [&] { Logger::Flush(); });
+
+				summary.WrittenLineCount = countingSink->GetLineCount();
+				runner.Check("All lines written by the flush thread", summary.WrittenLineCount == summary.ExpectedLineCount);
+
+				// NOTE: Exactly sized without a null terminator so that reading past the precision while capturing the arguments would overrun the allocation
+				constexpr std::string_view viewText = "view";
+				const auto unterminatedView = std::make_unique<char[]>(viewText.size());
+				std::copy(viewText.begin(), viewText.end(), unterminatedView.get());
+
+				const auto stringSink = std::make_shared<StringLogSink>();
+				Logger::SetSinks({ stringSink });
+				Logger::LogLine(LogLevel::Info, "[%.*s] [%.3s] [%*.*s]", static_cast<int>(viewText.size()), unterminatedView.get(), "abcdef", 6, 2, "xyz");
+				Logger::Flush();
+
+				Logger::SetSinks(originalSinks);
+				runner.Check("Precision limited strings captured by the flush thread", stringSink->Text == "[view] [abc] [    xy]\n");
+			}
+			else
+			{
+				runner.SkipCheck("All lines written by the flush thread");
+				runner.SkipCheck("Precision limited strings captured by the flush thread");
+			}
+
+			loggingBenchmark.Summary = summary;
+		}
+
+	private:
+		bool ownsAsyncFlushThread = false;
+
+		struct LoggingParam
+		{
+			i32 ThreadCount = 4;
+			i32 LinesPerThread = 50000;
+		};
+
+		struct LoggingSummary
+		{
+			bool AsyncFlushThreadRunning;
+			size_t ExpectedLineCount, WrittenLineCount;
+		};
+
+		System::Benchmark<LoggingParam, LoggingSummary> loggingBenchmark;
+	};
+}
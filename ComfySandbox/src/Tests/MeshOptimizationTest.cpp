@@ -0,0 +1,177 @@
+#include "TestTask.h"
+#include "Graphics/Auth3D/Misc/MeshOptimization.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
+#include <map>
+
+namespace Comfy::Sandbox::Tests
+{
+	class MeshOptimizationTest : public ITestTask
+	{
+	public:
+		MeshOptimizationTest() = default;
+
+		void Update() override
+		{
+			morphBenchmark.WindowGui("Mesh Optimization Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Vertex Count", param.VertexCount, 1.0f, ivec2(3, 60000));
+					GuiProperty::Input("Triangle Count", param.TriangleCount, 1.0f, ivec2(1, 1000000));
+				},
+				[&] { RunMorphBenchmark(); },
+				[&](const auto& summary)
+				{
+					Gui::Text("Vertex count: %u -> %u (base), %u -> %u (morph)", summary.BaseVertexCountBefore, summary.BaseVertexCountAfter, summary.MorphVertexCountBefore, summary.MorphVertexCountAfter);
+				});
+		}
+
+	private:
+		// NOTE: Base and morph position of a vertex, vertices welded together by the optimization must have had identical keys in the first place
+		using MorphVertexKey = std::array<f32, 6>;
+		using MorphTriangle = std::array<u32, 3>;
+
+		static MorphVertexKey GetMorphVertexKey(const Graphics::Mesh& baseMesh, const Graphics::Mesh& morphMesh, u32 vertex)
+		{
+			const vec3 basePosition = baseMesh.VertexData.Positions[vertex], morphPosition = morphMesh.VertexData.Positions[vertex];
+			return { basePosition.x, basePosition.y, basePosition.z, morphPosition.x, morphPosition.y, morphPosition.z };
+		}
+
+		// NOTE: Triangles as rotated lists of morph vertex key IDs so that the comparison ignores the triangle order and the starting corner but not the winding
+		static std::vector<MorphTriangle> GetSortedMorphTriangles(const Graphics::Mesh& baseMesh, const Graphics::Mesh& morphMesh, const std::map<MorphVertexKey, u32>& keyIDs)
+		{
+			std::vector<MorphTriangle> triangles;
+			const auto& indices = *baseMesh.SubMeshes.front().GetIndicesU32();
+
+			for (size_t i = 0; i + 2 < indices.size(); i += 3)
+			{
+				MorphTriangle triangle;
+				for (size_t corner = 0; corner < 3; corner++)
+				{
+					const auto found = keyIDs.find(GetMorphVertexKey(baseMesh, morphMesh, indices[i + corner]));
+					triangle[corner] = (found != keyIDs.end()) ? found->second : std::numeric_limits<u32>::max();
+				}
+
+				std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+				triangles.push_back(triangle);
+			}
+
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		}
+
+		void RunMorphBenchmark()
+		{
+			auto& runner = morphBenchmark.Runner;
+			const auto& param = morphBenchmark.Param;
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+			auto randomFloat = std::uniform_real_distribution<f32>(-1.0f, 1.0f);
+
+			const auto vertexCount = static_cast<u32>(param.VertexCount);
+			const auto triangleCount = static_cast<u32>(param.TriangleCount);
+
+			// NOTE: Same layout as an A3D morph target, the morph obj directly follows its base obj and shares the exact same topology
+			Graphics::ObjSet objSet;
+			objSet.Objects.resize(2);
+
+			for (auto& obj : objSet.Objects)
+			{
+				auto& mesh = obj.Meshes.emplace_back();
+				mesh.VertexData.VertexCount = vertexCount;
+				mesh.VertexData.Positions.resize(vertexCount);
+				mesh.VertexData.Normals.resize(vertexCount);
+				mesh.VertexData.TextureCoordinates[0].resize(vertexCount);
+
+				auto& subMesh = mesh.SubMeshes.emplace_back();
+				subMesh.Primitive = Graphics::PrimitiveType::Triangles;
+				subMesh.Indices = std::vector<u32>();
+			}
+
+			auto& baseMesh = objSet.Objects[0].Meshes[0];
+			auto& morphMesh = objSet.Objects[1].Meshes[0];
+
+			for (u32 vertex = 0; vertex < vertexCount; vertex++)
+			{
+				baseMesh.VertexData.Positions[vertex] = vec3(randomFloat(random), randomFloat(random), randomFloat(random));
+				baseMesh.VertexData.Normals[vertex] = glm::normalize(vec3(randomFloat(random), randomFloat(random), 1.0f));
+				baseMesh.VertexData.TextureCoordinates[0][vertex] = vec2(randomFloat(random), randomFloat(random));
+
+				morphMesh.VertexData.Positions[vertex] = baseMesh.VertexData.Positions[vertex] + vec3(0.0f, 1.0f, 0.0f);
+				morphMesh.VertexData.Normals[vertex] = baseMesh.VertexData.Normals[vertex];
+				morphMesh.VertexData.TextureCoordinates[0][vertex] = baseMesh.VertexData.TextureCoordinates[0][vertex];
+			}
+
+			// NOTE: Every third vertex is a duplicate of an earlier one within both meshes and can be welded, every fifth one only within the base mesh and must be kept
+			for (u32 vertex = 1; vertex < vertexCount; vertex++)
+			{
+				const u32 duplicateOf = random() % vertex;
+				if (vertex % 3 == 0)
+				{
+					for (auto* mesh : { &baseMesh, &morphMesh })
+					{
+						mesh->VertexData.Positions[vertex] = mesh->VertexData.Positions[duplicateOf];
+						mesh->VertexData.Normals[vertex] = mesh->VertexData.Normals[duplicateOf];
+						mesh->VertexData.TextureCoordinates[0][vertex] = mesh->VertexData.TextureCoordinates[0][duplicateOf];
+					}
+				}
+				else if (vertex % 5 == 0)
+				{
+					baseMesh.VertexData.Positions[vertex] = baseMesh.VertexData.Positions[duplicateOf];
+					baseMesh.VertexData.Normals[vertex] = baseMesh.VertexData.Normals[duplicateOf];
+					baseMesh.VertexData.TextureCoordinates[0][vertex] = baseMesh.VertexData.TextureCoordinates[0][duplicateOf];
+				}
+			}
+
+			std::vector<u32> indices(triangleCount * 3);
+			for (auto& index : indices)
+				index = random() % vertexCount;
+			baseMesh.SubMeshes[0].Indices = indices;
+			morphMesh.SubMeshes[0].Indices = indices;
+
+			std::map<MorphVertexKey, u32> keyIDs;
+			for (u32 vertex = 0; vertex < vertexCount; vertex++)
+				keyIDs.emplace(GetMorphVertexKey(baseMesh, morphMesh, vertex), static_cast<u32>(keyIDs.size()));
+
+			const auto trianglesBefore = GetSortedMorphTriangles(baseMesh, morphMesh, keyIDs);
+
+			MorphBenchmarkSummary summary = {};
+			summary.BaseVertexCountBefore = baseMesh.VertexData.VertexCount;
+			summary.MorphVertexCountBefore = morphMesh.VertexData.VertexCount;
+
+			runner.Run("OptimizeObjSet() base and morph obj", 1, [&] { Graphics::OptimizeObjSet(objSet); });
+
+			summary.BaseVertexCountAfter = baseMesh.VertexData.VertexCount;
+			summary.MorphVertexCountAfter = morphMesh.VertexData.VertexCount;
+
+			const auto* baseIndices = baseMesh.SubMeshes[0].GetIndicesU32();
+			const auto* morphIndices = morphMesh.SubMeshes[0].GetIndicesU32();
+			const bool indicesMatch = (baseIndices != nullptr && morphIndices != nullptr && *baseIndices == *morphIndices);
+			runner.Check("Base and morph indices match", indicesMatch);
+
+			bool verticesCorrespond = (summary.BaseVertexCountAfter == summary.MorphVertexCountAfter);
+			for (u32 vertex = 0; verticesCorrespond && vertex < baseMesh.VertexData.VertexCount; vertex++)
+				verticesCorrespond = (keyIDs.find(GetMorphVertexKey(baseMesh, morphMesh, vertex)) != keyIDs.end());
+			runner.Check("Base and morph vertices still correspond", verticesCorrespond);
+
+			runner.Check("Triangles preserved", indicesMatch && GetSortedMorphTriangles(baseMesh, morphMesh, keyIDs) == trianglesBefore);
+
+			morphBenchmark.Summary = summary;
+		}
+
+	private:
+		struct MorphBenchmarkParam
+		{
+			i32 VertexCount = 6000;
+			i32 TriangleCount = 20000;
+		};
+
+		struct MorphBenchmarkSummary
+		{
+			u32 BaseVertexCountBefore, BaseVertexCountAfter;
+			u32 MorphVertexCountBefore, MorphVertexCountAfter;
+		};
+
+		System::Benchmark<MorphBenchmarkParam, MorphBenchmarkSummary> morphBenchmark;
+	};
+}
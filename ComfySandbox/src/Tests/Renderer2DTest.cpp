@@ -1,4 +1,7 @@
 #include "TestTask.h"
+#include "Render/Core/Renderer2D/Detail/SpriteQuadGeneration.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
 
 namespace Comfy::Sandbox::Tests
 {
@@ -93,9 +96,207 @@ namespace Comfy::Sandbox::Tests
 					}
 				}
 				Gui::End();
+
+				headlessBenchmark.WindowGui("Renderer2D Headless Benchmark",
+					[&](auto& param)
+					{
+						GuiProperty::Input("Frame Count", param.FrameCount, 1.0f, ivec2(1, 100000));
+						GuiProperty::Input("Sprites per Frame", param.SpriteCount, 1.0f, ivec2(1, 1000000));
+					},
+					[&] { RunHeadlessBenchmark(); },
+					[&](const auto& summary)
+					{
+						for (const auto& scene : summary.Scenes)
+						{
+							Gui::Text("%s: %.2f M quads/s, %.1f draw calls per frame (last frame: %u quads, %u shape vertices, %u submits)", scene.Name.c_str(),
+								scene.QuadsPerSecond / 1000000.0, scene.DrawCallsPerFrame, scene.LastFrame.QuadCount, scene.LastFrame.ShapeVertexCount, scene.LastFrame.SubmitCount);
+						}
+
+						const auto& quadGeneration = summary.QuadGeneration;
+						Gui::Text("Quad generation: scalar %.2f M quads/s, SIMD %.2f M quads/s (%.2fx)", quadGeneration.ScalarQuadsPerSecond / 1000000.0, quadGeneration.SIMDQuadsPerSecond / 1000000.0,
+							quadGeneration.SIMDQuadsPerSecond / Max(quadGeneration.ScalarQuadsPerSecond, 1.0));
+						Gui::Text("Quad generation validation: max rotated position deviation %g, %zu mismatching unrotated quad(s)", quadGeneration.MaxRotatedPositionDeviation, quadGeneration.UnrotatedMismatchCount);
+
+						Gui::TextDisabled("Draws through a recording backend so only the CPU side of the renderer is measured");
+					});
+			}
+		}
+
+	private:
+		void RunHeadlessBenchmark()
+		{
+			auto& runner = headlessBenchmark.Runner;
+			const auto& param = headlessBenchmark.Param;
+
+			auto& summary = headlessBenchmark.Summary.emplace();
+			RunQuadGenerationBenchmark();
+
+			auto& recordingBackend = static_cast<Render::RecordingRenderer2DBackend&>(headlessRenderer.GetBackend());
+
+			auto& renderTarget = *headlessRenderTarget;
+			renderTarget.Param.Resolution = ivec2(1920, 1080);
+
+			Render::Camera2D headlessCamera;
+			headlessCamera.ProjectionSize = vec2(renderTarget.Param.Resolution);
+
+			const auto frameCount = static_cast<size_t>(param.FrameCount);
+			auto runFrames = [&](std::string_view name, auto drawFrameFunc)
+			{
+				// NOTE: Run every scene once in submission order and once sorted so the draw call reduction can be compared side by side
+				for (const bool sortAndMerge : { false, true })
+				{
+					auto fullName = std::string(name).append(sortAndMerge ? " [sort and merge]" : " [in order]");
+
+					headlessRenderer.SetSortAndMergeBatches(sortAndMerge);
+					recordingBackend.ResetStatistics();
+					const auto elapsed = runner.Run(fullName, frameCount, [&]
+					{
+						for (size_t frame = 0; frame < frameCount; frame++)
+						{
+							headlessRenderer.Begin(headlessCamera, renderTarget);
+							drawFrameFunc(frame);
+							headlessRenderer.End();
+						}
+					});
+
+					const auto elapsedSeconds = Max(elapsed.TotalSeconds(), 0.000001);
+					const auto& totalStatistics = recordingBackend.GetTotalStatistics();
+
+					auto& scene = summary.Scenes.emplace_back();
+					scene.Name = std::move(fullName);
+					scene.LastFrame = recordingBackend.GetLastFrameStatistics();
+					scene.QuadsPerSecond = static_cast<f64>(totalStatistics.QuadCount) / elapsedSeconds;
+					scene.DrawCallsPerFrame = static_cast<f64>(totalStatistics.DrawCallCount) / static_cast<f64>(recordingBackend.GetFrameCount());
+				}
+
+				headlessRenderer.SetSortAndMergeBatches(false);
+			};
+
+			// NOTE: Textures are never uploaded by the recording backend so only their size and format have to be valid
+			std::array<Graphics::Tex, 12> syntheticTextures;
+			for (auto& tex : syntheticTextures)
+			{
+				auto& mipMap = tex.MipMapsArray.emplace_back().emplace_back();
+				mipMap.Size = ivec2(256);
+				mipMap.Format = Graphics::TextureFormat::RGBA8;
+			}
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+			std::vector<Render::RenderCommand2D> spriteCommands(param.SpriteCount);
+			for (auto& command : spriteCommands)
+			{
+				command.TexView = Render::TexSamplerView(&syntheticTextures[random() % syntheticTextures.size()]);
+				command.SourceRegion = vec4(0.0f, 0.0f, 32.0f, 32.0f);
+				command.Position = vec2(static_cast<f32>(random() % 1920), static_cast<f32>(random() % 1080));
+				command.Rotation = static_cast<f32>(random() % 360);
+				command.BlendMode = (random() % 8 == 0) ? Graphics::AetBlendMode::Add : Graphics::AetBlendMode::Normal;
+			}
+
+			runFrames("Sprites (interleaved textures)", [&](size_t frame)
+			{
+				for (const auto& command : spriteCommands)
+					headlessRenderer.Draw(command);
+			});
+
+			runFrames("Sprites (interleaved textures, batched draw)", [&](size_t frame)
+			{
+				headlessRenderer.Draw(spriteCommands.data(), spriteCommands.size());
+			});
+
+			if (auto* font = GetHeadlessBenchmarkFont36(); font != nullptr)
+			{
+				runFrames("Font (border text)", [&](size_t frame)
+				{
+					for (i32 line = 0; line < 32; line++)
+						headlessRenderer.Font().DrawBorder(*font, "The quick brown fox jumps over the lazy dog 0123456789", vec2(32.0f, 32.0f * static_cast<f32>(line)));
+				});
 			}
 		}
 
+		void RunQuadGenerationBenchmark()
+		{
+			using namespace Render::Detail;
+
+			auto& runner = headlessBenchmark.Runner;
+			const auto& param = headlessBenchmark.Param;
+
+			// NOTE: Every third quad is unrotated to cover both the exact and the approximated sin / cos path
+			const auto quadCount = static_cast<size_t>(param.SpriteCount);
+			std::vector<f32> positionX(quadCount), positionY(quadCount), originX(quadCount), originY(quadCount), sizeX(quadCount), sizeY(quadCount), rotation(quadCount);
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+			for (size_t i = 0; i < quadCount; i++)
+			{
+				positionX[i] = static_cast<f32>(random() % 1920);
+				positionY[i] = static_cast<f32>(random() % 1080);
+				originX[i] = -static_cast<f32>(random() % 64);
+				originY[i] = -static_cast<f32>(random() % 64);
+				sizeX[i] = static_cast<f32>(1 + random() % 128);
+				sizeY[i] = static_cast<f32>(1 + random() % 128);
+				rotation[i] = (i % 3 == 0) ? 0.0f : (static_cast<f32>(random() % 72000) / 100.0f - 360.0f);
+			}
+
+			const SpriteQuadTransformsView transforms = { quadCount, positionX.data(), positionY.data(), originX.data(), originY.data(), sizeX.data(), sizeY.data(), rotation.data() };
+			std::vector<SpriteQuadVertices> scalarQuads(quadCount), simdQuads(quadCount);
+
+			const auto iterationCount = static_cast<size_t>(param.FrameCount);
+			const auto runQuadGeneration = [&](const char* name, auto generateFunc, std::vector<SpriteQuadVertices>& outQuads)
+			{
+				const auto elapsed = runner.Run(name, iterationCount * quadCount, [&]
+				{
+					for (size_t i = 0; i < iterationCount; i++)
+						generateFunc(transforms, outQuads.data());
+				});
+
+				const auto elapsedSeconds = Max(elapsed.TotalSeconds(), 0.000001);
+				return static_cast<f64>(iterationCount * quadCount) / elapsedSeconds;
+			};
+
+			auto& summary = headlessBenchmark.Summary->QuadGeneration;
+			summary.ScalarQuadsPerSecond = runQuadGeneration("Quad positions (scalar reference)", GenerateQuadPositionsScalar, scalarQuads);
+#if COMFY_SPRITE_QUAD_GENERATION_SIMD
+			summary.SIMDQuadsPerSecond = runQuadGeneration("Quad positions (SIMD)", GenerateQuadPositionsSIMD, simdQuads);
+#else
+			summary.SIMDQuadsPerSecond = runQuadGeneration("Quad positions (SIMD unavailable, scalar)", GenerateQuadPositionsScalar, simdQuads);
+#endif
+
+			for (size_t i = 0; i < quadCount; i++)
+			{
+				for (size_t vertex = 0; vertex < SpriteQuadVertices::GetVertexCount(); vertex++)
+				{
+					const vec2 scalarPosition = (&scalarQuads[i].TopLeft)[vertex].Position;
+					const vec2 simdPosition = (&simdQuads[i].TopLeft)[vertex].Position;
+
+					if (rotation[i] == 0.0f)
+					{
+						if (scalarPosition != simdPosition)
+							summary.UnrotatedMismatchCount++;
+					}
+					else
+					{
+						summary.MaxRotatedPositionDeviation = Max(summary.MaxRotatedPositionDeviation, glm::distance(scalarPosition, simdPosition));
+					}
+				}
+			}
+
+			// NOTE: The approximated sin / cos is only a few ULPs off, far below anything visible even for the largest quads
+			constexpr f32 maxAllowedRotatedPositionDeviation = 0.01f;
+			runner.Check("SIMD unrotated quad positions match scalar", summary.UnrotatedMismatchCount == 0);
+			runner.Check("SIMD rotated quad positions within tolerance", summary.MaxRotatedPositionDeviation <= maxAllowedRotatedPositionDeviation);
+		}
+
+		Graphics::BitmapFont* GetHeadlessBenchmarkFont36() const
+		{
+			if (headlessFontMap == nullptr)
+				return nullptr;
+
+			auto* font = FindIfOrNull(headlessFontMap->Fonts, [](const auto& font) { return font.GetFontSize() == ivec2(36); });
+			if (font != nullptr && font->Texture == nullptr && sprSet != nullptr && !sprSet->TexSet.Textures.empty())
+				font->Texture = sprSet->TexSet.Textures.front();
+
+			return font;
+		}
+
 	private:
 		Render::Renderer2D renderer = {};
 		Render::Camera2D camera = {};
@@ -108,5 +309,39 @@ namespace Comfy::Sandbox::Tests
 		int textureIndex = 0;
 
 		Render::RenderCommand2D testCommand;
+
+		Render::Renderer2D headlessRenderer { std::make_unique<Render::RecordingRenderer2DBackend>() };
+		std::unique_ptr<Render::RenderTarget2D> headlessRenderTarget = headlessRenderer.GetBackend().CreateRenderTarget();
+		std::unique_ptr<Graphics::FontMap> headlessFontMap = IO::File::Load<Graphics::FontMap>("dev_ram/font/fontmap/fontmap.bin");
+
+		struct HeadlessBenchmarkParam
+		{
+			i32 FrameCount = 1000;
+			i32 SpriteCount = 2000;
+		};
+
+		struct HeadlessSceneSummary
+		{
+			std::string Name;
+			Render::Renderer2DDrawStatistics LastFrame;
+			f64 QuadsPerSecond;
+			f64 DrawCallsPerFrame;
+		};
+
+		struct QuadGenerationSummary
+		{
+			f64 ScalarQuadsPerSecond;
+			f64 SIMDQuadsPerSecond;
+			f32 MaxRotatedPositionDeviation;
+			size_t UnrotatedMismatchCount;
+		};
+
+		struct HeadlessBenchmarkSummary
+		{
+			std::vector<HeadlessSceneSummary> Scenes;
+			QuadGenerationSummary QuadGeneration;
+		};
+
+		System::Benchmark<HeadlessBenchmarkParam, HeadlessBenchmarkSummary> headlessBenchmark;
 	};
 }
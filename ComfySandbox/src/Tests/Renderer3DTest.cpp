@@ -1,5 +1,10 @@
 #include "TestTask.h"
 #include "Resource/ResourceIDMap.h"
+#include "Render/Core/Renderer3D/Detail/RenderCommandPreparation.h"
+#include "Render/Core/BoundingVolumeHierarchy.h"
+#include "Render/Core/RayIntersection.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
 
 namespace Comfy::Sandbox::Tests
 {
@@ -14,8 +19,7 @@ namespace Comfy::Sandbox::Tests
 			{
 				texSet->SetTextureIDs(*objSet);
 
-				for (auto& tex : texSet->Textures)
-					texIDMap.Add(tex->ID, tex);
+				texIDMap.AddRange(texSet->Textures, [](auto& tex) { return tex->ID; });
 			}
 		}
 
@@ -40,6 +44,315 @@ namespace Comfy::Sandbox::Tests
 				Gui::Image(renderTarget->GetTextureID(), size);
 			}
 			Gui::End();
+
+			preparationBenchmark.WindowGui("Renderer3D Preparation Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Object Count", param.ObjectCount, 1.0f, ivec2(1, 1000000));
+					GuiProperty::Input("Frame Count", param.FrameCount, 1.0f, ivec2(1, 10000));
+				},
+				[&] { RunPreparationBenchmark(); },
+				[&](const auto& summary)
+				{
+					Gui::Text("Draw lists: %zu opaque, %zu transparent, %zu SSS, %zu shadow caster sub meshes", summary.OpaqueCount, summary.TransparentCount, summary.SubsurfaceScatteringCount, summary.ShadowCasterCount);
+					Gui::Text("Culled: %u objects, %u meshes, %u sub meshes (%u task(s))", summary.ObjectsCulled, summary.MeshesCulled, summary.SubMeshesCulled, summary.TaskCount);
+				});
+
+			bvhBenchmark.WindowGui("Scene BVH Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Entity Count", param.EntityCount, 1.0f, ivec2(1, 1000000));
+					GuiProperty::Input("Query Count", param.QueryCount, 1.0f, ivec2(1, 100000));
+				},
+				[&] { RunBoundingVolumeHierarchyBenchmark(); },
+				[&](const auto& summary)
+				{
+					Gui::Text("Tree height: %d, %zu proxies reinserted while moving", summary.TreeHeight, summary.ReinsertedCount);
+					Gui::Text("Last query: %zu entities inside the view frustum, %zu hit by the ray", summary.FrustumVisibleCount, summary.RayHitCount);
+				});
+		}
+
+	private:
+		void RunPreparationBenchmark()
+		{
+			using namespace Render::Detail;
+
+			auto& runner = preparationBenchmark.Runner;
+			const auto& benchmarkParam = preparationBenchmark.Param;
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+			const auto objs = GenerateBenchmarkObjs(16, random);
+
+			// NOTE: Objects scattered all around the camera so that roughly half of them end up outside the view frustum
+			std::vector<Render::ObjRenderCommand> commands(static_cast<size_t>(benchmarkParam.ObjectCount));
+			for (auto& command : commands)
+			{
+				const vec3 position = vec3(static_cast<f32>(random() % 2000), static_cast<f32>(random() % 200), static_cast<f32>(random() % 2000)) / 10.0f - vec3(100.0f, 10.0f, 100.0f);
+
+				command.SourceCommand = Render::RenderCommand3D(objs[random() % objs.size()], position);
+				command.SourceCommand.Flags.CastsShadow = (random() % 4 != 0);
+				command.SourceCommand.Flags.IgnoreShadowCastObjFlags = false;
+				command.ModelMatrix = command.SourceCommand.Transform.CalculateMatrix();
+				command.TransformedBoundingSphere = command.SourceCommand.SourceObj->BoundingSphere;
+				command.TransformedBoundingSphere.Transform(command.ModelMatrix, command.SourceCommand.Transform.Scale);
+			}
+
+			Render::Camera3D benchmarkCamera;
+			benchmarkCamera.ViewPoint = vec3(0.0f, 2.0f, 0.0f);
+			benchmarkCamera.Interest = vec3(0.0f, 0.0f, 10.0f);
+			benchmarkCamera.UpdateMatrices();
+
+			RenderCommandPreparationParam param = {};
+			param.Camera = &benchmarkCamera;
+			param.FrustumCulling = true;
+			param.AlphaSort = true;
+			param.PrepareShadowCasters = true;
+			param.PrepareSubsurfaceScattering = true;
+
+			RenderCommandPreparer preparer;
+			RenderPassDrawLists serialLists, multithreadedLists;
+
+			const auto frameCount = static_cast<size_t>(benchmarkParam.FrameCount);
+			const auto runPrepare = [&](std::string name, bool multithreaded, bool alphaSort, RenderPassDrawLists& outLists)
+			{
+				param.Multithreaded = multithreaded;
+				param.AlphaSort = alphaSort;
+
+				runner.Run(std::move(name), frameCount, [&]
+				{
+					for (size_t frame = 0; frame < frameCount; frame++)
+						preparer.Prepare(commands, param, outLists);
+				});
+			};
+
+			runPrepare("Prepare (single threaded, no alpha sort)", false, false, serialLists);
+			runPrepare("Prepare (multithreaded, no alpha sort)", true, false, multithreadedLists);
+			runPrepare("Prepare (single threaded)", false, true, serialLists);
+			runPrepare("Prepare (multithreaded)", true, true, multithreadedLists);
+
+			// NOTE: Reference for the radix sort using the comparison previously used by the Renderer3D
+			auto referenceSortedTransparent = serialLists.Transparent;
+			runner.Run("Alpha sort (std::sort reference)", frameCount, [&]
+			{
+				for (size_t frame = 0; frame < frameCount; frame++)
+				{
+					std::sort(referenceSortedTransparent.begin(), referenceSortedTransparent.end(), [](const auto& a, const auto& b)
+					{
+						constexpr float comparisonThreshold = 0.001f;
+						if (std::abs(a.CameraDistance - b.CameraDistance) < comparisonThreshold)
+							return a.SubMesh->BoundingSphere.Radius > b.SubMesh->BoundingSphere.Radius;
+
+						return (a.CameraDistance > b.CameraDistance);
+					});
+				}
+			});
+
+			PreparationSummary summary = {};
+			summary.OpaqueCount = serialLists.Opaque.size();
+			summary.TransparentCount = serialLists.Transparent.size();
+			summary.SubsurfaceScatteringCount = serialLists.SubsurfaceScattering.size();
+			summary.ShadowCasterCount = serialLists.ShadowCaster.size();
+
+			const auto& statistics = preparer.GetLastStatistics();
+			summary.ObjectsCulled = statistics.ObjectsCulled;
+			summary.MeshesCulled = statistics.MeshesCulled;
+			summary.SubMeshesCulled = statistics.SubMeshesCulled;
+			summary.TaskCount = statistics.TaskCount;
+
+			runner.Check("Multithreaded draw lists match single threaded",
+				SubMeshRenderCommandListsEqual(serialLists.Opaque, multithreadedLists.Opaque) &&
+				SubMeshRenderCommandListsEqual(serialLists.Transparent, multithreadedLists.Transparent) &&
+				SubMeshRenderCommandListsEqual(serialLists.SubsurfaceScattering, multithreadedLists.SubsurfaceScattering) &&
+				SubMeshRenderCommandListsEqual(serialLists.ShadowCaster, multithreadedLists.ShadowCaster));
+
+			// NOTE: Back to front within the depth quantization step and larger sub meshes first at the same quantized depth
+			runner.Check("Alpha sort order valid", std::is_sorted(serialLists.Transparent.begin(), serialLists.Transparent.end(), [](const auto& a, const auto& b)
+			{
+				const auto depthA = static_cast<u32>(a.CameraDistance / RenderCommandPreparer::DepthQuantizationStep);
+				const auto depthB = static_cast<u32>(b.CameraDistance / RenderCommandPreparer::DepthQuantizationStep);
+
+				if (depthA != depthB)
+					return (depthA > depthB);
+
+				return (a.SubMesh->BoundingSphere.Radius > b.SubMesh->BoundingSphere.Radius);
+			}));
+
+			preparationBenchmark.Summary = summary;
+		}
+
+		void RunBoundingVolumeHierarchyBenchmark()
+		{
+			using namespace Graphics;
+
+			auto& runner = bvhBenchmark.Runner;
+			const auto& param = bvhBenchmark.Param;
+
+			// NOTE: Roughly resembling a large stage with lots of small props spread out over a mostly flat area
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+			auto positionDistribution = std::uniform_real_distribution<f32>(-500.0f, 500.0f);
+			auto radiusDistribution = std::uniform_real_distribution<f32>(0.25f, 8.0f);
+
+			const auto entityCount = static_cast<size_t>(param.EntityCount);
+			std::vector<Sphere> spheres(entityCount);
+			for (auto& sphere : spheres)
+				sphere = { vec3(positionDistribution(random), positionDistribution(random) * 0.05f, positionDistribution(random)), radiusDistribution(random) };
+
+			Render::BoundingVolumeHierarchy bvh;
+			std::vector<Render::BoundingVolumeHierarchy::ProxyID> proxies(entityCount);
+
+			runner.Run("Build (incremental insertion)", entityCount, [&]
+			{
+				for (size_t i = 0; i < entityCount; i++)
+					proxies[i] = bvh.Add(AxisAlignedBox::FromSphere(spheres[i]), static_cast<u32>(i), 1);
+			});
+
+			// NOTE: Every query uses a different camera orientation / ray so the results can't be cached
+			const auto queryCount = static_cast<size_t>(param.QueryCount);
+			std::vector<Render::Camera3D> cameras(queryCount);
+			std::vector<Ray> rays(queryCount);
+			for (size_t i = 0; i < queryCount; i++)
+			{
+				const f32 angle = static_cast<f32>(i) / static_cast<f32>(queryCount) * glm::two_pi<f32>();
+
+				cameras[i].ViewPoint = vec3(positionDistribution(random), 10.0f, positionDistribution(random));
+				cameras[i].Interest = cameras[i].ViewPoint + vec3(glm::cos(angle), -0.1f, glm::sin(angle));
+				cameras[i].FarPlane = 300.0f;
+				cameras[i].UpdateMatrices();
+
+				rays[i] = { cameras[i].ViewPoint, glm::normalize(cameras[i].Interest - cameras[i].ViewPoint) };
+			}
+
+			BoundingVolumeHierarchySummary summary = {};
+			bool frustumResultsMatch = true, rayResultsMatch = true;
+
+			std::vector<u32> linearResults, bvhResults;
+			const auto compareResults = [&]()
+			{
+				std::sort(bvhResults.begin(), bvhResults.end());
+				return (linearResults == bvhResults);
+			};
+
+			TimeSpan linearFrustumElapsed = {}, bvhFrustumElapsed = {};
+			TimeSpan linearRayElapsed = {}, bvhRayElapsed = {};
+
+			for (size_t i = 0; i < queryCount; i++)
+			{
+				const auto& queryCamera = cameras[i];
+
+				linearResults.clear();
+				auto stopwatch = Stopwatch::StartNew();
+				for (size_t entity = 0; entity < entityCount; entity++)
+				{
+					if (queryCamera.IntersectsViewFrustum(spheres[entity]))
+						linearResults.push_back(static_cast<u32>(entity));
+				}
+				linearFrustumElapsed += stopwatch.Restart();
+
+				bvhResults.clear();
+				bvh.QueryFrustum(queryCamera, 1, [&](u32 entity)
+				{
+					if (queryCamera.IntersectsViewFrustum(spheres[entity]))
+						bvhResults.push_back(entity);
+				});
+				bvhFrustumElapsed += stopwatch.Restart();
+
+				summary.FrustumVisibleCount = linearResults.size();
+				frustumResultsMatch &= compareResults();
+
+				const auto& ray = rays[i];
+				float intersectionDistance = 0.0f;
+
+				linearResults.clear();
+				stopwatch.Restart();
+				for (size_t entity = 0; entity < entityCount; entity++)
+				{
+					if (Render::RayIntersectsSphere(ray, spheres[entity], intersectionDistance))
+						linearResults.push_back(static_cast<u32>(entity));
+				}
+				linearRayElapsed += stopwatch.Restart();
+
+				bvhResults.clear();
+				bvh.QueryRay(ray, 1, [&](u32 entity, float entryDistance)
+				{
+					if (Render::RayIntersectsSphere(ray, spheres[entity], intersectionDistance))
+						bvhResults.push_back(entity);
+				});
+				bvhRayElapsed += stopwatch.Restart();
+
+				summary.RayHitCount = linearResults.size();
+				rayResultsMatch &= compareResults();
+			}
+
+			runner.Check("BVH frustum query results match linear sphere tests", frustumResultsMatch);
+			runner.Check("BVH ray query results match linear sphere tests", rayResultsMatch);
+
+			runner.Add("Frustum query (linear sphere tests)", linearFrustumElapsed, queryCount);
+			runner.Add("Frustum query (BVH)", bvhFrustumElapsed, queryCount);
+			runner.Add("Ray query (linear sphere tests)", linearRayElapsed, queryCount);
+			runner.Add("Ray query (BVH)", bvhRayElapsed, queryCount);
+
+			// NOTE: Every tenth entity moves a small amount per frame, most of which should be absorbed by the fat bounds
+			auto movementDistribution = std::uniform_real_distribution<f32>(-0.5f, 0.5f);
+			runner.Run("Refit (10% of entities moving)", queryCount, [&]
+			{
+				for (size_t frame = 0; frame < queryCount; frame++)
+				{
+					for (size_t entity = (frame % 10); entity < entityCount; entity += 10)
+					{
+						spheres[entity].Center += vec3(movementDistribution(random), 0.0f, movementDistribution(random));
+						if (bvh.Update(proxies[entity], AxisAlignedBox::FromSphere(spheres[entity])))
+							summary.ReinsertedCount++;
+					}
+				}
+			});
+
+			summary.TreeHeight = bvh.GetHeight();
+			bvhBenchmark.Summary = summary;
+		}
+
+		// NOTE: A handful of obj variations with a mix of opaque, transparent, shadow casting and SSS sub meshes, none of them ever uploaded to the GPU
+		static std::vector<Graphics::Obj> GenerateBenchmarkObjs(size_t count, std::mt19937& random)
+		{
+			std::vector<Graphics::Obj> objs(count);
+			for (auto& obj : objs)
+			{
+				obj.BoundingSphere = { vec3(0.0f), 2.0f };
+
+				auto& opaqueMaterial = obj.Materials.emplace_back();
+				opaqueMaterial.ShaderType = Graphics::Material::ShaderIdentifiers::Blinn;
+
+				auto& transparentMaterial = obj.Materials.emplace_back();
+				transparentMaterial.ShaderType = Graphics::Material::ShaderIdentifiers::Item;
+				transparentMaterial.BlendFlags.AlphaMaterial = true;
+
+				auto& skinMaterial = obj.Materials.emplace_back();
+				skinMaterial.ShaderType = Graphics::Material::ShaderIdentifiers::Skin;
+
+				const size_t meshCount = 1 + (random() % 4);
+				for (size_t meshIndex = 0; meshIndex < meshCount; meshIndex++)
+				{
+					auto& mesh = obj.Meshes.emplace_back();
+					mesh.BoundingSphere = { vec3(static_cast<f32>(random() % 200) / 100.0f - 1.0f, 0.0f, 0.0f), 1.0f };
+
+					const size_t subMeshCount = 1 + (random() % 6);
+					for (size_t subMeshIndex = 0; subMeshIndex < subMeshCount; subMeshIndex++)
+					{
+						auto& subMesh = mesh.SubMeshes.emplace_back();
+						subMesh.BoundingSphere = { mesh.BoundingSphere.Center, static_cast<f32>(1 + random() % 100) / 100.0f };
+						subMesh.MaterialIndex = static_cast<u32>(random() % obj.Materials.size());
+						subMesh.Flags.CastsShadows = (random() % 2 == 0);
+					}
+				}
+			}
+			return objs;
+		}
+
+		static bool SubMeshRenderCommandListsEqual(const std::vector<Render::SubMeshRenderCommand>& listA, const std::vector<Render::SubMeshRenderCommand>& listB)
+		{
+			return std::equal(listA.begin(), listA.end(), listB.begin(), listB.end(), [](const auto& a, const auto& b)
+			{
+				return (a.ObjCommand == b.ObjCommand && a.ParentMesh == b.ParentMesh && a.SubMesh == b.SubMesh && a.Material == b.Material && a.CameraDistance == b.CameraDistance);
+			});
 		}
 
 	private:
@@ -56,5 +369,35 @@ namespace Comfy::Sandbox::Tests
 
 		std::unique_ptr<Render::RenderTarget3D> renderTarget = Render::Renderer3D::CreateRenderTarget();
 		Render::SceneParam3D sceneParam;
+
+		struct PreparationParam
+		{
+			i32 ObjectCount = 2000;
+			i32 FrameCount = 100;
+		};
+
+		struct PreparationSummary
+		{
+			size_t OpaqueCount, TransparentCount, SubsurfaceScatteringCount, ShadowCasterCount;
+			u32 ObjectsCulled, MeshesCulled, SubMeshesCulled, TaskCount;
+		};
+
+		System::Benchmark<PreparationParam, PreparationSummary> preparationBenchmark;
+
+		struct BoundingVolumeHierarchyParam
+		{
+			i32 EntityCount = 10000;
+			i32 QueryCount = 1000;
+		};
+
+		struct BoundingVolumeHierarchySummary
+		{
+			i32 TreeHeight;
+			size_t FrustumVisibleCount;
+			size_t RayHitCount;
+			size_t ReinsertedCount;
+		};
+
+		System::Benchmark<BoundingVolumeHierarchyParam, BoundingVolumeHierarchySummary> bvhBenchmark;
 	};
 }
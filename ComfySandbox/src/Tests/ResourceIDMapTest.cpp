@@ -0,0 +1,154 @@
+#include "TestTask.h"
+#include "Resource/ResourceIDMap.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
+
+namespace Comfy::Sandbox::Tests
+{
+	class ResourceIDMapTest : public ITestTask
+	{
+	public:
+		ResourceIDMapTest() = default;
+
+		void Update() override
+		{
+			lookupBenchmark.WindowGui("Resource ID Map Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Resource Count", param.ResourceCount, 1.0f, ivec2(1, 1000000));
+					GuiProperty::Input("Lookup Count", param.LookupCount, 1.0f, ivec2(1, 10000000));
+				},
+				[&] { RunLookupBenchmark(); },
+				[&](const auto&)
+				{
+					Gui::Text("Current linear search threshold: %zu", ResourceIDMap<TexID, i32>::LinearSearchThreshold);
+				});
+		}
+
+	private:
+		void RunLookupBenchmark()
+		{
+			auto& runner = lookupBenchmark.Runner;
+			const auto& param = lookupBenchmark.Param;
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+
+			// NOTE: Older games use small sequential texture IDs while newer ones use murmur hashes of the texture names which are spread across the entire range
+			const auto generateIDs = [&](size_t count, bool hashed)
+			{
+				std::vector<TexID> ids(count);
+				for (size_t i = 0; i < count; i++)
+					ids[i] = static_cast<TexID>(hashed ? (random() % static_cast<u32>(TexID::Invalid)) : static_cast<u32>(i));
+				std::shuffle(ids.begin(), ids.end(), random);
+				return ids;
+			};
+
+			const auto generateResources = [&](size_t count)
+			{
+				std::vector<std::shared_ptr<i32>> resources(count);
+				for (size_t i = 0; i < count; i++)
+					resources[i] = std::make_shared<i32>(static_cast<i32>(i));
+				return resources;
+			};
+
+			const auto resourceCount = static_cast<size_t>(param.ResourceCount);
+			const auto lookupCount = static_cast<size_t>(param.LookupCount);
+
+			for (const bool hashed : { false, true })
+			{
+				const auto suffix = std::string(hashed ? " (hashed IDs)" : " (sequential IDs)");
+				const auto ids = generateIDs(resourceCount, hashed);
+				const auto resources = generateResources(resourceCount);
+
+				ResourceIDMap<TexID, i32> oneByOneMap;
+				runner.Run("Add() one by one" + suffix, resourceCount, [&]
+				{
+					oneByOneMap.ReservedAdditional(resourceCount);
+					for (size_t i = 0; i < resourceCount; i++)
+						oneByOneMap.Add(ids[i], resources[i]);
+				});
+
+				ResourceIDMap<TexID, i32> bulkMap;
+				runner.Run("AddRange()" + suffix, resourceCount, [&]
+				{
+					bulkMap.AddRange(resources, [&](const auto& resource) { return ids[*resource]; });
+				});
+
+				std::vector<Cached_TexID> cachedIDs(lookupCount);
+				for (auto& cachedID : cachedIDs)
+				{
+					cachedID = ids[random() % resourceCount];
+					cachedID.CachedIndex = std::numeric_limits<u32>::max();
+				}
+
+				i32 uncachedFoundSum = 0, cachedFoundSum = 0;
+				runner.Run("Find() uncached" + suffix, lookupCount, [&]
+				{
+					for (const auto& cachedID : cachedIDs)
+						uncachedFoundSum += *bulkMap.Find(&cachedID);
+				});
+
+				runner.Run("Find() cached" + suffix, lookupCount, [&]
+				{
+					for (const auto& cachedID : cachedIDs)
+						cachedFoundSum += *bulkMap.Find(&cachedID);
+				});
+
+				runner.Check("Cached and uncached Find() results match" + suffix, cachedFoundSum == uncachedFoundSum);
+
+				i32 foundSum = 0;
+				bool searchResultsMatch = true;
+
+				// NOTE: Small maps such as the textures of a single ObjSet, used to settle the threshold between the linear and binary search
+				for (const size_t smallCount : { 8, 16, 24, 32, 48, 64, 96, 128 })
+				{
+					const auto smallIDs = generateIDs(smallCount, hashed);
+					const auto smallResources = generateResources(smallCount);
+
+					ResourceIDMap<TexID, i32> smallMap;
+					smallMap.AddRange(smallResources, [&](const auto& resource) { return smallIDs[*resource]; });
+
+					for (const auto id : smallIDs)
+					{
+						const auto linearResult = smallMap.FindIndexLinearSearch(id), binaryResult = smallMap.FindIndexBinarySearch(id);
+						searchResultsMatch &= (linearResult.WasFound && binaryResult.WasFound && linearResult.IndexOrClosest == binaryResult.IndexOrClosest);
+					}
+
+					std::vector<TexID> lookupIDs(lookupCount);
+					for (auto& id : lookupIDs)
+						id = smallIDs[random() % smallCount];
+
+					char nameBuffer[64];
+					sprintf_s(nameBuffer, "Linear search, %zu entries", smallCount);
+					runner.Run(nameBuffer + suffix, lookupCount, [&]
+					{
+						for (const auto id : lookupIDs)
+							foundSum += smallMap.FindIndexLinearSearch(id).IndexOrClosest;
+					});
+
+					sprintf_s(nameBuffer, "Binary search, %zu entries", smallCount);
+					runner.Run(nameBuffer + suffix, lookupCount, [&]
+					{
+						for (const auto id : lookupIDs)
+							foundSum += smallMap.FindIndexBinarySearch(id).IndexOrClosest;
+					});
+				}
+
+				runner.Check("Linear and binary search results match" + suffix, searchResultsMatch);
+
+				// NOTE: Only to prevent the lookups from being optimized away
+				if (foundSum == std::numeric_limits<i32>::min())
+					runner.Clear();
+			}
+		}
+
+	private:
+		struct LookupParam
+		{
+			i32 ResourceCount = 10000;
+			i32 LookupCount = 100000;
+		};
+
+		System::Benchmark<LookupParam> lookupBenchmark;
+	};
+}
@@ -0,0 +1,128 @@
+#include "TestTask.h"
+#include "Resource/IDHash.h"
+#include "Script/PVScript.h"
+#include "Misc/PerfectHashTable.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include <random>
+
+namespace Comfy::Sandbox::Tests
+{
+	class StringHashingTest : public ITestTask
+	{
+	public:
+		StringHashingTest() = default;
+
+		void Update() override
+		{
+			hashingBenchmark.WindowGui("String Hashing Benchmark",
+				[&](auto& param)
+				{
+					GuiProperty::Input("Name Count", param.NameCount, 1.0f, ivec2(1, 10000000));
+					GuiProperty::Input("Lookup Count", param.LookupCount, 1.0f, ivec2(1, 10000000));
+				},
+				[&] { RunHashingBenchmark(); },
+				[&](const auto&) {});
+		}
+
+	private:
+		static constexpr auto CreatePVCommandNameTable()
+		{
+			std::array<PerfectHashTableEntry<PVCommandType>, EnumCount<PVCommandType>()> entries = {};
+			for (size_t i = 0; i < entries.size(); i++)
+				entries[i] = { PVCommandInfoTable[i].Name, PVCommandInfoTable[i].Type };
+
+			return PerfectHashTable<PVCommandType, EnumCount<PVCommandType>()>(entries);
+		}
+
+		void RunHashingBenchmark()
+		{
+			auto& runner = hashingBenchmark.Runner;
+			const auto& param = hashingBenchmark.Param;
+
+			auto random = std::mt19937(System::BenchmarkRandomSeed);
+
+			// NOTE: Resembling sprite names with a shared prefix and varying length suffixes
+			const auto nameCount = static_cast<size_t>(param.NameCount);
+			std::vector<std::string> names(nameCount);
+			for (auto& name : names)
+			{
+				name = "SPR_GAM_CMN_";
+				const size_t suffixLength = 4 + (random() % 20);
+				for (size_t i = 0; i < suffixLength; i++)
+					name += static_cast<char>('A' + (random() % 26));
+			}
+
+			std::vector<std::string_view> nameViews(names.begin(), names.end());
+			std::vector<u32> scalarHashes(nameCount), batchHashes(nameCount);
+
+			runner.Run("MurmurHash() one by one", nameCount, [&]
+			{
+				for (size_t i = 0; i < nameCount; i++)
+					scalarHashes[i] = MurmurHash(nameViews[i]);
+			});
+
+			runner.Run("MurmurHashBatch()", nameCount, [&]
+			{
+				MurmurHashBatch(nameViews.data(), batchHashes.data(), nameCount);
+			});
+
+			runner.Check("Batch hashes match scalar hashes", scalarHashes == batchHashes);
+
+			const auto lookupCount = static_cast<size_t>(param.LookupCount);
+			std::vector<std::string_view> commandNames(lookupCount);
+			for (auto& commandName : commandNames)
+				commandName = PVCommandInfoTable[random() % PVCommandInfoTable.size()].Name;
+
+			// NOTE: Case sensitive reverse lookup of GetPVCommandName(), kept local to compare against the linear search until the PV script name lookup is needed elsewhere
+			static constexpr auto pvCommandNameTable = CreatePVCommandNameTable();
+			static_assert(pvCommandNameTable.IsValid());
+
+			size_t linearFoundSum = 0, perfectHashFoundSum = 0;
+			runner.Run("PV command name linear search", lookupCount, [&]
+			{
+				for (const auto commandName : commandNames)
+					linearFoundSum += static_cast<size_t>(FindIfOrNull(PVCommandInfoTable, [&](const auto& info) { return (info.Name == commandName); })->Type);
+			});
+
+			runner.Run("PV command name perfect hash", lookupCount, [&]
+			{
+				for (const auto commandName : commandNames)
+					perfectHashFoundSum += static_cast<size_t>(pvCommandNameTable.FindOr(commandName, PVCommandType::Count));
+			});
+
+			runner.Check("PV command name perfect hash results match linear search", perfectHashFoundSum == linearFoundSum);
+
+			size_t foundSum = 0;
+
+			std::vector<std::string_view> keyCodeNames;
+			for (Input::KeyCode keyCode = Input::KeyCode_None; keyCode < Input::KeyCode_Count; keyCode++)
+			{
+				if (const char* keyCodeName = Input::GetKeyCodeName(keyCode); keyCodeName[0] != '\0')
+					keyCodeNames.push_back(keyCodeName);
+			}
+
+			std::vector<std::string_view> keyCodeLookupNames(lookupCount);
+			for (auto& keyCodeName : keyCodeLookupNames)
+				keyCodeName = keyCodeNames[random() % keyCodeNames.size()];
+
+			runner.Run("ParseKeyCodeName() perfect hash", lookupCount, [&]
+			{
+				for (const auto keyCodeName : keyCodeLookupNames)
+					foundSum += static_cast<size_t>(Input::ParseKeyCodeName(keyCodeName));
+			});
+
+			// NOTE: Only to prevent the lookups from being optimized away
+			if (foundSum == std::numeric_limits<size_t>::max())
+				runner.Clear();
+		}
+
+	private:
+		struct HashingParam
+		{
+			i32 NameCount = 100000;
+			i32 LookupCount = 100000;
+		};
+
+		System::Benchmark<HashingParam> hashingBenchmark;
+	};
+}
@@ -3,11 +3,16 @@
 #include "Version/BuildVersion.h"
 #include "Version/BuildConfiguration.h"
 #include "Graphics/Auth2D/Aet/AetSet.h"
+#include "Editor/Chart/FileFormat/ComfyStudioChartFile.h"
+#include "Editor/Chart/Gameplay/PlayTestSimulation.h"
+#include "Editor/Chart/PVScript/PVScriptUtil.h"
 #include "IO/Archive/FArc.h"
 #include "IO/Directory.h"
 #include "IO/File.h"
 #include "IO/Path.h"
 #include "Misc/StringUtil.h"
+#include "Time/Stopwatch.h"
+#include <future>
 
 namespace Comfy::Studio::CLI
 {
@@ -41,6 +46,166 @@ namespace Comfy::Studio::CLI
 			IO::File::Save(outputPath, *aetSet);
 	}
 
+	static std::vector<std::string> FindSortedChartFilePaths(std::string_view inputPath)
+	{
+		std::vector<std::string> chartPaths;
+		if (IO::Directory::Exists(inputPath))
+		{
+			IO::Directory::IterateFilesRecursive(inputPath, [&](const std::string& filePath)
+			{
+				if (Util::EndsWithInsensitive(filePath, Editor::ComfyStudioChartFile::Extension))
+					chartPaths.push_back(filePath);
+			});
+		}
+		else
+		{
+			chartPaths.emplace_back(inputPath);
+		}
+
+		// NOTE: Sorted so that the output of two runs over the same directory can be diffed line by line
+		std::sort(chartPaths.begin(), chartPaths.end());
+		return chartPaths;
+	}
+
+	template <typename Func>
+	static void ParallelForEachChartIndex(size_t chartCount, Func perChartFunc)
+	{
+		std::atomic<size_t> nextChartIndex = 0;
+		const size_t workerCount = Clamp<size_t>(std::thread::hardware_concurrency(), 1, Max<size_t>(chartCount, 1));
+
+		std::vector<std::future<void>> workers;
+		workers.reserve(workerCount);
+		for (size_t i = 0; i < workerCount; i++)
+		{
+			workers.push_back(std::async(std::launch::async, [&]
+			{
+				for (size_t chartIndex = nextChartIndex++; chartIndex < chartCount; chartIndex = nextChartIndex++)
+					perChartFunc(chartIndex);
+			}));
+		}
+
+		for (auto& worker : workers)
+			worker.wait();
+	}
+
+	static void AutoplayScoreProcessor(int index, const char* arguments[])
+	{
+		using namespace Editor;
+		const auto chartPaths = FindSortedChartFilePaths(arguments[index]);
+
+		struct ChartScore
+		{
+			bool Loaded;
+			u32 TargetCount;
+			HeadlessAutoplayResult Result;
+		};
+
+		std::vector<ChartScore> chartScores(chartPaths.size());
+		const auto stopwatch = Stopwatch::StartNew();
+
+		// NOTE: Each chart is simulated independently on a single thread at a fixed frame interval so the results don't depend on the worker count
+		ParallelForEachChartIndex(chartPaths.size(), [&](size_t chartIndex)
+		{
+			const auto chartFile = IO::File::Load<ComfyStudioChartFile>(chartPaths[chartIndex]);
+			if (chartFile == nullptr)
+				return;
+
+			auto chart = chartFile->MoveToChart();
+			chart->TempoMap.RebuildAccelerationStructure();
+
+			chartScores[chartIndex] = { true, static_cast<u32>(chart->Targets.size()), SimulateHeadlessAutoplay(*chart) };
+		});
+
+		size_t loadedChartCount = 0;
+		for (size_t i = 0; i < chartPaths.size(); i++)
+		{
+			const auto& chartScore = chartScores[i];
+			if (!chartScore.Loaded)
+			{
+				Logger::LogErrorLine("%s | Unable to load chart", chartPaths[i].c_str());
+				continue;
+			}
+
+			const auto& result = chartScore.Result;
+			const auto evaluationCount = [&](HitEvaluation evaluation) { return result.EvaluationCounts[static_cast<size_t>(evaluation)]; };
+			const u32 wrongCount = evaluationCount(HitEvaluation::WrongCool) + evaluationCount(HitEvaluation::WrongFine) + evaluationCount(HitEvaluation::WrongSafe) + evaluationCount(HitEvaluation::WrongSad);
+
+			Logger::LogLine("%s | Targets: %u, Evaluated: %u, Pairs: %u | Cool: %u, Fine: %u, Safe: %u, Sad: %u, Wrong: %u, Worst: %u | Max Combo: %d, Chain Slide: %d | Buttons: %s - %s, Frames: %u",
+				chartPaths[i].c_str(),
+				chartScore.TargetCount,
+				result.EvaluatedTargetCount,
+				result.EvaluatedPairCount,
+				evaluationCount(HitEvaluation::Cool),
+				evaluationCount(HitEvaluation::Fine),
+				evaluationCount(HitEvaluation::Safe),
+				evaluationCount(HitEvaluation::Sad),
+				wrongCount,
+				evaluationCount(HitEvaluation::Worst),
+				result.MaxComboCount,
+				result.TotalChainSlideScore,
+				result.FirstButtonTime.FormatTime().data(),
+				result.LastButtonTime.FormatTime().data(),
+				result.SimulatedFrameCount);
+
+			loadedChartCount++;
+		}
+
+		// NOTE: Wall time is the only non deterministic output and intentionally kept on its own line
+		Logger::LogLine("Simulated %zu / %zu charts in %.3f ms", loadedChartCount, chartPaths.size(), stopwatch.GetElapsed().TotalMilliseconds());
+	}
+
+	static void PVScriptExportProcessor(int index, const char* arguments[])
+	{
+		using namespace Editor;
+		const auto chartPaths = FindSortedChartFilePaths(arguments[index]);
+
+		struct ExportedScript
+		{
+			bool Loaded;
+			bool Saved;
+			size_t CommandCount;
+			std::string OutputPath;
+		};
+
+		std::vector<ExportedScript> exportedScripts(chartPaths.size());
+		const auto stopwatch = Stopwatch::StartNew();
+
+		// NOTE: Written next to each chart using the same file name so that all difficulties of a song end up in the same directory
+		ParallelForEachChartIndex(chartPaths.size(), [&](size_t chartIndex)
+		{
+			const auto chartFile = IO::File::Load<ComfyStudioChartFile>(chartPaths[chartIndex]);
+			if (chartFile == nullptr)
+				return;
+
+			auto chart = chartFile->MoveToChart();
+			chart->TempoMap.RebuildAccelerationStructure();
+
+			auto& exported = exportedScripts[chartIndex];
+			exported.Loaded = true;
+			exported.OutputPath = IO::Path::ChangeExtension(chartPaths[chartIndex], PVScript::Extension);
+
+			auto script = ConvertChartToPVScript(*chart);
+			exported.CommandCount = script.Commands.size();
+			exported.Saved = IO::File::Save(exported.OutputPath, script);
+		});
+
+		size_t savedScriptCount = 0;
+		for (size_t i = 0; i < chartPaths.size(); i++)
+		{
+			const auto& exported = exportedScripts[i];
+			if (!exported.Loaded)
+				Logger::LogErrorLine("%s | Unable to load chart", chartPaths[i].c_str());
+			else if (!exported.Saved)
+				Logger::LogErrorLine("%s | Unable to save '%s'", chartPaths[i].c_str(), exported.OutputPath.c_str());
+			else
+				Logger::LogLine("%s | Commands: %zu | %s", chartPaths[i].c_str(), exported.CommandCount, exported.OutputPath.c_str());
+
+			savedScriptCount += exported.Saved;
+		}
+
+		Logger::LogLine("Exported %zu / %zu charts in %.3f ms", savedScriptCount, chartPaths.size(), stopwatch.GetElapsed().TotalMilliseconds());
+	}
+
 	const char* CommandLineOption::GetDescription() const
 	{
 		return (Description != nullptr) ? Description : "No Description";
@@ -69,6 +234,8 @@ namespace Comfy::Studio::CLI
 			{ "-e",		"--exit",			"Exit the application",				true,	0, [](int index, const char* arguments[]) {} },
 			{ "-f",		"--farc",			"Extract FArc",						true,	1, FArcProcessor },
 			{ "-aet",	"--aet_reformat",	"Reformat an AetSet",				true,	2, AetSetFormatProcessor },
+			{ "-as",	"--autoplay_score",	"Autoplay score a chart or all charts in a directory",	true,	1, AutoplayScoreProcessor },
+			{ "-dsc",	"--export_pv_script",	"Export a chart or all charts in a directory as PV scripts",	true,	1, PVScriptExportProcessor },
 		};
 	}
 
@@ -1,8 +1,10 @@
 #include "ComfyStudioApplication.h"
 #include "ComfyStudioSettings.h"
 #include "DataTest/AudioTestWindow.h"
+#include "DataTest/ChartBenchmarkWindow.h"
 #include "DataTest/IconTestWindow.h"
 #include "DataTest/InputTestWindow.h"
+#include "DataTest/LogViewerWindow.h"
 #include "DataTest/MovieTestWindow.h"
 #include "System/Profiling/Profiler.h"
 #include "Version/BuildConfiguration.h"
@@ -21,6 +23,7 @@ namespace Comfy::Studio
 	constexpr std::string_view ComfyStudioWindowTitle = "Comfy Studio";
 	constexpr std::string_view ComfyCopyrightNotice = "Copyright (C) 2021 Samyuu";
 	constexpr std::string_view UserManualDocumentFilePath = "manual/comfy_manual.html";
+	constexpr std::string_view LogFilePath = "comfy_studio.log";
 	constexpr const char* AboutWindowName = "About##Application";
 
 	namespace
@@ -38,6 +41,11 @@ namespace Comfy::Studio
 	{
 		GlobalLastCreatedApplication = this;
 
+		// NOTE: Keep loader threads from contending on the stdio lock and from stalling the main thread on file IO while logging
+		Logger::AddSink(std::make_shared<FileLogSink>(LogFilePath));
+		Logger::StartAsyncFlushThread();
+		defer { Logger::StopAsyncFlushThread(); };
+
 		System::MountComfyData();
 
 		GlobalAppDataExistedOnLoad = GlobalAppData.LoadFromFile();
@@ -171,11 +179,13 @@ namespace Comfy::Studio
 	{
 		editorManager = std::make_unique<Editor::EditorManager>(*this);
 
-		testWindows.reserve(4);
+		testWindows.reserve(6);
 		testWindows.push_back(std::make_unique<DataTest::InputTestWindow>(*this));
 		testWindows.push_back(std::make_unique<DataTest::AudioTestWindow>(*this));
 		testWindows.push_back(std::make_unique<DataTest::MovieTestWindow>(*this));
 		testWindows.push_back(std::make_unique<DataTest::IconTestWindow>(*this));
+		testWindows.push_back(std::make_unique<DataTest::ChartBenchmarkWindow>(*this));
+		testWindows.push_back(std::make_unique<DataTest::LogViewerWindow>(*this));
 
 		return true;
 	}
@@ -555,6 +555,9 @@ namespace Comfy::Studio
 		constexpr std::string_view System_Gui_TargetButtonPathCurveSegments = "target_button_path_curve_segments";
 		constexpr std::string_view System_Gui_TargetButtonPathMaxCount = "target_button_path_max_count";
 
+		constexpr std::string_view System_UndoHistory = "undo_history";
+		constexpr std::string_view System_UndoHistory_MemoryBudgetMB = "memory_budget_mb";
+
 		constexpr std::string_view System_Discord = "discord";
 		constexpr std::string_view System_Discord_EnableRichPresence = "enable_rich_presence";
 		constexpr std::string_view System_Discord_ShareSongTitleAndArtist = "share_song_title_and_artist";
@@ -567,6 +570,7 @@ namespace Comfy::Studio
 		constexpr std::string_view SaveAndLoad_AutoSaveMaxFiles = "auto_save_max_files";
 		constexpr std::string_view SaveAndLoad_AutoSaveBeforeDiscardingChanges = "auto_save_before_discarding_changes";
 		constexpr std::string_view SaveAndLoad_AutoSaveDirectory = "auto_save_directory";
+		constexpr std::string_view SaveAndLoad_CompactChartFileTargets = "compact_chart_file_targets";
 
 		constexpr std::string_view Input = "input";
 		constexpr std::string_view Input_ControllerLayoutMappings = "controller_layout_mappings";
@@ -1027,6 +1031,11 @@ namespace Comfy::Studio
 				TryAssign(System.Gui.TargetButtonPathMaxCount, TryGetI32(Find(*guiJson, UserIDs::System_Gui_TargetButtonPathMaxCount)));
 			}
 
+			if (const Value* undoHistoryJson = Find(*systemJson, UserIDs::System_UndoHistory))
+			{
+				TryAssign(System.UndoHistory.MemoryBudgetMB, TryGetI32(Find(*undoHistoryJson, UserIDs::System_UndoHistory_MemoryBudgetMB)));
+			}
+
 			if (const Value* discordJson = Find(*systemJson, UserIDs::System_Discord))
 			{
 				TryAssign(System.Discord.EnableRichPresence, TryGetBool(Find(*discordJson, UserIDs::System_Discord_EnableRichPresence)));
@@ -1044,6 +1053,7 @@ namespace Comfy::Studio
 			TryAssign(SaveAndLoad.AutoSaveMaxFiles, TryGetI32(Find(*saveAndLoadJson, UserIDs::SaveAndLoad_AutoSaveMaxFiles)));
 			TryAssign(SaveAndLoad.AutoSaveDirectory, TryGetStrView(Find(*saveAndLoadJson, UserIDs::SaveAndLoad_AutoSaveDirectory)));
 			TryAssign(SaveAndLoad.AutoSaveBeforeDiscardingChanges, TryGetBool(Find(*saveAndLoadJson, UserIDs::SaveAndLoad_AutoSaveBeforeDiscardingChanges)));
+			TryAssign(SaveAndLoad.CompactChartFileTargets, TryGetBool(Find(*saveAndLoadJson, UserIDs::SaveAndLoad_CompactChartFileTargets)));
 		}
 
 		if (const Value* inputJson = Find(rootJson, UserIDs::Input))
@@ -1464,6 +1474,12 @@ namespace Comfy::Studio
 				}
 				writer.MemberObjectEnd();
 
+				writer.MemberObjectBegin(UserIDs::System_UndoHistory);
+				{
+					writer.MemberI32(UserIDs::System_UndoHistory_MemoryBudgetMB, System.UndoHistory.MemoryBudgetMB);
+				}
+				writer.MemberObjectEnd();
+
 				writer.MemberObjectBegin(UserIDs::System_Discord);
 				{
 					writer.MemberBool(UserIDs::System_Discord_EnableRichPresence, System.Discord.EnableRichPresence);
@@ -1482,6 +1498,7 @@ namespace Comfy::Studio
 				writer.MemberI32(UserIDs::SaveAndLoad_AutoSaveMaxFiles, SaveAndLoad.AutoSaveMaxFiles);
 				writer.MemberBool(UserIDs::SaveAndLoad_AutoSaveBeforeDiscardingChanges, SaveAndLoad.AutoSaveBeforeDiscardingChanges);
 				writer.MemberStr(UserIDs::SaveAndLoad_AutoSaveDirectory, SaveAndLoad.AutoSaveDirectory);
+				writer.MemberBool(UserIDs::SaveAndLoad_CompactChartFileTargets, SaveAndLoad.CompactChartFileTargets);
 			}
 			writer.MemberObjectEnd();
 
@@ -1841,6 +1858,8 @@ namespace Comfy::Studio
 		System.Gui.TargetButtonPathCurveSegments = 32;
 		System.Gui.TargetButtonPathMaxCount = 64;
 
+		System.UndoHistory.MemoryBudgetMB = 256;
+
 		// NOTE: This one is debatable...
 		System.Discord.EnableRichPresence = true;
 		System.Discord.ShareSongTitleAndArtist = true;
@@ -1852,6 +1871,7 @@ namespace Comfy::Studio
 		SaveAndLoad.AutoSaveMaxFiles = 120;
 		SaveAndLoad.AutoSaveBeforeDiscardingChanges = true;
 		SaveAndLoad.AutoSaveDirectory = "auto_save";
+		SaveAndLoad.CompactChartFileTargets = false;
 
 		{
 			using namespace Input;
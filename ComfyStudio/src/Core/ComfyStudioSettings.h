@@ -60,7 +60,7 @@ namespace Comfy::Studio
 	// NOTE: Loaded at startup but only saved when manually edited by the user via a settings window
 	struct ComfyStudioUserSettings
 	{
-		static constexpr SemanticVersion CurrentVersion = { 1, 42, 1 };
+		static constexpr SemanticVersion CurrentVersion = { 1, 44, 0 };
 
 		bool LoadFromFile(std::string_view filePath = ComfyStudioUserSettingsFilePath);
 		void SaveToFile(std::string_view filePath = ComfyStudioUserSettingsFilePath) const;
@@ -107,6 +107,12 @@ namespace Comfy::Studio
 				i32 TargetButtonPathMaxCount;
 			} Gui;
 
+			struct
+			{
+				// NOTE: Zero for an unlimited budget
+				i32 MemoryBudgetMB;
+			} UndoHistory;
+
 			struct
 			{
 				bool EnableRichPresence;
@@ -127,6 +133,7 @@ namespace Comfy::Studio
 			i32 AutoSaveMaxFiles;
 			bool AutoSaveBeforeDiscardingChanges;
 			std::string AutoSaveDirectory;
+			bool CompactChartFileTargets;
 		} SaveAndLoad;
 
 		struct // NOTE: Underscores in symbols are usually a big no go but definitely help with readability here quite a lot
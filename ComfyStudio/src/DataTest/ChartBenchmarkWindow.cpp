@@ -0,0 +1,695 @@
+#include "ChartBenchmarkWindow.h"
+#include "Editor/Chart/SortedTargetList.h"
+#include "Editor/Chart/SortedTempoMap.h"
+#include "Editor/Chart/Chart.h"
+#include "Editor/Chart/FileFormat/ComfyStudioChartFile.h"
+#include "IO/File.h"
+#include "IO/Stream/MemoryWriteStream.h"
+#include <random>
+#include <cstdio>
+
+namespace Comfy::Studio::DataTest
+{
+	using namespace Editor;
+
+	namespace
+	{
+		std::vector<TimelineTarget> GenerateUniqueShuffledTargets(i32 count, std::mt19937& random)
+		{
+			std::vector<TimelineTarget> targets;
+			targets.reserve(count);
+
+			// NOTE: Roughly resembling a dense chart with a target every 16th note and the occasional sync pair and slide chain
+			for (i32 i = 0; i < count; i++)
+			{
+				const auto tick = BeatTick::FromBars(1) / 16 * (i / 2);
+				const auto type = static_cast<ButtonType>(((i % 2) * 3 + random() % 3) % EnumCount<ButtonType>());
+
+				auto& target = targets.emplace_back(tick, type);
+				target.Flags.IsChain = IsSlideButtonType(type) && (random() % 2 == 0);
+			}
+
+			std::shuffle(targets.begin(), targets.end(), random);
+			return targets;
+		}
+
+		// NOTE: A handful of tempo and flying time changes to not only ever hit the first tempo segment
+		void SetBenchmarkTempoChanges(SortedTempoMap& outTempoMap)
+		{
+			outTempoMap = std::vector<TempoChange>
+			{
+				TempoChange(BeatTick::FromBars(0), Tempo(160.0f), FlyingTimeFactor(1.0f), TimeSignature(4, 4)),
+				TempoChange(BeatTick::FromBars(16), Tempo(200.0f), FlyingTimeFactor(0.5f), {}),
+				TempoChange(BeatTick::FromBars(48), Tempo(120.0f), FlyingTimeFactor(1.0f), {}),
+				TempoChange(BeatTick::FromBars(96), Tempo(180.0f), FlyingTimeFactor(2.0f), {}),
+			};
+			outTempoMap.RebuildAccelerationStructure();
+		}
+
+		// NOTE: Every third target gets properties, mostly on the compact quantization grid but with the occasional arbitrary value and negative zero
+		void AddBenchmarkTargetProperties(std::vector<TimelineTarget>& inOutTargets, std::mt19937& random)
+		{
+			auto arbitraryDistribution = std::uniform_real_distribution<f32>(-1000.0f, 1000.0f);
+			for (size_t i = 0; i < inOutTargets.size(); i += 3)
+			{
+				auto& target = inOutTargets[i];
+				target.Flags.HasProperties = true;
+				target.Properties.Position = vec2(static_cast<f32>(random() % 1920), static_cast<f32>(random() % 1080) + 0.25f);
+				target.Properties.Angle = static_cast<f32>(random() % 360) - 180.0f;
+				target.Properties.Frequency = (i % 2 == 0) ? -0.0f : 2.0f;
+				target.Properties.Amplitude = 500.0f;
+				target.Properties.Distance = (i % 9 == 0) ? arbitraryDistribution(random) : 1200.0f;
+			}
+		}
+
+		// NOTE: Only compares the fields that are actually stored inside a chart file, properties bit for bit
+		bool AllStoredTargetFieldsEqual(const SortedTargetList& targetsA, const SortedTargetList& targetsB)
+		{
+			if (targetsA.size() != targetsB.size())
+				return false;
+
+			for (size_t i = 0; i < targetsA.size(); i++)
+			{
+				const auto& a = targetsA[i];
+				const auto& b = targetsB[i];
+
+				if (a.Tick != b.Tick || a.Type != b.Type)
+					return false;
+				if (a.Flags.HasProperties != b.Flags.HasProperties || a.Flags.IsHold != b.Flags.IsHold || a.Flags.IsChain != b.Flags.IsChain || a.Flags.IsChance != b.Flags.IsChance)
+					return false;
+				if (std::memcmp(&a.Properties, &b.Properties, sizeof(TargetProperties)) != 0)
+					return false;
+			}
+
+			return true;
+		}
+
+		size_t WriteChartFileToMemory(ComfyStudioChartFile& chartFile, std::unique_ptr<u8[]>& outFileBuffer)
+		{
+			auto memoryStream = IO::MemoryWriteStream(outFileBuffer);
+			auto writer = IO::StreamWriter(memoryStream);
+			chartFile.Write(writer);
+
+			return static_cast<size_t>(memoryStream.GetLength());
+		}
+
+		std::unique_ptr<ComfyStudioChartFile> ReadChartFileFromMemory(const u8* fileBuffer, size_t fileSize)
+		{
+			IO::MemoryStream memoryStream;
+			memoryStream.FromBuffer(fileSize, [&](void* outData, size_t dataSize) { std::memcpy(outData, fileBuffer, dataSize); });
+
+			auto reader = IO::StreamReader(memoryStream);
+			auto chartFile = std::make_unique<ComfyStudioChartFile>();
+
+			if (chartFile->Read(reader) != IO::StreamResult::Success)
+				return nullptr;
+
+			return chartFile;
+		}
+
+		// NOTE: Far more tempo and flying time changes than any real chart would have, spaced a random number of bars apart
+		void SetRandomBenchmarkTempoChanges(SortedTempoMap& outTempoMap, i32 tempoChangeCount, std::mt19937& random)
+		{
+			auto tempoDistribution = std::uniform_real_distribution<f32>(60.0f, 300.0f);
+			auto flyingTimeDistribution = std::uniform_real_distribution<f32>(FlyingTimeFactor::Min, FlyingTimeFactor::Max);
+
+			std::vector<TempoChange> tempoChanges;
+			tempoChanges.reserve(tempoChangeCount);
+
+			for (i32 i = 0, bar = 0; i < tempoChangeCount; i++)
+			{
+				const auto tempo = Tempo(tempoDistribution(random));
+				const auto flyingTime = FlyingTimeFactor(flyingTimeDistribution(random));
+				const auto signature = (i == 0) ? std::optional<TimeSignature>(TimeSignature(4, 4)) : std::nullopt;
+
+				tempoChanges.emplace_back(BeatTick::FromBars(bar), tempo, flyingTime, signature);
+				bar += 1 + static_cast<i32>(random() % 8);
+			}
+
+			outTempoMap = std::move(tempoChanges);
+			outTempoMap.RebuildAccelerationStructure();
+		}
+
+		// NOTE: Reference implementation of the previous approach of pre calculating one time per tick up to the last tempo change.
+		//		 Ticks outside the table are extrapolated using the first and last tempo, same as the first and last acceleration structure segment
+		struct ReferenceTickTimeLookupTable
+		{
+			std::vector<TimeSpan> TickTimes;
+			f64 FirstTickDuration;
+			f64 LastTickDuration;
+
+			TimeSpan TickToTime(BeatTick tick) const
+			{
+				const i32 lastTableTick = static_cast<i32>(TickTimes.size()) - 1;
+
+				if (tick.Ticks() < 0)
+					return TimeSpan::FromSeconds(FirstTickDuration * tick.Ticks());
+				if (tick.Ticks() > lastTableTick)
+					return TimeSpan::FromSeconds(TickTimes[lastTableTick].TotalSeconds() + (LastTickDuration * (tick.Ticks() - lastTableTick)));
+
+				return TickTimes[tick.Ticks()];
+			}
+		};
+
+		void BuildReferenceTickTimeLookupTable(const SortedTempoMap& tempoMap, bool applyFlyingTimeFactor, ReferenceTickTimeLookupTable& outLookupTable)
+		{
+			auto& tickTimes = outLookupTable.TickTimes;
+			tickTimes.resize(tempoMap.GetRawView().back().Tick.Ticks() + 1);
+
+			f64 lastEndTime = 0.0;
+			tempoMap.ForEachNewOrInherited([&](const NewOrInheritedTempoChange& tempoChange)
+			{
+				const f64 tempoBPM = static_cast<f64>(tempoChange.Tempo.BeatsPerMinute);
+				const f64 bpm = (applyFlyingTimeFactor) ? (tempoBPM * static_cast<f64>(tempoChange.FlyingTime.Factor)) : tempoBPM;
+				const f64 tickDuration = ((60.0 / bpm) / BeatTick::TicksPerBeat);
+
+				const bool isSingleOrLastTempo = (tempoMap.Count() == 1) || (tempoChange.IndexWithinTempoMap == (tempoMap.Count() - 1));
+				const size_t timesCount = (isSingleOrLastTempo) ? (tickTimes.size()) : (tempoMap.GetRawViewAt(tempoChange.IndexWithinTempoMap + 1).Tick.Ticks());
+
+				for (size_t i = 0, t = tempoChange.Tick.Ticks(); t < timesCount; t++)
+					tickTimes[t] = TimeSpan::FromSeconds((tickDuration * i++) + lastEndTime);
+
+				if (tempoMap.Count() > 1)
+					lastEndTime = tickTimes[timesCount - 1].TotalSeconds() + tickDuration;
+
+				if (tempoChange.IndexWithinTempoMap == 0)
+					outLookupTable.FirstTickDuration = tickDuration;
+				outLookupTable.LastTickDuration = tickDuration;
+				return false;
+			});
+		}
+	}
+
+	ChartBenchmarkWindow::ChartBenchmarkWindow(ComfyStudioApplication& parent) : BaseWindow(parent)
+	{
+		Close();
+	}
+
+	const char* ChartBenchmarkWindow::GetName() const
+	{
+		return "Chart Benchmark";
+	}
+
+	ImGuiWindowFlags ChartBenchmarkWindow::GetFlags() const
+	{
+		return ImGuiWindowFlags_None;
+	}
+
+	void ChartBenchmarkWindow::Gui()
+	{
+		if (Gui::BeginTabBar("ChartBenchmarkWindowTabBar", ImGuiTabBarFlags_NoCloseWithMiddleMouseButton | ImGuiTabBarFlags_NoTooltip))
+		{
+			SortedTargetListTabItemGui();
+			VisibleRangeCullingTabItemGui();
+			PlayTestSimulationTabItemGui();
+			ChartFileEncodingTabItemGui();
+			TempoMapTabItemGui();
+			Gui::EndTabBar();
+		}
+	}
+
+	void ChartBenchmarkWindow::SortedTargetListTabItemGui()
+	{
+		if (Gui::BeginTabItem("Sorted Target List"))
+		{
+			Gui::InputInt("Target Count", &targetCount, 1000, 10000);
+			Gui::InputInt("Range Query Count", &rangeQueryCount, 100, 1000);
+			targetCount = Clamp(targetCount, 1, 1000000);
+			rangeQueryCount = Clamp(rangeQueryCount, 1, 1000000);
+
+			if (targetListBenchmark.RunButtonGui())
+				RunSortedTargetListBenchmark();
+
+			targetListBenchmark.ResultsTableGui();
+			Gui::EndTabItem();
+		}
+	}
+
+	void ChartBenchmarkWindow::RunSortedTargetListBenchmark()
+	{
+		targetListBenchmark.Clear();
+
+		auto random = std::mt19937(System::BenchmarkRandomSeed);
+		auto shuffledTargets = GenerateUniqueShuffledTargets(targetCount, random);
+		const auto halfTargets = std::vector<TimelineTarget>(shuffledTargets.begin(), shuffledTargets.begin() + (shuffledTargets.size() / 2));
+
+		{
+			SortedTargetList targetList;
+			targetListBenchmark.Run("Add() one by one", shuffledTargets.size(), [&]
+			{
+				for (const auto& target : shuffledTargets)
+					(void)targetList.Add(target);
+			});
+
+			targetListBenchmark.Run("Remove() one by one (half)", halfTargets.size(), [&]
+			{
+				for (const auto& target : halfTargets)
+					targetList.Remove(target);
+			});
+		}
+
+		{
+			SortedTargetList targetList;
+			targetListBenchmark.Run("AddRange()", shuffledTargets.size(), [&]
+			{
+				targetList.AddRange(shuffledTargets);
+			});
+
+			targetListBenchmark.Run("RemoveRange() (half)", halfTargets.size(), [&]
+			{
+				targetList.RemoveRange(halfTargets);
+			});
+
+			const auto lastTick = targetList.GetRawView().empty() ? BeatTick::Zero() : targetList.GetRawView().back().Tick;
+			std::vector<std::pair<BeatTick, BeatTick>> tickRanges;
+			tickRanges.reserve(rangeQueryCount);
+
+			for (i32 i = 0; i < rangeQueryCount; i++)
+			{
+				const auto startTick = BeatTick::FromTicks(static_cast<i32>(random() % static_cast<u32>(lastTick.Ticks() + 1)));
+				tickRanges.emplace_back(startTick, startTick + BeatTick::FromBars(4));
+			}
+
+			size_t linearFoundCount = 0, binaryFoundCount = 0;
+			targetListBenchmark.Run("Tick range query (linear scan)", tickRanges.size(), [&]
+			{
+				for (const auto&[startTick, endTick] : tickRanges)
+				{
+					for (const auto& target : targetList)
+						linearFoundCount += (target.Tick >= startTick && target.Tick <= endTick);
+				}
+			});
+
+			targetListBenchmark.Run("TargetsInTickRange()", tickRanges.size(), [&]
+			{
+				for (const auto&[startTick, endTick] : tickRanges)
+					binaryFoundCount += targetList.TargetsInTickRange(startTick, endTick).size();
+			});
+
+			assert(linearFoundCount == binaryFoundCount);
+		}
+	}
+
+	void ChartBenchmarkWindow::VisibleRangeCullingTabItemGui()
+	{
+		if (Gui::BeginTabItem("Visible Range Culling"))
+		{
+			Gui::InputInt("Target Count", &cullingTargetCount, 1000, 10000);
+			Gui::InputInt("Frame Count", &cullingFrameCount, 100, 1000);
+			cullingTargetCount = Clamp(cullingTargetCount, 1, 1000000);
+			cullingFrameCount = Clamp(cullingFrameCount, 1, 1000000);
+
+			if (cullingBenchmark.RunButtonGui())
+				RunVisibleRangeCullingBenchmark();
+
+			cullingBenchmark.ResultsTableGui();
+			Gui::EndTabItem();
+		}
+	}
+
+	void ChartBenchmarkWindow::RunVisibleRangeCullingBenchmark()
+	{
+		cullingBenchmark.Clear();
+
+		auto random = std::mt19937(System::BenchmarkRandomSeed);
+		auto shuffledTargets = GenerateUniqueShuffledTargets(cullingTargetCount, random);
+
+		SortedTargetList targetList;
+		targetList.AddRange(shuffledTargets);
+
+		SortedTempoMap tempoMap;
+		SetBenchmarkTempoChanges(tempoMap);
+
+		// NOTE: Emulating a timeline showing roughly two bars at a time and the default post hit linger duration
+		const auto lastTick = targetList.GetRawView().back().Tick;
+		const auto visibleTickSpan = BeatTick::FromBars(2);
+		const auto postHitLingerDuration = BeatTick::FromBars(1) / 16;
+
+		std::vector<BeatTick> frameCursorTicks;
+		frameCursorTicks.reserve(cullingFrameCount);
+		for (i32 i = 0; i < cullingFrameCount; i++)
+			frameCursorTicks.push_back(BeatTick::FromTicks(static_cast<i32>((static_cast<i64>(lastTick.Ticks()) * i) / cullingFrameCount)));
+
+		size_t linearTimelineCount = 0, culledTimelineCount = 0;
+		cullingBenchmark.Run("Timeline targets (linear scan)", frameCursorTicks.size(), [&]
+		{
+			for (const auto cursorTick : frameCursorTicks)
+			{
+				const auto minVisibleTime = tempoMap.TickToTime(cursorTick);
+				const auto maxVisibleTime = tempoMap.TickToTime(cursorTick + visibleTickSpan);
+
+				for (const auto& target : targetList)
+				{
+					const auto buttonTime = tempoMap.TickToTime(target.Tick);
+					if (buttonTime < minVisibleTime)
+						continue;
+					if (buttonTime > maxVisibleTime)
+						break;
+					linearTimelineCount++;
+				}
+			}
+		});
+
+		cullingBenchmark.Run("Timeline targets (TargetsInTickRange)", frameCursorTicks.size(), [&]
+		{
+			for (const auto cursorTick : frameCursorTicks)
+			{
+				const auto minVisibleTime = tempoMap.TickToTime(cursorTick);
+				const auto maxVisibleTime = tempoMap.TickToTime(cursorTick + visibleTickSpan);
+
+				for (const auto& target : targetList.TargetsInTickRange(cursorTick - BeatTick::FromTicks(1), cursorTick + visibleTickSpan + BeatTick::FromTicks(1)))
+				{
+					const auto buttonTime = tempoMap.TickToTime(target.Tick);
+					if (buttonTime < minVisibleTime)
+						continue;
+					if (buttonTime > maxVisibleTime)
+						break;
+					culledTimelineCount++;
+				}
+			}
+		});
+
+		assert(linearTimelineCount == culledTimelineCount);
+
+		size_t linearRenderWindowCount = 0, culledRenderWindowCount = 0;
+		const auto isTargetOnScreen = [&](const TimelineTarget& target, BeatTick cursorTick)
+		{
+			const auto spawnTimes = tempoMap.GetTargetSpawnTimes(target);
+			return (cursorTick >= spawnTimes.TargetTick && cursorTick <= (spawnTimes.ButtonTick + postHitLingerDuration));
+		};
+
+		cullingBenchmark.Run("Render window targets (linear scan)", frameCursorTicks.size(), [&]
+		{
+			for (const auto cursorTick : frameCursorTicks)
+			{
+				for (const auto& target : targetList)
+					linearRenderWindowCount += isTargetOnScreen(target, cursorTick);
+			}
+		});
+
+		cullingBenchmark.Run("Render window targets (GetOnScreenButtonTickRange)", frameCursorTicks.size(), [&]
+		{
+			for (const auto cursorTick : frameCursorTicks)
+			{
+				const auto[startTick, endTick] = tempoMap.GetOnScreenButtonTickRange(cursorTick, postHitLingerDuration);
+				for (const auto& target : targetList.TargetsInTickRange(startTick, endTick))
+					culledRenderWindowCount += isTargetOnScreen(target, cursorTick);
+			}
+		});
+
+		assert(linearRenderWindowCount == culledRenderWindowCount);
+	}
+
+	void ChartBenchmarkWindow::PlayTestSimulationTabItemGui()
+	{
+		if (Gui::BeginTabItem("Play Test Simulation"))
+		{
+			Gui::InputInt("Target Count", &playTestTargetCount, 1000, 10000);
+			Gui::InputInt("Restart Count", &playTestRestartCount, 100, 1000);
+			playTestTargetCount = Clamp(playTestTargetCount, 1, 1000000);
+			playTestRestartCount = Clamp(playTestRestartCount, 1, 1000000);
+
+			if (playTestBenchmark.RunButtonGui())
+				RunPlayTestSimulationBenchmark();
+
+			if (lastHeadlessAutoplayResult.has_value())
+			{
+				const auto& result = lastHeadlessAutoplayResult.value();
+				Gui::Text("Headless autoplay: %u frames simulating %.2f s in %.3f ms (%.1fx real time)", result.SimulatedFrameCount,
+					result.SimulatedDuration.TotalSeconds(), result.WallTime.TotalMilliseconds(), result.SimulatedDuration / Max(result.WallTime, TimeSpan::FromSeconds(0.000001)));
+				Gui::Text("Evaluated %u targets in %u pairs, %u cool, %u worst, max combo %d, chain slide score %d", result.EvaluatedTargetCount, result.EvaluatedPairCount,
+					result.EvaluationCounts[static_cast<size_t>(HitEvaluation::Cool)], result.EvaluationCounts[static_cast<size_t>(HitEvaluation::Worst)], result.MaxComboCount, result.TotalChainSlideScore);
+			}
+
+			playTestBenchmark.ResultsTableGui();
+			Gui::EndTabItem();
+		}
+	}
+
+	void ChartBenchmarkWindow::RunPlayTestSimulationBenchmark()
+	{
+		playTestBenchmark.Clear();
+
+		auto random = std::mt19937(System::BenchmarkRandomSeed);
+		auto shuffledTargets = GenerateUniqueShuffledTargets(playTestTargetCount, random);
+
+		Chart chart;
+		chart.Targets.AddRange(shuffledTargets);
+		SetBenchmarkTempoChanges(chart.TempoMap);
+
+		const auto lastButtonTime = chart.TempoMap.TickToTime(chart.Targets.GetRawView().back().Tick);
+
+		std::vector<TimeSpan> restartTimes;
+		restartTimes.reserve(playTestRestartCount);
+		for (i32 i = 0; i < playTestRestartCount; i++)
+			restartTimes.push_back(TimeSpan::FromSeconds(lastButtonTime.TotalSeconds() * static_cast<f64>(random() % 1000) / 1000.0));
+
+		PlayTestTargetTimeline targetTimeline;
+		PlayTestSimulation simulation;
+
+		// NOTE: Equivalent to the amount of work previously done by each restart, converting the entire chart to playtest targets
+		playTestBenchmark.Run("Restart (timeline rebuild)", restartTimes.size(), [&]
+		{
+			for (const auto restartTime : restartTimes)
+			{
+				targetTimeline.Rebuild(chart);
+				simulation.Restart(targetTimeline, restartTime);
+			}
+		});
+
+		playTestBenchmark.Run("Restart (timeline seek)", restartTimes.size(), [&]
+		{
+			for (const auto restartTime : restartTimes)
+				simulation.Restart(targetTimeline, restartTime);
+		});
+
+		HeadlessAutoplayResult autoplayResult = {};
+		playTestBenchmark.Run("Headless autoplay (full chart)", 1, [&]
+		{
+			autoplayResult = SimulateHeadlessAutoplay(chart);
+		});
+
+		lastHeadlessAutoplayResult = autoplayResult;
+	}
+
+	void ChartBenchmarkWindow::ChartFileEncodingTabItemGui()
+	{
+		if (Gui::BeginTabItem("Chart File Encoding"))
+		{
+			Gui::InputInt("Target Count", &chartFileTargetCount, 1000, 10000);
+			Gui::InputInt("Iteration Count", &chartFileIterationCount, 1, 10);
+			chartFileTargetCount = Clamp(chartFileTargetCount, 1, 1000000);
+			chartFileIterationCount = Clamp(chartFileIterationCount, 1, 1000);
+
+			if (chartFileBenchmark.RunButtonGui())
+				RunChartFileEncodingBenchmark();
+
+			if (lastChartFileEncodingSummary.has_value())
+			{
+				const auto& summary = lastChartFileEncodingSummary.value();
+				Gui::Text("File size: %zu bytes (columns), %zu bytes (compact, %.1f%%)", summary.ColumnsByteSize, summary.CompactByteSize,
+					static_cast<f64>(summary.CompactByteSize) / static_cast<f64>(Max<size_t>(summary.ColumnsByteSize, 1)) * 100.0);
+				Gui::Text("Round trip: %s (columns), %s (compact)", summary.ColumnsRoundTripLossless ? "Lossless" : "MISMATCH", summary.CompactRoundTripLossless ? "Lossless" : "MISMATCH");
+			}
+
+			chartFileBenchmark.ResultsTableGui();
+			Gui::EndTabItem();
+		}
+	}
+
+	void ChartBenchmarkWindow::RunChartFileEncodingBenchmark()
+	{
+		chartFileBenchmark.Clear();
+
+		auto random = std::mt19937(System::BenchmarkRandomSeed);
+		auto shuffledTargets = GenerateUniqueShuffledTargets(chartFileTargetCount, random);
+		AddBenchmarkTargetProperties(shuffledTargets, random);
+
+		Chart chart;
+		chart.Targets.AddRange(shuffledTargets);
+		SetBenchmarkTempoChanges(chart.TempoMap);
+		chart.Properties.Song.Title = "Chart File Encoding Benchmark";
+
+		// NOTE: Overwritten by every run and deleted again at the end
+		const std::string tempFilePath = std::string("chart_file_encoding_benchmark") + std::string(ComfyStudioChartFile::Extension);
+
+		const auto iterations = static_cast<size_t>(chartFileIterationCount);
+		ChartFileEncodingSummary summary = {};
+
+		for (const auto encoding : { ChartFileTargetEncoding::Columns, ChartFileTargetEncoding::Compact })
+		{
+			const std::string encodingSuffix = (encoding == ChartFileTargetEncoding::Compact) ? " (compact)" : " (columns)";
+
+			std::unique_ptr<u8[]> fileBuffer;
+			size_t fileSize = 0;
+
+			chartFileBenchmark.Run("Save to memory" + encodingSuffix, iterations, [&]
+			{
+				for (size_t i = 0; i < iterations; i++)
+				{
+					ComfyStudioChartFile chartFile(chart, encoding);
+					fileSize = WriteChartFileToMemory(chartFile, fileBuffer);
+				}
+			});
+
+			std::unique_ptr<Chart> roundTripChart;
+			chartFileBenchmark.Run("Load from memory" + encodingSuffix, iterations, [&]
+			{
+				for (size_t i = 0; i < iterations; i++)
+				{
+					auto chartFile = ReadChartFileFromMemory(fileBuffer.get(), fileSize);
+					roundTripChart = (chartFile != nullptr && chartFile->GetTargetEncoding() == encoding) ? chartFile->MoveToChart() : nullptr;
+				}
+			});
+
+			const bool roundTripLossless = (roundTripChart != nullptr) && AllStoredTargetFieldsEqual(chart.Targets, roundTripChart->Targets) && (chart.TempoMap.Count() == roundTripChart->TempoMap.Count());
+			assert(roundTripLossless);
+
+			if (encoding == ChartFileTargetEncoding::Compact)
+			{
+				summary.CompactByteSize = fileSize;
+				summary.CompactRoundTripLossless = roundTripLossless;
+			}
+			else
+			{
+				summary.ColumnsByteSize = fileSize;
+				summary.ColumnsRoundTripLossless = roundTripLossless;
+			}
+
+			chartFileBenchmark.Run("Save to file (per value writes)" + encodingSuffix, iterations, [&]
+			{
+				for (size_t i = 0; i < iterations; i++)
+				{
+					ComfyStudioChartFile chartFile(chart, encoding);
+					IO::File::Save(tempFilePath, chartFile);
+				}
+			});
+
+			chartFileBenchmark.Run("Save to file (single buffered write)" + encodingSuffix, iterations, [&]
+			{
+				for (size_t i = 0; i < iterations; i++)
+				{
+					ComfyStudioChartFile chartFile(chart, encoding);
+					IO::File::SaveBuffered(tempFilePath, chartFile);
+				}
+			});
+
+			chartFileBenchmark.Run("Load from file" + encodingSuffix, iterations, [&]
+			{
+				for (size_t i = 0; i < iterations; i++)
+				{
+					if (auto chartFile = IO::File::Load<ComfyStudioChartFile>(tempFilePath); chartFile != nullptr)
+						roundTripChart = chartFile->MoveToChart();
+				}
+			});
+		}
+
+		std::remove(tempFilePath.c_str());
+		lastChartFileEncodingSummary = summary;
+	}
+
+	void ChartBenchmarkWindow::TempoMapTabItemGui()
+	{
+		if (Gui::BeginTabItem("Tempo Map"))
+		{
+			Gui::InputInt("Tempo Change Count", &tempoMapChangeCount, 16, 256);
+			Gui::InputInt("Rebuild Count", &tempoMapRebuildCount, 10, 100);
+			tempoMapChangeCount = Clamp(tempoMapChangeCount, 1, 4096);
+			tempoMapRebuildCount = Clamp(tempoMapRebuildCount, 1, 10000);
+
+			if (tempoMapBenchmark.RunButtonGui())
+				RunTempoMapBenchmark();
+
+			if (lastTempoMapSummary.has_value())
+			{
+				const auto& summary = lastTempoMapSummary.value();
+				Gui::Text("Lookup table size: %zu ticks", summary.LookupTableTickCount);
+				Gui::Text("Segments vs lookup table: %s (max deviation: %.3f ns, max round trip error: %d ticks)", summary.SegmentsMatchLookupTable ? "Equivalent" : "MISMATCH",
+					summary.MaxTickTimeDeviation * 1000000000.0, summary.MaxRoundTripTickError);
+			}
+
+			tempoMapBenchmark.ResultsTableGui();
+			Gui::EndTabItem();
+		}
+	}
+
+	void ChartBenchmarkWindow::RunTempoMapBenchmark()
+	{
+		tempoMapBenchmark.Clear();
+
+		auto random = std::mt19937(System::BenchmarkRandomSeed);
+		SortedTempoMap tempoMap;
+		SetRandomBenchmarkTempoChanges(tempoMap, tempoMapChangeCount, random);
+
+		const auto rebuildIterations = static_cast<size_t>(tempoMapRebuildCount);
+		TempoMapSummary summary = {};
+
+		for (const bool applyFlyingTimeFactor : { false, true })
+		{
+			const std::string flyingTimeSuffix = (applyFlyingTimeFactor) ? " (flying time)" : " (tempo)";
+
+			ReferenceTickTimeLookupTable lookupTable;
+			tempoMapBenchmark.Run("Per tick lookup table build" + flyingTimeSuffix, rebuildIterations, [&]
+			{
+				for (size_t i = 0; i < rebuildIterations; i++)
+					BuildReferenceTickTimeLookupTable(tempoMap, applyFlyingTimeFactor, lookupTable);
+			});
+
+			TempoMapAccelerationStructure accelerationStructure;
+			accelerationStructure.SetApplyFlyingTimeFactor(applyFlyingTimeFactor);
+
+			tempoMapBenchmark.Run("Segment Rebuild()" + flyingTimeSuffix, rebuildIterations, [&]
+			{
+				for (size_t i = 0; i < rebuildIterations; i++)
+					accelerationStructure.Rebuild(tempoMap);
+			});
+
+			tempoMapBenchmark.Run("Segment RebuildFrom() (last tempo change)" + flyingTimeSuffix, rebuildIterations, [&]
+			{
+				for (size_t i = 0; i < rebuildIterations; i++)
+					accelerationStructure.RebuildFrom(tempoMap, tempoMap.Count() - 1);
+			});
+
+			// NOTE: Every tick covered by the lookup table plus a few bars of extrapolation in either direction
+			const i32 firstTick = -BeatTick::FromBars(4).Ticks();
+			const i32 lastTick = static_cast<i32>(lookupTable.TickTimes.size()) - 1 + BeatTick::FromBars(4).Ticks();
+			const auto tickCount = static_cast<size_t>(lastTick - firstTick + 1);
+
+			std::vector<TimeSpan> lookupTableTimes(tickCount), segmentTimes(tickCount);
+			std::vector<BeatTick> roundTripTicks(tickCount);
+
+			tempoMapBenchmark.Run("Tick to time (lookup table)" + flyingTimeSuffix, tickCount, [&]
+			{
+				for (i32 tick = firstTick; tick <= lastTick; tick++)
+					lookupTableTimes[tick - firstTick] = lookupTable.TickToTime(BeatTick(tick));
+			});
+
+			tempoMapBenchmark.Run("Tick to time (segment binary search)" + flyingTimeSuffix, tickCount, [&]
+			{
+				for (i32 tick = firstTick; tick <= lastTick; tick++)
+					segmentTimes[tick - firstTick] = accelerationStructure.ConvertTickToTimeUsingSegmentBinarySearch(BeatTick(tick));
+			});
+
+			tempoMapBenchmark.Run("Time to tick (segment binary search)" + flyingTimeSuffix, tickCount, [&]
+			{
+				for (size_t i = 0; i < tickCount; i++)
+					roundTripTicks[i] = accelerationStructure.ConvertTimeToTickUsingSegmentBinarySearch(segmentTimes[i]);
+			});
+
+			for (size_t i = 0; i < tickCount; i++)
+			{
+				const i32 tick = firstTick + static_cast<i32>(i);
+				summary.MaxTickTimeDeviation = Max(summary.MaxTickTimeDeviation, glm::abs(segmentTimes[i].TotalSeconds() - lookupTableTimes[i].TotalSeconds()));
+				summary.MaxRoundTripTickError = Max(summary.MaxRoundTripTickError, glm::abs(roundTripTicks[i].Ticks() - tick));
+			}
+
+			summary.LookupTableTickCount = lookupTable.TickTimes.size();
+		}
+
+		// NOTE: Both approaches accumulate the same tick durations in a slightly different order so only tiny floating point differences are expected
+		summary.SegmentsMatchLookupTable = (summary.MaxTickTimeDeviation < 0.000001) && (summary.MaxRoundTripTickError <= 1);
+		assert(summary.SegmentsMatchLookupTable);
+
+		lastTempoMapSummary = summary;
+	}
+}
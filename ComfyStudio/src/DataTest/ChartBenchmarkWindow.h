@@ -0,0 +1,78 @@
+#pragma once
+#include "Types.h"
+#include "Core/BaseWindow.h"
+#include "Time/TimeSpan.h"
+#include "System/Profiling/BenchmarkRunner.h"
+#include "Editor/Chart/Gameplay/PlayTestSimulation.h"
+
+namespace Comfy::Studio::DataTest
+{
+	// NOTE: Synthetic chart data benchmarks for measuring editor data structures independent of any loaded chart
+	class ChartBenchmarkWindow : public BaseWindow
+	{
+	public:
+		ChartBenchmarkWindow(ComfyStudioApplication&);
+		~ChartBenchmarkWindow() = default;
+
+	public:
+		const char* GetName() const override;
+		ImGuiWindowFlags GetFlags() const override;
+		void Gui() override;
+
+	private:
+		void SortedTargetListTabItemGui();
+		void RunSortedTargetListBenchmark();
+
+		void VisibleRangeCullingTabItemGui();
+		void RunVisibleRangeCullingBenchmark();
+
+		void PlayTestSimulationTabItemGui();
+		void RunPlayTestSimulationBenchmark();
+
+		void ChartFileEncodingTabItemGui();
+		void RunChartFileEncodingBenchmark();
+
+		void TempoMapTabItemGui();
+		void RunTempoMapBenchmark();
+
+	private:
+		i32 targetCount = 10000;
+		i32 rangeQueryCount = 1000;
+		System::BenchmarkRunner targetListBenchmark;
+
+		i32 cullingTargetCount = 5000;
+		i32 cullingFrameCount = 1000;
+		System::BenchmarkRunner cullingBenchmark;
+
+		i32 playTestTargetCount = 5000;
+		i32 playTestRestartCount = 1000;
+		System::BenchmarkRunner playTestBenchmark;
+		std::optional<Editor::HeadlessAutoplayResult> lastHeadlessAutoplayResult;
+
+		struct ChartFileEncodingSummary
+		{
+			size_t ColumnsByteSize;
+			size_t CompactByteSize;
+			bool ColumnsRoundTripLossless;
+			bool CompactRoundTripLossless;
+		};
+
+		i32 chartFileTargetCount = 20000;
+		i32 chartFileIterationCount = 10;
+		System::BenchmarkRunner chartFileBenchmark;
+		std::optional<ChartFileEncodingSummary> lastChartFileEncodingSummary;
+
+		struct TempoMapSummary
+		{
+			size_t LookupTableTickCount;
+			f64 MaxTickTimeDeviation;
+			i32 MaxRoundTripTickError;
+			bool SegmentsMatchLookupTable;
+		};
+
+		i32 tempoMapChangeCount = 256;
+		i32 tempoMapRebuildCount = 100;
+		System::BenchmarkRunner tempoMapBenchmark;
+		std::optional<TempoMapSummary> lastTempoMapSummary;
+	};
+}
@@ -0,0 +1,102 @@
+#include "LogViewerWindow.h"
+#include "Core/ComfyStudioApplication.h"
+
+namespace Comfy::Studio::DataTest
+{
+	namespace
+	{
+		constexpr std::array<vec4, EnumCount<LogLevel>()> LogLevelTextColors =
+		{
+			vec4(0.60f, 0.60f, 0.60f, 1.00f),
+			vec4(1.00f, 1.00f, 1.00f, 1.00f),
+			vec4(0.95f, 0.78f, 0.12f, 1.00f),
+			vec4(0.95f, 0.12f, 0.12f, 1.00f),
+		};
+	}
+
+	// NOTE: Only messages logged after the window has been created are captured
+	LogViewerWindow::LogViewerWindow(ComfyStudioApplication& parent) : BaseWindow(parent), memorySink(std::make_shared<MemoryLogSink>())
+	{
+		Logger::AddSink(memorySink);
+		Close();
+	}
+
+	LogViewerWindow::~LogViewerWindow()
+	{
+		Logger::RemoveSink(memorySink.get());
+	}
+
+	const char* LogViewerWindow::GetName() const
+	{
+		return "Log Viewer";
+	}
+
+	ImGuiWindowFlags LogViewerWindow::GetFlags() const
+	{
+		return ImGuiWindowFlags_None;
+	}
+
+	void LogViewerWindow::Gui()
+	{
+		for (size_t i = 0; i < visibleLevels.size(); i++)
+		{
+			Gui::PushStyleColor(ImGuiCol_Text, LogLevelTextColors[i]);
+			filterChanged |= Gui::Checkbox(LogLevelNames[i], &visibleLevels[i]);
+			Gui::PopStyleColor();
+			Gui::SameLine();
+		}
+
+		Gui::Checkbox("Auto Scroll", &autoScroll);
+		Gui::SameLine();
+		if (Gui::Button("Clear"))
+			memorySink->Clear();
+		Gui::SameLine();
+		if (Gui::Button("Flush"))
+			Logger::Flush();
+
+		filterChanged |= textFilter.Draw("Filter");
+		UpdateFilteredLines();
+
+		Gui::BeginChild("LogViewerLinesChild", vec2(0.0f, 0.0f), true, ImGuiWindowFlags_HorizontalScrollbar);
+		{
+			ImGuiListClipper clipper; clipper.Begin(static_cast<i32>(filteredLineIndices.size()));
+			while (clipper.Step())
+			{
+				for (i32 i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+				{
+					const auto& line = copiedLines[filteredLineIndices[i]];
+					Gui::PushStyleColor(ImGuiCol_Text, LogLevelTextColors[static_cast<size_t>(line.Level)]);
+					Gui::TextUnformatted(line.Text.data(), line.Text.data() + line.Text.size());
+					Gui::PopStyleColor();
+				}
+			}
+
+			if (autoScroll && Gui::GetScrollY() >= Gui::GetScrollMaxY())
+				Gui::SetScrollHereY(1.0f);
+		}
+		Gui::EndChild();
+	}
+
+	void LogViewerWindow::UpdateFilteredLines()
+	{
+		const u32 sinkVersion = memorySink->GetVersion();
+		if (sinkVersion != lastCopiedVersion)
+		{
+			memorySink->CopyLines(copiedLines);
+			lastCopiedVersion = sinkVersion;
+			filterChanged = true;
+		}
+
+		if (!filterChanged)
+			return;
+
+		filteredLineIndices.clear();
+		for (u32 i = 0; i < static_cast<u32>(copiedLines.size()); i++)
+		{
+			const auto& line = copiedLines[i];
+			if (visibleLevels[static_cast<size_t>(line.Level)] && textFilter.PassFilter(line.Text.data(), line.Text.data() + line.Text.size()))
+				filteredLineIndices.push_back(i);
+		}
+		filterChanged = false;
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "Types.h"
+#include "Core/BaseWindow.h"
+#include "Core/Logger.h"
+
+namespace Comfy::Studio::DataTest
+{
+	class LogViewerWindow : public BaseWindow
+	{
+	public:
+		LogViewerWindow(ComfyStudioApplication&);
+		~LogViewerWindow();
+
+	public:
+		const char* GetName() const override;
+		ImGuiWindowFlags GetFlags() const override;
+		void Gui() override;
+
+	private:
+		void UpdateFilteredLines();
+
+	private:
+		std::shared_ptr<MemoryLogSink> memorySink;
+
+		u32 lastCopiedVersion = 0;
+		std::vector<MemoryLogSink::Line> copiedLines;
+		std::vector<u32> filteredLineIndices;
+
+		ImGuiTextFilter textFilter;
+		std::array<bool, EnumCount<LogLevel>()> visibleLevels = { true, true, true, true };
+		bool autoScroll = true;
+		bool filterChanged = true;
+	};
+}
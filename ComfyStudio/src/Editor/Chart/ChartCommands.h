@@ -112,19 +112,17 @@ namespace Comfy::Studio::Editor
 	public:
 		void Undo() override
 		{
-			for (const auto& target : targets)
-				chart.Targets.Remove(target);
+			chart.Targets.RemoveRange(targets);
 		}
 
 		void Redo() override
 		{
-			// TODO: Optimizations for working on known size lists
-			for (auto& target : targets)
-				target.ID = chart.Targets.Add(target);
+			chart.Targets.AddRange(targets);
 		}
 
 		Undo::MergeResult TryMerge(Command& commandToMerge) override { return Undo::MergeResult::Failed; }
 		std::string_view GetName() const override { return "Add Targets"; }
+		size_t GetDynamicMemoryUsage() const override { return Undo::GetVectorMemoryUsage(targets); }
 
 	private:
 		Chart& chart;
@@ -165,18 +163,17 @@ namespace Comfy::Studio::Editor
 	public:
 		void Undo() override
 		{
-			for (auto& target : targets)
-				target.ID = chart.Targets.Add(target);
+			chart.Targets.AddRange(targets);
 		}
 
 		void Redo() override
 		{
-			for (auto& target : targets)
-				chart.Targets.Remove(target);
+			chart.Targets.RemoveRange(targets);
 		}
 
 		Undo::MergeResult TryMerge(Command& commandToMerge) override { return Undo::MergeResult::Failed; }
 		std::string_view GetName() const override { return "Remove Targets"; }
+		size_t GetDynamicMemoryUsage() const override { return Undo::GetVectorMemoryUsage(targets); }
 
 	private:
 		Chart& chart;
@@ -213,7 +210,7 @@ namespace Comfy::Studio::Editor
 		void Undo() override
 		{
 			for (const auto& data : targetData)
-				chart.Targets[chart.Targets.FindIndex(data.ID)].Type = data.OldValue;
+				chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID)).Type = data.OldValue;
 			if (!targetData.empty())
 				chart.Targets.ExplicitlyUpdateFlagsAndSortEverything();
 		}
@@ -221,7 +218,7 @@ namespace Comfy::Studio::Editor
 		void Redo() override
 		{
 			for (const auto& data : targetData)
-				chart.Targets[chart.Targets.FindIndex(data.ID)].Type = data.NewValue;
+				chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID)).Type = data.NewValue;
 			if (!targetData.empty())
 				chart.Targets.ExplicitlyUpdateFlagsAndSortEverything();
 		}
@@ -248,6 +245,7 @@ namespace Comfy::Studio::Editor
 		}
 
 		std::string_view GetName() const override { return "Change Target Types"; }
+		size_t GetDynamicMemoryUsage() const override { return Undo::GetVectorMemoryUsage(targetData); }
 
 	private:
 		Chart& chart;
@@ -284,7 +282,7 @@ namespace Comfy::Studio::Editor
 		void Undo() override
 		{
 			for (const auto& data : targetData)
-				chart.Targets[chart.Targets.FindIndex(data.ID)].Tick = data.OldValue;
+				chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID)).Tick = data.OldValue;
 			if (!targetData.empty())
 				chart.Targets.ExplicitlyUpdateFlagsAndSortEverything();
 		}
@@ -292,7 +290,7 @@ namespace Comfy::Studio::Editor
 		void Redo() override
 		{
 			for (const auto& data : targetData)
-				chart.Targets[chart.Targets.FindIndex(data.ID)].Tick = data.NewValue;
+				chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID)).Tick = data.NewValue;
 			if (!targetData.empty())
 				chart.Targets.ExplicitlyUpdateFlagsAndSortEverything();
 		}
@@ -319,6 +317,7 @@ namespace Comfy::Studio::Editor
 		}
 
 		std::string_view GetName() const override { return "Change Target Times"; }
+		size_t GetDynamicMemoryUsage() const override { return Undo::GetVectorMemoryUsage(targetData); }
 
 	private:
 		Chart& chart;
@@ -368,7 +367,7 @@ namespace Comfy::Studio::Editor
 		{
 			for (auto& data : targetData)
 			{
-				auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
+				const auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
 				data.HadProperties = target.Flags.HasProperties;
 				data.OldValue = target.Properties;
 			}
@@ -377,9 +376,27 @@ namespace Comfy::Studio::Editor
 	public:
 		void Undo() override
 		{
+			if (isCompacted)
+			{
+				const size_t valuesPerTarget = GetCompactValuesPerTarget();
+				for (size_t i = 0; i < compactData.IDs.size(); i++)
+				{
+					auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(compactData.IDs[i]));
+					const f32* oldValues = compactData.Values.data() + (i * valuesPerTarget);
+
+					target.Flags.HasProperties = compactData.HadProperties[i];
+					for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+					{
+						if (propertyFlags & (1 << p))
+							target.Properties[p] = *oldValues++;
+					}
+				}
+				return;
+			}
+
 			for (const auto& data : targetData)
 			{
-				auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
+				auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID));
 				for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
 				{
 					if (propertyFlags & (1 << p))
@@ -393,9 +410,32 @@ namespace Comfy::Studio::Editor
 
 		void Redo() override
 		{
+			if (isCompacted)
+			{
+				const size_t valuesPerTarget = GetCompactValuesPerTarget();
+				for (size_t i = 0; i < compactData.IDs.size(); i++)
+				{
+					auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(compactData.IDs[i]));
+					const f32* newValues = compactData.Values.data() + (i * valuesPerTarget) + (valuesPerTarget / 2);
+
+					if (!compactData.HadProperties[i])
+					{
+						target.Properties = Rules::Detail::PresetTargetProperties(target);
+						target.Flags.HasProperties = true;
+					}
+
+					for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+					{
+						if (propertyFlags & (1 << p))
+							target.Properties[p] = *newValues++;
+					}
+				}
+				return;
+			}
+
 			for (const auto& data : targetData)
 			{
-				auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
+				auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID));
 
 				if (!data.HadProperties)
 				{
@@ -417,6 +457,10 @@ namespace Comfy::Studio::Editor
 			if (&other->chart != &chart || other->propertyFlags != propertyFlags)
 				return Undo::MergeResult::Failed;
 
+			// NOTE: Can only happen after having been undone and redone back to the top of the undo stack
+			if (isCompacted || other->isCompacted)
+				return Undo::MergeResult::Failed;
+
 			if (other->targetData.size() != targetData.size())
 				return Undo::MergeResult::Failed;
 
@@ -434,10 +478,85 @@ namespace Comfy::Studio::Editor
 
 		std::string_view GetName() const override { return "Change Target Properties"; }
 
+		size_t GetDynamicMemoryUsage() const override
+		{
+			return Undo::GetVectorMemoryUsage(targetData) + Undo::GetVectorMemoryUsage(compactData.IDs) + (compactData.HadProperties.capacity() / 8) + Undo::GetVectorMemoryUsage(compactData.Values);
+		}
+
+		void Compact() override
+		{
+			if (isCompacted)
+				return;
+
+			// NOTE: Only the flagged property components are ever read so the full old / new TargetProperties copies are packed down
+			//		 into a flat [old..., new...] array per target. Targets which already had properties and whose values didn't change are dropped entirely
+			const size_t valuesPerTarget = GetCompactValuesPerTarget();
+			size_t changedTargetCount = 0;
+			for (const auto& data : targetData)
+				changedTargetCount += DataChangesTarget(data);
+
+			compactData.IDs.reserve(changedTargetCount);
+			compactData.HadProperties.reserve(changedTargetCount);
+			compactData.Values.reserve(changedTargetCount * valuesPerTarget);
+
+			for (const auto& data : targetData)
+			{
+				if (!DataChangesTarget(data))
+					continue;
+
+				compactData.IDs.push_back(data.ID);
+				compactData.HadProperties.push_back(data.HadProperties);
+				for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+				{
+					if (propertyFlags & (1 << p))
+						compactData.Values.push_back(data.OldValue[p]);
+				}
+				for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+				{
+					if (propertyFlags & (1 << p))
+						compactData.Values.push_back(data.NewValue[p]);
+				}
+			}
+
+			// NOTE: Swap with an empty vector to actually free the memory
+			std::vector<Data>().swap(targetData);
+			isCompacted = true;
+		}
+
+	private:
+		size_t GetCompactValuesPerTarget() const
+		{
+			size_t flaggedPropertyCount = 0;
+			for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+				flaggedPropertyCount += ((propertyFlags & (1 << p)) != 0);
+			return (flaggedPropertyCount * 2);
+		}
+
+		bool DataChangesTarget(const Data& data) const
+		{
+			if (!data.HadProperties)
+				return true;
+
+			for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+			{
+				if ((propertyFlags & (1 << p)) && (data.NewValue[p] != data.OldValue[p]))
+					return true;
+			}
+			return false;
+		}
+
 	private:
 		Chart& chart;
 		std::vector<Data> targetData;
 		TargetPropertyFlags propertyFlags;
+
+		bool isCompacted = false;
+		struct CompactData
+		{
+			std::vector<TimelineTargetID> IDs;
+			std::vector<bool> HadProperties;
+			std::vector<f32> Values;
+		} compactData;
 	};
 
 	class ChangeTargetListPositions : public ChangeTargetListProperties
@@ -602,7 +721,7 @@ namespace Comfy::Studio::Editor
 		{
 			for (const auto& data : targetData)
 			{
-				auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
+				auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID));
 				target.Flags.HasProperties = data.HadProperties;
 				target.Properties = data.OldProperties;
 			}
@@ -612,7 +731,7 @@ namespace Comfy::Studio::Editor
 		{
 			for (const auto& data : targetData)
 			{
-				auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
+				auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID));
 
 				if (target.Flags.HasProperties != newHasProperties)
 				{
@@ -628,6 +747,7 @@ namespace Comfy::Studio::Editor
 		}
 
 		std::string_view GetName() const override { return "Change Targets Use Presets"; }
+		size_t GetDynamicMemoryUsage() const override { return Undo::GetVectorMemoryUsage(targetData); }
 
 	private:
 		Chart& chart;
@@ -660,7 +780,7 @@ namespace Comfy::Studio::Editor
 		{
 			for (const auto& data : targetData)
 			{
-				auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
+				auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID));
 				target.Flags.IsHold = data.OldValue;
 			}
 		}
@@ -669,7 +789,7 @@ namespace Comfy::Studio::Editor
 		{
 			for (const auto& data : targetData)
 			{
-				auto& target = chart.Targets[chart.Targets.FindIndex(data.ID)];
+				auto& target = chart.Targets.GetMutable(chart.Targets.FindIndex(data.ID));
 				target.Flags.IsHold = data.NewValue;
 			}
 		}
@@ -680,6 +800,7 @@ namespace Comfy::Studio::Editor
 		}
 
 		std::string_view GetName() const override { return "Change Target Holds"; }
+		size_t GetDynamicMemoryUsage() const override { return Undo::GetVectorMemoryUsage(targetData); }
 
 	private:
 		Chart& chart;
@@ -811,13 +932,13 @@ namespace Comfy::Studio::Editor
 		void Undo() override
 		{
 			chart.TempoMap.ChangeExistingTempoChangeTick(tempoChangeIndex, oldTick);
-			chart.TempoMap.RebuildAccelerationStructure();
+			chart.TempoMap.RebuildAccelerationStructureFrom(tempoChangeIndex);
 		}
 
 		void Redo() override
 		{
 			chart.TempoMap.ChangeExistingTempoChangeTick(tempoChangeIndex, newTick);
-			chart.TempoMap.RebuildAccelerationStructure();
+			chart.TempoMap.RebuildAccelerationStructureFrom(tempoChangeIndex);
 		}
 
 		Undo::MergeResult TryMerge(Command& commandToMerge) override
@@ -39,6 +39,11 @@ namespace Comfy::Studio::Editor
 		constexpr std::string_view ComfyAutoSaveFilePrefix = "comfy_auto_save_";
 		constexpr std::string_view ComfyAutoSaveFileExtension = ComfyStudioChartFile::Extension;
 
+		ChartFileTargetEncoding GetUserChartFileTargetEncoding()
+		{
+			return GlobalUserData.SaveAndLoad.CompactChartFileTargets ? ChartFileTargetEncoding::Compact : ChartFileTargetEncoding::Columns;
+		}
+
 		std::string MakeRelativeAutoSaveDirectoryAbsolute(std::string_view relativeDirectory)
 		{
 			if (relativeDirectory.empty())
@@ -169,6 +174,7 @@ namespace Comfy::Studio::Editor
 			CheckAutoSaveStopwatchAndDoAsyncAutoSave();
 
 		UpdateAsyncSongSourceLoading();
+		UpdateChartSaveWorkerFailures();
 		UpdateGlobalControlInput();
 
 		GuiChildWindows();
@@ -179,7 +185,9 @@ namespace Comfy::Studio::Editor
 		GuiPVScriptExportPopup();
 		GuiFileNotFoundPopup();
 		GuiSaveConfirmationPopup();
+		GuiSaveFailedPopup();
 
+		undoManager.SetMemoryBudget(static_cast<size_t>(Max(GlobalUserData.System.UndoHistory.MemoryBudgetMB, 0)) * (1024 * 1024));
 		undoManager.FlushExecuteEndOfFrameCommands();
 	}
 
@@ -639,13 +647,10 @@ namespace Comfy::Studio::Editor
 			if (!chart->SongFileName.empty() && !songSourceFilePathAbsolute.empty())
 				chart->SongFileName = IO::Path::TryMakeRelative(songSourceFilePathAbsolute, chart->ChartFilePath);
 
-			if (chartSaveFileFuture.valid())
-				chartSaveFileFuture.get();
-
-			auto syncConvertedChartFile = std::make_unique<ComfyStudioChartFile>(*chart);
-			chartSaveFileFuture = std::async(std::launch::async, [futureOwnedPath = std::string(chart->ChartFilePath), futureOwnedChartFile = std::move(syncConvertedChartFile)]()
+			auto syncConvertedChartFile = std::make_unique<ComfyStudioChartFile>(*chart, GetUserChartFileTargetEncoding());
+			chartSaveWorker.Enqueue(chart->ChartFilePath, std::move(syncConvertedChartFile), [workerOwnedPath = std::string(chart->ChartFilePath)](ComfyStudioChartFile& chartFile)
 			{
-				return (futureOwnedChartFile != nullptr) ? IO::File::Save(futureOwnedPath, *futureOwnedChartFile) : false;
+				return IO::File::SaveBuffered(workerOwnedPath, chartFile);
 			});
 
 			undoManager.ClearPendingChangesFlag();
@@ -1012,12 +1017,7 @@ namespace Comfy::Studio::Editor
 			if (undoManager.GetHasPendingChanged() && GlobalUserData.SaveAndLoad.AutoSaveBeforeDiscardingChanges)
 				AutoSaveCurrentChartIfEnabledThenRestartStopwatch();
 
-			if (chartAutoSaveFuture.valid())
-				chartAutoSaveFuture.get();
-
-			if (chartSaveFileFuture.valid())
-				chartSaveFileFuture.get();
-
+			chartSaveWorker.WaitUntilIdle();
 			parentApplication.Exit();
 		});
 	}
@@ -1177,6 +1177,24 @@ namespace Comfy::Studio::Editor
 		timeline->OnSongLoaded();
 	}
 
+	void ChartEditor::UpdateChartSaveWorkerFailures()
+	{
+		auto failedRequestKeys = chartSaveWorker.TakeFailedRequestKeys();
+		if (failedRequestKeys.empty())
+			return;
+
+		for (auto& requestKey : failedRequestKeys)
+		{
+			// NOTE: The changes never made it to disk so the unsaved changes confirmation should still be shown
+			if (chart != nullptr && requestKey == chart->ChartFilePath)
+				undoManager.SetChangesWereMade();
+
+			saveFailedPopup.FailedPaths.push_back((requestKey == ComfyAutoSaveFilePrefix) ? std::string("Auto save") : std::move(requestKey));
+		}
+
+		saveFailedPopup.OpenOnNextFrame = true;
+	}
+
 	void ChartEditor::CheckAutoSaveStopwatchAndDoAsyncAutoSave()
 	{
 		const auto timeSinceLastAutoSave = lastAutoSaveStowpatch.GetElapsed();
@@ -1187,30 +1205,26 @@ namespace Comfy::Studio::Editor
 	void ChartEditor::AutoSaveCurrentChartIfEnabledThenRestartStopwatch()
 	{
 		if (GlobalUserData.SaveAndLoad.AutoSaveEnabled && !GlobalUserData.SaveAndLoad.AutoSaveDirectory.empty() && chart != nullptr)
-			StartAsyncAutoSaveFutureForChart(*chart);
+			EnqueueAutoSaveForChart(*chart);
 
 		lastAutoSaveStowpatch.Restart();
 	}
 
-	void ChartEditor::StartAsyncAutoSaveFutureForChart(const Chart& chartToSave) const
+	void ChartEditor::EnqueueAutoSaveForChart(const Chart& chartToSave) const
 	{
-		struct FutureOwnedAsyncAutoSaveContext
+		struct WorkerOwnedAutoSaveContext
 		{
-			std::unique_ptr<ComfyStudioChartFile> ChartFile;
 			i32 MaxAutoSaveFilesToKeep;
 			std::string RelativeOutputDirectory;
 		};
 
-		// NOTE: Create sync copies first to avoid any kind of multi threading problems
-		FutureOwnedAsyncAutoSaveContext syncPreparedAutoSaveContext = {};
-		syncPreparedAutoSaveContext.ChartFile = std::make_unique<ComfyStudioChartFile>(chartToSave);
+		// NOTE: Create sync copies first to avoid any kind of multi threading problems. The chart file itself only holds snapshots of the target and tempo data
+		WorkerOwnedAutoSaveContext syncPreparedAutoSaveContext = {};
 		syncPreparedAutoSaveContext.MaxAutoSaveFilesToKeep = GlobalUserData.SaveAndLoad.AutoSaveMaxFiles;
 		syncPreparedAutoSaveContext.RelativeOutputDirectory = GlobalUserData.SaveAndLoad.AutoSaveDirectory;
 
-		if (chartAutoSaveFuture.valid())
-			chartAutoSaveFuture.get();
-
-		chartAutoSaveFuture = std::async(std::launch::async, [autoSaveContext = std::move(syncPreparedAutoSaveContext)]()
+		auto syncConvertedChartFile = std::make_unique<ComfyStudioChartFile>(chartToSave, GetUserChartFileTargetEncoding());
+		chartSaveWorker.Enqueue(ComfyAutoSaveFilePrefix, std::move(syncConvertedChartFile), [autoSaveContext = std::move(syncPreparedAutoSaveContext)](ComfyStudioChartFile& chartFile)
 		{
 			const std::string absoluteOutputDirectory = MakeRelativeAutoSaveDirectoryAbsolute(autoSaveContext.RelativeOutputDirectory);
 			if (absoluteOutputDirectory.empty())
@@ -1231,7 +1245,7 @@ namespace Comfy::Studio::Editor
 			outputPath += std::string_view(BuildVersion::CommitHash, 8);
 			outputPath += ComfyAutoSaveFileExtension;
 
-			return (autoSaveContext.ChartFile != nullptr) ? IO::File::Save(outputPath, *autoSaveContext.ChartFile) : false;
+			return IO::File::SaveBuffered(outputPath, chartFile);
 		});
 	}
 
@@ -1520,6 +1534,45 @@ namespace Comfy::Studio::Editor
 		}
 	}
 
+	void ChartEditor::GuiSaveFailedPopup()
+	{
+		constexpr const char* saveFailedPopupID = ICON_FA_EXCLAMATION_TRIANGLE "  Comfy Studio - Save Failed##SaveFailedPopup";
+
+		if (saveFailedPopup.OpenOnNextFrame)
+		{
+			Gui::OpenPopup(saveFailedPopupID);
+			saveFailedPopup.OpenOnNextFrame = false;
+		}
+
+		const auto* viewport = Gui::GetMainViewport();
+		Gui::SetNextWindowPos(viewport->Pos + (viewport->Size / 2.0f), ImGuiCond_Appearing, vec2(0.5f));
+
+		bool isOpen = true;
+		if (Gui::WideBeginPopupModal(saveFailedPopupID, &isOpen, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			constexpr vec2 buttonSize = vec2(120.0f, 0.0f);
+			Gui::AlignTextToFramePadding();
+			Gui::TextUnformatted("The following chart files could not be written:");
+			for (const auto& failedPath : saveFailedPopup.FailedPaths)
+				Gui::BulletText("%s", failedPath.c_str());
+			Gui::Separator();
+
+			const bool okBindingPressed = Gui::IsWindowFocused() && Input::IsAnyPressed(GlobalUserData.Input.App_Dialog_YesOrOk, false);
+			const bool cancelBindingPressed = Gui::IsWindowFocused() && Input::IsAnyPressed(GlobalUserData.Input.App_Dialog_Cancel, false);
+
+			if (Gui::Button(ICON_FA_CHECK "   OK", buttonSize) || okBindingPressed || cancelBindingPressed)
+			{
+				saveFailedPopup.FailedPaths.clear();
+				Gui::CloseCurrentPopup();
+			}
+
+			Gui::EndPopup();
+		}
+
+		if (!isOpen)
+			saveFailedPopup.FailedPaths.clear();
+	}
+
 	void ChartEditor::SyncWorkingChartPointers()
 	{
 		if (timeline != nullptr)
@@ -1574,6 +1627,9 @@ namespace Comfy::Studio::Editor
 		assert(exitType != PlayTestExitType::None);
 		parentApplication.SetExclusiveFullscreenGui(false);
 
+		if (playTestWindow != nullptr)
+			playTestWindow->Stop();
+
 		PausePlayback();
 		if (exitType == PlayTestExitType::ReturnCurrentTime)
 		{
@@ -10,6 +10,7 @@
 #include "BPMCalculatorWindow.h"
 #include "ChartPropertiesWindow.h"
 #include "FileFormat/ComfyStudioChartFile.h"
+#include "FileFormat/ChartFileSaveWorker.h"
 #include "Timeline/TargetTimeline.h"
 #include "RenderWindow/TargetRenderWindow.h"
 #include "ChartMoviePlaybackController.h"
@@ -164,9 +165,10 @@ namespace Comfy::Studio::Editor
 		void UpdateApplicationWindowTitle();
 		void UpdateDiscordStatusIfEnabled(bool isPlaytesting);
 		void UpdateAsyncSongSourceLoading();
+		void UpdateChartSaveWorkerFailures();
 		void CheckAutoSaveStopwatchAndDoAsyncAutoSave();
 		void AutoSaveCurrentChartIfEnabledThenRestartStopwatch();
-		void StartAsyncAutoSaveFutureForChart(const Chart& chartToSave) const;
+		void EnqueueAutoSaveForChart(const Chart& chartToSave) const;
 
 		void GuiChildWindows();
 		void GuiPlaytestFullscreenFadeOutAnimation();
@@ -176,6 +178,7 @@ namespace Comfy::Studio::Editor
 		void GuiPVScriptExportPopup();
 		void GuiFileNotFoundPopup();
 		void GuiSaveConfirmationPopup();
+		void GuiSaveFailedPopup();
 
 		void SyncWorkingChartPointers();
 
@@ -247,9 +250,14 @@ namespace Comfy::Studio::Editor
 			std::function<void()> OnYesClickedFunction;
 		} fileNotFoundPopup = {};
 
-		std::future<bool> chartSaveFileFuture;
+		struct SaveFailedPopupData
+		{
+			bool OpenOnNextFrame;
+			std::vector<std::string> FailedPaths;
+		} saveFailedPopup = {};
 
-		mutable std::future<bool> chartAutoSaveFuture;
+		// NOTE: Shared by both manual and auto saves, the UI thread only ever takes O(1) snapshots of the chart
+		mutable ChartFileSaveWorker chartSaveWorker;
 		Stopwatch lastAutoSaveStowpatch = {};
 
 #if COMFY_COMILE_WITH_DLL_DISCORD_RICH_PRESENCE_INTEGRATION
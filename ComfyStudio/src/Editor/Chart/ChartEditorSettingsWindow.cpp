@@ -920,6 +920,21 @@ namespace Comfy::Studio::Editor
 			GuiEndSettingsColumns();
 		}
 
+		if (Gui::CollapsingHeader("Undo History", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			GuiBeginSettingsColumns();
+
+			if (auto v = userData.System.UndoHistory.MemoryBudgetMB;
+				GuiSettingsInputI32("Memory Budget", v, 16, 256, ImGuiInputTextFlags_None, (v <= 0) ? "%d MB (Unlimited)" : "%d MB"))
+			{
+				userData.System.UndoHistory.MemoryBudgetMB = Clamp(v, 0, 8192);
+				pendingChanges = true;
+			}
+			GuiSettingsRighSideHelpMarker("The maximum amount of memory used for storing undo history before the oldest actions are discarded. Set to 0 to never discard any undo history");
+
+			GuiEndSettingsColumns();
+		}
+
 #if COMFY_DEBUG && 1 // DEBUG: Mostly for internal testing, probably won't need to expose these to the user
 		auto guiSettingsSliderVec3 = [](std::string_view label, vec3& inOutValue, f32 minValue, f32 maxValue, const char* format = "%.3f", ImGuiSliderFlags flags = ImGuiSliderFlags_None)
 		{
@@ -1387,6 +1402,16 @@ namespace Comfy::Studio::Editor
 
 			GuiEndSettingsColumns();
 		}
+
+		if (Gui::CollapsingHeader("Chart File", ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			GuiBeginSettingsColumns();
+
+			pendingChanges |= GuiSettingsCheckbox("Compact Target Encoding", userData.SaveAndLoad.CompactChartFileTargets);
+			GuiSettingsRighSideHelpMarker("Stores the targets of saved and auto saved charts in a smaller and faster to load format. Charts saved this way cannot be opened by older versions of Comfy Studio");
+
+			GuiEndSettingsColumns();
+		}
 	}
 
 	void ChartEditorSettingsWindow::GuiTabPlaytest(ComfyStudioUserSettings& userData)
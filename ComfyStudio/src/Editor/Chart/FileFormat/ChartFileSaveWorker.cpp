@@ -0,0 +1,127 @@
+#include "ChartFileSaveWorker.h"
+#include "Core/Logger.h"
+
+namespace Comfy::Studio::Editor
+{
+	ChartFileSaveWorker::ChartFileSaveWorker()
+	{
+		workerThread = std::thread([this] { WorkerThreadEntryPoint(); });
+	}
+
+	ChartFileSaveWorker::~ChartFileSaveWorker()
+	{
+		// NOTE: Pending requests are still written before exiting so that no save is ever silently dropped
+		{
+			std::scoped_lock lock(mutex);
+			exitRequested = true;
+		}
+		requestAvailableCondition.notify_one();
+
+		if (workerThread.joinable())
+			workerThread.join();
+	}
+
+	void ChartFileSaveWorker::Enqueue(std::string_view requestKey, std::unique_ptr<ComfyStudioChartFile> chartFile, WriteFunction writeFunc)
+	{
+		if (chartFile == nullptr || !writeFunc)
+			return;
+
+		// NOTE: The replaced file is destroyed outside of the lock, releasing its snapshot references
+		std::unique_ptr<ComfyStudioChartFile> replacedChartFile = nullptr;
+		{
+			std::scoped_lock lock(mutex);
+
+			auto existingRequest = std::find_if(pendingRequests.begin(), pendingRequests.end(), [&](const auto& request) { return (request.Key == requestKey); });
+			if (existingRequest != pendingRequests.end())
+			{
+				replacedChartFile = std::move(existingRequest->ChartFile);
+				existingRequest->ChartFile = std::move(chartFile);
+				existingRequest->WriteFunc = std::move(writeFunc);
+				replacedRequestCount++;
+			}
+			else
+			{
+				pendingRequests.push_back(SaveRequest { std::string(requestKey), std::move(chartFile), std::move(writeFunc) });
+			}
+		}
+		requestAvailableCondition.notify_one();
+	}
+
+	void ChartFileSaveWorker::WaitUntilIdle()
+	{
+		std::unique_lock lock(mutex);
+		idleCondition.wait(lock, [this] { return (pendingRequests.empty() && !isWriting); });
+	}
+
+	bool ChartFileSaveWorker::IsIdle() const
+	{
+		std::scoped_lock lock(mutex);
+		return (pendingRequests.empty() && !isWriting);
+	}
+
+	u32 ChartFileSaveWorker::GetCompletedWriteCount() const
+	{
+		std::scoped_lock lock(mutex);
+		return completedWriteCount;
+	}
+
+	u32 ChartFileSaveWorker::GetReplacedRequestCount() const
+	{
+		std::scoped_lock lock(mutex);
+		return replacedRequestCount;
+	}
+
+	u32 ChartFileSaveWorker::GetFailedWriteCount() const
+	{
+		std::scoped_lock lock(mutex);
+		return failedWriteCount;
+	}
+
+	std::vector<std::string> ChartFileSaveWorker::TakeFailedRequestKeys()
+	{
+		std::vector<std::string> takenRequestKeys;
+
+		std::scoped_lock lock(mutex);
+		takenRequestKeys.swap(failedRequestKeys);
+		return takenRequestKeys;
+	}
+
+	void ChartFileSaveWorker::WorkerThreadEntryPoint()
+	{
+		while (true)
+		{
+			SaveRequest request = {};
+			{
+				std::unique_lock lock(mutex);
+				requestAvailableCondition.wait(lock, [this] { return (!pendingRequests.empty() || exitRequested); });
+
+				if (pendingRequests.empty())
+					return;
+
+				request = std::move(pendingRequests.front());
+				pendingRequests.erase(pendingRequests.begin());
+				isWriting = true;
+			}
+
+			const bool writeSucceeded = request.WriteFunc(*request.ChartFile);
+			if (!writeSucceeded)
+				Logger::LogErrorLine(__FUNCTION__"(): Failed to write chart file for save request '%s'", request.Key.c_str());
+
+			std::string requestKey = std::move(request.Key);
+			request = {};
+
+			{
+				std::scoped_lock lock(mutex);
+				isWriting = false;
+				completedWriteCount++;
+
+				if (!writeSucceeded)
+				{
+					failedWriteCount++;
+					failedRequestKeys.push_back(std::move(requestKey));
+				}
+			}
+			idleCondition.notify_all();
+		}
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "Types.h"
+#include "ComfyStudioChartFile.h"
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Comfy::Studio::Editor
+{
+	// NOTE: Single persistent background thread for serializing and writing chart files so that the UI thread only ever has to take O(1) chart snapshots.
+	//		 A new request replaces any still pending request with the same key so repeatedly saving to the same destination faster than it can be written
+	//		 only ever writes the most recent state once (debouncing) instead of queuing up redundant writes of outdated snapshots
+	class ChartFileSaveWorker : NonCopyable
+	{
+	public:
+		using WriteFunction = std::function<bool(ComfyStudioChartFile& chartFile)>;
+
+	public:
+		ChartFileSaveWorker();
+		~ChartFileSaveWorker();
+
+	public:
+		void Enqueue(std::string_view requestKey, std::unique_ptr<ComfyStudioChartFile> chartFile, WriteFunction writeFunc);
+
+		// NOTE: Blocks until all pending requests have been written
+		void WaitUntilIdle();
+		bool IsIdle() const;
+
+		u32 GetCompletedWriteCount() const;
+		u32 GetReplacedRequestCount() const;
+		u32 GetFailedWriteCount() const;
+
+		// NOTE: Keys of all requests for which the write function returned false since the last call, to be polled by the UI thread
+		std::vector<std::string> TakeFailedRequestKeys();
+
+	private:
+		void WorkerThreadEntryPoint();
+
+	private:
+		struct SaveRequest
+		{
+			std::string Key;
+			std::unique_ptr<ComfyStudioChartFile> ChartFile;
+			WriteFunction WriteFunc;
+		};
+
+		mutable std::mutex mutex;
+		std::condition_variable requestAvailableCondition;
+		std::condition_variable idleCondition;
+
+		std::vector<SaveRequest> pendingRequests;
+		bool isWriting = false;
+		bool exitRequested = false;
+
+		u32 completedWriteCount = 0;
+		u32 replacedRequestCount = 0;
+		u32 failedWriteCount = 0;
+
+		std::vector<std::string> failedRequestKeys;
+
+		std::thread workerThread;
+	};
+}
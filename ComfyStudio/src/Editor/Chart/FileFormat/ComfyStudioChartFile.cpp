@@ -11,8 +11,9 @@ namespace Comfy::Studio::Editor
 {
 	namespace ChartFileFormat
 	{
-		// NOTE: Increment major version for breaking changes and minor version for backwards and forward compatible additions
-		enum class Version : u16 { CurrentMajor = 1, CurrentMinor = 8, };
+		// NOTE: Increment major version for breaking changes and minor version for backwards and forward compatible additions.
+		//		 Files with a compact target table use their own major version so that older versions refuse to open them instead of silently dropping all targets
+		enum class Version : u16 { CurrentMajor = 1, CurrentMinor = 8, CompactTargetsMajor = 2, MaxSupportedMajor = CompactTargetsMajor, };
 		enum class Endianness : u16 { Little = 'L', Big = 'B' };
 		enum class PointerSize : u16 { Bit32 = 32, Bit64 = 64 };
 		enum class HeaderFlags : u32 { None = 0xFFFFFFFF };
@@ -181,9 +182,200 @@ namespace Comfy::Studio::Editor
 				w.WriteU32(flags.RawU32);
 			} },
 		};
+
+		// NOTE: The compact target table replaces the fixed size per field columns with three variable length byte columns.
+		//		 Ticks are stored as zigzag varint deltas to the previous target, type and flags are packed into a single byte
+		//		 and properties are quantised to a fixed point grid with an escape to the raw bits for anything that wouldn't survive it exactly
+		constexpr std::string_view CompactTargetFieldTickDeltas = "Compact Tick Deltas";
+		constexpr std::string_view CompactTargetFieldTypeFlags = "Compact Type Flags";
+		constexpr std::string_view CompactTargetFieldProperties = "Compact Properties";
+
+		union CompactTargetTypeFlags
+		{
+			// NOTE: Since these are written to the file directly as is, the order and layout should never be changed
+			struct
+			{
+				u8 Type : 3;
+				u8 HasProperties : 1;
+				u8 IsHold : 1;
+				u8 IsChain : 1;
+				u8 IsChance : 1;
+				// NOTE: All property values are +0.0f and therefore not stored at all, which is the case for most targets without properties
+				u8 AllPropertiesZero : 1;
+			};
+			u8 RawU8;
+		};
+
+		static_assert(sizeof(CompactTargetTypeFlags) == sizeof(u8));
+		static_assert(EnumCount<ButtonType>() <= 0b111);
+
+		// NOTE: 1/64 is fine enough for all positions, angles and frequencies that can be entered through the editor GUI
+		//		 while still keeping typical values within two or three varint bytes
+		constexpr f32 CompactPropertyQuantizationScale = 64.0f;
+		constexpr i32 CompactPropertyMaxQuantizedMagnitude = (1 << 24);
+		constexpr u64 CompactPropertyRawBitsEscape = 0b1;
+
+		struct CompactTargetColumns
+		{
+			std::vector<u8> TickDeltas;
+			std::vector<u8> TypeFlags;
+			std::vector<u8> Properties;
+		};
+
+		constexpr u64 ZigZagEncode(i64 value) { return (static_cast<u64>(value) << 1) ^ static_cast<u64>(value >> 63); }
+		constexpr i64 ZigZagDecode(u64 value) { return static_cast<i64>(value >> 1) ^ -static_cast<i64>(value & 1); }
+
+		void AppendVarInt(std::vector<u8>& outBytes, u64 value)
+		{
+			while (value >= 0x80)
+			{
+				outBytes.push_back(static_cast<u8>(value | 0x80));
+				value >>= 7;
+			}
+			outBytes.push_back(static_cast<u8>(value));
+		}
+
+		bool TryReadVarInt(const u8*& inOutBytes, const u8* bytesEnd, u64& outValue)
+		{
+			outValue = 0;
+			for (u32 shift = 0; shift < 64 && inOutBytes < bytesEnd; shift += 7)
+			{
+				const u8 byte = *inOutBytes++;
+				outValue |= static_cast<u64>(byte & 0x7F) << shift;
+
+				if ((byte & 0x80) == 0)
+					return true;
+			}
+			return false;
+		}
+
+		void AppendCompactProperty(std::vector<u8>& outBytes, f32 value)
+		{
+			// NOTE: Comparison written so that NaN also takes the escape path
+			const f32 scaled = value * CompactPropertyQuantizationScale;
+			if (scaled > -static_cast<f32>(CompactPropertyMaxQuantizedMagnitude) && scaled < static_cast<f32>(CompactPropertyMaxQuantizedMagnitude))
+			{
+				const i32 quantized = static_cast<i32>(std::round(scaled));
+				const f32 dequantized = static_cast<f32>(quantized) / CompactPropertyQuantizationScale;
+
+				// NOTE: Compare the bits and not the values so that -0.0f is never turned into +0.0f
+				if (std::memcmp(&dequantized, &value, sizeof(f32)) == 0)
+				{
+					AppendVarInt(outBytes, ZigZagEncode(quantized) << 1);
+					return;
+				}
+			}
+
+			u32 rawBits;
+			std::memcpy(&rawBits, &value, sizeof(rawBits));
+
+			AppendVarInt(outBytes, CompactPropertyRawBitsEscape);
+			for (size_t i = 0; i < sizeof(rawBits); i++)
+				outBytes.push_back(static_cast<u8>(rawBits >> (i * 8)));
+		}
+
+		bool TryReadCompactProperty(const u8*& inOutBytes, const u8* bytesEnd, f32& outValue)
+		{
+			u64 encoded;
+			if (!TryReadVarInt(inOutBytes, bytesEnd, encoded))
+				return false;
+
+			if (encoded & CompactPropertyRawBitsEscape)
+			{
+				if ((bytesEnd - inOutBytes) < static_cast<ptrdiff_t>(sizeof(u32)))
+					return false;
+
+				u32 rawBits = 0;
+				for (size_t i = 0; i < sizeof(rawBits); i++)
+					rawBits |= static_cast<u32>(*inOutBytes++) << (i * 8);
+
+				std::memcpy(&outValue, &rawBits, sizeof(outValue));
+				return true;
+			}
+
+			outValue = static_cast<f32>(ZigZagDecode(encoded >> 1)) / CompactPropertyQuantizationScale;
+			return true;
+		}
+
+		void EncodeCompactTargetColumns(const std::vector<TimelineTarget>& targets, CompactTargetColumns& outColumns)
+		{
+			outColumns.TickDeltas.reserve(targets.size() * 2);
+			outColumns.TypeFlags.reserve(targets.size());
+
+			static constexpr TargetProperties zeroProperties = {};
+			i64 previousTick = 0;
+
+			for (const auto& target : targets)
+			{
+				AppendVarInt(outColumns.TickDeltas, ZigZagEncode(static_cast<i64>(target.Tick.Ticks()) - previousTick));
+				previousTick = target.Tick.Ticks();
+
+				CompactTargetTypeFlags typeFlags = {};
+				typeFlags.Type = static_cast<u8>(target.Type);
+				typeFlags.HasProperties = target.Flags.HasProperties;
+				typeFlags.IsHold = target.Flags.IsHold;
+				typeFlags.IsChain = target.Flags.IsChain;
+				typeFlags.IsChance = target.Flags.IsChance;
+				typeFlags.AllPropertiesZero = (std::memcmp(&target.Properties, &zeroProperties, sizeof(TargetProperties)) == 0);
+				outColumns.TypeFlags.push_back(typeFlags.RawU8);
+
+				if (!typeFlags.AllPropertiesZero)
+				{
+					for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+						AppendCompactProperty(outColumns.Properties, target.Properties[p]);
+				}
+			}
+		}
+
+		bool TryDecodeCompactTargetColumns(const CompactTargetColumns& columns, std::vector<TimelineTarget>& outTargets)
+		{
+			if (columns.TypeFlags.size() != outTargets.size())
+				return false;
+
+			const u8* tickDeltas = columns.TickDeltas.data();
+			const u8* tickDeltasEnd = tickDeltas + columns.TickDeltas.size();
+			const u8* properties = columns.Properties.data();
+			const u8* propertiesEnd = properties + columns.Properties.size();
+			i64 previousTick = 0;
+
+			for (size_t i = 0; i < outTargets.size(); i++)
+			{
+				auto& target = outTargets[i];
+
+				u64 encodedTickDelta;
+				if (!TryReadVarInt(tickDeltas, tickDeltasEnd, encodedTickDelta))
+					return false;
+
+				previousTick += ZigZagDecode(encodedTickDelta);
+				target.Tick = BeatTick(static_cast<i32>(previousTick));
+
+				CompactTargetTypeFlags typeFlags = {};
+				typeFlags.RawU8 = columns.TypeFlags[i];
+				target.Type = static_cast<ButtonType>(typeFlags.Type);
+				target.Flags.HasProperties = typeFlags.HasProperties;
+				target.Flags.IsHold = typeFlags.IsHold;
+				target.Flags.IsChain = typeFlags.IsChain;
+				target.Flags.IsChance = typeFlags.IsChance;
+
+				if (typeFlags.AllPropertiesZero)
+				{
+					target.Properties = {};
+				}
+				else
+				{
+					for (TargetPropertyType p = 0; p < TargetPropertyType_Count; p++)
+					{
+						if (!TryReadCompactProperty(properties, propertiesEnd, target.Properties[p]))
+							return false;
+					}
+				}
+			}
+
+			return (tickDeltas == tickDeltasEnd) && (properties == propertiesEnd);
+		}
 	}
 
-	ComfyStudioChartFile::ComfyStudioChartFile(const Chart& sourceChart)
+	ComfyStudioChartFile::ComfyStudioChartFile(const Chart& sourceChart, ChartFileTargetEncoding targetEncoding) : targetEncoding(targetEncoding)
 	{
 		FromChart(sourceChart);
 	}
@@ -225,8 +417,8 @@ namespace Comfy::Studio::Editor
 		outChart->Properties.SongPreview.StartTime = chart.Time.SongPreviewStart;
 		outChart->Properties.SongPreview.Duration = chart.Time.SongPreviewDuration;
 
-		outChart->Targets = std::move(chart.Targets);
-		outChart->TempoMap = std::move(chart.TempoChanges);
+		outChart->Targets = (chart.TargetsSnapshot != nullptr) ? std::vector<TimelineTarget>(*chart.TargetsSnapshot) : std::move(chart.Targets);
+		outChart->TempoMap = (chart.TempoChangesSnapshot != nullptr) ? std::vector<TempoChange>(*chart.TempoChangesSnapshot) : std::move(chart.TempoChanges);
 
 		outChart->Properties.ButtonSound.ButtonID = chart.ButtonSound.ButtonID;
 		outChart->Properties.ButtonSound.SlideID = chart.ButtonSound.SlideID;
@@ -246,6 +438,16 @@ namespace Comfy::Studio::Editor
 		return outChart;
 	}
 
+	ChartFileTargetEncoding ComfyStudioChartFile::GetTargetEncoding() const
+	{
+		return targetEncoding;
+	}
+
+	void ComfyStudioChartFile::SetTargetEncoding(ChartFileTargetEncoding value)
+	{
+		targetEncoding = value;
+	}
+
 	IO::StreamResult ComfyStudioChartFile::Read(IO::StreamReader& reader)
 	{
 		using namespace ChartFileFormat;
@@ -263,7 +465,7 @@ namespace Comfy::Studio::Editor
 		if (header.FileMagic != Magic)
 			return IO::StreamResult::BadFormat;
 
-		if (header.MajorVersion > Version::CurrentMajor)
+		if (header.MajorVersion > Version::MaxSupportedMajor)
 			return IO::StreamResult::BadFormat;
 
 		if (header.Endianness != Endianness::Little)
@@ -291,6 +493,9 @@ namespace Comfy::Studio::Editor
 		if (!reader.IsValidPointer(sectionsOffset))
 			return IO::StreamResult::BadPointer;
 
+		CompactTargetColumns compactTargetColumns = {};
+		bool anyCompactTargetColumnRead = false, compactTargetColumnsDecoded = false;
+
 		reader.ReadAt(sectionsOffset, [&](IO::StreamReader& reader)
 		{
 			for (size_t sectionIndex = 0; sectionIndex < sectionCount; sectionIndex++)
@@ -444,9 +649,24 @@ namespace Comfy::Studio::Editor
 																	break;
 																}
 															}
+
+															std::vector<u8>* compactColumn =
+																(nameID == CompactTargetFieldTickDeltas) ? &compactTargetColumns.TickDeltas :
+																(nameID == CompactTargetFieldTypeFlags) ? &compactTargetColumns.TypeFlags :
+																(nameID == CompactTargetFieldProperties) ? &compactTargetColumns.Properties : nullptr;
+
+															if (compactColumn != nullptr && fieldArraySize <= static_cast<size_t>(reader.GetLength()))
+															{
+																compactColumn->resize(fieldArraySize);
+																compactColumn->resize(reader.ReadBuffer(compactColumn->data(), compactColumn->size()));
+																anyCompactTargetColumnRead = true;
+															}
 														});
 													}
 												}
+
+												if (anyCompactTargetColumnRead)
+													compactTargetColumnsDecoded = TryDecodeCompactTargetColumns(compactTargetColumns, chart.Targets);
 											});
 										}
 									}
@@ -527,6 +747,10 @@ namespace Comfy::Studio::Editor
 			}
 		});
 
+		if (anyCompactTargetColumnRead && !compactTargetColumnsDecoded)
+			return IO::StreamResult::BadFormat;
+
+		targetEncoding = anyCompactTargetColumnRead ? ChartFileTargetEncoding::Compact : ChartFileTargetEncoding::Columns;
 		return IO::StreamResult::Success;
 	}
 
@@ -534,9 +758,25 @@ namespace Comfy::Studio::Editor
 	{
 		using namespace ChartFileFormat;
 
+		// NOTE: Either the snapshots of the source chart or the previously read data
+		const auto& targets = (chart.TargetsSnapshot != nullptr) ? *chart.TargetsSnapshot : chart.Targets;
+		const auto& tempoChanges = (chart.TempoChangesSnapshot != nullptr) ? *chart.TempoChangesSnapshot : chart.TempoChanges;
+
+		// NOTE: Encoded up front because the field pointer functions below are only invoked once the pointer pool is flushed
+		CompactTargetColumns compactTargetColumns = {};
+		if (targetEncoding == ChartFileTargetEncoding::Compact)
+			EncodeCompactTargetColumns(targets, compactTargetColumns);
+
+		const std::array<std::pair<std::string_view, const std::vector<u8>*>, 3> compactTargetFields =
+		{
+			std::make_pair(CompactTargetFieldTickDeltas, &compactTargetColumns.TickDeltas),
+			std::make_pair(CompactTargetFieldTypeFlags, &compactTargetColumns.TypeFlags),
+			std::make_pair(CompactTargetFieldProperties, &compactTargetColumns.Properties),
+		};
+
 		HeaderData header;
 		header.FileMagic = Magic;
-		header.MajorVersion = Version::CurrentMajor;
+		header.MajorVersion = (targetEncoding == ChartFileTargetEncoding::Compact) ? Version::CompactTargetsMajor : Version::CurrentMajor;
 		header.MinorVersion = Version::CurrentMinor;
 		header.Endianness = Endianness::Little;
 		header.PointerSize = PointerSize::Bit64;
@@ -662,7 +902,34 @@ namespace Comfy::Studio::Editor
 									writer.WriteStrPtr(SectionIDChartSectionIDTargets);
 									writer.WriteFuncPtr([&](IO::StreamWriter& writer)
 									{
-										writer.WriteSize(chart.Targets.size());
+										if (targetEncoding == ChartFileTargetEncoding::Compact)
+										{
+											writer.WriteSize(targets.size());
+											writer.WriteSize(compactTargetFields.size());
+											writer.WriteFuncPtr([&](IO::StreamWriter& writer)
+											{
+												for (const auto& compactField : compactTargetFields)
+												{
+													// NOTE: Variable length columns so the field byte size is left as zero and the array size is the total byte size instead
+													writer.WriteStrPtr(compactField.first);
+													writer.WriteSize(0);
+													writer.WriteSize(compactField.second->size());
+													writer.WriteFuncPtr([&](IO::StreamWriter& writer)
+													{
+														writer.WriteBuffer(compactField.second->data(), compactField.second->size());
+														writer.WriteAlignmentPadding(16);
+													});
+													writer.WriteU64(0);
+													writer.WriteU64(0);
+												}
+												writer.WriteAlignmentPadding(16);
+											});
+											writer.WriteU64(0);
+											writer.WriteAlignmentPadding(16);
+											return;
+										}
+
+										writer.WriteSize(targets.size());
 										writer.WriteSize(TargetFields.size());
 										writer.WriteFuncPtr([&](IO::StreamWriter& writer)
 										{
@@ -671,10 +938,10 @@ namespace Comfy::Studio::Editor
 												// TODO: Store boolean flags in packed bit arrays
 												writer.WriteStrPtr(field.Name);
 												writer.WriteSize(field.ByteSize);
-												writer.WriteSize(field.ByteSize * chart.Targets.size());
+												writer.WriteSize(field.ByteSize * targets.size());
 												writer.WriteFuncPtr([&](IO::StreamWriter& writer)
 												{
-													for (const auto& target : chart.Targets)
+													for (const auto& target : targets)
 														field.WriteFunc(writer, target);
 													writer.WriteAlignmentPadding(16);
 												});
@@ -694,7 +961,7 @@ namespace Comfy::Studio::Editor
 									writer.WriteStrPtr(SectionIDChartSectionIDTempoMap);
 									writer.WriteFuncPtr([&](IO::StreamWriter& writer)
 									{
-										writer.WriteSize(chart.TempoChanges.size());
+										writer.WriteSize(tempoChanges.size());
 										writer.WriteSize(TempoMapFields.size());
 										writer.WriteFuncPtr([&](IO::StreamWriter& writer)
 										{
@@ -702,20 +969,20 @@ namespace Comfy::Studio::Editor
 											{
 												writer.WriteStrPtr(field.Name);
 												writer.WriteSize(field.ByteSize);
-												writer.WriteSize(field.ByteSize * chart.TempoChanges.size());
+												writer.WriteSize(field.ByteSize * tempoChanges.size());
 												writer.WriteFuncPtr([&](IO::StreamWriter& writer)
 												{
-													if (!chart.TempoChanges.empty())
+													if (!tempoChanges.empty())
 													{
 														// HACK: Basically a reimplementation of SortedTempoMap::ForEachNewOrInherited() just because this operates on a raw vector
 														NewOrInheritedTempoChange newOrInherited = {};
-														newOrInherited.Tempo = chart.TempoChanges[0].Tempo.value_or(TempoChange::DefaultTempo);
-														newOrInherited.FlyingTime = chart.TempoChanges[0].FlyingTime.value_or(TempoChange::DefaultFlyingTimeFactor);
-														newOrInherited.Signature = chart.TempoChanges[0].Signature.value_or(TempoChange::DefaultSignature);
+														newOrInherited.Tempo = tempoChanges[0].Tempo.value_or(TempoChange::DefaultTempo);
+														newOrInherited.FlyingTime = tempoChanges[0].FlyingTime.value_or(TempoChange::DefaultFlyingTimeFactor);
+														newOrInherited.Signature = tempoChanges[0].Signature.value_or(TempoChange::DefaultSignature);
 
-														for (size_t i = 0; i < chart.TempoChanges.size(); i++)
+														for (size_t i = 0; i < tempoChanges.size(); i++)
 														{
-															const auto& tempoChange = chart.TempoChanges[i];
+															const auto& tempoChange = tempoChanges[i];
 															newOrInherited.Tick = tempoChange.Tick;
 															newOrInherited.Tempo = tempoChange.Tempo.value_or(newOrInherited.Tempo);
 															newOrInherited.FlyingTime = tempoChange.FlyingTime.value_or(newOrInherited.FlyingTime);
@@ -889,8 +1156,9 @@ namespace Comfy::Studio::Editor
 		chart.Time.SongPreviewStart = sourceChart.Properties.SongPreview.StartTime;
 		chart.Time.SongPreviewDuration = sourceChart.Properties.SongPreview.Duration;
 
-		chart.Targets = sourceChart.Targets.GetRawView();
-		chart.TempoChanges = sourceChart.TempoMap.GetRawView();
+		// NOTE: Only sharing the current state instead of copying it, which keeps constructing a file to be saved on another thread cheap
+		chart.TargetsSnapshot = sourceChart.Targets.GetSnapshot();
+		chart.TempoChangesSnapshot = sourceChart.TempoMap.GetSnapshot();
 
 		switch (sourceChart.Properties.Difficulty.Type)
 		{
@@ -5,6 +5,14 @@
 
 namespace Comfy::Studio::Editor
 {
+	// NOTE: The compact target table is smaller and faster to read and write but can't be opened by versions older than the one that introduced it
+	enum class ChartFileTargetEncoding : u8
+	{
+		Columns,
+		Compact,
+		Count
+	};
+
 	// NOTE: A separate file class has the advantage of making async saving (due to a copy) much easier
 	//		 and better abstracts away the file format details
 	class ComfyStudioChartFile : public IO::IStreamReadable, public IO::IStreamWritable, NonCopyable
@@ -17,12 +25,16 @@ namespace Comfy::Studio::Editor
 
 	public:
 		ComfyStudioChartFile() = default;
-		ComfyStudioChartFile(const Chart& sourceChart);
+		ComfyStudioChartFile(const Chart& sourceChart, ChartFileTargetEncoding targetEncoding = ChartFileTargetEncoding::Columns);
 		~ComfyStudioChartFile() = default;
 
 	public:
 		std::unique_ptr<Chart> MoveToChart();
 
+		// NOTE: Set to the encoding of the file that was read and used for the next write
+		ChartFileTargetEncoding GetTargetEncoding() const;
+		void SetTargetEncoding(ChartFileTargetEncoding value);
+
 	public:
 		IO::StreamResult Read(IO::StreamReader& reader) override;
 		IO::StreamResult Write(IO::StreamWriter& writer) override;
@@ -40,6 +52,7 @@ namespace Comfy::Studio::Editor
 			inline std::string_view Find(std::string_view key) const { for (auto& item : Items) { if (item.Key == key) return item.Value; }; return ""; }
 		};
 
+		ChartFileTargetEncoding targetEncoding = ChartFileTargetEncoding::Columns;
 		SmallKeyValueMap metadata;
 
 		struct ChartData
@@ -64,6 +77,10 @@ namespace Comfy::Studio::Editor
 			std::vector<TimelineTarget> Targets;
 			std::vector<TempoChange> TempoChanges;
 
+			// NOTE: Set instead of the vectors above when created from a chart
+			std::shared_ptr<const std::vector<TimelineTarget>> TargetsSnapshot;
+			std::shared_ptr<const std::vector<TempoChange>> TempoChangesSnapshot;
+
 			struct ButtonSoundData
 			{
 				u32 ButtonID, SlideID, ChainSlideID, SliderTouchID;
@@ -1,5 +1,6 @@
 ﻿#include "PlayTestCore.h"
 #include "PlayTestWindow.h"
+#include "PlayTestSimulation.h"
 #include "Core/ComfyStudioSettings.h"
 #include "Time/Stopwatch.h"
 #include "Misc/StringUtil.h"
@@ -12,42 +13,6 @@ namespace Comfy::Studio::Editor
 	{
 		constexpr std::array<const char*, EnumCount<PlayTestSlidePositionType>()> PlayTestSlidePositionTypeIDStrings = { " ", "L", "R", };
 
-		struct PlayTestTarget
-		{
-			ButtonType Type;
-			PlayTestSlidePositionType SlidePosition;
-			TargetFlags Flags;
-			TargetProperties Properties;
-
-			TimeSpan RemainingTimeOnHit;
-			HitEvaluation HitEvaluation;
-			HitPrecision HitPrecision;
-
-			bool HasBeenHit;
-			bool HasBeenChainHit;
-			bool HasAnyChainFragmentFailed;
-			bool HasAnyChainHitAttemptBeenMade;
-			bool HasAnyChainStartFragmentBeenHit;
-			bool ThisFragmentCausedChainFailure;;
-			bool HasTimedOut;
-			bool WrongTypeOnTimeOut;
-		};
-
-		struct PlayTestSyncPair
-		{
-			std::array<PlayTestTarget, Rules::MaxSyncPairCount> Targets;
-			u8 TargetCount;
-
-			bool HasBeenAdded;
-			bool NoLongerValid;
-
-			TimeSpan TargetTime;
-			TimeSpan ButtonTime;
-			TimeSpan FlyingTime;
-
-			vec2 PositionCenter;
-		};
-
 		struct SliderTouchPoint
 		{
 			SliderTouchPoint(f32 direction) : Direction(direction) {}
@@ -59,126 +24,6 @@ namespace Comfy::Studio::Editor
 			TimeSpan SoundInterval = TimeSpan::FromMilliseconds(50.0);
 		};
 
-		enum class PlayTestHoldEventType : u8
-		{
-			Start,
-			Addition,
-			Cancel,
-			MaxOut,
-			Count
-		};
-
-		struct PlayTestHoldEvent
-		{
-			PlayTestHoldEventType EventType;
-			ButtonTypeFlags ButtonTypes;
-			TimeSpan PlaybackTime;
-			// TODO: Store index instead for safety
-			const PlayTestSyncPair* SyncPair;
-		};
-
-		struct PlayTestHoldState
-		{
-			ButtonTypeFlags CurrentHoldTypes = ButtonTypeFlags_None;
-			std::vector<PlayTestHoldEvent> EventHistory;
-			// TODO: Store indices to avoid potential pointer invalidations, although that would make the code slightly less readable
-			std::array<std::vector<const PlayTestInputBinding*>, EnumCount<ButtonType>()> PerTypeHeldDownBindings = {};
-
-			void ClearAll()
-			{
-				CurrentHoldTypes = ButtonTypeFlags_None;
-				EventHistory.clear();
-				for (auto& bindings : PerTypeHeldDownBindings)
-					bindings.clear();
-			}
-
-			void ClearAllHeldDownBindings()
-			{
-				for (auto& bindings : PerTypeHeldDownBindings)
-					bindings.clear();
-			}
-		};
-
-		constexpr ButtonTypeFlags GetSyncPairTypeFlags(const PlayTestSyncPair& syncPair)
-		{
-			ButtonTypeFlags holdFlags = ButtonTypeFlags_None;
-
-			for (size_t i = 0; i < syncPair.TargetCount; i++)
-				holdFlags |= ButtonTypeToButtonTypeFlags(syncPair.Targets[i].Type);
-
-			return holdFlags;
-		}
-
-		constexpr ButtonTypeFlags GetSyncPairHoldTypeFlags(const PlayTestSyncPair& syncPair)
-		{
-			ButtonTypeFlags holdFlags = ButtonTypeFlags_None;
-
-			for (size_t i = 0; i < syncPair.TargetCount; i++)
-			{
-				if (syncPair.Targets[i].Flags.IsHold)
-					holdFlags |= ButtonTypeToButtonTypeFlags(syncPair.Targets[i].Type);
-			}
-
-			return holdFlags;
-		}
-
-		constexpr bool AnyInSyncPairHasBeenHitByPlayer(const PlayTestSyncPair& syncPair)
-		{
-			for (size_t i = 0; i < syncPair.TargetCount; i++)
-			{
-				if (syncPair.Targets[i].HasBeenHit && !syncPair.Targets[i].HasTimedOut)
-					return true;
-			}
-
-			return false;
-		}
-
-		constexpr bool AllInSyncPairHaveBeenHitByPlayer(const PlayTestSyncPair& syncPair)
-		{
-			for (size_t i = 0; i < syncPair.TargetCount; i++)
-			{
-				if (!syncPair.Targets[i].HasBeenHit || syncPair.Targets[i].HasTimedOut)
-					return false;
-			}
-
-			return true;
-		}
-
-		constexpr bool AllInSyncPairHaveBeenHit(const PlayTestSyncPair& syncPair)
-		{
-			for (size_t i = 0; i < syncPair.TargetCount; i++)
-			{
-				if (!syncPair.Targets[i].HasBeenHit)
-					return false;
-			}
-
-			return true;
-		}
-
-		template <typename Func>
-		void ForEachFragmentInChain(std::vector<PlayTestSyncPair>& allPairs, PlayTestSyncPair& startFragmentPair, PlayTestTarget& startFragment, Func perFragmentFunc)
-		{
-			assert(startFragment.Flags.IsChain);
-			const auto slideType = startFragment.Type;
-			const auto firstFragmentIndex = std::distance(&allPairs[0], &startFragmentPair);
-
-			for (size_t i = firstFragmentIndex; i < allPairs.size(); i++)
-			{
-				auto& pair = allPairs[i];
-				for (size_t p = 0; p < pair.TargetCount; p++)
-				{
-					auto& potentialFragment = pair.Targets[p];
-
-					if (!potentialFragment.Flags.IsChain || potentialFragment.Type != slideType)
-						continue;
-
-					perFragmentFunc(pair, potentialFragment);
-					if (potentialFragment.Flags.IsChainEnd)
-						return;
-				}
-			}
-		}
-
 		inline bool IsPlayTestBindingPressed(const PlayTestInputBinding& binding)
 		{
 			return Input::IsPressed(binding.InputSource, false);
@@ -189,54 +34,16 @@ namespace Comfy::Studio::Editor
 			return Input::IsDown(binding.InputSource);
 		}
 
-		inline void ChartToPlayTestTargets(Chart& chart, std::vector<PlayTestSyncPair>& outTargets)
+		// NOTE: Keyboard bindings with modifiers still have to go through the per frame input state to correctly handle the modifier order
+		inline bool CanPlayTestBindingBeCaptured(const PlayTestInputBinding& binding)
 		{
-			outTargets.reserve(chart.Targets.size());
-
-			for (size_t targetIndex = 0; targetIndex < chart.Targets.size();)
-			{
-				const auto& frontPairSourceTarget = chart.Targets[targetIndex];
-
-				auto& newPair = outTargets.emplace_back();
-				newPair.TargetCount = static_cast<u8>(Min(static_cast<size_t>(frontPairSourceTarget.Flags.SyncPairCount), newPair.Targets.size()));
-				for (size_t i = 0; i < newPair.TargetCount; i++)
-				{
-					const auto& sourceTarget = chart.Targets[targetIndex + i];
-
-					auto& newTarget = newPair.Targets[i];
-					newTarget.Type = sourceTarget.Type;
-					newTarget.SlidePosition = PlayTestSlidePositionType::None;
-					newTarget.Flags = sourceTarget.Flags;
-					newTarget.Properties = Rules::TryGetProperties(sourceTarget);
-				}
-
-				for (size_t i = 0; i < newPair.TargetCount; i++)
-				{
-					auto& thisSyncSlide = newPair.Targets[i];
-					if (thisSyncSlide.Flags.IsSync && IsSlideButtonType(thisSyncSlide.Type))
-					{
-						auto& otherSyncSlide = newPair.Targets[(i == 0) ? 1 : 0];
-						thisSyncSlide.SlidePosition = (thisSyncSlide.Properties.Position.x <= otherSyncSlide.Properties.Position.x) ? PlayTestSlidePositionType::Left : PlayTestSlidePositionType::Right;
-					}
-				}
-
-				const auto spawnTimes = chart.TempoMap.GetTargetSpawnTimes(frontPairSourceTarget);
-				newPair.TargetTime = Max(spawnTimes.TargetTime, TimeSpan::Zero());
-				newPair.ButtonTime = spawnTimes.ButtonTime;
-				newPair.FlyingTime = spawnTimes.FlyingTime;
-
-				for (size_t i = 0; i < newPair.TargetCount; i++)
-					newPair.PositionCenter += newPair.Targets[i].Properties.Position;
-				newPair.PositionCenter /= static_cast<f32>(newPair.TargetCount);
-
-				assert(frontPairSourceTarget.Flags.SyncPairCount >= 1);
-				targetIndex += frontPairSourceTarget.Flags.SyncPairCount;
-			}
+			return (binding.InputSource.Type == Input::BindingType::Controller) ||
+				(binding.InputSource.Type == Input::BindingType::Keyboard && binding.InputSource.Keyboard.Modifiers == Input::KeyModifiers_None);
 		}
 
-		inline PlayTestSyncPair* FindBestSuitableUnhitSyncPairToEvaluateNext(std::vector<PlayTestSyncPair>& onScreenTargetPairs, TimeSpan playbackTime)
+		inline PlayTestSyncPair* FindBestSuitableUnhitSyncPairToEvaluateNext(PlayTestSyncPairRange activeOnScreenPairs, TimeSpan playbackTime)
 		{
-			for (auto& onScreenPair : onScreenTargetPairs)
+			for (auto& onScreenPair : activeOnScreenPairs)
 			{
 				if (onScreenPair.NoLongerValid || AllInSyncPairHaveBeenHit(onScreenPair))
 					continue;
@@ -294,6 +101,7 @@ namespace Comfy::Studio::Editor
 		Impl(PlayTestWindow& window, PlayTestContext& context, PlayTestSharedContext& sharedContext)
 			: window(window), context(context), sharedContext(sharedContext)
 		{
+			simulation.SetButtonSoundController(sharedContext.ButtonSoundController);
 		}
 
 	public:
@@ -308,9 +116,9 @@ namespace Comfy::Studio::Editor
 			sharedContext.MoviePlaybackController->OnUpdateTick(GetIsPlayback(), GetPlaybackTime(), sharedContext.Chart->MovieOffset, sharedContext.SongVoice->GetPlaybackSpeed());
 
 			if (GetIsPlayback() && autoplayEnabled)
-				UpdateAutoplayInput();
+				simulation.UpdateAutoplayInput(GetPlaybackTime(), TimeSpan::FromSeconds(Gui::GetIO().DeltaTime * 0.5f), context.Score);
 
-			CheckUpdateHoldStateMaxOut();
+			simulation.CheckUpdateHoldStateMaxOut(GetPlaybackTime());
 
 			DrawBackground();
 			DrawUpdateOnScreenTargets();
@@ -377,9 +185,23 @@ namespace Comfy::Studio::Editor
 		{
 			resetPoint = startTime;
 			fadeInOut.InStopwatch = {};
+
+			chartDuration = sharedContext.Chart->DurationOrDefault();
+			targetTimeline.Rebuild(*sharedContext.Chart);
+
+			// NOTE: Only capture while play testing so that the polling thread and the raised system timer resolution don't outlive the play test
+			if (!inputCapture.IsRunning())
+				inputCapture.Start(Input::CreateNativeInputCaptureSource());
+
 			RestartFromResetPoint();
 		}
 
+		void Stop()
+		{
+			inputCapture.Stop();
+			capturedPressesThisFrame.clear();
+		}
+
 		bool GetAutoplayEnabled() const
 		{
 			return autoplayEnabled;
@@ -391,7 +213,7 @@ namespace Comfy::Studio::Editor
 
 			// TODO: Think about handling this in a more optimal way
 			if (!value)
-				holdState.ClearAll();
+				simulation.GetHoldState().ClearAll();
 		}
 
 		bool GetIsPlayback() const
@@ -400,8 +222,26 @@ namespace Comfy::Studio::Editor
 		}
 
 	private:
+		void DrainCapturedInputPresses()
+		{
+			capturedPressesThisFrame.clear();
+
+			// NOTE: Sample both clocks together to map the capture times onto the song playback time
+			const TimeSpan captureTimeNow = inputCapture.GetTimeNow();
+			const TimeSpan playbackTimeNow = GetPlaybackTime();
+			const f64 playbackSpeed = static_cast<f64>(sharedContext.SongVoice->GetPlaybackSpeed());
+
+			for (Input::TimedInputEvent inputEvent; inputCapture.TryPopEvent(inputEvent);)
+			{
+				if (inputEvent.IsDown)
+					capturedPressesThisFrame.push_back({ inputEvent.Source, playbackTimeNow - ((captureTimeNow - inputEvent.Time) * playbackSpeed) });
+			}
+		}
+
 		void UpdateUserInput()
 		{
+			DrainCapturedInputPresses();
+
 			if (!Gui::IsWindowFocused() || fadeInOut.OutExitStopwatch.IsRunning())
 				return;
 
@@ -430,6 +270,7 @@ namespace Comfy::Studio::Editor
 
 				if (!autoplayEnabled)
 				{
+					auto& holdState = simulation.GetHoldState();
 					if (holdState.CurrentHoldTypes != ButtonTypeFlags_None)
 					{
 						for (size_t i = 0; i < EnumCount<ButtonType>(); i++)
@@ -440,7 +281,7 @@ namespace Comfy::Studio::Editor
 								heldDownBindings.erase(std::remove_if(heldDownBindings.begin(), heldDownBindings.end(), [](auto* b) { return !IsPlayTestBindingDown(*b); }), heldDownBindings.end());
 
 								if (heldDownBindings.empty())
-									ProcessHoldStateCancelNow();
+									simulation.ProcessHoldStateCancelNow(GetPlaybackTime());
 							}
 						}
 					}
@@ -449,7 +290,18 @@ namespace Comfy::Studio::Editor
 
 					for (const auto& binding : GlobalUserData.Input.PlaytestBindings)
 					{
-						UpdateInputBindingButtonInputs(binding);
+						if (inputCapture.IsRunning() && CanPlayTestBindingBeCaptured(binding))
+						{
+							for (const auto& capturedPress : capturedPressesThisFrame)
+							{
+								if (capturedPress.Source == binding.InputSource)
+									UpdateInputBindingButtonInputs(binding, capturedPress.PlaybackTime);
+							}
+						}
+						else if (IsPlayTestBindingPressed(binding))
+						{
+							UpdateInputBindingButtonInputs(binding, GetPlaybackTime());
+						}
 
 						if (IsPlayTestBindingDown(binding))
 						{
@@ -477,6 +329,7 @@ namespace Comfy::Studio::Editor
 
 			RenderChartBackgroundForEditorOrPlaytestUsingGlobalUserData(*sharedContext.Renderer, *sharedContext.RenderHelper, *sharedContext.Chart, *sharedContext.MoviePlaybackController, playbackTime, false);
 
+			const auto& holdState = simulation.GetHoldState();
 			if (!holdState.EventHistory.empty())
 			{
 				const auto lastValidEvent = std::find_if(holdState.EventHistory.rbegin(), holdState.EventHistory.rend(), [&](const auto& e)
@@ -554,207 +407,107 @@ namespace Comfy::Studio::Editor
 		{
 			const auto playbackTime = GetPlaybackTime();
 
-			for (auto& availablePair : availableTargetPairs)
-			{
-				if (availablePair.HasBeenAdded)
-					continue;
-
-				if (availablePair.TargetTime <= playbackTime)
-				{
-					onScreenTargetPairs.push_back(availablePair);
-					availablePair.HasBeenAdded = true;
-				}
-			}
+			simulation.SpawnDueTargetPairs(playbackTime);
+			simulation.UpdateOnScreenTargetPairs(playbackTime, context.Score, [&](const PlayTestSyncPair& onScreenPair) { DrawOnScreenTargetPair(onScreenPair, playbackTime); });
+		}
 
-			for (auto& onScreenPair : onScreenTargetPairs)
-			{
-				if (onScreenPair.NoLongerValid)
-					continue;
+		void DrawOnScreenTargetPair(const PlayTestSyncPair& onScreenPair, TimeSpan playbackTime)
+		{
+			const auto elapsedTime = playbackTime - onScreenPair.TargetTime;
+			const auto remainingTime = onScreenPair.ButtonTime - playbackTime;
 
-				const auto elapsedTime = playbackTime - onScreenPair.TargetTime;
-				const auto remainingTime = onScreenPair.ButtonTime - playbackTime;
+			const f32 progressUnbound = static_cast<f32>(ConvertRange(onScreenPair.TargetTime.TotalSeconds(), onScreenPair.ButtonTime.TotalSeconds(), 0.0, 1.0, playbackTime.TotalSeconds()));
+			const f32 progress = Clamp(progressUnbound, 0.0f, 1.0f);
 
-				const f32 progressUnbound = static_cast<f32>(ConvertRange(onScreenPair.TargetTime.TotalSeconds(), onScreenPair.ButtonTime.TotalSeconds(), 0.0, 1.0, playbackTime.TotalSeconds()));
-				const f32 progress = Clamp(progressUnbound, 0.0f, 1.0f);
+			const f32 hitMissProgress = Clamp(static_cast<f32>(ConvertRange(0.0, -HitThreshold::Worst.TotalSeconds(), 1.0, 0.0, remainingTime.TotalSeconds())), 0.0f, 1.0f);
 
-				constexpr TimeSpan maxPostHitAnimationDuration = TimeSpan::FromSeconds(2.0);
-				if (remainingTime < -maxPostHitAnimationDuration)
-					onScreenPair.NoLongerValid = true;
+			for (size_t i = 0; i < onScreenPair.TargetCount; i++)
+			{
+				const auto& onScreenTarget = onScreenPair.Targets[i];
 
-				const f32 hitMissProgress = Clamp(static_cast<f32>(ConvertRange(0.0, -HitThreshold::Worst.TotalSeconds(), 1.0, 0.0, remainingTime.TotalSeconds())), 0.0f, 1.0f);
+				auto properties = onScreenTarget.Properties;
+				if (onScreenTarget.Flags.IsChain && !onScreenTarget.Flags.IsChainStart)
+					properties.Position.x += Rules::ChainFragmentStartEndOffsetDistance * (onScreenTarget.Type == ButtonType::SlideL ? -1.0f : +1.0f);
 
-				for (size_t i = 0; i < onScreenPair.TargetCount; i++)
+				if (!onScreenTarget.HasBeenHit)
 				{
-					auto& onScreenTarget = onScreenPair.Targets[i];
-
-					if (onScreenTarget.Flags.IsChain)
-					{
-						const auto chainSlot = (onScreenTarget.Type == ButtonType::SlideL) ? ChainSoundSlot::Left : ChainSoundSlot::Right;
-						if (!onScreenTarget.HasBeenHit && onScreenTarget.HasBeenChainHit && !onScreenTarget.HasAnyChainFragmentFailed && remainingTime <= TimeSpan::Zero())
-						{
-							ForEachFragmentInChain(onScreenTargetPairs, onScreenPair, onScreenTarget, [&](PlayTestSyncPair& fragmentPair, PlayTestTarget& fragment)
-							{
-								fragment.HasAnyChainHitAttemptBeenMade = true;
-							});
-
-							onScreenTarget.HasBeenHit = true;
-							onScreenTarget.RemainingTimeOnHit = TimeSpan::Zero();
-							onScreenTarget.HitEvaluation = HitEvaluation::Cool;
-
-							if (onScreenTarget.Flags.IsChainStart)
-							{
-								sharedContext.ButtonSoundController->PlayChainSoundStart(chainSlot);
-								context.Score.ComboCount++;
-								context.Score.ChainSlideScore = 0;
-
-								ForEachFragmentInChain(onScreenTargetPairs, onScreenPair, onScreenTarget, [&](PlayTestSyncPair& fragmentPair, PlayTestTarget& fragment)
-								{
-									fragment.HasAnyChainStartFragmentBeenHit = true;
-								});
-							}
-							else
-							{
-								if (onScreenTarget.Flags.IsChainEnd)
-								{
-									sharedContext.ButtonSoundController->FadeOutLastChainSound(chainSlot);
-									sharedContext.ButtonSoundController->PlayChainSoundSuccess(chainSlot);
-									context.Score.ChainSlideScore += 1000;
-								}
-
-								context.Score.ChainSlideScore += 10;
-								lastSlideActionStopwatch.Restart();
-							}
-						}
-
-						if (!onScreenTarget.HasBeenHit && !onScreenTarget.HasBeenChainHit && remainingTime < -HitThreshold::Worst)
-						{
-							if (!onScreenTarget.HasAnyChainFragmentFailed)
-							{
-								onScreenTarget.ThisFragmentCausedChainFailure = true;
-								ForEachFragmentInChain(onScreenTargetPairs, onScreenPair, onScreenTarget, [&](PlayTestSyncPair& fragmentPair, PlayTestTarget& fragment)
-								{
-									fragment.HasAnyChainFragmentFailed = true;
-								});
-
-								if (onScreenTarget.HasAnyChainHitAttemptBeenMade)
-								{
-									sharedContext.ButtonSoundController->FadeOutLastChainSound(chainSlot);
-									sharedContext.ButtonSoundController->PlayChainSoundFailure(chainSlot);
-								}
-
-								context.Score.ChainSlideScore = 0;
-							}
-
-							onScreenTarget.HasBeenHit = true;
-							onScreenTarget.RemainingTimeOnHit = remainingTime;
-							onScreenTarget.HasTimedOut = true;
-							onScreenTarget.HitEvaluation = onScreenTarget.WrongTypeOnTimeOut ? HitEvaluation::WrongCool : HitEvaluation::Worst;
-							onScreenTarget.HitPrecision = HitPrecision::Late;
-
-							context.Score.ComboCount = 0;
-						}
-					}
-					else if (!onScreenTarget.HasBeenHit && remainingTime < -HitThreshold::Worst)
-					{
-						onScreenTarget.HasBeenHit = true;
-						onScreenTarget.RemainingTimeOnHit = remainingTime;
-						onScreenTarget.HasTimedOut = true;
-						onScreenTarget.HitEvaluation = onScreenTarget.WrongTypeOnTimeOut ? HitEvaluation::WrongCool : HitEvaluation::Worst;
-						onScreenTarget.HitPrecision = HitPrecision::Late;
-
-						if (onScreenTarget.WrongTypeOnTimeOut && IsSlideButtonType(onScreenTarget.Type))
-							sharedContext.ButtonSoundController->PlaySlideSound();
-
-						if (AllInSyncPairHaveBeenHit(onScreenPair))
-							ProcessHoldStateForFullyHitSyncPair(onScreenPair);
-
-						context.Score.ComboCount = 0;
-					}
-
-					auto properties = onScreenTarget.Properties;
-					if (onScreenTarget.Flags.IsChain && !onScreenTarget.Flags.IsChainStart)
-						properties.Position.x += Rules::ChainFragmentStartEndOffsetDistance * (onScreenTarget.Type == ButtonType::SlideL ? -1.0f : +1.0f);
+					auto& targetData = context.RenderHelperEx.EmplaceTarget();
+					targetData.Type = onScreenTarget.Type;
+					targetData.Sync = onScreenTarget.Flags.IsSync;
+					targetData.HoldText = onScreenTarget.Flags.IsHold;
+					targetData.Chain = onScreenTarget.Flags.IsChain;
+					targetData.ChainStart = onScreenTarget.Flags.IsChainStart;
+					targetData.ChainHit = onScreenTarget.HasBeenChainHit;
+					targetData.Chance = onScreenTarget.Flags.IsChance;
+					targetData.Position = properties.Position;
+					targetData.Progress = progressUnbound;
+					targetData.Scale = hitMissProgress;
+					targetData.Opacity = 1.0f;
+
+					auto& targetAppearData = context.RenderHelperEx.EmplaceTargetAppear();
+					targetAppearData.Position = properties.Position;
+					targetAppearData.Time = elapsedTime;
+				}
 
-					if (!onScreenTarget.HasBeenHit)
-					{
-						auto& targetData = context.RenderHelperEx.EmplaceTarget();
-						targetData.Type = onScreenTarget.Type;
-						targetData.Sync = onScreenTarget.Flags.IsSync;
-						targetData.HoldText = onScreenTarget.Flags.IsHold;
-						targetData.Chain = onScreenTarget.Flags.IsChain;
-						targetData.ChainStart = onScreenTarget.Flags.IsChainStart;
-						targetData.ChainHit = onScreenTarget.HasBeenChainHit;
-						targetData.Chance = onScreenTarget.Flags.IsChance;
-						targetData.Position = properties.Position;
-						targetData.Progress = progressUnbound;
-						targetData.Scale = hitMissProgress;
-						targetData.Opacity = 1.0f;
-
-						auto& targetAppearData = context.RenderHelperEx.EmplaceTargetAppear();
-						targetAppearData.Position = properties.Position;
-						targetAppearData.Time = elapsedTime;
-					}
+				if (onScreenTarget.HasBeenHit && (!onScreenTarget.HasTimedOut || onScreenTarget.WrongTypeOnTimeOut))
+				{
+					const auto timeOnHit = onScreenPair.ButtonTime - onScreenTarget.RemainingTimeOnHit;
+					const auto timeSinceHit = playbackTime - timeOnHit;
 
-					if (onScreenTarget.HasBeenHit && (!onScreenTarget.HasTimedOut || onScreenTarget.WrongTypeOnTimeOut))
+					auto& targetHitData = context.RenderHelperEx.EmplaceTargetHit();
+					targetHitData.Position = properties.Position;
+					targetHitData.Time = timeSinceHit;
+					if (!onScreenTarget.WrongTypeOnTimeOut)
 					{
-						const auto timeOnHit = onScreenPair.ButtonTime - onScreenTarget.RemainingTimeOnHit;
-						const auto timeSinceHit = playbackTime - timeOnHit;
-
-						auto& targetHitData = context.RenderHelperEx.EmplaceTargetHit();
-						targetHitData.Position = properties.Position;
-						targetHitData.Time = timeSinceHit;
-						if (!onScreenTarget.WrongTypeOnTimeOut)
-						{
-							targetHitData.SlideL = (onScreenTarget.Type == ButtonType::SlideL);
-							targetHitData.SlideR = (onScreenTarget.Type == ButtonType::SlideR);
-							targetHitData.Chain = onScreenTarget.Flags.IsChain;
-						}
-						targetHitData.CoolHit = (onScreenTarget.HitEvaluation == HitEvaluation::Cool);
-						targetHitData.FineHit = (onScreenTarget.HitEvaluation == HitEvaluation::Fine);
-						targetHitData.SafeHit = (onScreenTarget.HitEvaluation == HitEvaluation::Safe);
-						targetHitData.SadHit = (onScreenTarget.HitEvaluation == HitEvaluation::Sad);
+						targetHitData.SlideL = (onScreenTarget.Type == ButtonType::SlideL);
+						targetHitData.SlideR = (onScreenTarget.Type == ButtonType::SlideR);
+						targetHitData.Chain = onScreenTarget.Flags.IsChain;
 					}
+					targetHitData.CoolHit = (onScreenTarget.HitEvaluation == HitEvaluation::Cool);
+					targetHitData.FineHit = (onScreenTarget.HitEvaluation == HitEvaluation::Fine);
+					targetHitData.SafeHit = (onScreenTarget.HitEvaluation == HitEvaluation::Safe);
+					targetHitData.SadHit = (onScreenTarget.HitEvaluation == HitEvaluation::Sad);
+				}
 
-					if (!onScreenTarget.HasBeenHit)
-					{
-						auto& buttonData = context.RenderHelperEx.EmplaceButton();
-						buttonData.Type = onScreenTarget.Type;
-						buttonData.Sync = onScreenTarget.Flags.IsSync;
-						buttonData.Chain = onScreenTarget.Flags.IsChain;
-						buttonData.ChainStart = onScreenTarget.Flags.IsChainStart;
-						buttonData.Shadow = TargetRenderHelper::ButtonShadowType::Black;
-						buttonData.Position = GetButtonPathSinePoint(progressUnbound, properties);
-						buttonData.Progress = progress;
-						buttonData.Scale = hitMissProgress;
-					}
+				if (!onScreenTarget.HasBeenHit)
+				{
+					auto& buttonData = context.RenderHelperEx.EmplaceButton();
+					buttonData.Type = onScreenTarget.Type;
+					buttonData.Sync = onScreenTarget.Flags.IsSync;
+					buttonData.Chain = onScreenTarget.Flags.IsChain;
+					buttonData.ChainStart = onScreenTarget.Flags.IsChainStart;
+					buttonData.Shadow = TargetRenderHelper::ButtonShadowType::Black;
+					buttonData.Position = GetButtonPathSinePoint(progressUnbound, properties);
+					buttonData.Progress = progress;
+					buttonData.Scale = hitMissProgress;
+				}
 
-					if (!onScreenTarget.Flags.IsSync && !onScreenTarget.HasBeenHit)
-					{
-						auto& trailData = context.RenderHelperEx.EmplaceButtonTrail();
-						context.RenderHelperEx.ConstructButtonTrail(trailData, onScreenTarget.Type, progressUnbound, progressUnbound, properties, onScreenPair.FlyingTime);
-						trailData.ProgressMax = std::numeric_limits<f32>::max();
-						trailData.Opacity = hitMissProgress;
-					}
+				if (!onScreenTarget.Flags.IsSync && !onScreenTarget.HasBeenHit)
+				{
+					auto& trailData = context.RenderHelperEx.EmplaceButtonTrail();
+					context.RenderHelperEx.ConstructButtonTrail(trailData, onScreenTarget.Type, progressUnbound, progressUnbound, properties, onScreenPair.FlyingTime);
+					trailData.ProgressMax = std::numeric_limits<f32>::max();
+					trailData.Opacity = hitMissProgress;
 				}
+			}
+
+			if (onScreenPair.TargetCount > 1)
+			{
+				bool anyInSyncPairHit = false;
+				for (size_t i = 0; i < onScreenPair.TargetCount; i++)
+					anyInSyncPairHit |= onScreenPair.Targets[i].HasBeenHit;
 
-				if (onScreenPair.TargetCount > 1)
+				if (!anyInSyncPairHit)
 				{
-					bool anyInSyncPairHit = false;
+					auto& syncLineData = context.RenderHelperEx.EmplaceSyncLine();
+					syncLineData.SyncPairCount = onScreenPair.TargetCount;
+					syncLineData.Progress = progressUnbound;
+					syncLineData.Scale = hitMissProgress;
+					syncLineData.Opacity = hitMissProgress;
 					for (size_t i = 0; i < onScreenPair.TargetCount; i++)
-						anyInSyncPairHit |= onScreenPair.Targets[i].HasBeenHit;
-
-					if (!anyInSyncPairHit)
 					{
-						auto& syncLineData = context.RenderHelperEx.EmplaceSyncLine();
-						syncLineData.SyncPairCount = onScreenPair.TargetCount;
-						syncLineData.Progress = progressUnbound;
-						syncLineData.Scale = hitMissProgress;
-						syncLineData.Opacity = hitMissProgress;
-						for (size_t i = 0; i < onScreenPair.TargetCount; i++)
-						{
-							syncLineData.TargetPositions[i] = onScreenPair.Targets[i].Properties.Position;
-							syncLineData.ButtonPositions[i] = GetButtonPathSinePoint(progressUnbound, onScreenPair.Targets[i].Properties);
-						}
+						syncLineData.TargetPositions[i] = onScreenPair.Targets[i].Properties.Position;
+						syncLineData.ButtonPositions[i] = GetButtonPathSinePoint(progressUnbound, onScreenPair.Targets[i].Properties);
 					}
 				}
 			}
@@ -779,6 +532,7 @@ namespace Comfy::Studio::Editor
 			bool comboTextDrawn = false;
 			bool chainSlidePointTextDrawn = false;
 
+			const auto& onScreenTargetPairs = simulation.GetOnScreenPairs();
 			for (i32 i = static_cast<i32>(onScreenTargetPairs.size()) - 1; i >= 0; i--)
 			{
 				const auto& onScreenPair = onScreenTargetPairs[i];
@@ -913,6 +667,8 @@ namespace Comfy::Studio::Editor
 					return buffer;
 				};
 
+				const auto& holdState = simulation.GetHoldState();
+
 				static std::string buffer; buffer.clear();
 				buffer += "CurrentHoldTypes: ";
 				if (holdState.CurrentHoldTypes == ButtonTypeFlags_None)
@@ -1040,129 +796,20 @@ namespace Comfy::Studio::Editor
 					sharedContext.ButtonSoundController->FadeOutLastChainSound(static_cast<ChainSoundSlot>(i));
 			}
 
-			holdState.ClearAll();
-
 			SetPlaybackTime(startTime);
 			sharedContext.SongVoice->SetIsPlaying(true);
 			sharedContext.MoviePlaybackController->OnResume(startTime);
 
-			chartDuration = sharedContext.Chart->DurationOrDefault();
-			availableTargetPairs.clear();
-			ChartToPlayTestTargets(*sharedContext.Chart, availableTargetPairs);
-			onScreenTargetPairs.clear();
-			onScreenTargetPairs.reserve(availableTargetPairs.size());
-
-			for (auto& pair : availableTargetPairs)
-			{
-				if (pair.TargetTime < startTime)
-				{
-					pair.NoLongerValid = true;
-
-					for (size_t i = 0; i < pair.TargetCount; i++)
-					{
-						// NOTE: Ensure all chains always have a valid start fragment
-						if (pair.Targets[i].Flags.IsChain)
-							ForEachFragmentInChain(availableTargetPairs, pair, pair.Targets[i], [&](auto& chainPair, auto& fragment) { chainPair.NoLongerValid = true; });
-					}
-				}
-			}
+			simulation.Restart(targetTimeline, startTime);
 
 			if (resetScore)
 				context.Score = {};
 		}
 
-		void UpdateAutoplayInput()
+		void UpdateInputBindingButtonInputs(const PlayTestInputBinding& binding, TimeSpan playbackTime)
 		{
-			const auto playbackTime = GetPlaybackTime();
-			const auto deltaPerfectHitThreshold = TimeSpan::FromSeconds(Gui::GetIO().DeltaTime * 0.5f);
-
-			for (auto& onScreenPair : onScreenTargetPairs)
-			{
-				if (onScreenPair.NoLongerValid || AllInSyncPairHaveBeenHit(onScreenPair))
-					continue;
-
-				const auto remainingTime = (onScreenPair.ButtonTime - playbackTime);
-				if (remainingTime <= deltaPerfectHitThreshold)
-				{
-					for (size_t i = 0; i < onScreenPair.TargetCount; i++)
-					{
-						auto& target = onScreenPair.Targets[i];
-						if (target.HasBeenHit || target.Flags.IsChain)
-							continue;
-
-						if (IsSlideButtonType(target.Type))
-							sharedContext.ButtonSoundController->PlaySlideSound();
-						else
-							sharedContext.ButtonSoundController->PlayButtonSound();
-
-						target.RemainingTimeOnHit = TimeSpan::Zero();
-						target.HasBeenHit = true;
-						target.HitEvaluation = HitEvaluation::Cool;
-						target.HitPrecision = HitPrecision::Just;
-
-						if (AllInSyncPairHaveBeenHit(onScreenPair))
-						{
-							context.Score.ComboCount++;
-
-							ProcessHoldStateForFullyHitSyncPair(onScreenPair);
-						}
-
-					}
-				}
-			}
-
-			for (auto& onScreenPair : onScreenTargetPairs)
-			{
-				if (onScreenPair.NoLongerValid || AllInSyncPairHaveBeenHit(onScreenPair))
-					continue;
-
-				for (size_t i = 0; i < onScreenPair.TargetCount; i++)
-				{
-					auto& target = onScreenPair.Targets[i];
-					if (!target.Flags.IsChain || target.HasBeenChainHit)
-						continue;
-
-					if (!target.HasAnyChainStartFragmentBeenHit)
-					{
-						const auto remainingTime = (onScreenPair.ButtonTime - playbackTime);
-						if (remainingTime <= deltaPerfectHitThreshold)
-							target.HasBeenChainHit = true;
-					}
-					else
-					{
-						const auto progress = static_cast<f32>(ConvertRange(onScreenPair.TargetTime.TotalSeconds(), onScreenPair.ButtonTime.TotalSeconds(), 0.0, 1.0, playbackTime.TotalSeconds()));
-						if (progress >= HitThreshold::ChainSlidePreHitProgress)
-							target.HasBeenChainHit = true;
-					}
-				}
-			}
-		}
-
-		void CheckUpdateHoldStateMaxOut()
-		{
-			if (holdState.CurrentHoldTypes != ButtonTypeFlags_None && !holdState.EventHistory.empty())
-			{
-				const auto lastEvent = holdState.EventHistory.back();
-				if (lastEvent.EventType == PlayTestHoldEventType::Start || lastEvent.EventType == PlayTestHoldEventType::Addition)
-				{
-					const auto timeSinceLastEvent = (GetPlaybackTime() - lastEvent.PlaybackTime);
-					if (timeSinceLastEvent >= MaxTargetHoldDuration)
-					{
-						holdState.EventHistory.push_back({ PlayTestHoldEventType::MaxOut, holdState.CurrentHoldTypes, GetPlaybackTime(), nullptr });
-						holdState.CurrentHoldTypes = ButtonTypeFlags_None;
-						holdState.ClearAllHeldDownBindings();
-					}
-				}
-			}
-		}
-
-		void UpdateInputBindingButtonInputs(const PlayTestInputBinding& binding)
-		{
-			if (!IsPlayTestBindingPressed(binding))
-				return;
-
-			const auto playbackTime = GetPlaybackTime();
-			PlayTestSyncPair* nextPairToHit = FindBestSuitableUnhitSyncPairToEvaluateNext(onScreenTargetPairs, playbackTime);
+			PlayTestSyncPair* nextPairToHit = FindBestSuitableUnhitSyncPairToEvaluateNext(simulation.GetActiveOnScreenPairs(), playbackTime);
+			auto& holdState = simulation.GetHoldState();
 
 			bool anyTargetWasHit = false;
 
@@ -1250,7 +897,7 @@ namespace Comfy::Studio::Editor
 					if (matchingType && IsSlideButtonType(nextTargetToHit->Type))
 					{
 						sharedContext.ButtonSoundController->PlaySlideSound();
-						lastSlideActionStopwatch.Restart();
+						simulation.GetLastSlideActionStopwatch().Restart();
 					}
 
 					nextTargetToHit->HasBeenHit = true;
@@ -1309,7 +956,7 @@ namespace Comfy::Studio::Editor
 					if (inputTypeMatchesAny)
 					{
 						if (AllInSyncPairHaveBeenHit(*nextPairToHit))
-							ProcessHoldStateForFullyHitSyncPair(*nextPairToHit);
+							simulation.ProcessHoldStateForFullyHitSyncPair(*nextPairToHit, playbackTime);
 
 						if (nextTargetToHit->Flags.IsHold)
 							holdState.PerTypeHeldDownBindings[static_cast<size_t>(nextTargetToHit->Type)].push_back(&binding);
@@ -1318,7 +965,7 @@ namespace Comfy::Studio::Editor
 					{
 						const bool inputTypeIsBeingHeld = holdState.CurrentHoldTypes & binding.ButtonTypes;
 						if (inputTypeIsBeingHeld)
-							ProcessHoldStateCancelNow();
+							simulation.ProcessHoldStateCancelNow(playbackTime);
 					}
 				}
 			}
@@ -1352,6 +999,7 @@ namespace Comfy::Studio::Editor
 
 		void UpdateChainSlideDirection(ButtonType slideDirection, f32 strength, SliderTouchPoint& touchPoint)
 		{
+			const auto& lastSlideActionStopwatch = simulation.GetLastSlideActionStopwatch();
 			if (lastSlideActionStopwatch.IsRunning() && lastSlideActionStopwatch.GetElapsed() < TimeSpan::FromSeconds(1.0))
 			{
 				touchPoint.NormalizedPosition = 0.5f;
@@ -1371,7 +1019,7 @@ namespace Comfy::Studio::Editor
 
 			const auto playbackTime = GetPlaybackTime();
 
-			for (auto& onScreenPair : onScreenTargetPairs)
+			for (auto& onScreenPair : simulation.GetActiveOnScreenPairs())
 			{
 				if (onScreenPair.NoLongerValid)
 					continue;
@@ -1406,60 +1054,6 @@ namespace Comfy::Studio::Editor
 			}
 		}
 
-		void ProcessHoldStateCancelNow()
-		{
-			holdState.CurrentHoldTypes = ButtonTypeFlags_None;
-			holdState.EventHistory.push_back({ PlayTestHoldEventType::Cancel, holdState.CurrentHoldTypes, GetPlaybackTime(), nullptr });
-			holdState.ClearAllHeldDownBindings();
-		}
-
-		void ProcessHoldStateForFullyHitSyncPair(const PlayTestSyncPair& syncPair)
-		{
-			const ButtonTypeFlags pairHoldTypes = GetSyncPairHoldTypeFlags(syncPair);
-			const ButtonTypeFlags pairTypes = GetSyncPairTypeFlags(syncPair);
-			const bool typeIsAlreadyBeingHeld = (holdState.CurrentHoldTypes & pairTypes);
-
-			if (pairHoldTypes != ButtonTypeFlags_None && AllInSyncPairHaveBeenHitByPlayer(syncPair))
-			{
-				if (typeIsAlreadyBeingHeld || (holdState.CurrentHoldTypes == ButtonTypeFlags_None))
-				{
-					holdState.CurrentHoldTypes = pairHoldTypes;
-					holdState.EventHistory.push_back({ PlayTestHoldEventType::Start, holdState.CurrentHoldTypes, GetPlaybackTime(), &syncPair });
-
-					if (pairHoldTypes == pairTypes)
-						holdState.ClearAllHeldDownBindings();
-				}
-				else
-				{
-					holdState.CurrentHoldTypes |= pairHoldTypes;
-					holdState.EventHistory.push_back({ PlayTestHoldEventType::Addition, holdState.CurrentHoldTypes, GetPlaybackTime(), &syncPair });
-				}
-			}
-			else if (typeIsAlreadyBeingHeld)
-			{
-				// BUG: Something about this still isn't right... for example:
-				//		PREREQUISITE: 
-				//		- Single Triangle(Hold) followed by Triangle(Hold)+Square(Hold)
-				//
-				//		USER_INPUT: 
-				//		- Hit and hold first Triangle, then hit and release only second Triangle
-				//		RESULT: 
-				//		- Hold combo not canceled
-				//		EXPECTED:
-				//		- Hold combo immediately canceled
-				//
-				//		USER_INPUT: 
-				//		- Hit and hold first Triangle, then hit and release only second Square
-				//		RESULT:
-				//		- Hold combo canceled once Square released despite Square not being part of the active (displayed) hold combo
-				//		EXPECTED:
-				//		- Hold combo not affected at all, until rest of sync pair has been hit by the user (or any target hit that is part of the active hold combo)
-
-				if (AllInSyncPairHaveBeenHitByPlayer(syncPair))
-					ProcessHoldStateCancelNow();
-			}
-		}
-
 		TimeSpan GetPlaybackTime() const
 		{
 			const auto currentAudioBackend = Audio::AudioEngine::GetInstance().GetAudioBackend();
@@ -1492,13 +1086,22 @@ namespace Comfy::Studio::Editor
 
 		TimeSpan resetPoint = TimeSpan::Zero();
 		TimeSpan chartDuration = TimeSpan::FromMinutes(1.0);
-		std::vector<PlayTestSyncPair> availableTargetPairs, onScreenTargetPairs;
 
-		PlayTestHoldState holdState = {};
+		PlayTestTargetTimeline targetTimeline = {};
+		PlayTestSimulation simulation = {};
 
 		bool autoplayEnabled = false;
 
-		Stopwatch lastSlideActionStopwatch = {};
+		struct CapturedPress
+		{
+			Input::Binding Source;
+			TimeSpan PlaybackTime;
+		};
+
+		// NOTE: Button presses are timestamped by the capture thread so that the hit timing isn't quantized to the frame rate
+		Input::InputCaptureThread inputCapture;
+		std::vector<CapturedPress> capturedPressesThisFrame;
+
 		SliderTouchPoint sliderTouchPointL = { -1.0f }, sliderTouchPointR = { +1.0f };
 
 		struct PauseFadeData
@@ -1609,6 +1212,11 @@ namespace Comfy::Studio::Editor
 		return impl->Restart(startTime);
 	}
 
+	void PlayTestCore::Stop()
+	{
+		return impl->Stop();
+	}
+
 	bool PlayTestCore::GetAutoplayEnabled() const
 	{
 		return impl->GetAutoplayEnabled();
@@ -57,6 +57,7 @@ namespace Comfy::Studio::Editor
 		void OverlayGui();
 		PlayTestExitType GetAndClearExitRequestThisFrame();
 		void Restart(TimeSpan startTime);
+		void Stop();
 
 		bool GetAutoplayEnabled() const;
 		void SetAutoplayEnabled(bool value);
@@ -0,0 +1,536 @@
+#include "PlayTestSimulation.h"
+
+namespace Comfy::Studio::Editor
+{
+	namespace
+	{
+		void ChartToPlayTestTargets(const Chart& chart, std::vector<PlayTestSyncPair>& outTargets)
+		{
+			outTargets.reserve(chart.Targets.size());
+
+			for (size_t targetIndex = 0; targetIndex < chart.Targets.size();)
+			{
+				const auto& frontPairSourceTarget = chart.Targets[targetIndex];
+
+				auto& newPair = outTargets.emplace_back();
+				newPair.TargetCount = static_cast<u8>(Min(static_cast<size_t>(frontPairSourceTarget.Flags.SyncPairCount), newPair.Targets.size()));
+				for (size_t i = 0; i < newPair.TargetCount; i++)
+				{
+					const auto& sourceTarget = chart.Targets[targetIndex + i];
+
+					auto& newTarget = newPair.Targets[i];
+					newTarget.Type = sourceTarget.Type;
+					newTarget.SlidePosition = PlayTestSlidePositionType::None;
+					newTarget.Flags = sourceTarget.Flags;
+					newTarget.Properties = Rules::TryGetProperties(sourceTarget);
+				}
+
+				for (size_t i = 0; i < newPair.TargetCount; i++)
+				{
+					auto& thisSyncSlide = newPair.Targets[i];
+					if (thisSyncSlide.Flags.IsSync && IsSlideButtonType(thisSyncSlide.Type))
+					{
+						auto& otherSyncSlide = newPair.Targets[(i == 0) ? 1 : 0];
+						thisSyncSlide.SlidePosition = (thisSyncSlide.Properties.Position.x <= otherSyncSlide.Properties.Position.x) ? PlayTestSlidePositionType::Left : PlayTestSlidePositionType::Right;
+					}
+				}
+
+				const auto spawnTimes = chart.TempoMap.GetTargetSpawnTimes(frontPairSourceTarget);
+				newPair.TargetTime = Max(spawnTimes.TargetTime, TimeSpan::Zero());
+				newPair.ButtonTime = spawnTimes.ButtonTime;
+				newPair.FlyingTime = spawnTimes.FlyingTime;
+
+				for (size_t i = 0; i < newPair.TargetCount; i++)
+					newPair.PositionCenter += newPair.Targets[i].Properties.Position;
+				newPair.PositionCenter /= static_cast<f32>(newPair.TargetCount);
+
+				assert(frontPairSourceTarget.Flags.SyncPairCount >= 1);
+				targetIndex += frontPairSourceTarget.Flags.SyncPairCount;
+			}
+		}
+
+		void UpdateEarliestChainTargetTimes(std::vector<PlayTestSyncPair>& pairs)
+		{
+			// NOTE: Running minimum target time of all pairs containing a fragment of the current chain, per slide direction.
+			//		 Equivalent to walking each chain forward from every pair that starts before the playback start time
+			std::array<TimeSpan, 2> chainMinTargetTimes = { TimeSpan::FromSeconds(std::numeric_limits<f64>::max()), TimeSpan::FromSeconds(std::numeric_limits<f64>::max()) };
+
+			for (auto& pair : pairs)
+			{
+				pair.EarliestChainTargetTime = pair.TargetTime;
+
+				for (size_t i = 0; i < pair.TargetCount; i++)
+				{
+					const auto& target = pair.Targets[i];
+					if (!target.Flags.IsChain)
+						continue;
+
+					auto& chainMinTargetTime = chainMinTargetTimes[(target.Type == ButtonType::SlideL) ? 0 : 1];
+					chainMinTargetTime = Min(chainMinTargetTime, pair.TargetTime);
+					pair.EarliestChainTargetTime = Min(pair.EarliestChainTargetTime, chainMinTargetTime);
+
+					if (target.Flags.IsChainEnd)
+						chainMinTargetTime = TimeSpan::FromSeconds(std::numeric_limits<f64>::max());
+				}
+			}
+		}
+	}
+
+	void PlayTestTargetTimeline::Rebuild(const Chart& chart)
+	{
+		pairs.clear();
+		ChartToPlayTestTargets(chart, pairs);
+		UpdateEarliestChainTargetTimes(pairs);
+
+		spawnEvents.resize(pairs.size());
+		for (size_t i = 0; i < pairs.size(); i++)
+			spawnEvents[i] = { pairs[i].TargetTime, static_cast<u32>(i), static_cast<u32>(i) };
+
+		// NOTE: Target times aren't necessarily in chart order because the flying time can change between tempo changes
+		std::stable_sort(spawnEvents.begin(), spawnEvents.end(), [](const auto& a, const auto& b) { return a.TargetTime < b.TargetTime; });
+
+		outOfOrderSpawnEventIndices.clear();
+		for (i32 i = static_cast<i32>(spawnEvents.size()) - 2; i >= 0; i--)
+		{
+			const u32 minPairIndexAfter = spawnEvents[i + 1].MinPairIndexFromHere;
+			spawnEvents[i].MinPairIndexFromHere = Min(spawnEvents[i].PairIndex, minPairIndexAfter);
+
+			if (spawnEvents[i].PairIndex > minPairIndexAfter)
+				outOfOrderSpawnEventIndices.push_back(static_cast<u32>(i));
+		}
+		std::reverse(outOfOrderSpawnEventIndices.begin(), outOfOrderSpawnEventIndices.end());
+	}
+
+	const std::vector<PlayTestSyncPair>& PlayTestTargetTimeline::GetPairs() const
+	{
+		return pairs;
+	}
+
+	const std::vector<PlayTestTargetTimeline::SpawnEvent>& PlayTestTargetTimeline::GetSpawnEvents() const
+	{
+		return spawnEvents;
+	}
+
+	size_t PlayTestTargetTimeline::FindFirstSpawnEventIndexAtOrAfter(TimeSpan time) const
+	{
+		const auto found = std::lower_bound(spawnEvents.begin(), spawnEvents.end(), time, [](const auto& e, TimeSpan t) { return e.TargetTime < t; });
+		return static_cast<size_t>(std::distance(spawnEvents.begin(), found));
+	}
+
+	const std::vector<u32>& PlayTestTargetTimeline::GetOutOfOrderSpawnEventIndices() const
+	{
+		return outOfOrderSpawnEventIndices;
+	}
+
+	void PlayTestSimulation::Restart(const PlayTestTargetTimeline& targetTimeline, TimeSpan startTime)
+	{
+		this->targetTimeline = &targetTimeline;
+		this->startTime = startTime;
+
+		holdState.ClearAll();
+
+		// NOTE: Reserve all up front because the hold state event history stores pointers to the on-screen pairs
+		onScreenPairs.clear();
+		onScreenPairs.reserve(targetTimeline.GetPairs().size());
+		firstActiveOnScreenPairIndex = 0;
+
+		const auto& spawnEvents = targetTimeline.GetSpawnEvents();
+		spawnEventCursor = targetTimeline.FindFirstSpawnEventIndexAtOrAfter(startTime);
+
+		// NOTE: Skipped pairs are never updated, however out of order ones may still be visited while iterating over a chain
+		//		 so they are spawned along with the first due pairs to keep the on-screen order identical to spawning all of them
+		dueSpawnPairIndices.clear();
+		if (spawnEventCursor < spawnEvents.size())
+		{
+			const u32 minFuturePairIndex = spawnEvents[spawnEventCursor].MinPairIndexFromHere;
+			for (const u32 eventIndex : targetTimeline.GetOutOfOrderSpawnEventIndices())
+			{
+				if (eventIndex >= spawnEventCursor)
+					break;
+
+				if (spawnEvents[eventIndex].PairIndex > minFuturePairIndex)
+					dueSpawnPairIndices.push_back(spawnEvents[eventIndex].PairIndex);
+			}
+		}
+	}
+
+	void PlayTestSimulation::SpawnDueTargetPairs(TimeSpan playbackTime)
+	{
+		if (targetTimeline == nullptr)
+			return;
+
+		const auto& spawnEvents = targetTimeline->GetSpawnEvents();
+		while (spawnEventCursor < spawnEvents.size() && spawnEvents[spawnEventCursor].TargetTime <= playbackTime)
+			dueSpawnPairIndices.push_back(spawnEvents[spawnEventCursor++].PairIndex);
+
+		if (dueSpawnPairIndices.empty())
+			return;
+
+		// NOTE: Pairs spawned within the same frame are added in chart order
+		std::sort(dueSpawnPairIndices.begin(), dueSpawnPairIndices.end());
+
+		const auto& pairs = targetTimeline->GetPairs();
+		for (const u32 pairIndex : dueSpawnPairIndices)
+		{
+			auto& newPair = onScreenPairs.emplace_back(pairs[pairIndex]);
+			newPair.HasBeenAdded = true;
+			newPair.NoLongerValid = (newPair.EarliestChainTargetTime < startTime);
+		}
+
+		dueSpawnPairIndices.clear();
+	}
+
+	void PlayTestSimulation::UpdateOnScreenTargetPairs(TimeSpan playbackTime, PlayTestScore& score, const std::function<void(const PlayTestSyncPair&)>& perUpdatedPairFunc)
+	{
+		for (auto& onScreenPair : GetActiveOnScreenPairs())
+		{
+			if (onScreenPair.NoLongerValid)
+				continue;
+
+			const auto remainingTime = onScreenPair.ButtonTime - playbackTime;
+
+			constexpr TimeSpan maxPostHitAnimationDuration = TimeSpan::FromSeconds(2.0);
+			if (remainingTime < -maxPostHitAnimationDuration)
+				onScreenPair.NoLongerValid = true;
+
+			for (size_t i = 0; i < onScreenPair.TargetCount; i++)
+			{
+				auto& onScreenTarget = onScreenPair.Targets[i];
+
+				if (onScreenTarget.Flags.IsChain)
+				{
+					const auto chainSlot = (onScreenTarget.Type == ButtonType::SlideL) ? ChainSoundSlot::Left : ChainSoundSlot::Right;
+					if (!onScreenTarget.HasBeenHit && onScreenTarget.HasBeenChainHit && !onScreenTarget.HasAnyChainFragmentFailed && remainingTime <= TimeSpan::Zero())
+					{
+						ForEachFragmentInChain(onScreenPairs, onScreenPair, onScreenTarget, [&](PlayTestSyncPair& fragmentPair, PlayTestTarget& fragment)
+						{
+							fragment.HasAnyChainHitAttemptBeenMade = true;
+						});
+
+						onScreenTarget.HasBeenHit = true;
+						onScreenTarget.RemainingTimeOnHit = TimeSpan::Zero();
+						onScreenTarget.HitEvaluation = HitEvaluation::Cool;
+
+						if (onScreenTarget.Flags.IsChainStart)
+						{
+							if (buttonSoundController != nullptr)
+								buttonSoundController->PlayChainSoundStart(chainSlot);
+							score.ComboCount++;
+							score.ChainSlideScore = 0;
+
+							ForEachFragmentInChain(onScreenPairs, onScreenPair, onScreenTarget, [&](PlayTestSyncPair& fragmentPair, PlayTestTarget& fragment)
+							{
+								fragment.HasAnyChainStartFragmentBeenHit = true;
+							});
+						}
+						else
+						{
+							if (onScreenTarget.Flags.IsChainEnd)
+							{
+								if (buttonSoundController != nullptr)
+								{
+									buttonSoundController->FadeOutLastChainSound(chainSlot);
+									buttonSoundController->PlayChainSoundSuccess(chainSlot);
+								}
+								score.ChainSlideScore += 1000;
+							}
+
+							score.ChainSlideScore += 10;
+							lastSlideActionStopwatch.Restart();
+						}
+					}
+
+					if (!onScreenTarget.HasBeenHit && !onScreenTarget.HasBeenChainHit && remainingTime < -HitThreshold::Worst)
+					{
+						if (!onScreenTarget.HasAnyChainFragmentFailed)
+						{
+							onScreenTarget.ThisFragmentCausedChainFailure = true;
+							ForEachFragmentInChain(onScreenPairs, onScreenPair, onScreenTarget, [&](PlayTestSyncPair& fragmentPair, PlayTestTarget& fragment)
+							{
+								fragment.HasAnyChainFragmentFailed = true;
+							});
+
+							if (onScreenTarget.HasAnyChainHitAttemptBeenMade && buttonSoundController != nullptr)
+							{
+								buttonSoundController->FadeOutLastChainSound(chainSlot);
+								buttonSoundController->PlayChainSoundFailure(chainSlot);
+							}
+
+							score.ChainSlideScore = 0;
+						}
+
+						onScreenTarget.HasBeenHit = true;
+						onScreenTarget.RemainingTimeOnHit = remainingTime;
+						onScreenTarget.HasTimedOut = true;
+						onScreenTarget.HitEvaluation = onScreenTarget.WrongTypeOnTimeOut ? HitEvaluation::WrongCool : HitEvaluation::Worst;
+						onScreenTarget.HitPrecision = HitPrecision::Late;
+
+						score.ComboCount = 0;
+					}
+				}
+				else if (!onScreenTarget.HasBeenHit && remainingTime < -HitThreshold::Worst)
+				{
+					onScreenTarget.HasBeenHit = true;
+					onScreenTarget.RemainingTimeOnHit = remainingTime;
+					onScreenTarget.HasTimedOut = true;
+					onScreenTarget.HitEvaluation = onScreenTarget.WrongTypeOnTimeOut ? HitEvaluation::WrongCool : HitEvaluation::Worst;
+					onScreenTarget.HitPrecision = HitPrecision::Late;
+
+					if (onScreenTarget.WrongTypeOnTimeOut && IsSlideButtonType(onScreenTarget.Type) && buttonSoundController != nullptr)
+						buttonSoundController->PlaySlideSound();
+
+					if (AllInSyncPairHaveBeenHit(onScreenPair))
+						ProcessHoldStateForFullyHitSyncPair(onScreenPair, playbackTime);
+
+					score.ComboCount = 0;
+				}
+			}
+
+			if (perUpdatedPairFunc)
+				perUpdatedPairFunc(onScreenPair);
+		}
+
+		while (firstActiveOnScreenPairIndex < onScreenPairs.size() && onScreenPairs[firstActiveOnScreenPairIndex].NoLongerValid)
+			firstActiveOnScreenPairIndex++;
+	}
+
+	void PlayTestSimulation::UpdateAutoplayInput(TimeSpan playbackTime, TimeSpan perfectHitThreshold, PlayTestScore& score)
+	{
+		for (auto& onScreenPair : GetActiveOnScreenPairs())
+		{
+			if (onScreenPair.NoLongerValid || AllInSyncPairHaveBeenHit(onScreenPair))
+				continue;
+
+			const auto remainingTime = (onScreenPair.ButtonTime - playbackTime);
+			if (remainingTime <= perfectHitThreshold)
+			{
+				for (size_t i = 0; i < onScreenPair.TargetCount; i++)
+				{
+					auto& target = onScreenPair.Targets[i];
+					if (target.HasBeenHit || target.Flags.IsChain)
+						continue;
+
+					if (buttonSoundController != nullptr)
+					{
+						if (IsSlideButtonType(target.Type))
+							buttonSoundController->PlaySlideSound();
+						else
+							buttonSoundController->PlayButtonSound();
+					}
+
+					target.RemainingTimeOnHit = TimeSpan::Zero();
+					target.HasBeenHit = true;
+					target.HitEvaluation = HitEvaluation::Cool;
+					target.HitPrecision = HitPrecision::Just;
+
+					if (AllInSyncPairHaveBeenHit(onScreenPair))
+					{
+						score.ComboCount++;
+
+						ProcessHoldStateForFullyHitSyncPair(onScreenPair, playbackTime);
+					}
+
+				}
+			}
+		}
+
+		for (auto& onScreenPair : GetActiveOnScreenPairs())
+		{
+			if (onScreenPair.NoLongerValid || AllInSyncPairHaveBeenHit(onScreenPair))
+				continue;
+
+			for (size_t i = 0; i < onScreenPair.TargetCount; i++)
+			{
+				auto& target = onScreenPair.Targets[i];
+				if (!target.Flags.IsChain || target.HasBeenChainHit)
+					continue;
+
+				if (!target.HasAnyChainStartFragmentBeenHit)
+				{
+					const auto remainingTime = (onScreenPair.ButtonTime - playbackTime);
+					if (remainingTime <= perfectHitThreshold)
+						target.HasBeenChainHit = true;
+				}
+				else
+				{
+					const auto progress = static_cast<f32>(ConvertRange(onScreenPair.TargetTime.TotalSeconds(), onScreenPair.ButtonTime.TotalSeconds(), 0.0, 1.0, playbackTime.TotalSeconds()));
+					if (progress >= HitThreshold::ChainSlidePreHitProgress)
+						target.HasBeenChainHit = true;
+				}
+			}
+		}
+	}
+
+	void PlayTestSimulation::CheckUpdateHoldStateMaxOut(TimeSpan playbackTime)
+	{
+		if (holdState.CurrentHoldTypes != ButtonTypeFlags_None && !holdState.EventHistory.empty())
+		{
+			const auto lastEvent = holdState.EventHistory.back();
+			if (lastEvent.EventType == PlayTestHoldEventType::Start || lastEvent.EventType == PlayTestHoldEventType::Addition)
+			{
+				const auto timeSinceLastEvent = (playbackTime - lastEvent.PlaybackTime);
+				if (timeSinceLastEvent >= MaxTargetHoldDuration)
+				{
+					holdState.EventHistory.push_back({ PlayTestHoldEventType::MaxOut, holdState.CurrentHoldTypes, playbackTime, nullptr });
+					holdState.CurrentHoldTypes = ButtonTypeFlags_None;
+					holdState.ClearAllHeldDownBindings();
+				}
+			}
+		}
+	}
+
+	void PlayTestSimulation::ProcessHoldStateCancelNow(TimeSpan playbackTime)
+	{
+		holdState.CurrentHoldTypes = ButtonTypeFlags_None;
+		holdState.EventHistory.push_back({ PlayTestHoldEventType::Cancel, holdState.CurrentHoldTypes, playbackTime, nullptr });
+		holdState.ClearAllHeldDownBindings();
+	}
+
+	void PlayTestSimulation::ProcessHoldStateForFullyHitSyncPair(const PlayTestSyncPair& syncPair, TimeSpan playbackTime)
+	{
+		const ButtonTypeFlags pairHoldTypes = GetSyncPairHoldTypeFlags(syncPair);
+		const ButtonTypeFlags pairTypes = GetSyncPairTypeFlags(syncPair);
+		const bool typeIsAlreadyBeingHeld = (holdState.CurrentHoldTypes & pairTypes);
+
+		if (pairHoldTypes != ButtonTypeFlags_None && AllInSyncPairHaveBeenHitByPlayer(syncPair))
+		{
+			if (typeIsAlreadyBeingHeld || (holdState.CurrentHoldTypes == ButtonTypeFlags_None))
+			{
+				holdState.CurrentHoldTypes = pairHoldTypes;
+				holdState.EventHistory.push_back({ PlayTestHoldEventType::Start, holdState.CurrentHoldTypes, playbackTime, &syncPair });
+
+				if (pairHoldTypes == pairTypes)
+					holdState.ClearAllHeldDownBindings();
+			}
+			else
+			{
+				holdState.CurrentHoldTypes |= pairHoldTypes;
+				holdState.EventHistory.push_back({ PlayTestHoldEventType::Addition, holdState.CurrentHoldTypes, playbackTime, &syncPair });
+			}
+		}
+		else if (typeIsAlreadyBeingHeld)
+		{
+			// BUG: Something about this still isn't right... for example:
+			//		PREREQUISITE:
+			//		- Single Triangle(Hold) followed by Triangle(Hold)+Square(Hold)
+			//
+			//		USER_INPUT:
+			//		- Hit and hold first Triangle, then hit and release only second Triangle
+			//		RESULT:
+			//		- Hold combo not canceled
+			//		EXPECTED:
+			//		- Hold combo immediately canceled
+			//
+			//		USER_INPUT:
+			//		- Hit and hold first Triangle, then hit and release only second Square
+			//		RESULT:
+			//		- Hold combo canceled once Square released despite Square not being part of the active (displayed) hold combo
+			//		EXPECTED:
+			//		- Hold combo not affected at all, until rest of sync pair has been hit by the user (or any target hit that is part of the active hold combo)
+
+			if (AllInSyncPairHaveBeenHitByPlayer(syncPair))
+				ProcessHoldStateCancelNow(playbackTime);
+		}
+	}
+
+	std::vector<PlayTestSyncPair>& PlayTestSimulation::GetOnScreenPairs()
+	{
+		return onScreenPairs;
+	}
+
+	PlayTestSyncPairRange PlayTestSimulation::GetActiveOnScreenPairs()
+	{
+		return { onScreenPairs.data() + firstActiveOnScreenPairIndex, onScreenPairs.data() + onScreenPairs.size() };
+	}
+
+	PlayTestHoldState& PlayTestSimulation::GetHoldState()
+	{
+		return holdState;
+	}
+
+	Stopwatch& PlayTestSimulation::GetLastSlideActionStopwatch()
+	{
+		return lastSlideActionStopwatch;
+	}
+
+	void PlayTestSimulation::SetButtonSoundController(ButtonSoundController* value)
+	{
+		buttonSoundController = value;
+	}
+
+	bool PlayTestSimulation::HasSpawnedAllTargetPairs() const
+	{
+		return (targetTimeline == nullptr) || (spawnEventCursor >= targetTimeline->GetSpawnEvents().size() && dueSpawnPairIndices.empty());
+	}
+
+	bool PlayTestSimulation::HasAnyActiveOnScreenPairs() const
+	{
+		return (firstActiveOnScreenPairIndex < onScreenPairs.size());
+	}
+
+	HeadlessAutoplayResult SimulateHeadlessAutoplay(const Chart& chart, const HeadlessAutoplayParam& param)
+	{
+		assert(param.FrameInterval > TimeSpan::Zero());
+		const auto stopwatch = Stopwatch::StartNew();
+
+		PlayTestTargetTimeline targetTimeline = {};
+		targetTimeline.Rebuild(chart);
+
+		PlayTestSimulation simulation = {};
+		simulation.Restart(targetTimeline, param.StartTime);
+
+		HeadlessAutoplayResult result = {};
+		PlayTestScore score = {};
+
+		// NOTE: Same as the interactive autoplay which uses half of the frame delta time
+		const auto perfectHitThreshold = (param.FrameInterval * 0.5);
+
+		for (u32 frameIndex = 0; ; frameIndex++)
+		{
+			// NOTE: Multiply instead of accumulating to avoid floating point drift over long charts
+			const auto playbackTime = param.StartTime + (param.FrameInterval * static_cast<f64>(frameIndex));
+			const i32 lastChainSlideScore = score.ChainSlideScore;
+
+			simulation.UpdateAutoplayInput(playbackTime, perfectHitThreshold, score);
+			simulation.CheckUpdateHoldStateMaxOut(playbackTime);
+			simulation.SpawnDueTargetPairs(playbackTime);
+			simulation.UpdateOnScreenTargetPairs(playbackTime, score);
+
+			if (score.ChainSlideScore > lastChainSlideScore)
+				result.TotalChainSlideScore += (score.ChainSlideScore - lastChainSlideScore);
+
+			result.MaxComboCount = Max(result.MaxComboCount, score.ComboCount);
+			result.SimulatedFrameCount = (frameIndex + 1);
+			result.SimulatedDuration = (playbackTime - param.StartTime);
+
+			if (simulation.HasSpawnedAllTargetPairs() && !simulation.HasAnyActiveOnScreenPairs())
+				break;
+		}
+
+		// NOTE: Skipped pairs are spawned as no longer valid and are therefore never hit
+		for (const auto& pair : simulation.GetOnScreenPairs())
+		{
+			bool anyTargetEvaluated = false;
+			for (size_t i = 0; i < pair.TargetCount; i++)
+			{
+				if (!pair.Targets[i].HasBeenHit)
+					continue;
+
+				anyTargetEvaluated = true;
+				result.EvaluatedTargetCount++;
+				result.EvaluationCounts[static_cast<size_t>(pair.Targets[i].HitEvaluation)]++;
+			}
+
+			if (anyTargetEvaluated)
+			{
+				result.FirstButtonTime = (result.EvaluatedPairCount == 0) ? pair.ButtonTime : Min(result.FirstButtonTime, pair.ButtonTime);
+				result.LastButtonTime = (result.EvaluatedPairCount == 0) ? pair.ButtonTime : Max(result.LastButtonTime, pair.ButtonTime);
+				result.EvaluatedPairCount++;
+			}
+		}
+
+		result.FinalComboCount = score.ComboCount;
+		result.WallTime = stopwatch.GetElapsed();
+		return result;
+	}
+}
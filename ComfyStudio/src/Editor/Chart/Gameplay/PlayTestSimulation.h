@@ -0,0 +1,299 @@
+#pragma once
+#include "Types.h"
+#include "PlayTestCore.h"
+#include "Editor/Chart/Chart.h"
+#include "Editor/Chart/TargetPropertyRules.h"
+#include "Editor/Chart/HitEvaluation.h"
+#include "Editor/Common/ButtonSoundController.h"
+#include "Time/Stopwatch.h"
+#include <functional>
+
+namespace Comfy::Studio::Editor
+{
+	struct PlayTestTarget
+	{
+		ButtonType Type;
+		PlayTestSlidePositionType SlidePosition;
+		TargetFlags Flags;
+		TargetProperties Properties;
+
+		TimeSpan RemainingTimeOnHit;
+		HitEvaluation HitEvaluation;
+		HitPrecision HitPrecision;
+
+		bool HasBeenHit;
+		bool HasBeenChainHit;
+		bool HasAnyChainFragmentFailed;
+		bool HasAnyChainHitAttemptBeenMade;
+		bool HasAnyChainStartFragmentBeenHit;
+		bool ThisFragmentCausedChainFailure;
+		bool HasTimedOut;
+		bool WrongTypeOnTimeOut;
+	};
+
+	struct PlayTestSyncPair
+	{
+		std::array<PlayTestTarget, Rules::MaxSyncPairCount> Targets;
+		u8 TargetCount;
+
+		bool HasBeenAdded;
+		bool NoLongerValid;
+
+		TimeSpan TargetTime;
+		TimeSpan ButtonTime;
+		TimeSpan FlyingTime;
+		// NOTE: The earliest target time of this pair and of all chain fragments leading up to any chain fragment within this pair.
+		//		 Starting before this time would leave a chain without its start fragment so the entire pair is skipped instead
+		TimeSpan EarliestChainTargetTime;
+
+		vec2 PositionCenter;
+	};
+
+
+	enum class PlayTestHoldEventType : u8
+	{
+		Start,
+		Addition,
+		Cancel,
+		MaxOut,
+		Count
+	};
+
+	struct PlayTestHoldEvent
+	{
+		PlayTestHoldEventType EventType;
+		ButtonTypeFlags ButtonTypes;
+		TimeSpan PlaybackTime;
+		// TODO: Store index instead for safety
+		const PlayTestSyncPair* SyncPair;
+	};
+
+	struct PlayTestHoldState
+	{
+		ButtonTypeFlags CurrentHoldTypes = ButtonTypeFlags_None;
+		std::vector<PlayTestHoldEvent> EventHistory;
+		// TODO: Store indices to avoid potential pointer invalidations, although that would make the code slightly less readable
+		std::array<std::vector<const PlayTestInputBinding*>, EnumCount<ButtonType>()> PerTypeHeldDownBindings = {};
+
+		void ClearAll()
+		{
+			CurrentHoldTypes = ButtonTypeFlags_None;
+			EventHistory.clear();
+			for (auto& bindings : PerTypeHeldDownBindings)
+				bindings.clear();
+		}
+
+		void ClearAllHeldDownBindings()
+		{
+			for (auto& bindings : PerTypeHeldDownBindings)
+				bindings.clear();
+		}
+	};
+
+
+	constexpr ButtonTypeFlags GetSyncPairTypeFlags(const PlayTestSyncPair& syncPair)
+	{
+		ButtonTypeFlags holdFlags = ButtonTypeFlags_None;
+
+		for (size_t i = 0; i < syncPair.TargetCount; i++)
+			holdFlags |= ButtonTypeToButtonTypeFlags(syncPair.Targets[i].Type);
+
+		return holdFlags;
+	}
+
+	constexpr ButtonTypeFlags GetSyncPairHoldTypeFlags(const PlayTestSyncPair& syncPair)
+	{
+		ButtonTypeFlags holdFlags = ButtonTypeFlags_None;
+
+		for (size_t i = 0; i < syncPair.TargetCount; i++)
+		{
+			if (syncPair.Targets[i].Flags.IsHold)
+				holdFlags |= ButtonTypeToButtonTypeFlags(syncPair.Targets[i].Type);
+		}
+
+		return holdFlags;
+	}
+
+	constexpr bool AnyInSyncPairHasBeenHitByPlayer(const PlayTestSyncPair& syncPair)
+	{
+		for (size_t i = 0; i < syncPair.TargetCount; i++)
+		{
+			if (syncPair.Targets[i].HasBeenHit && !syncPair.Targets[i].HasTimedOut)
+				return true;
+		}
+
+		return false;
+	}
+
+	constexpr bool AllInSyncPairHaveBeenHitByPlayer(const PlayTestSyncPair& syncPair)
+	{
+		for (size_t i = 0; i < syncPair.TargetCount; i++)
+		{
+			if (!syncPair.Targets[i].HasBeenHit || syncPair.Targets[i].HasTimedOut)
+				return false;
+		}
+
+		return true;
+	}
+
+	constexpr bool AllInSyncPairHaveBeenHit(const PlayTestSyncPair& syncPair)
+	{
+		for (size_t i = 0; i < syncPair.TargetCount; i++)
+		{
+			if (!syncPair.Targets[i].HasBeenHit)
+				return false;
+		}
+
+		return true;
+	}
+
+	template <typename Func>
+	void ForEachFragmentInChain(std::vector<PlayTestSyncPair>& allPairs, PlayTestSyncPair& startFragmentPair, PlayTestTarget& startFragment, Func perFragmentFunc)
+	{
+		assert(startFragment.Flags.IsChain);
+		const auto slideType = startFragment.Type;
+		const auto firstFragmentIndex = std::distance(&allPairs[0], &startFragmentPair);
+
+		for (size_t i = firstFragmentIndex; i < allPairs.size(); i++)
+		{
+			auto& pair = allPairs[i];
+			for (size_t p = 0; p < pair.TargetCount; p++)
+			{
+				auto& potentialFragment = pair.Targets[p];
+
+				if (!potentialFragment.Flags.IsChain || potentialFragment.Type != slideType)
+					continue;
+
+				perFragmentFunc(pair, potentialFragment);
+				if (potentialFragment.Flags.IsChainEnd)
+					return;
+			}
+		}
+	}
+
+
+	struct PlayTestScore
+	{
+		i32 ComboCount;
+		i32 ChainSlideScore;
+		// TODO: Eventually (?)
+		// i32 ScoreNumber;
+		// i32 ScoreNumberRolling;
+	};
+
+	struct PlayTestSyncPairRange
+	{
+		PlayTestSyncPair* Begin;
+		PlayTestSyncPair* End;
+
+		PlayTestSyncPair* begin() const { return Begin; }
+		PlayTestSyncPair* end() const { return End; }
+	};
+
+	// NOTE: All sync pairs of a chart in chart order together with their spawn events sorted by target time.
+	//		 Only has to be rebuilt once the chart has changed, restarting from any point in time is then a binary search
+	class PlayTestTargetTimeline
+	{
+	public:
+		struct SpawnEvent
+		{
+			TimeSpan TargetTime;
+			u32 PairIndex;
+			// NOTE: Smallest pair index of this and all following spawn events
+			u32 MinPairIndexFromHere;
+		};
+
+	public:
+		void Rebuild(const Chart& chart);
+
+		const std::vector<PlayTestSyncPair>& GetPairs() const;
+		const std::vector<SpawnEvent>& GetSpawnEvents() const;
+
+		size_t FindFirstSpawnEventIndexAtOrAfter(TimeSpan time) const;
+
+		// NOTE: Spawn events whose pair comes after any of the following spawn events in chart order, which can happen due to flying time changes.
+		//		 These are the only skipped pairs that a chain fragment lookup could still reach so they have to be spawned (as no longer valid) when restarting
+		const std::vector<u32>& GetOutOfOrderSpawnEventIndices() const;
+
+	private:
+		std::vector<PlayTestSyncPair> pairs;
+		std::vector<SpawnEvent> spawnEvents;
+		std::vector<u32> outOfOrderSpawnEventIndices;
+	};
+
+	// NOTE: The chart dependent state of a single playtest run without any rendering, windowing or input device code.
+	//		 Targets are spawned from a timeline cursor and on-screen pairs that have timed out are skipped over by a second cursor
+	//		 so that each update only touches the pairs that are either due to spawn or still active
+	class PlayTestSimulation
+	{
+	public:
+		PlayTestSimulation() = default;
+		~PlayTestSimulation() = default;
+
+	public:
+		void Restart(const PlayTestTargetTimeline& targetTimeline, TimeSpan startTime);
+
+		void SpawnDueTargetPairs(TimeSpan playbackTime);
+
+		// NOTE: Chain slide hits, timeouts and expiration of all active pairs. The optional function is called for each active pair right after it has been updated
+		void UpdateOnScreenTargetPairs(TimeSpan playbackTime, PlayTestScore& score, const std::function<void(const PlayTestSyncPair&)>& perUpdatedPairFunc = {});
+		void UpdateAutoplayInput(TimeSpan playbackTime, TimeSpan perfectHitThreshold, PlayTestScore& score);
+
+		void CheckUpdateHoldStateMaxOut(TimeSpan playbackTime);
+		void ProcessHoldStateCancelNow(TimeSpan playbackTime);
+		void ProcessHoldStateForFullyHitSyncPair(const PlayTestSyncPair& syncPair, TimeSpan playbackTime);
+
+	public:
+		// NOTE: All pairs that have been spawned since the last restart, including the ones that are no longer valid
+		std::vector<PlayTestSyncPair>& GetOnScreenPairs();
+		PlayTestSyncPairRange GetActiveOnScreenPairs();
+
+		PlayTestHoldState& GetHoldState();
+		Stopwatch& GetLastSlideActionStopwatch();
+
+		// NOTE: Optional, to play button, slide and chain sounds for the interactive playtest
+		void SetButtonSoundController(ButtonSoundController* value);
+
+		bool HasSpawnedAllTargetPairs() const;
+		bool HasAnyActiveOnScreenPairs() const;
+
+	private:
+		const PlayTestTargetTimeline* targetTimeline = nullptr;
+		ButtonSoundController* buttonSoundController = nullptr;
+
+		TimeSpan startTime = TimeSpan::Zero();
+		size_t spawnEventCursor = 0;
+		size_t firstActiveOnScreenPairIndex = 0;
+
+		std::vector<PlayTestSyncPair> onScreenPairs;
+		std::vector<u32> dueSpawnPairIndices;
+
+		PlayTestHoldState holdState = {};
+		Stopwatch lastSlideActionStopwatch = {};
+	};
+
+	struct HeadlessAutoplayParam
+	{
+		TimeSpan StartTime = TimeSpan::Zero();
+		TimeSpan FrameInterval = TimeSpan::FromSeconds(1.0 / 60.0);
+	};
+
+	struct HeadlessAutoplayResult
+	{
+		u32 SimulatedFrameCount;
+		u32 EvaluatedPairCount;
+		u32 EvaluatedTargetCount;
+		std::array<u32, EnumCount<HitEvaluation>()> EvaluationCounts;
+		i32 MaxComboCount;
+		i32 FinalComboCount;
+		i32 TotalChainSlideScore;
+		TimeSpan FirstButtonTime;
+		TimeSpan LastButtonTime;
+		TimeSpan SimulatedDuration;
+		TimeSpan WallTime;
+	};
+
+	// NOTE: Runs the same simulation as the autoplay mode of the playtest window at a fixed frame interval as fast as possible.
+	//		 No window, audio device or renderer is required and the result is fully deterministic for the same chart and parameters
+	HeadlessAutoplayResult SimulateHeadlessAutoplay(const Chart& chart, const HeadlessAutoplayParam& param = {});
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "Types.h"
 #include "PlayTestCore.h"
+#include "PlayTestSimulation.h"
 #include "Render/Render.h"
 #include "Editor/Chart/Chart.h"
 #include "Editor/Chart/TargetPropertyRules.h"
@@ -28,14 +29,7 @@ namespace Comfy::Studio::Editor
 		std::unique_ptr<Render::RenderTarget2D> RenderTarget = Render::Renderer2D::CreateRenderTarget();
 		TargetRenderHelperEx RenderHelperEx = {};
 
-		struct ScoreData
-		{
-			i32 ComboCount;
-			i32 ChainSlideScore;
-			// TODO: Eventually (?)
-			// i32 ScoreNumber;
-			// i32 ScoreNumberRolling;
-		} Score;
+		PlayTestScore Score = {};
 	};
 
 	struct PlayTestSharedContext
@@ -62,6 +56,7 @@ namespace Comfy::Studio::Editor
 
 		void SetWorkingChart(Chart* chart);
 		void Restart(TimeSpan startTime);
+		void Stop();
 
 		bool GetAutoplayEnabled() const;
 		void SetAutoplayEnabled(bool value);
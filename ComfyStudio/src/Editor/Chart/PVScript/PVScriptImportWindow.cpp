@@ -1,5 +1,6 @@
 #include "PVScriptImportWindow.h"
 #include "Core/ComfyStudioSettings.h"
+#include "Core/Logger.h"
 #include "ImGui/Extensions/ImGuiExtensions.h"
 #include "IO/File.h"
 #include "IO/Path.h"
@@ -91,10 +92,11 @@ namespace Comfy::Studio::Editor
 
 			outTargetList.Clear();
 			outTargetList = std::move(outTargets);
-			for (auto& outTarget : outTargetList)
+			for (size_t i = 0; i < outTargetList.size(); i++)
 			{
+				const auto& outTarget = outTargetList[i];
 				if (outTarget.Flags.IsChain && !outTarget.Flags.IsChainStart)
-					outTarget.Properties.Position.x -= Rules::ChainFragmentStartEndOffsetDistance * (outTarget.Type == ButtonType::SlideL ? -1.0f : +1.0f);
+					outTargetList.GetMutable(i).Properties.Position.x -= Rules::ChainFragmentStartEndOffsetDistance * (outTarget.Type == ButtonType::SlideL ? -1.0f : +1.0f);
 			}
 		}
 
@@ -569,6 +571,8 @@ namespace Comfy::Studio::Editor
 			inScript.Async.LoadedScriptFile = IO::File::Load<PVScript>(inScript.Sync.ScriptPath);
 			if (inScript.Async.LoadedScriptFile == nullptr)
 				inScript.Async.LoadedScriptFile = std::make_unique<PVScript>();
+			else if (const auto parseResult = inScript.Async.LoadedScriptFile->ParseResult; parseResult != PVScriptParseResult::Success)
+				Logger::LogErrorLine(__FUNCTION__"(): Stopped parsing '%s' at byte offset %zu (%s)", inScript.Sync.ScriptPath.c_str(), inScript.Async.LoadedScriptFile->InvalidCommandByteOffset, PVScriptParseResultNames[static_cast<size_t>(parseResult)]);
 
 			inScript.Async.DecomposedScipt = DecomposePVScriptChartData(*inScript.Async.LoadedScriptFile, inScript.Sync.ScriptPath);
 			inScript.Async.DecomposedSciptUneditedCopy = inScript.Async.DecomposedScipt;
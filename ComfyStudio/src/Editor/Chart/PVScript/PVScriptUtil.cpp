@@ -6,6 +6,29 @@
 
 namespace Comfy::Studio::Editor
 {
+	namespace
+	{
+		constexpr PVCommandLayout::TargetType ButtonTypeToPVCommandTargetType(const TimelineTarget& target)
+		{
+			using namespace PVCommandLayout;
+			const bool isHold = target.Flags.IsHold;
+			const bool isChain = target.Flags.IsChain;
+			const bool isChance = target.Flags.IsChance;
+
+			switch (target.Type)
+			{
+			case ButtonType::Triangle: return isHold ? TargetType::TriangleHold : isChance ? TargetType::TriangleChance : TargetType::Triangle;
+			case ButtonType::Square: return isHold ? TargetType::SquareHold : isChance ? TargetType::SquareChance : TargetType::Square;
+			case ButtonType::Cross: return isHold ? TargetType::CrossHold : isChance ? TargetType::CrossChance : TargetType::Cross;
+			case ButtonType::Circle: return isHold ? TargetType::CircleHold : isChance ? TargetType::CircleChance : TargetType::Circle;
+			case ButtonType::SlideL: return isChain ? TargetType::SlideChainL : isChance ? TargetType::SlideLChance : TargetType::SlideL;
+			case ButtonType::SlideR: return isChain ? TargetType::SlideChainR : isChance ? TargetType::SlideRChance : TargetType::SlideR;
+			}
+
+			return TargetType::Circle;
+		}
+	}
+
 	DecompsedPVScriptFileName DecompsePVScriptFileName(std::string_view fileNameWithoutExtension)
 	{
 		if (!Util::StartsWithInsensitive(fileNameWithoutExtension, "pv_") || fileNameWithoutExtension.size() < std::string_view("pv_xxx_xxxx").size())
@@ -91,6 +114,104 @@ namespace Comfy::Studio::Editor
 		return out;
 	}
 
+	PVScript ConvertChartToPVScript(const Chart& chart, vec4 backgroundTint)
+	{
+		// NOTE: At most one flying time command per sync pair in addition to each target and a small number of fixed commands
+		PVScriptBuilder scriptBuilder {};
+		scriptBuilder.Reserve((chart.Targets.size() * 2) + 8);
+
+		scriptBuilder.Add(TimeSpan::Zero(), PVCommandLayout::ChangeField(1));
+		scriptBuilder.Add(TimeSpan::Zero(), PVCommandLayout::MikuDisp(0, false));
+
+		if (backgroundTint.a > 0.0f)
+			scriptBuilder.Add(TimeSpan::Zero(), PVCommandLayout::SceneFade(TimeSpan::Zero(), backgroundTint.a, backgroundTint.a, vec3(backgroundTint)));
+
+		const TimeSpan songOffset = !chart.SongFileName.empty() ? chart.SongOffset : TimeSpan::Zero();
+		const TimeSpan movieOffset = !chart.MovieFileName.empty() ? chart.MovieOffset : TimeSpan::Zero();
+
+		TimeSpan songPlayCommandTime = Max(-songOffset, TimeSpan::Zero());
+		TimeSpan moviePlayCommandTime = Max(-movieOffset, TimeSpan::Zero());
+
+		// NOTE: In the case the song or movie is set to start before time 0, as that would require a negative time command which typically isn't supported
+		const TimeSpan targetTimeDelayToEnsurePositiveSongAndMovieStart = Max(Max(songOffset, movieOffset), TimeSpan::Zero());
+		if (songOffset > TimeSpan::Zero() || movieOffset >= TimeSpan::Zero())
+		{
+			// TODO: Does this correctly handle all casess (?)
+			if (songOffset > movieOffset)
+				moviePlayCommandTime += songOffset.Absolute();
+			else if (movieOffset > songOffset)
+				songPlayCommandTime += movieOffset.Absolute();
+		}
+
+		if (!chart.SongFileName.empty())
+		{
+			scriptBuilder.Add(songPlayCommandTime, PVCommandLayout::MusicPlay());
+		}
+
+		if (!chart.MovieFileName.empty())
+		{
+			scriptBuilder.Add(moviePlayCommandTime, PVCommandLayout::MoviePlay(1));
+			scriptBuilder.Add(moviePlayCommandTime, PVCommandLayout::MovieDisp(true));
+		}
+
+		i32 lastFlyingTimeMS = {};
+		TimeSpan lastSyncPairTargetTime = {};
+
+		// NOTE: Has to be larger than at least one diva time unit
+		constexpr TimeSpan minTimeBetweenPairsToPreventAccidentalSyncTargets = TimeSpan::FromMilliseconds(0.1);
+
+		for (size_t targetIndex = 0; targetIndex < chart.Targets.size();)
+		{
+			const auto& firstTargetInSyncPair = chart.Targets[targetIndex];
+
+			auto spawnTimes = chart.TempoMap.GetTargetSpawnTimes(firstTargetInSyncPair);
+			spawnTimes.TargetTime = Max(TimeSpan::Zero(), spawnTimes.TargetTime + targetTimeDelayToEnsurePositiveSongAndMovieStart);
+			spawnTimes.ButtonTime = Max(TimeSpan::Zero(), spawnTimes.ButtonTime + targetTimeDelayToEnsurePositiveSongAndMovieStart);
+
+			const TimeSpan timeSinceLastSyncPair = (spawnTimes.TargetTime - lastSyncPairTargetTime);
+			if ((targetIndex > 0) && timeSinceLastSyncPair <= TimeSpan::Zero())
+				spawnTimes.TargetTime = (lastSyncPairTargetTime + minTimeBetweenPairsToPreventAccidentalSyncTargets);
+			lastSyncPairTargetTime = spawnTimes.TargetTime;
+			spawnTimes.FlyingTime = Max(TimeSpan::FromMilliseconds(1.0), (spawnTimes.ButtonTime - spawnTimes.TargetTime));
+
+			const i32 flyingTimeMS = static_cast<i32>(glm::round(spawnTimes.FlyingTime.TotalMilliseconds()));
+			if (flyingTimeMS != lastFlyingTimeMS)
+			{
+				scriptBuilder.Add(spawnTimes.TargetTime, PVCommandLayout::TargetFlyingTime(flyingTimeMS));
+				lastFlyingTimeMS = flyingTimeMS;
+			}
+
+			for (size_t indexWithinPair = 0; indexWithinPair < firstTargetInSyncPair.Flags.SyncPairCount; indexWithinPair++)
+			{
+				const auto& targetInSyncPair = chart.Targets[targetIndex + indexWithinPair];
+
+				auto targetProperties = Rules::TryGetProperties(targetInSyncPair);
+				if (targetInSyncPair.Flags.IsChain && !targetInSyncPair.Flags.IsChainStart)
+					targetProperties.Position.x += Rules::ChainFragmentStartEndOffsetDistance * (targetInSyncPair.Type == ButtonType::SlideL ? -1.0f : +1.0f);
+
+				auto targetCommand = PVCommandLayout::Target();
+				targetCommand.Type = ButtonTypeToPVCommandTargetType(targetInSyncPair);
+				targetCommand.PositionX = static_cast<i32>(targetProperties.Position.x * 250.0f);
+				targetCommand.PositionY = static_cast<i32>(targetProperties.Position.y * 250.0f);
+				targetCommand.Angle = static_cast<i32>(targetProperties.Angle * 1000.0f);
+				targetCommand.Distance = static_cast<i32>(targetProperties.Distance * 250.0f);
+				targetCommand.Amplitude = static_cast<i32>(targetProperties.Amplitude);
+				targetCommand.Frequency = static_cast<i32>(targetProperties.Frequency);
+
+				scriptBuilder.Add(spawnTimes.TargetTime, targetCommand);
+			}
+
+			assert(firstTargetInSyncPair.Flags.SyncPairCount >= 1);
+			targetIndex += Max<i32>(1, firstTargetInSyncPair.Flags.SyncPairCount);
+		}
+
+		scriptBuilder.Add(chart.DurationOrDefault(), PVCommandLayout::PVEnd());
+
+		PVScript script = {};
+		script.Commands = std::move(scriptBuilder.Create());
+		return script;
+	}
+
 	SongAndMovieFilePaths GetPotentialSongAndMovieFilePathsFromPVScriptPath(std::string_view scriptPath)
 	{
 		SongAndMovieFilePaths out = {};
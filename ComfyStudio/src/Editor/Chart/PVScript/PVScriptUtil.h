@@ -58,6 +58,9 @@ namespace Comfy::Studio::Editor
 
 	DecomposedPVScriptChartData DecomposePVScriptChartData(const PVScript& script, std::string_view scriptFilePath);
 
+	// NOTE: Only reads from the chart so multiple charts can safely be converted concurrently
+	PVScript ConvertChartToPVScript(const Chart& chart, vec4 backgroundTint = {});
+
 	struct SongAndMovieFilePaths
 	{
 		std::set<std::string> SongPaths;
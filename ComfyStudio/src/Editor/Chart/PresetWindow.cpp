@@ -414,7 +414,8 @@ namespace Comfy::Studio::Editor
 		const auto& style = Gui::GetStyle();
 		const auto presetSettingsContextMenuID = Gui::GetCurrentWindow()->GetID("PresetWindowSyncSettingsContextMenu");
 
-		const bool anySyncTargetSelected = std::any_of(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return (t.IsSelected && t.Flags.IsSync); });
+		const auto selectedTargets = chart.Targets.SelectedTargets();
+		const bool anySyncTargetSelected = std::any_of(selectedTargets.begin(), selectedTargets.end(), [](auto& t) { return (t.Flags.IsSync); });
 
 		// TODO: Correctly factor in window padding and other missing stlye vars (?)
 		const f32 dynamicChildHeight = (DynamicSyncButtonHeight + PresetButtonSpacing.y) * 3.0f + (style.WindowPadding.y * 2.0f) - PresetButtonSpacing.y;
@@ -507,8 +508,9 @@ namespace Comfy::Studio::Editor
 			if (Gui::ButtonEx("Add New...", vec2(Gui::GetContentRegionAvail().x - SyncSettingsButtonWidth, StaticSyncButtonHeight)))
 			{
 #if COMFY_DEBUG && 1 // TODO:
-				if (const auto firstSelectedTarget = FindIfOrNull(chart.Targets.GetRawView(), [&](auto& t) { return (t.IsSelected && t.Flags.IsSync); }); firstSelectedTarget != nullptr)
+				if (const auto firstSelectedIt = std::find_if(selectedTargets.begin(), selectedTargets.end(), [&](auto& t) { return (t.Flags.IsSync); }); firstSelectedIt != selectedTargets.end())
 				{
+					const auto* firstSelectedTarget = &(*firstSelectedIt);
 					const auto syncPair = &firstSelectedTarget[-firstSelectedTarget->Flags.IndexWithinSyncPair];
 					assert(syncPair[0].Flags.IndexWithinSyncPair == 0);
 
@@ -602,7 +604,7 @@ namespace Comfy::Studio::Editor
 		hovered.Sequence.AnyChildWindow = Gui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows);
 
 		const auto& style = Gui::GetStyle();
-		const bool anyTargetSelected = std::any_of(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return (t.IsSelected); });
+		const bool anyTargetSelected = (chart.Targets.GetSelectionCount() > 0);
 
 		Gui::BeginChild("SequencePresetsChild", vec2(0.0f, 0.0f), true, ImGuiWindowFlags_AlwaysVerticalScrollbar);
 		{
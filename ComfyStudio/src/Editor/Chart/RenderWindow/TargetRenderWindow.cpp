@@ -198,11 +198,8 @@ namespace Comfy::Studio::Editor
 		constexpr size_t maxSelectionToDraw = 512;
 		size_t selectionDrawCount = 0;
 
-		for (const auto& target : workingChart->Targets)
+		for (const auto& target : workingChart->Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const auto position = Rules::TryGetProperties(target).Position;
 			const auto tl = glm::round(TargetAreaToScreenSpace(position - TargetHitboxSize));
 			const auto br = glm::round(TargetAreaToScreenSpace(position + TargetHitboxSize));
@@ -567,7 +564,7 @@ namespace Comfy::Studio::Editor
 		const auto cursorTime = timeline.GetCursorTime();
 		const auto cursorTick = timeline.GetCursorTick();
 
-		for (const auto& target : targets)
+		const auto addTargetToDrawBuffersIfVisible = [&](const TimelineTarget& target)
 		{
 			auto[targetTime, buttonTime, targetTick, buttonTick, flyingTime] = workingChart->TempoMap.GetTargetSpawnTimes(target);
 
@@ -578,7 +575,7 @@ namespace Comfy::Studio::Editor
 			const auto endTick = buttonTick + GlobalUserData.TargetPreview.PostHitLingerDuration;
 			const auto endTime = workingChart->TempoMap.TickToTime(endTick);
 
-			if (target.IsSelected || (cursorTick >= targetTick && cursorTick <= endTick))
+			if (target.GetIsSelected() || (cursorTick >= targetTick && cursorTick <= endTick))
 			{
 				const auto progressUnbound = static_cast<f32>(ConvertRange(targetTime.TotalSeconds(), buttonTime.TotalSeconds(), 0.0, 1.0, cursorTime.TotalSeconds()));
 				const auto progress = Clamp(progressUnbound, 0.0f, 1.0f);
@@ -604,7 +601,7 @@ namespace Comfy::Studio::Editor
 				targetData.Position = properties.Position;
 				targetData.Progress = progress;
 				targetData.Scale = 1.0f;
-				targetData.Opacity = (target.IsSelected || !inCursorBarRange) ? 0.5f : 1.0f;
+				targetData.Opacity = (target.GetIsSelected() || !inCursorBarRange) ? 0.5f : 1.0f;
 
 				if (inCursorBarRange)
 				{
@@ -644,6 +641,23 @@ namespace Comfy::Studio::Editor
 					}
 				}
 			}
-		}
+		};
+
+		// NOTE: Only the targets within the on-screen tick range need to be checked in full. Selected targets are always drawn however
+		//		 so to preserve the draw order all selected targets before and after the range are added in their respective passes
+		const auto[rangeStartTick, rangeEndTick] = workingChart->TempoMap.GetOnScreenButtonTickRange(cursorTick, GlobalUserData.TargetPreview.PostHitLingerDuration);
+		const auto visibleTargets = targets.TargetsInTickRange(rangeStartTick, rangeEndTick);
+
+		const auto& selectedIndices = targets.GetSelectedIndices();
+		const auto selectedAfterRangeIt = std::lower_bound(selectedIndices.begin(), selectedIndices.end(), visibleTargets.StartIndex + static_cast<i32>(visibleTargets.size()));
+
+		for (auto it = selectedIndices.begin(); it != selectedIndices.end() && *it < visibleTargets.StartIndex; it++)
+			addTargetToDrawBuffersIfVisible(targets[*it]);
+
+		for (const auto& target : visibleTargets)
+			addTargetToDrawBuffersIfVisible(target);
+
+		for (auto it = selectedAfterRangeIt; it != selectedIndices.end(); it++)
+			addTargetToDrawBuffersIfVisible(targets[*it]);
 	}
 }
@@ -52,7 +52,7 @@ namespace Comfy::Studio::Editor
 					const auto spawnTimes = chart.TempoMap.GetTargetSpawnTimes(target);
 					const BeatTick targetTick = spawnTimes.TargetTick;
 					const BeatTick endTick = target.Tick + postHitLingerDuration;
-					if (target.IsSelected || (cursorTick >= targetTick && cursorTick <= endTick))
+					if (target.GetIsSelected() || (cursorTick >= targetTick && cursorTick <= endTick))
 					{
 						const auto position = Rules::TryGetProperties(target).Position;
 						return (position.x > minTargetSpace.x && position.y >= minTargetSpace.y) && (position.x <= maxTargetSpace.x && position.y <= maxTargetSpace.y);
@@ -60,27 +60,29 @@ namespace Comfy::Studio::Editor
 					return false;
 				};
 
+				auto& targets = chart.Targets;
 				switch (data.Action)
 				{
 				case ActionType::Clean:
-					for (auto& target : chart.Targets)
-						target.IsSelected = isTargetInSelectionRange(target);
+				{
+					// NOTE: Every on-screen target has to be checked but all of the remaining ones can only be in range if already selected
+					const auto[onScreenStartTick, onScreenEndTick] = chart.TempoMap.GetOnScreenButtonTickRange(cursorTick, postHitLingerDuration);
+
+					targets.DeselectIf([&](const TimelineTarget& target) { return !isTargetInSelectionRange(target); });
+					targets.SelectInTickRangeIf(onScreenStartTick, onScreenEndTick, isTargetInSelectionRange);
 					break;
+				}
 
 				case ActionType::Add:
-					for (auto& target : chart.Targets)
-					{
-						if (isTargetInSelectionRange(target))
-							target.IsSelected = true;
-					}
+				{
+					// NOTE: Off-screen targets can only be in range if they are already selected in which case adding them would be a no-op
+					const auto[onScreenStartTick, onScreenEndTick] = chart.TempoMap.GetOnScreenButtonTickRange(cursorTick, postHitLingerDuration);
+					targets.SelectInTickRangeIf(onScreenStartTick, onScreenEndTick, isTargetInSelectionRange);
 					break;
+				}
 
 				case ActionType::Remove:
-					for (auto& target : chart.Targets)
-					{
-						if (isTargetInSelectionRange(target))
-							target.IsSelected = false;
-					}
+					targets.DeselectIf([&](const TimelineTarget& target) { return isTargetInSelectionRange(target); });
 					break;
 
 				default:
@@ -26,7 +26,7 @@ namespace Comfy::Studio::Editor
 
 	void TargetPathTool::OnContextMenuGUI(Chart& chart)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 
 		if (Gui::MenuItem("Invert Target Frequencies", Input::ToString(GlobalUserData.Input.TargetPreview_PathTool_InvertFrequencies).data(), false, (selectionCount > 0)))
 			InvertSelectedTargetFrequencies(undoManager, chart);
@@ -155,9 +155,9 @@ namespace Comfy::Studio::Editor
 		{
 			const auto* dragTarget = IndexOrNull(angleDrag.Active ? angleDrag.TargetIndex : angleScroll.TargetIndex, chart.Targets);
 
-			for (auto& target : chart.Targets)
+			for (auto& target : chart.Targets.SelectedTargets())
 			{
-				if (target.IsSelected && (settingAlsoShowDragTargetPath || &target != dragTarget))
+				if (settingAlsoShowDragTargetPath || &target != dragTarget)
 				{
 					if (settingShowStraightPaths)
 						DrawStraightButtonAngleLine(renderWindow, drawList, Rules::TryGetProperties(target), GetButtonTypeColorU32(target.Type, buttonPathAlphaActive), pathThickness);
@@ -180,15 +180,12 @@ namespace Comfy::Studio::Editor
 		}
 		else
 		{
-			for (auto& target : chart.Targets)
+			for (auto& target : chart.Targets.SelectedTargets())
 			{
-				if (target.IsSelected)
-				{
-					DrawCurvedButtonPathLine(renderWindow, drawList, Rules::TryGetProperties(target), GetButtonTypeColorU32(target.Type, buttonPathAlphaInactive), pathThickness);
+				DrawCurvedButtonPathLine(renderWindow, drawList, Rules::TryGetProperties(target), GetButtonTypeColorU32(target.Type, buttonPathAlphaInactive), pathThickness);
 
-					if (pathsDrawnSoFar++ >= settingMaxPathsToDraw)
-						break;
-				}
+				if (pathsDrawnSoFar++ >= settingMaxPathsToDraw)
+					break;
 			}
 		}
 	}
@@ -283,7 +280,7 @@ namespace Comfy::Studio::Editor
 
 		constexpr auto activeScrollThreshold = TimeSpan::FromSeconds(0.75);
 		angleScroll.Active = angleScroll.LastScroll.IsRunning() && angleScroll.LastScroll.GetElapsed() <= activeScrollThreshold;
-		angleScroll.TargetIndex = angleScroll.Active ? static_cast<i32>(FindIndexOf(chart.Targets, [](auto& t) { return t.IsSelected; })) : -1;
+		angleScroll.TargetIndex = (angleScroll.Active && chart.Targets.GetSelectionCount() > 0) ? chart.Targets.GetSelectedIndices().front() : -1;
 	}
 
 	void TargetPathTool::UpdateMouseAngleDragInput(Chart& chart)
@@ -300,16 +297,15 @@ namespace Comfy::Studio::Editor
 			{
 				angleDrag.UseLastTarget = Gui::GetIO().KeyAlt;
 
-				const size_t targetIndex = angleDrag.UseLastTarget ?
-					FindLastIndexOf(chart.Targets, [](auto& t) { return t.IsSelected; }) :
-					FindIndexOf(chart.Targets, [](auto& t) { return t.IsSelected; });
+				const auto& selectedIndices = chart.Targets.GetSelectedIndices();
+				const i32 targetIndex = selectedIndices.empty() ? -1 : angleDrag.UseLastTarget ? selectedIndices.back() : selectedIndices.front();
 
 				if (InBounds(targetIndex, chart.Targets))
 				{
 					angleDrag.Active = true;
 					angleDrag.StartMouse = Gui::GetMousePos();
 					angleDrag.StartTargetPosition = renderWindow.TargetAreaToScreenSpace(Rules::TryGetProperties(chart.Targets[targetIndex]).Position);
-					angleDrag.TargetIndex = static_cast<i32>(targetIndex);
+					angleDrag.TargetIndex = targetIndex;
 					undoManager.DisallowMergeForLastCommand();
 				}
 			}
@@ -345,18 +341,15 @@ namespace Comfy::Studio::Editor
 
 	void TargetPathTool::IncrementSelectedTargetAnglesBy(Undo::UndoManager& undoManager, Chart& chart, f32 increment)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
 		std::vector<ChangeTargetListProperties::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
 			data.NewValue.Angle = Rules::NormalizeAngle(Rules::TryGetProperties(target).Angle + increment);
@@ -367,18 +360,15 @@ namespace Comfy::Studio::Editor
 
 	void TargetPathTool::SetSelectedTargetAnglesTo(Undo::UndoManager& undoManager, Chart& chart, f32 newAngle)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
 		std::vector<ChangeTargetListProperties::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
 			data.NewValue.Angle = newAngle;
@@ -389,18 +379,15 @@ namespace Comfy::Studio::Editor
 
 	void TargetPathTool::InvertSelectedTargetFrequencies(Undo::UndoManager& undoManager, Chart& chart)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
 		std::vector<ChangeTargetListProperties::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const f32 targetFrequency = Rules::TryGetProperties(target).Frequency;
 
 			auto& data = targetData.emplace_back();
@@ -414,12 +401,12 @@ namespace Comfy::Studio::Editor
 
 	void TargetPathTool::InterpolateSelectedTargetAngles(Undo::UndoManager& undoManager, Chart& chart, bool clockwise)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
-		const auto& firstFoundTarget = *std::find_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
-		const auto& lastFoundTarget = *std::find_if(chart.Targets.rbegin(), chart.Targets.rend(), [](auto& t) { return t.IsSelected; });
+		const auto& firstFoundTarget = chart.Targets.SelectedTargets().front();
+		const auto& lastFoundTarget = chart.Targets.SelectedTargets().back();
 		if (firstFoundTarget.Tick == lastFoundTarget.Tick)
 			return;
 
@@ -433,11 +420,8 @@ namespace Comfy::Studio::Editor
 		std::vector<InterpolateTargetListAngles::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const f32 t = static_cast<f32>(target.Tick.Ticks() - startTicks) * tickSpanReciprocal;
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
@@ -450,12 +434,12 @@ namespace Comfy::Studio::Editor
 
 	void TargetPathTool::InterpolateSelectedTargetDistances(Undo::UndoManager& undoManager, Chart& chart)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
-		const auto& firstFoundTarget = *std::find_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
-		const auto& lastFoundTarget = *std::find_if(chart.Targets.rbegin(), chart.Targets.rend(), [](auto& t) { return t.IsSelected; });
+		const auto& firstFoundTarget = chart.Targets.SelectedTargets().front();
+		const auto& lastFoundTarget = chart.Targets.SelectedTargets().back();
 		if (firstFoundTarget.Tick == lastFoundTarget.Tick)
 			return;
 
@@ -469,11 +453,8 @@ namespace Comfy::Studio::Editor
 		std::vector<InterpolateTargetListDistances::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const f32 t = static_cast<f32>(target.Tick.Ticks() - startTicks) * tickSpanReciprocal;
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
@@ -488,18 +469,15 @@ namespace Comfy::Studio::Editor
 	{
 		assert(std::isnormal(direction));
 
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
 		std::vector<ChangeTargetListAngles::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
 			data.NewValue = Rules::TryGetProperties(target);
@@ -60,13 +60,10 @@ namespace Comfy::Studio::Editor
 					}
 				};
 
-				const auto firstSelectedIt = std::find_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
-				const auto lastSelectedIt = std::find_if(chart.Targets.rbegin(), chart.Targets.rend(), [&](auto& t) { return t.IsSelected; });
-
-				if (firstSelectedIt != chart.Targets.end() && lastSelectedIt != chart.Targets.rend())
+				if (const auto selectedTargets = chart.Targets.SelectedTargets(); !selectedTargets.empty())
 				{
-					const auto& first = *firstSelectedIt;
-					const auto& last = *lastSelectedIt;
+					const auto& first = selectedTargets.front();
+					const auto& last = selectedTargets.back();
 
 					const auto firstProperties = Rules::TryGetProperties(first);
 					const auto lastProperties = Rules::TryGetProperties(last);
@@ -193,11 +190,8 @@ namespace Comfy::Studio::Editor
 	void TargetPositionTool::UpdateInput(Chart& chart)
 	{
 		selectedTargetsBuffer.clear();
-		for (auto& target : chart.Targets)
-		{
-			if (target.IsSelected)
-				selectedTargetsBuffer.push_back(&target);
-		}
+		for (auto& target : chart.Targets.SelectedTargets())
+			selectedTargetsBuffer.push_back(&target);
 
 		UpdateKeyboardKeyBindingsInput(chart);
 		UpdateKeyboardStepInput(chart);
@@ -222,18 +216,17 @@ namespace Comfy::Studio::Editor
 		const f32 cameraZoom = renderWindow.GetCamera().Zoom;
 
 		// NOTE: For each pair, if any is selected within, draw distance guide around each target in previous pair
-		for (size_t i = 0; i < chart.Targets.size();)
+		size_t lastVisitedPairStartIndex = std::numeric_limits<size_t>::max();
+		for (const i32 selectedIndex : chart.Targets.GetSelectedIndices())
 		{
-			const auto& firstTargetOfPair = chart.Targets[i];
+			const size_t i = static_cast<size_t>(selectedIndex - chart.Targets[selectedIndex].Flags.IndexWithinSyncPair);
+			if (i == lastVisitedPairStartIndex)
+				continue;
 
-			bool anyWithinPairSelected = false;
-			for (size_t pair = 0; pair < firstTargetOfPair.Flags.SyncPairCount; pair++)
-			{
-				if (chart.Targets[i + pair].IsSelected)
-					anyWithinPairSelected = true;
-			}
+			lastVisitedPairStartIndex = i;
+			const auto& firstTargetOfPair = chart.Targets[i];
 
-			if (anyWithinPairSelected && i > 0)
+			if (i > 0)
 			{
 				const auto& lastTargetOfPrevPair = chart.Targets[i - 1];
 				const auto tickDistanceToPrevPair = (firstTargetOfPair.Tick - lastTargetOfPrevPair.Tick);
@@ -257,9 +250,6 @@ namespace Comfy::Studio::Editor
 						return;
 				}
 			}
-
-			assert(firstTargetOfPair.Flags.SyncPairCount >= 1);
-			i += firstTargetOfPair.Flags.SyncPairCount;
 		}
 	}
 
@@ -734,15 +724,16 @@ namespace Comfy::Studio::Editor
 
 	void TargetPositionTool::FlipSelectedTargets(Undo::UndoManager& undoManager, Chart& chart, FlipMode flipMode)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
 		const bool isHorizontal = (flipMode == FlipMode::Horizontal || flipMode == FlipMode::HorizontalLocal);
 		const bool isLocal = (flipMode == FlipMode::HorizontalLocal || flipMode == FlipMode::VerticalLocal);
 
-		const vec2 selectionCenter = std::accumulate(chart.Targets.begin(), chart.Targets.end(), vec2(0.0f),
-			[](vec2 p, auto& t) { return t.IsSelected ? p + Rules::TryGetProperties(t).Position : p; }) / static_cast<f32>(selectionCount);
+		const auto selectedTargets = chart.Targets.SelectedTargets();
+		const vec2 selectionCenter = std::accumulate(selectedTargets.begin(), selectedTargets.end(), vec2(0.0f),
+			[](vec2 p, auto& t) { return p + Rules::TryGetProperties(t).Position; }) / static_cast<f32>(selectionCount);
 
 		const vec2 flipCenter = isLocal ? selectionCenter : Rules::PlacementAreaCenter;
 		const vec2 componentFlipMask = isHorizontal ? vec2(-1.0f, +1.0f) : vec2(+1.0f, -1.0f);
@@ -750,11 +741,8 @@ namespace Comfy::Studio::Editor
 		std::vector<ChangeTargetListProperties::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const auto properties = Rules::TryGetProperties(target);
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
@@ -773,18 +761,15 @@ namespace Comfy::Studio::Editor
 
 	void TargetPositionTool::SnapSelectedTargetPositions(Undo::UndoManager& undoManager, Chart& chart, f32 snapDistance)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
 		std::vector<SnapTargetListPositions::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
 			data.NewValue.Position = Rules::SnapPositionTo(Rules::TryGetProperties(target).Position, snapDistance);
@@ -796,21 +781,18 @@ namespace Comfy::Studio::Editor
 
 	void TargetPositionTool::StackSelectedTargetPositions(Undo::UndoManager& undoManager, Chart& chart)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
-		const auto& firstFoundTarget = *std::find_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
+		const auto& firstFoundTarget = chart.Targets.SelectedTargets().front();
 		const vec2 stackPosition = Rules::TryGetProperties(firstFoundTarget).Position;
 
 		std::vector<StackTargetListPositions::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
 			data.NewValue.Position = stackPosition;
@@ -822,12 +804,12 @@ namespace Comfy::Studio::Editor
 
 	void TargetPositionTool::PositionSelectedTargetsInRowBetweenFirstAndLastTarget(Undo::UndoManager& undoManager, Chart& chart, bool backwards)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
-		const auto& firstFoundTarget = *std::find_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
-		const auto& lastFoundTarget = *std::find_if(chart.Targets.rbegin(), chart.Targets.rend(), [&](auto& t) { return t.IsSelected; });
+		const auto& firstFoundTarget = chart.Targets.SelectedTargets().front();
+		const auto& lastFoundTarget = chart.Targets.SelectedTargets().back();
 		if (firstFoundTarget.Tick == lastFoundTarget.Tick)
 			return;
 
@@ -840,11 +822,8 @@ namespace Comfy::Studio::Editor
 
 		if (startPosition == endPosition)
 		{
-			for (const auto& target : chart.Targets)
+			for (const auto& target : chart.Targets.SelectedTargets())
 			{
-				if (!target.IsSelected)
-					continue;
-
 				auto& data = targetData.emplace_back();
 				data.ID = target.ID;
 				data.NewValue.Position = PositionInterpolationSnap(startPosition);
@@ -859,9 +838,6 @@ namespace Comfy::Studio::Editor
 
 				for (auto thisTargetIt = beginIt; thisTargetIt != endIt; thisTargetIt++)
 				{
-					if (!thisTargetIt->IsSelected)
-						continue;
-
 					auto& data = targetData.emplace_back();
 					data.ID = thisTargetIt->ID;
 
@@ -887,10 +863,11 @@ namespace Comfy::Studio::Editor
 				}
 			};
 
+			const auto selectedTargets = chart.Targets.SelectedTargets();
 			if (backwards)
-				applyUsingForwardOrReverseIterators(chart.Targets.rbegin(), chart.Targets.rend());
+				applyUsingForwardOrReverseIterators(selectedTargets.rbegin(), selectedTargets.rend());
 			else
-				applyUsingForwardOrReverseIterators(chart.Targets.begin(), chart.Targets.end());
+				applyUsingForwardOrReverseIterators(selectedTargets.begin(), selectedTargets.end());
 		}
 
 		undoManager.DisallowMergeForLastCommand();
@@ -899,12 +876,12 @@ namespace Comfy::Studio::Editor
 
 	void TargetPositionTool::InterpolateSelectedTargetPositionsLinear(Undo::UndoManager& undoManager, Chart& chart)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
-		const auto& firstFoundTarget = *std::find_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
-		const auto& lastFoundTarget = *std::find_if(chart.Targets.rbegin(), chart.Targets.rend(), [&](auto& t) { return t.IsSelected; });
+		const auto& firstFoundTarget = chart.Targets.SelectedTargets().front();
+		const auto& lastFoundTarget = chart.Targets.SelectedTargets().back();
 		if (firstFoundTarget.Tick == lastFoundTarget.Tick)
 			return;
 
@@ -918,11 +895,8 @@ namespace Comfy::Studio::Editor
 		std::vector<InterpolateTargetListPositions::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const f32 t = static_cast<f32>(target.Tick.Ticks() - startTicks) * tickSpanReciprocal;
 			auto& data = targetData.emplace_back();
 			data.ID = target.ID;
@@ -935,12 +909,12 @@ namespace Comfy::Studio::Editor
 
 	void TargetPositionTool::InterpolateSelectedTargetPositionsCircular(Undo::UndoManager& undoManager, Chart& chart, f32 direction)
 	{
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
-		const auto& firstFoundTarget = *std::find_if(chart.Targets.begin(), chart.Targets.end(), [&](auto& t) { return t.IsSelected; });
-		const auto& lastFoundTarget = *std::find_if(chart.Targets.rbegin(), chart.Targets.rend(), [&](auto& t) { return t.IsSelected; });
+		const auto& firstFoundTarget = chart.Targets.SelectedTargets().front();
+		const auto& lastFoundTarget = chart.Targets.SelectedTargets().back();
 		if (firstFoundTarget.Tick == lastFoundTarget.Tick)
 			return;
 
@@ -958,11 +932,8 @@ namespace Comfy::Studio::Editor
 		std::vector<InterpolateTargetListPositions::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const f32 t = static_cast<f32>(target.Tick.Ticks() - startTicks) * tickSpanReciprocal;
 			const f32 angle = startAngle - (t * glm::pi<f32>() * direction);
 			const vec2 pointOnCircle = vec2(glm::cos(angle), glm::sin(angle)) * radius;
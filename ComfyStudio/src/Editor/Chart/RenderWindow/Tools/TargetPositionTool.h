@@ -57,7 +57,7 @@ namespace Comfy::Studio::Editor
 		void InterpolateSelectedTargetPositionsCircular(Undo::UndoManager& undoManager, Chart& chart, f32 direction);
 
 	private:
-		std::vector<TimelineTarget*> selectedTargetsBuffer;
+		std::vector<const TimelineTarget*> selectedTargetsBuffer;
 		size_t lastFrameSelectionCount = 0;
 
 		struct GrabData
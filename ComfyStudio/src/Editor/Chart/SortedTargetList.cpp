@@ -22,6 +22,15 @@ namespace Comfy::Studio::Editor
 			return GetTargetSortWeight(target.Tick, target.Type);
 		}
 
+		constexpr bool TargetSortWeightLess(const TimelineTarget& a, const TimelineTarget& b)
+		{
+			return GetTargetSortWeight(a) < GetTargetSortWeight(b);
+		}
+
+		// HACK: Not sure if there exists a better solution. If the threshold is determined by time instead
+		//		 then each target will need to store a cached time tick field that has to be kept in sync with the tempo map
+		constexpr auto ChainFragmentTickThreshold = (BeatTick::FromBars(1) / 12);
+
 		std::atomic<std::underlying_type_t<TimelineTargetID>> GlobalTimelineTargetIDCounter = {};
 
 #if COMFY_DEBUG
@@ -108,17 +117,39 @@ namespace Comfy::Studio::Editor
 					assert(false);
 			}
 		}
+
+		void AssertSelectedIndices(const std::vector<TimelineTarget>& targets, const std::vector<i32>& selectedIndices)
+		{
+			assert(std::is_sorted(selectedIndices.begin(), selectedIndices.end()));
+
+			size_t selectionCount = 0;
+			for (i32 index = 0; index < static_cast<i32>(targets.size()); index++)
+			{
+				if (!targets[index].GetIsSelected())
+					continue;
+
+				if (selectionCount >= selectedIndices.size() || selectedIndices[selectionCount] != index)
+					assert(false);
+
+				selectionCount++;
+			}
+
+			if (selectionCount != selectedIndices.size())
+				assert(false);
+		}
 #else
 		inline void AssertTargetListOrder(const std::vector<TimelineTarget>& targets) {}
 		inline void AssertTargetListFlags(const std::vector<TimelineTarget>& targets) {}
 		inline void AssertTargetIDToIndexMap(const std::vector<TimelineTarget>& targets, const std::unordered_map<TimelineTargetID, i32>& idToIndexMap) {}
+		inline void AssertSelectedIndices(const std::vector<TimelineTarget>& targets, const std::vector<i32>& selectedIndices) {}
 #endif
 
-		inline void AssertSortedTargetListEntireState(const std::vector<TimelineTarget>& targets, const std::unordered_map<TimelineTargetID, i32>& idToIndexMap)
+		inline void AssertSortedTargetListEntireState(const std::vector<TimelineTarget>& targets, const std::unordered_map<TimelineTargetID, i32>& idToIndexMap, const std::vector<i32>& selectedIndices)
 		{
 			AssertTargetListOrder(targets);
 			AssertTargetListFlags(targets);
 			AssertTargetIDToIndexMap(targets, idToIndexMap);
+			AssertSelectedIndices(targets, selectedIndices);
 		}
 	}
 
@@ -130,11 +161,14 @@ namespace Comfy::Studio::Editor
 	SortedTargetList::SortedTargetList()
 	{
 		constexpr auto reasonableInitialCapacity = 2000;
-		targets.reserve(reasonableInitialCapacity);
+		sharedTargets = std::make_shared<std::vector<TimelineTarget>>();
+		sharedTargets->reserve(reasonableInitialCapacity);
 	}
 
 	TimelineTargetID SortedTargetList::Add(TimelineTarget newTarget)
 	{
+		auto& targets = MutableTargets();
+
 		if (newTarget.ID == TimelineTargetID::Null)
 			newTarget.ID = GetNextUniqueID();
 
@@ -145,14 +179,52 @@ namespace Comfy::Studio::Editor
 			idToIndexMap[targets[i].ID] = i;
 
 		UpdateTargetInternalFlagsAround(static_cast<i32>(insertionIndex));
+		UpdateSelectedIndicesInRange(static_cast<i32>(insertionIndex), static_cast<i32>(targets.size()));
 
 		// AssertTargetListOrder(targets);
 		// AssertTargetIDToIndexMap(targets, idToIndexMap);
-		AssertSortedTargetListEntireState(targets, idToIndexMap);
+		AssertSortedTargetListEntireState(targets, idToIndexMap, selectedIndices);
 
 		return newTarget.ID;
 	}
 
+	void SortedTargetList::AddRange(std::vector<TimelineTarget>& newTargets)
+	{
+		auto& targets = MutableTargets();
+
+		if (newTargets.empty())
+			return;
+
+		for (auto& newTarget : newTargets)
+		{
+			if (newTarget.ID == TimelineTargetID::Null)
+				newTarget.ID = GetNextUniqueID();
+		}
+
+		const auto oldTargetCount = static_cast<i32>(targets.size());
+		targets.insert(targets.end(), newTargets.begin(), newTargets.end());
+
+		const auto newTargetsBegin = targets.begin() + oldTargetCount;
+		std::sort(newTargetsBegin, targets.end(), TargetSortWeightLess);
+
+		const auto lastNewTargetID = targets.back().ID;
+		const auto firstInsertionIt = std::upper_bound(targets.begin(), newTargetsBegin, *newTargetsBegin, TargetSortWeightLess);
+		const auto firstInsertionIndex = static_cast<i32>(std::distance(targets.begin(), firstInsertionIt));
+
+		// NOTE: Existing targets come before new targets of equal weight, same as for the single Add()
+		std::inplace_merge(firstInsertionIt, newTargetsBegin, targets.end(), TargetSortWeightLess);
+
+		idToIndexMap.reserve(targets.size());
+		for (i32 i = firstInsertionIndex; i < static_cast<i32>(targets.size()); i++)
+			idToIndexMap[targets[i].ID] = i;
+
+		const auto lastInsertionIndex = idToIndexMap.find(lastNewTargetID)->second;
+		UpdateTargetInternalFlagsInRange(firstInsertionIndex - 1, lastInsertionIndex + 1);
+		UpdateSelectedIndicesInRange(firstInsertionIndex, static_cast<i32>(targets.size()));
+
+		AssertSortedTargetListEntireState(targets, idToIndexMap, selectedIndices);
+	}
+
 	void SortedTargetList::Remove(TimelineTarget target)
 	{
 		RemoveAt(FindIndex(target.Tick, target.Type));
@@ -160,6 +232,8 @@ namespace Comfy::Studio::Editor
 
 	void SortedTargetList::RemoveAt(i32 index)
 	{
+		auto& targets = MutableTargets();
+
 		if (!InBounds(static_cast<size_t>(index), targets))
 			return;
 
@@ -169,29 +243,81 @@ namespace Comfy::Studio::Editor
 			idToIndexMap.find(targets[i].ID)->second--;
 
 		idToIndexMap.erase(targets[index].ID);
-		targets.erase(begin() + index);
+		targets.erase(targets.begin() + index);
 
 		UpdateTargetInternalFlagsAround(index);
+		UpdateSelectedIndicesInRange(index, static_cast<i32>(targets.size()));
 
 		AssertTargetIDToIndexMap(targets, idToIndexMap);
+		AssertSelectedIndices(targets, selectedIndices);
+	}
+
+	void SortedTargetList::RemoveRange(const std::vector<TimelineTarget>& targetsToRemove)
+	{
+		auto& targets = MutableTargets();
+
+		indexBuffer.clear();
+		indexBuffer.reserve(targetsToRemove.size());
+
+		for (const auto& target : targetsToRemove)
+		{
+			if (const auto index = FindIndex(target.Tick, target.Type); index > -1)
+				indexBuffer.push_back(index);
+		}
+
+		if (indexBuffer.empty())
+			return;
+
+		std::sort(indexBuffer.begin(), indexBuffer.end());
+		indexBuffer.erase(std::unique(indexBuffer.begin(), indexBuffer.end()), indexBuffer.end());
+
+		const auto firstRemovedIndex = indexBuffer.front();
+		const auto lastRemovedIndex = indexBuffer.back();
+
+		i32 writeIndex = firstRemovedIndex;
+		for (i32 readIndex = firstRemovedIndex, removalIndex = 0; readIndex < static_cast<i32>(targets.size()); readIndex++)
+		{
+			if (removalIndex < static_cast<i32>(indexBuffer.size()) && indexBuffer[removalIndex] == readIndex)
+			{
+				idToIndexMap.erase(targets[readIndex].ID);
+				removalIndex++;
+				continue;
+			}
+
+			targets[writeIndex] = targets[readIndex];
+			idToIndexMap.find(targets[writeIndex].ID)->second = writeIndex;
+			writeIndex++;
+		}
+
+		targets.resize(writeIndex);
+
+		const auto lastRemovedIndexAfterRemoval = lastRemovedIndex - static_cast<i32>(indexBuffer.size()) + 1;
+		UpdateTargetInternalFlagsInRange(firstRemovedIndex - 1, lastRemovedIndexAfterRemoval + 1);
+		UpdateSelectedIndicesInRange(firstRemovedIndex, static_cast<i32>(targets.size()));
+
+		AssertSortedTargetListEntireState(targets, idToIndexMap, selectedIndices);
 	}
 
 	i32 SortedTargetList::FindIndex(BeatTick tick) const
 	{
-		// TODO: Binary search
-		const auto foundIndex = FindIndexOf(targets, [&](const auto& target) { return (target.Tick == tick); });
-		return InBounds(foundIndex, targets) ? static_cast<i32>(foundIndex) : -1;
+		const auto& targets = GetRawView();
+
+		const auto foundIt = std::lower_bound(targets.begin(), targets.end(), tick, [](const auto& target, BeatTick tick) { return (target.Tick < tick); });
+		return (foundIt != targets.end() && foundIt->Tick == tick) ? static_cast<i32>(std::distance(targets.begin(), foundIt)) : -1;
 	}
 
 	i32 SortedTargetList::FindIndex(BeatTick tick, ButtonType type) const
 	{
-		// TODO: Binary search
-		const auto foundIndex = FindIndexOf(targets, [&](const auto& target) { return (target.Tick == tick) && (target.Type == type); });
-		return InBounds(foundIndex, targets) ? static_cast<i32>(foundIndex) : -1;
+		const auto& targets = GetRawView();
+
+		const auto inputSortWeight = GetTargetSortWeight(tick, type);
+		const auto foundIt = std::lower_bound(targets.begin(), targets.end(), inputSortWeight, [](const auto& target, u64 weight) { return (GetTargetSortWeight(target) < weight); });
+		return (foundIt != targets.end() && GetTargetSortWeight(*foundIt) == inputSortWeight) ? static_cast<i32>(std::distance(targets.begin(), foundIt)) : -1;
 	}
 
 	i32 SortedTargetList::FindIndex(TimelineTargetID id) const
 	{
+		const auto& targets = GetRawView();
 #if COMFY_DEBUG && 0
 		const auto linearFoundIndex = FindIndexOf(targets, [id](auto& t) { return t.ID == id; });
 		return InBounds(linearFoundIndex, targets) ? static_cast<i32>(linearFoundIndex) : -1;
@@ -209,10 +335,110 @@ namespace Comfy::Studio::Editor
 		return foundIndex;
 	}
 
+	TimelineTargetRangeView<const TimelineTarget> SortedTargetList::TargetsInTickRange(BeatTick startTick, BeatTick endTick) const
+	{
+		const auto& targets = GetRawView();
+
+		const auto[startIndex, endIndex] = FindIndexRangeInTickRange(startTick, endTick);
+		return { targets.data() + startIndex, targets.data() + endIndex, startIndex };
+	}
+
 	void SortedTargetList::Clear()
 	{
-		targets.clear();
+		// NOTE: No need to copy targets that are about to be discarded anyway
+		if (sharedTargets.use_count() > 1)
+			sharedTargets = std::make_shared<std::vector<TimelineTarget>>();
+		else
+			sharedTargets->clear();
+
 		idToIndexMap.clear();
+		selectedIndices.clear();
+	}
+
+	void SortedTargetList::SetIsSelected(i32 index, bool value)
+	{
+		auto& targets = SelectionStateTargets();
+
+		if (!InBounds(index, targets) || targets[index].isSelected == value)
+			return;
+
+		targets[index].isSelected = value;
+
+		const auto foundIt = std::lower_bound(selectedIndices.begin(), selectedIndices.end(), index);
+		if (value)
+			selectedIndices.insert(foundIt, index);
+		else
+			selectedIndices.erase(foundIt);
+
+		AssertSelectedIndices(targets, selectedIndices);
+	}
+
+	void SortedTargetList::SetIsSelected(const TimelineTarget& target, bool value)
+	{
+		const auto& targets = GetRawView();
+		const TimelineTarget* targetPtr = &target;
+
+		assert(targetPtr >= targets.data() && targetPtr < (targets.data() + targets.size()));
+		SetIsSelected(static_cast<i32>(std::distance(targets.data(), targetPtr)), value);
+	}
+
+	void SortedTargetList::SelectAll()
+	{
+		auto& targets = SelectionStateTargets();
+
+		selectedIndices.resize(targets.size());
+		for (i32 i = 0; i < static_cast<i32>(targets.size()); i++)
+		{
+			targets[i].isSelected = true;
+			selectedIndices[i] = i;
+		}
+	}
+
+	void SortedTargetList::DeselectAll()
+	{
+		auto& targets = SelectionStateTargets();
+
+		for (const auto index : selectedIndices)
+			targets[index].isSelected = false;
+
+		selectedIndices.clear();
+	}
+
+	size_t SortedTargetList::GetSelectionCount() const
+	{
+		return selectedIndices.size();
+	}
+
+	TimelineTargetSelectionView<const TimelineTarget> SortedTargetList::SelectedTargets() const
+	{
+		const auto& targets = GetRawView();
+
+		return { targets.data(), selectedIndices.data(), selectedIndices.data() + selectedIndices.size() };
+	}
+
+	void SortedTargetList::UpdateSelectedIndicesInRange(i32 startIndex, i32 endIndex)
+	{
+		const auto& targets = GetRawView();
+
+		startIndex = Clamp(startIndex, 0, static_cast<i32>(targets.size()));
+		endIndex = Clamp(endIndex, startIndex, static_cast<i32>(targets.size()));
+
+		// NOTE: Indices outside the range are either unaffected or have already been invalidated by the mutation (when endIndex is the end of the list)
+		const auto eraseBeginIt = std::lower_bound(selectedIndices.begin(), selectedIndices.end(), startIndex);
+		const auto eraseEndIt = (endIndex >= static_cast<i32>(targets.size())) ? selectedIndices.end() : std::lower_bound(eraseBeginIt, selectedIndices.end(), endIndex);
+		const auto insertionIndex = std::distance(selectedIndices.begin(), eraseBeginIt);
+		selectedIndices.erase(eraseBeginIt, eraseEndIt);
+
+		indexBuffer.clear();
+		for (i32 i = startIndex; i < endIndex; i++)
+		{
+			if (targets[i].isSelected)
+				indexBuffer.push_back(i);
+		}
+
+		selectedIndices.insert(selectedIndices.begin() + insertionIndex, indexBuffer.begin(), indexBuffer.end());
+
+		AssertSelectedIndices(targets, selectedIndices);
 	}
 
 	void SortedTargetList::ExplicitlyUpdateFlagsAndSortEverything()
@@ -222,6 +448,8 @@ namespace Comfy::Studio::Editor
 
 	void SortedTargetList::ExplicitlyUpdateFlagsAndSortIndexRange(i32 startIndex, i32 endIndex)
 	{
+		auto& targets = MutableTargets();
+
 		if (targets.empty())
 			return;
 
@@ -237,7 +465,7 @@ namespace Comfy::Studio::Editor
 		std::sort(
 			Clamp(targets.begin() + startIndex, targets.begin(), targets.end()),
 			Clamp(targets.begin() + endIndex, targets.begin(), targets.end()),
-			[&](auto& a, auto& b) { return GetTargetSortWeight(a) < GetTargetSortWeight(b); });
+			TargetSortWeightLess);
 
 		for (i32 i = startIndex; i <= endIndex; i++)
 		{
@@ -246,17 +474,19 @@ namespace Comfy::Studio::Editor
 		}
 
 		UpdateTargetInternalFlagsInRange(startIndex, endIndex);
+		UpdateSelectedIndicesInRange(startIndex, endIndex);
 
 		// AssertTargetListFlags(targets);
 		// AssertTargetIDToIndexMap(targets, idToIndexMap);
-		AssertSortedTargetListEntireState(targets, idToIndexMap);
+		AssertSortedTargetListEntireState(targets, idToIndexMap, selectedIndices);
 	}
 
 	void SortedTargetList::operator=(std::vector<TimelineTarget>&& newTargets)
 	{
-		targets = std::move(newTargets);
+		sharedTargets = std::make_shared<std::vector<TimelineTarget>>(std::move(newTargets));
+		auto& targets = *sharedTargets;
 
-		std::sort(targets.begin(), targets.end(), [&](auto& a, auto& b) { return GetTargetSortWeight(a) < GetTargetSortWeight(b); });
+		std::sort(targets.begin(), targets.end(), TargetSortWeightLess);
 		UpdateTargetInternalFlagsInRange(-1, -1);
 
 		idToIndexMap.clear();
@@ -267,20 +497,41 @@ namespace Comfy::Studio::Editor
 			assert(targets[i].ID == TimelineTargetID::Null);
 			idToIndexMap[targets[i].ID = GetNextUniqueID()] = i;
 		}
+
+		selectedIndices.clear();
+		UpdateSelectedIndicesInRange(0, static_cast<i32>(targets.size()));
+	}
+
+	std::shared_ptr<const std::vector<TimelineTarget>> SortedTargetList::GetSnapshot() const
+	{
+		return sharedTargets;
+	}
+
+	void SortedTargetList::DetachSharedTargets()
+	{
+		sharedTargets = std::make_shared<std::vector<TimelineTarget>>(*sharedTargets);
 	}
 
 	size_t SortedTargetList::FindSortedInsertionIndex(BeatTick tick, ButtonType type) const
 	{
+		const auto& targets = GetRawView();
+
 		const auto inputSortWeight = GetTargetSortWeight(tick, type);
+		const auto foundIt = std::upper_bound(targets.begin(), targets.end(), inputSortWeight, [](u64 weight, const auto& target) { return (weight < GetTargetSortWeight(target)); });
+		return static_cast<size_t>(std::distance(targets.begin(), foundIt));
+	}
 
-		size_t insertionIndex;
-		for (insertionIndex = 0; insertionIndex < targets.size(); insertionIndex++)
-		{
-			if (inputSortWeight < GetTargetSortWeight(targets[insertionIndex]))
-				break;
-		}
+	std::pair<i32, i32> SortedTargetList::FindIndexRangeInTickRange(BeatTick startTick, BeatTick endTick) const
+	{
+		const auto& targets = GetRawView();
+
+		if (endTick < startTick)
+			return { 0, 0 };
+
+		const auto startIt = std::lower_bound(targets.begin(), targets.end(), startTick, [](const auto& target, BeatTick tick) { return (target.Tick < tick); });
+		const auto endIt = std::upper_bound(startIt, targets.end(), endTick, [](BeatTick tick, const auto& target) { return (tick < target.Tick); });
 
-		return insertionIndex;
+		return { static_cast<i32>(std::distance(targets.begin(), startIt)), static_cast<i32>(std::distance(targets.begin(), endIt)) };
 	}
 
 	void SortedTargetList::UpdateTargetInternalFlagsAround(i32 index)
@@ -291,6 +542,8 @@ namespace Comfy::Studio::Editor
 
 	void SortedTargetList::UpdateTargetInternalFlagsInRange(i32 startIndex, i32 endIndex)
 	{
+		auto& targets = MutableTargets();
+
 		if (startIndex < 0)
 			startIndex = 0;
 
@@ -302,12 +555,21 @@ namespace Comfy::Studio::Editor
 		const auto syncEndIndex = CeilIndexToSyncPairEnd(endIndex);
 		UpdateSyncPairFlagsInRange(syncStartIndex, syncEndIndex);
 
-		// TODO: Floor and ceil to "slide -> slide chain" transitions (?)
-		UpdateChainFlagsInRange(0, static_cast<i32>(targets.size()));
+		if (targets.empty())
+			return;
+
+		// NOTE: Chain fragments further apart than the threshold never influence each other,
+		//		 so only the targets within the threshold surrounding the changed range need to be updated
+		const auto chainStartTick = targets[Clamp(startIndex, 0, targetCount - 1)].Tick - ChainFragmentTickThreshold;
+		const auto chainEndTick = targets[Clamp(endIndex - 1, 0, targetCount - 1)].Tick + ChainFragmentTickThreshold;
+		const auto[chainStartIndex, chainEndIndex] = FindIndexRangeInTickRange(chainStartTick, chainEndTick);
+		UpdateChainFlagsInRange(chainStartIndex, chainEndIndex);
 	}
 
 	i32 SortedTargetList::FloorIndexToSyncPairStart(i32 index) const
 	{
+		const auto& targets = GetRawView();
+
 		i32 syncPairStartIndex = index;
 		for (i32 i = (index - 1); i >= 0; i--)
 		{
@@ -321,6 +583,8 @@ namespace Comfy::Studio::Editor
 
 	i32 SortedTargetList::CeilIndexToSyncPairEnd(i32 index) const
 	{
+		const auto& targets = GetRawView();
+
 		i32 syncPairEndIndex = index;
 		for (i32 i = index; i < static_cast<i32>(targets.size()); i++)
 		{
@@ -334,6 +598,8 @@ namespace Comfy::Studio::Editor
 
 	i32 SortedTargetList::CountConsecutiveSyncTargets(i32 startIndex) const
 	{
+		const auto& targets = GetRawView();
+
 		for (i32 i = startIndex; i < static_cast<i32>(targets.size()); i++)
 		{
 			const auto& target = targets[i];
@@ -348,6 +614,8 @@ namespace Comfy::Studio::Editor
 
 	i32 SortedTargetList::CountConsecutiveSameTypeSyncTargets(i32 startIndex) const
 	{
+		const auto& targets = GetRawView();
+
 		for (i32 i = startIndex; i < static_cast<i32>(targets.size()); i++)
 		{
 			const auto& target = targets[i];
@@ -362,6 +630,8 @@ namespace Comfy::Studio::Editor
 
 	void SortedTargetList::UpdateSyncPairFlagsInRange(i32 startIndex, i32 endIndex)
 	{
+		auto& targets = MutableTargets();
+
 		for (i32 i = startIndex; i < endIndex;)
 		{
 			const auto pairStartIndex = i;
@@ -400,54 +670,39 @@ namespace Comfy::Studio::Editor
 
 	void SortedTargetList::UpdateChainFlagsForDirection(i32 startIndex, i32 endIndex, ButtonType slideDirection)
 	{
+		auto& targets = MutableTargets();
+
 		assert(IsSlideButtonType(slideDirection));
 
 		for (i32 i = startIndex; i < endIndex; i++)
 		{
 			auto& target = targets[i];
-			if (target.Type == slideDirection)
-			{
-				target.Flags.IsChainStart = false;
-				target.Flags.IsChainEnd = false;
-				slideTargetBuffer.push_back(&target);
-			}
-		}
+			if (target.Type != slideDirection)
+				continue;
 
-		if (slideTargetBuffer.empty())
-			return;
+			const auto* prevTarget = FindAdjacentChainFragment(i, -1);
+			const auto* nextTarget = FindAdjacentChainFragment(i, +1);
 
-		for (i32 i = 0; i < static_cast<i32>(slideTargetBuffer.size()); i++)
-		{
-			auto& target = *slideTargetBuffer[i];
-			auto* nextTarget = (i + 1 < slideTargetBuffer.size()) ? slideTargetBuffer[i + 1] : nullptr;
-			auto* prevTarget = (i - 1 >= 0) ? slideTargetBuffer[i - 1] : nullptr;
+			target.Flags.IsChainStart = target.Flags.IsChain && (prevTarget == nullptr || !prevTarget->Flags.IsChain);
+			target.Flags.IsChainEnd = target.Flags.IsChain && (nextTarget == nullptr || !nextTarget->Flags.IsChain);
+		}
+	}
 
-			if (prevTarget == nullptr)
-			{
-				if (target.Flags.IsChain)
-					target.Flags.IsChainStart = true;
-			}
-			else
-			{
-				// HACK: Not sure if there exists a better solution. If the threshold is determined by time instead
-				//		 then each target will need to store a cached time tick field that has to be kept in sync with the tempo map
-				constexpr auto chainFragThreshold = (BeatTick::FromBars(1) / 12);
-				const auto tickDistToLast = (target.Tick - prevTarget->Tick);
+	const TimelineTarget* SortedTargetList::FindAdjacentChainFragment(i32 index, i32 direction) const
+	{
+		const auto& targets = GetRawView();
 
-				if ((tickDistToLast > chainFragThreshold) || (prevTarget->Flags.IsChain != target.Flags.IsChain))
-				{
-					if (prevTarget->Flags.IsChain)
-						prevTarget->Flags.IsChainEnd = true;
+		const auto& target = targets[index];
+		for (i32 i = index + direction; InBounds(i, targets); i += direction)
+		{
+			const auto& other = targets[i];
+			if (glm::abs((other.Tick - target.Tick).Ticks()) > ChainFragmentTickThreshold.Ticks())
+				return nullptr;
 
-					if (target.Flags.IsChain)
-						target.Flags.IsChainStart = true;
-				}
-			}
+			if (other.Type == target.Type)
+				return &other;
 		}
 
-		if (auto& back = *slideTargetBuffer.back(); back.Flags.IsChain)
-			back.Flags.IsChainEnd = true;
-
-		slideTargetBuffer.clear();
+		return nullptr;
 	}
 }
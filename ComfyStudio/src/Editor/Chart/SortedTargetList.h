@@ -3,6 +3,9 @@
 #include "BeatTick.h"
 #include "Time/TimeSpan.h"
 #include <unordered_map>
+#include <iterator>
+#include <memory>
+#include <atomic>
 
 namespace Comfy::Studio::Editor
 {
@@ -155,14 +158,84 @@ namespace Comfy::Studio::Editor
 
 		BeatTick Tick = {};
 		ButtonType Type = {};
-		bool IsSelected = false;
+
+	private:
+		friend class SortedTargetList;
+
+		// NOTE: Only ever changed by the SortedTargetList selection functions to keep its selection index in sync.
+		//		 Not part of the chart data, so it is written in place without detaching a shared snapshot
+		bool isSelected = false;
+
+	public:
 		TargetFlags Flags = {};
 		TargetProperties Properties = {};
 		TimelineTargetID ID = {};
+
+	public:
+		bool GetIsSelected() const { return isSelected; }
 	};
 
 	static_assert(sizeof(TimelineTarget) == 40);
 
+	// NOTE: Contiguous view into a SortedTargetList, only valid for as long as the list isn't modified
+	template <typename TargetType>
+	struct TimelineTargetRangeView
+	{
+		TargetType* Begin = nullptr;
+		TargetType* End = nullptr;
+		i32 StartIndex = 0;
+
+		TargetType* begin() const { return Begin; }
+		TargetType* end() const { return End; }
+
+		size_t size() const { return static_cast<size_t>(End - Begin); }
+		bool empty() const { return (Begin == End); }
+	};
+
+	// NOTE: Indirect view over the selected targets of a SortedTargetList in sorted order, only valid for as long as the list isn't modified
+	template <typename TargetType>
+	struct TimelineTargetSelectionView
+	{
+		struct Iterator
+		{
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = std::remove_const_t<TargetType>;
+			using difference_type = ptrdiff_t;
+			using pointer = TargetType*;
+			using reference = TargetType&;
+
+			TargetType* Targets;
+			const i32* Index;
+
+			TargetType& operator*() const { return Targets[*Index]; }
+			TargetType* operator->() const { return &Targets[*Index]; }
+
+			Iterator& operator++() { ++Index; return *this; }
+			Iterator operator++(int) { Iterator previous = *this; ++Index; return previous; }
+			Iterator& operator--() { --Index; return *this; }
+			Iterator operator--(int) { Iterator previous = *this; --Index; return previous; }
+			bool operator==(const Iterator& other) const { return (Index == other.Index); }
+			bool operator!=(const Iterator& other) const { return (Index != other.Index); }
+		};
+
+		TargetType* Targets = nullptr;
+		const i32* IndicesBegin = nullptr;
+		const i32* IndicesEnd = nullptr;
+
+		Iterator begin() const { return { Targets, IndicesBegin }; }
+		Iterator end() const { return { Targets, IndicesEnd }; }
+
+		std::reverse_iterator<Iterator> rbegin() const { return std::reverse_iterator<Iterator>(end()); }
+		std::reverse_iterator<Iterator> rend() const { return std::reverse_iterator<Iterator>(begin()); }
+
+		size_t size() const { return static_cast<size_t>(IndicesEnd - IndicesBegin); }
+		bool empty() const { return (IndicesBegin == IndicesEnd); }
+
+		TargetType& operator[](size_t index) const { return Targets[IndicesBegin[index]]; }
+		TargetType& front() const { return Targets[*IndicesBegin]; }
+		TargetType& back() const { return Targets[*(IndicesEnd - 1)]; }
+	};
+
 	class SortedTargetList : NonCopyable
 	{
 	public:
@@ -175,41 +248,126 @@ namespace Comfy::Studio::Editor
 
 	public:
 		COMFY_NODISCARD TimelineTargetID Add(TimelineTarget newTarget);
+		// NOTE: Merges all targets at once only updating the ID map and flags a single time. Null IDs are assigned in place
+		void AddRange(std::vector<TimelineTarget>& newTargets);
 
 		void Remove(TimelineTarget target);
 		void RemoveAt(i32 index);
+		// NOTE: Removes all targets matching by tick and type in a single pass
+		void RemoveRange(const std::vector<TimelineTarget>& targetsToRemove);
 
 		i32 FindIndex(BeatTick tick) const;
 		i32 FindIndex(BeatTick tick, ButtonType type) const;
 		i32 FindIndex(TimelineTargetID id) const;
 
+		// NOTE: All targets within the inclusive [startTick, endTick] range found via binary search
+		TimelineTargetRangeView<const TimelineTarget> TargetsInTickRange(BeatTick startTick, BeatTick endTick) const;
+
 		void Clear();
 
+		// NOTE: The selection index is kept up to date by all mutating functions, allowing for O(k) iteration over the k selected targets
+		void SetIsSelected(i32 index, bool value);
+		void SetIsSelected(const TimelineTarget& target, bool value);
+		void SelectAll();
+		void DeselectAll();
+
+		// NOTE: Single pass over the current selection only, deselecting all targets in order for which the predicate returns true
+		template <typename Predicate>
+		void DeselectIf(Predicate predicate)
+		{
+			auto& targets = SelectionStateTargets();
+			size_t writeIndex = 0;
+			for (size_t readIndex = 0; readIndex < selectedIndices.size(); readIndex++)
+			{
+				auto& target = targets[selectedIndices[readIndex]];
+				if (predicate(static_cast<const TimelineTarget&>(target)))
+					target.isSelected = false;
+				else
+					selectedIndices[writeIndex++] = selectedIndices[readIndex];
+			}
+			selectedIndices.resize(writeIndex);
+		}
+
+		size_t GetSelectionCount() const;
+		TimelineTargetSelectionView<const TimelineTarget> SelectedTargets() const;
+
+		// NOTE: Single pass over the targets within the exclusive [startIndex, endIndex) range, selecting all targets in order for which the predicate returns true.
+		//		 Already selected targets are passed to the predicate as well but are never deselected
+		template <typename Predicate>
+		void SelectInIndexRangeIf(i32 startIndex, i32 endIndex, Predicate predicate)
+		{
+			auto& targets = SelectionStateTargets();
+			startIndex = Clamp(startIndex, 0, static_cast<i32>(targets.size()));
+			endIndex = Clamp(endIndex, startIndex, static_cast<i32>(targets.size()));
+
+			for (i32 i = startIndex; i < endIndex; i++)
+			{
+				auto& target = targets[i];
+				if (!target.isSelected && predicate(static_cast<const TimelineTarget&>(target)))
+					target.isSelected = true;
+			}
+			UpdateSelectedIndicesInRange(startIndex, endIndex);
+		}
+
+		// NOTE: Same as above for all targets within the inclusive [startTick, endTick] range
+		template <typename Predicate>
+		void SelectInTickRangeIf(BeatTick startTick, BeatTick endTick, Predicate predicate)
+		{
+			const auto[startIndex, endIndex] = FindIndexRangeInTickRange(startTick, endTick);
+			SelectInIndexRangeIf(startIndex, endIndex, predicate);
+		}
+
 		void ExplicitlyUpdateFlagsAndSortEverything();
 		void ExplicitlyUpdateFlagsAndSortIndexRange(i32 startIndex, i32 endIndex);
 
 	public:
-		auto begin() { return targets.begin(); }
-		auto end() { return targets.end(); }
-		auto begin() const { return targets.begin(); }
-		auto end() const { return targets.end(); }
+		auto begin() const { return GetRawView().begin(); }
+		auto end() const { return GetRawView().end(); }
+
+		auto rbegin() const { return GetRawView().rbegin(); }
+		auto rend() const { return GetRawView().rend(); }
 
-		auto rbegin() { return targets.rbegin(); }
-		auto rend() { return targets.rend(); }
-		auto rbegin() const { return targets.rbegin(); }
-		auto rend() const { return targets.rend(); }
+		size_t size() const { return GetRawView().size(); }
 
-		size_t size() const { return targets.size(); }
+		auto& operator[](size_t index) const { return GetRawView()[index]; }
 
-		auto& operator[](size_t index) { return targets[index]; }
-		auto& operator[](size_t index) const { return targets[index]; }
+		// NOTE: Explicit write access to a single target, copying the target vector first if it is still shared with a snapshot.
+		//		 There intentionally are no non-const iterator or index overloads so that reading from a non-const list never has to detach it
+		TimelineTarget& GetMutable(size_t index) { return MutableTargets()[index]; }
 
 		void operator=(std::vector<TimelineTarget>&& newTargets);
 
-		const std::vector<TimelineTarget>& GetRawView() const { return targets; }
+		const std::vector<TimelineTarget>& GetRawView() const { return *sharedTargets; }
+		const std::vector<i32>& GetSelectedIndices() const { return selectedIndices; }
+
+		// NOTE: Constant time immutable copy of the current targets that is safe to read from any other thread, for example to serialize them in the background.
+		//		 The target vector is shared until the next modification of this list at which point it is copied once (copy-on-write).
+		//		 Selecting targets is not a modification, so the selection state of a snapshot must never be relied upon or read from another thread
+		std::shared_ptr<const std::vector<TimelineTarget>> GetSnapshot() const;
 
 	private:
+		// NOTE: Must be used for all write access to the chart data so that existing snapshots are never modified
+		std::vector<TimelineTarget>& MutableTargets()
+		{
+			if (sharedTargets.use_count() > 1)
+				DetachSharedTargets();
+
+			// NOTE: Pairs with the release of a snapshot reference on another thread before its count dropped back down to one
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return *sharedTargets;
+		}
+
+		void DetachSharedTargets();
+
+		// NOTE: Only for writing TimelineTarget::isSelected, which no snapshot reader ever accesses. Unlike MutableTargets() this never detaches,
+		//		 so changing the selection doesn't copy the entire target vector while a background save is still holding on to a snapshot
+		std::vector<TimelineTarget>& SelectionStateTargets() { return *sharedTargets; }
+
+		// NOTE: To be called after directly changing the selection state of many targets within the index range at once
+		void UpdateSelectedIndicesInRange(i32 startIndex, i32 endIndex);
+
 		size_t FindSortedInsertionIndex(BeatTick tick, ButtonType type) const;
+		std::pair<i32, i32> FindIndexRangeInTickRange(BeatTick startTick, BeatTick endTick) const;
 
 		void UpdateTargetInternalFlagsAround(i32 index);
 		void UpdateTargetInternalFlagsInRange(i32 startIndex = -1, i32 endIndex = -1);
@@ -224,9 +382,12 @@ namespace Comfy::Studio::Editor
 		void UpdateChainFlagsInRange(i32 startIndex, i32 endIndex);
 		void UpdateChainFlagsForDirection(i32 startIndex, i32 endIndex, ButtonType slideDirection);
 
+		const TimelineTarget* FindAdjacentChainFragment(i32 index, i32 direction) const;
+
 	private:
-		std::vector<TimelineTarget> targets;
-		std::vector<TimelineTarget*> slideTargetBuffer;
+		std::shared_ptr<std::vector<TimelineTarget>> sharedTargets;
+		std::vector<i32> indexBuffer;
+		std::vector<i32> selectedIndices;
 
 		std::unordered_map<TimelineTargetID, i32> idToIndexMap;
 	};
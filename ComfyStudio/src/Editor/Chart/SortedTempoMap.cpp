@@ -20,119 +20,118 @@ namespace Comfy::Studio::Editor
 		applyFlyingTimeFactor = value;
 	}
 
-	TimeSpan TempoMapAccelerationStructure::ConvertTickToTimeUsingLookupTableIndexing(BeatTick tick) const
+	TimeSpan TempoMapAccelerationStructure::ConvertTickToTimeUsingSegmentBinarySearch(BeatTick tick) const
 	{
-		const i32 tickTimeCount = static_cast<i32>(tickTimes.size());
-		const i32 totalTicks = tick.Ticks();
+		if (segments.empty())
+			return TimeSpan::Zero();
 
-		if (totalTicks < 0) // NOTE: Negative tick
-		{
-			// NOTE: Calculate the duration of a BeatTick at the first tempo
-			const TimeSpan firstTickDuration = TimeSpan::FromSeconds((60.0 / firstTempoBPM) / BeatTick::TicksPerBeat);
-
-			// NOTE: Then scale by the negative tick
-			return firstTickDuration * totalTicks;
-		}
-		else if (totalTicks >= tickTimeCount) // NOTE: Tick is outside the defined tempo map
-		{
-			// NOTE: Take the last calculated time
-			const TimeSpan lastTime = GetLastCalculatedTime();
+		// NOTE: Negative ticks are extrapolated using the first and ticks past the last tempo change using the last segment
+		const auto& segment = segments[FindSegmentIndexForTick(tick)];
+		const i32 ticksWithinSegment = (tick.Ticks() - segment.StartTick);
 
-			// NOTE: Calculate the duration of a BeatTick at the last used tempo
-			const TimeSpan lastTickDuration = TimeSpan::FromSeconds((60.0 / lastTempoBPM) / BeatTick::TicksPerBeat);
-
-			// NOTE: Then scale by the remaining ticks
-			const i32 remainingTicks = (totalTicks - tickTimeCount) + 1;
-			return lastTime + (lastTickDuration * remainingTicks);
-		}
-		else // NOTE: Use the pre calculated lookup table
-		{
-			return tickTimes.at(totalTicks);
-		}
+		return TimeSpan::FromSeconds(segment.StartTime + (segment.TickDuration * ticksWithinSegment));
 	}
 
-	BeatTick TempoMapAccelerationStructure::ConvertTimeToTickUsingLookupTableBinarySearch(TimeSpan time) const
+	BeatTick TempoMapAccelerationStructure::ConvertTimeToTickUsingSegmentBinarySearch(TimeSpan time) const
 	{
-		const i32 tickTimeCount = static_cast<i32>(tickTimes.size());
-		const TimeSpan lastTime = GetLastCalculatedTime();
+		if (segments.empty())
+			return BeatTick::Zero();
 
-		if (time < TimeSpan::FromSeconds(0.0)) // NOTE: Negative time
-		{
-			// NOTE: Calculate the duration of a BeatTick at the first tempo
-			const TimeSpan firstTickDuration = TimeSpan::FromSeconds((60.0 / firstTempoBPM) / BeatTick::TicksPerBeat);
+		const f64 timeSeconds = time.TotalSeconds();
 
-			// NOTE: Then the time by the negative tick, this is assuming all tempo changes happen on positive ticks
-			return BeatTick(static_cast<i32>(time / firstTickDuration));
-		}
-		else if (time >= lastTime) // NOTE: Tick is outside the defined tempo map
+		if (timeSeconds < 0.0) // NOTE: Negative time
 		{
-			const TimeSpan timePastLast = (time - lastTime);
-
-			// NOTE: Each tick past the end has a duration of this value
-			const TimeSpan lastTickDuration = TimeSpan::FromSeconds((60.0 / lastTempoBPM) / BeatTick::TicksPerBeat);
+			// NOTE: Divide the time by the duration of a BeatTick at the first tempo, this is assuming all tempo changes happen on positive ticks
+			const auto& firstSegment = segments.front();
+			return BeatTick(static_cast<i32>(timeSeconds / firstSegment.TickDuration));
+		}
 
-			// NOTE: So we just have to divide the remaining ticks by the duration
-			const f64 ticks = timePastLast / lastTickDuration;
+		const auto& segment = segments[FindSegmentIndexForTime(time)];
+		const f64 ticksWithinSegment = (timeSeconds - segment.StartTime) / segment.TickDuration;
 
-			// NOTE: And add it to the last tick
-			return BeatTick(static_cast<i32>(tickTimeCount + ticks - 1));
+		if (&segment == &segments.back()) // NOTE: Time is outside the defined tempo map
+		{
+			// NOTE: Each tick past the end has the duration of the last segment so only truncate the remaining ticks
+			return BeatTick(static_cast<i32>(segment.StartTick + ticksWithinSegment));
 		}
-		else // NOTE: Perform a binary search
+		else // NOTE: Round to the closest tick, preferring the earlier one if exactly in between
 		{
-			i32 left = 0, right = tickTimeCount - 1;
-
-			while (left <= right)
-			{
-				const i32 mid = (left + right) / 2;
-
-				if (time < tickTimes[mid])
-					right = mid - 1;
-				else if (time > tickTimes[mid])
-					left = mid + 1;
-				else
-					return BeatTick::FromTicks(mid);
-			}
-
-			return BeatTick::FromTicks((tickTimes[left] - time) < (time - tickTimes[right]) ? left : right);
+			const f64 flooredTicks = glm::floor(ticksWithinSegment);
+			const i32 roundedTicks = static_cast<i32>(flooredTicks) + ((ticksWithinSegment - flooredTicks) > 0.5 ? 1 : 0);
+			return BeatTick(segment.StartTick + roundedTicks);
 		}
 	}
 
 	TimeSpan TempoMapAccelerationStructure::GetLastCalculatedTime() const
 	{
-		const size_t tickTimeCount = tickTimes.size();
-		return (tickTimeCount == 0) ? TimeSpan::Zero() : tickTimes[tickTimeCount - 1];
+		return segments.empty() ? TimeSpan::Zero() : TimeSpan::FromSeconds(segments.back().StartTime);
+	}
+
+	TimeSpan TempoMapAccelerationStructure::GetMaxTickDuration() const
+	{
+		f64 maxTickDuration = 0.0;
+		for (const auto& segment : segments)
+			maxTickDuration = Max(maxTickDuration, segment.TickDuration);
+
+		return TimeSpan::FromSeconds(maxTickDuration);
 	}
 
 	void TempoMapAccelerationStructure::Rebuild(const SortedTempoMap& tempoMap)
+	{
+		RebuildFrom(tempoMap, 0);
+	}
+
+	void TempoMapAccelerationStructure::RebuildFrom(const SortedTempoMap& tempoMap, size_t firstChangedIndex)
 	{
 		assert(tempoMap.Count() > 0);
-		tickTimes.resize(tempoMap.GetRawView().back().Tick.Ticks() + 1);
 
-		f64 lastEndTime = 0.0;
-		tempoMap.ForEachNewOrInherited([&](const NewOrInheritedTempoChange& tempoChange)
+		segments.resize(tempoMap.Count());
+
+		// NOTE: The start time of each segment only depends on the preceding one so everything before the first changed index can be reused as is
+		tempoMap.ForEachNewOrInheritedInRange(Min(firstChangedIndex, tempoMap.Count() - 1), tempoMap.Count(), [&](const NewOrInheritedTempoChange& tempoChange)
 		{
 			const f64 bpm = GetF64FlyingTimeFactorAdjustedBPM(tempoChange.Tempo.BeatsPerMinute, tempoChange.FlyingTime, applyFlyingTimeFactor);
 			const f64 beatDuration = (60.0 / bpm);
 			const f64 tickDuration = (beatDuration / BeatTick::TicksPerBeat);
 
-			const bool isSingleOrLastTempo = (tempoMap.Count() == 1) || (tempoChange.IndexWithinTempoMap == (tempoMap.Count() - 1));
-			const size_t timesCount = (isSingleOrLastTempo) ? (tickTimes.size()) : (tempoMap.GetRawViewAt(tempoChange.IndexWithinTempoMap + 1).Tick.Ticks());
-
-			for (size_t i = 0, t = tempoChange.Tick.Ticks(); t < timesCount; t++)
-				tickTimes[t] = TimeSpan::FromSeconds((tickDuration * i++) + lastEndTime);
+			const size_t segmentIndex = tempoChange.IndexWithinTempoMap;
+			auto& segment = segments[segmentIndex];
+			segment.StartTick = tempoChange.Tick.Ticks();
+			segment.TickDuration = tickDuration;
 
-			if (tempoMap.Count() > 1)
-				lastEndTime = tickTimes[timesCount - 1].TotalSeconds() + tickDuration;
+			if (segmentIndex == 0)
+			{
+				segment.StartTime = 0.0;
+			}
+			else
+			{
+				const auto& previousSegment = segments[segmentIndex - 1];
+				segment.StartTime = previousSegment.StartTime + (previousSegment.TickDuration * (segment.StartTick - previousSegment.StartTick));
+			}
 
-			firstTempoBPM = (tempoChange.IndexWithinTempoMap == 0) ? bpm : firstTempoBPM;
-			lastTempoBPM = bpm;
 			return false;
 		});
 	}
 
+	size_t TempoMapAccelerationStructure::FindSegmentIndexForTick(BeatTick tick) const
+	{
+		assert(!segments.empty());
+		const auto foundIt = std::upper_bound(segments.begin(), segments.end(), tick.Ticks(), [](i32 tick, const TempoSegment& segment) { return tick < segment.StartTick; });
+		return (foundIt == segments.begin()) ? 0 : static_cast<size_t>(std::distance(segments.begin(), foundIt) - 1);
+	}
+
+	size_t TempoMapAccelerationStructure::FindSegmentIndexForTime(TimeSpan time) const
+	{
+		assert(!segments.empty());
+		const f64 timeSeconds = time.TotalSeconds();
+		const auto foundIt = std::upper_bound(segments.begin(), segments.end(), timeSeconds, [](f64 time, const TempoSegment& segment) { return time < segment.StartTime; });
+		return (foundIt == segments.begin()) ? 0 : static_cast<size_t>(std::distance(segments.begin(), foundIt) - 1);
+	}
+
 	SortedTempoMap::SortedTempoMap()
 	{
-		tempoChanges.push_back(TempoChange(BeatTick(0), TempoChange::DefaultTempo, TempoChange::DefaultSignature));
+		sharedTempoChanges = std::make_shared<std::vector<TempoChange>>();
+		sharedTempoChanges->push_back(TempoChange(BeatTick(0), TempoChange::DefaultTempo, TempoChange::DefaultSignature));
 
 		accelerationStructure.SetApplyFlyingTimeFactor(false);
 		accelerationStructureFlyingTimeFactor.SetApplyFlyingTimeFactor(true);
@@ -140,6 +139,8 @@ namespace Comfy::Studio::Editor
 
 	void SortedTempoMap::SetTempoChange(TempoChange tempoChangeToInsertOrUpdate)
 	{
+		auto& tempoChanges = MutableTempoChanges();
+
 		assert(tempoChangeToInsertOrUpdate.Tick.Ticks() >= 0);
 		if (tempoChangeToInsertOrUpdate.Signature.has_value()) assert(tempoChangeToInsertOrUpdate.Signature->Numerator > 0 && tempoChangeToInsertOrUpdate.Signature->Denominator > 0);
 
@@ -161,9 +162,15 @@ namespace Comfy::Studio::Editor
 
 	void SortedTempoMap::RemoveTempoChange(BeatTick tick)
 	{
-		const auto foundChange = std::find_if(tempoChanges.begin(), tempoChanges.end(), [&](auto& tempoChange) { return tempoChange.Tick == tick; });
-		if (foundChange != tempoChanges.end())
-			tempoChanges.erase(foundChange);
+		// NOTE: Search the shared view first so that a no-op removal never detaches an existing snapshot
+		const auto& rawView = GetRawView();
+		const auto foundChange = std::find_if(rawView.begin(), rawView.end(), [&](auto& tempoChange) { return tempoChange.Tick == tick; });
+		if (foundChange == rawView.end())
+			return;
+
+		const auto foundIndex = std::distance(rawView.begin(), foundChange);
+		auto& tempoChanges = MutableTempoChanges();
+		tempoChanges.erase(tempoChanges.begin() + foundIndex);
 
 		// NOTE: Always keep at least one TempoChange because the TimelineMap relies on it
 		if (tempoChanges.empty())
@@ -172,6 +179,8 @@ namespace Comfy::Studio::Editor
 
 	void SortedTempoMap::ChangeExistingTempoChangeTick(size_t index, BeatTick newTick)
 	{
+		auto& tempoChanges = MutableTempoChanges();
+
 		if (!InBounds(index, tempoChanges))
 		{
 			assert(false);
@@ -184,11 +193,15 @@ namespace Comfy::Studio::Editor
 
 	const TempoChange& SortedTempoMap::GetRawViewAt(size_t index) const
 	{
+		const auto& tempoChanges = GetRawView();
+
 		return tempoChanges.at(index);
 	}
 
 	const TempoChange& SortedTempoMap::FindRawViewAtTick(BeatTick tick) const
 	{
+		const auto& tempoChanges = GetRawView();
+
 		assert(!tempoChanges.empty());
 		if (tempoChanges.size() == 1)
 			return tempoChanges.front();
@@ -207,6 +220,8 @@ namespace Comfy::Studio::Editor
 
 	i32 SortedTempoMap::RawViewToIndex(const TempoChange* tempoChange) const
 	{
+		const auto& tempoChanges = GetRawView();
+
 		if (tempoChange == nullptr)
 			return -1;
 
@@ -220,6 +235,8 @@ namespace Comfy::Studio::Editor
 
 	NewOrInheritedTempoChange SortedTempoMap::FindNewOrInheritedAt(size_t index) const
 	{
+		const auto& tempoChanges = GetRawView();
+
 		NewOrInheritedTempoChange result = {};
 		if (index >= tempoChanges.size())
 			return result;
@@ -246,6 +263,8 @@ namespace Comfy::Studio::Editor
 
 	const TempoChange* SortedTempoMap::FindNextTempoChangeWithValidSignatureAt(size_t startIndex) const
 	{
+		const auto& tempoChanges = GetRawView();
+
 		if (startIndex == 0)
 			return &tempoChanges[startIndex];
 
@@ -260,13 +279,15 @@ namespace Comfy::Studio::Editor
 
 	size_t SortedTempoMap::Count() const
 	{
+		const auto& tempoChanges = GetRawView();
+
 		return tempoChanges.size();
 	}
 
 	void SortedTempoMap::Reset()
 	{
-		tempoChanges.clear();
-		tempoChanges.push_back(TempoChange(BeatTick(0), TempoChange::DefaultTempo, TempoChange::DefaultSignature));
+		sharedTempoChanges = std::make_shared<std::vector<TempoChange>>();
+		sharedTempoChanges->push_back(TempoChange(BeatTick(0), TempoChange::DefaultTempo, TempoChange::DefaultSignature));
 	}
 
 	void SortedTempoMap::RebuildAccelerationStructure()
@@ -275,34 +296,55 @@ namespace Comfy::Studio::Editor
 		accelerationStructureFlyingTimeFactor.Rebuild(*this);
 	}
 
+	void SortedTempoMap::RebuildAccelerationStructureFrom(size_t firstChangedIndex)
+	{
+		accelerationStructure.RebuildFrom(*this, firstChangedIndex);
+		accelerationStructureFlyingTimeFactor.RebuildFrom(*this, firstChangedIndex);
+	}
+
 	TimeSpan SortedTempoMap::TickToTime(BeatTick tick) const
 	{
-		return accelerationStructure.ConvertTickToTimeUsingLookupTableIndexing(tick);
+		return accelerationStructure.ConvertTickToTimeUsingSegmentBinarySearch(tick);
 	}
 
 	BeatTick SortedTempoMap::TimeToTick(TimeSpan tick) const
 	{
-		return accelerationStructure.ConvertTimeToTickUsingLookupTableBinarySearch(tick);
+		return accelerationStructure.ConvertTimeToTickUsingSegmentBinarySearch(tick);
 	}
 
 	TimelineTargetSpawnTimes SortedTempoMap::GetTargetSpawnTimes(const TimelineTarget& target) const
 	{
 		const BeatTick buttonTick = target.Tick;
-		const TimeSpan buttonTime = accelerationStructure.ConvertTickToTimeUsingLookupTableIndexing(buttonTick);
+		const TimeSpan buttonTime = accelerationStructure.ConvertTickToTimeUsingSegmentBinarySearch(buttonTick);
 
-		const TimeSpan buttonTimeAdjusted = accelerationStructureFlyingTimeFactor.ConvertTickToTimeUsingLookupTableIndexing(buttonTick);
-		const TimeSpan targetTimeAdjusted = accelerationStructureFlyingTimeFactor.ConvertTickToTimeUsingLookupTableIndexing(buttonTick - BeatTick::FromBars(1));
+		const TimeSpan buttonTimeAdjusted = accelerationStructureFlyingTimeFactor.ConvertTickToTimeUsingSegmentBinarySearch(buttonTick);
+		const TimeSpan targetTimeAdjusted = accelerationStructureFlyingTimeFactor.ConvertTickToTimeUsingSegmentBinarySearch(buttonTick - BeatTick::FromBars(1));
 		const TimeSpan flyingTimeAdjusted = (buttonTimeAdjusted - targetTimeAdjusted);
 
 		const TimeSpan targetTime = (buttonTime - flyingTimeAdjusted);
-		const BeatTick targetTick = accelerationStructure.ConvertTimeToTickUsingLookupTableBinarySearch(targetTime);
+		const BeatTick targetTick = accelerationStructure.ConvertTimeToTickUsingSegmentBinarySearch(targetTime);
 
 		return TimelineTargetSpawnTimes { targetTime, buttonTime, targetTick, buttonTick, flyingTimeAdjusted };
 	}
 
+	std::pair<BeatTick, BeatTick> SortedTempoMap::GetOnScreenButtonTickRange(BeatTick cursorTick, BeatTick postHitLingerDuration) const
+	{
+		// NOTE: No flying time can ever be longer than a bar at the slowest flying time adjusted tempo
+		const TimeSpan maxFlyingTime = accelerationStructureFlyingTimeFactor.GetMaxTickDuration() * BeatTick::FromBars(1).Ticks();
+
+		// NOTE: Additional margin to account for the tick rounding of the spawn times
+		constexpr BeatTick roundingMargin = BeatTick::FromBeats(1);
+
+		const BeatTick startTick = (cursorTick - postHitLingerDuration - roundingMargin);
+		const BeatTick endTick = (TimeToTick(TickToTime(cursorTick) + maxFlyingTime) + roundingMargin);
+		return { startTick, endTick };
+	}
+
 	void SortedTempoMap::operator=(std::vector<TempoChange>&& newTempoChanges)
 	{
-		tempoChanges = std::move(newTempoChanges);
+		sharedTempoChanges = std::make_shared<std::vector<TempoChange>>(std::move(newTempoChanges));
+		auto& tempoChanges = *sharedTempoChanges;
+
 		if (tempoChanges.empty())
 			tempoChanges.push_back(TempoChange(BeatTick(0), TempoChange::DefaultTempo, TempoChange::DefaultSignature));
 		else
@@ -317,8 +359,20 @@ namespace Comfy::Studio::Editor
 		std::sort(tempoChanges.begin(), tempoChanges.end(), [](const auto& a, const auto& b) { return a.Tick < b.Tick; });
 	}
 
+	std::shared_ptr<const std::vector<TempoChange>> SortedTempoMap::GetSnapshot() const
+	{
+		return sharedTempoChanges;
+	}
+
+	void SortedTempoMap::DetachSharedTempoChanges()
+	{
+		sharedTempoChanges = std::make_shared<std::vector<TempoChange>>(*sharedTempoChanges);
+	}
+
 	size_t SortedTempoMap::InternalFindSortedInsertionIndex(BeatTick tick) const
 	{
+		const auto& tempoChanges = GetRawView();
+
 		for (size_t i = 0; i < tempoChanges.size(); i++)
 		{
 			if (tick <= tempoChanges[i].Tick)
@@ -120,16 +120,31 @@ namespace Comfy::Studio::Editor
 	public:
 		void SetApplyFlyingTimeFactor(bool value);
 
-		TimeSpan ConvertTickToTimeUsingLookupTableIndexing(BeatTick tick) const;
-		BeatTick ConvertTimeToTickUsingLookupTableBinarySearch(TimeSpan time) const;
+		TimeSpan ConvertTickToTimeUsingSegmentBinarySearch(BeatTick tick) const;
+		BeatTick ConvertTimeToTickUsingSegmentBinarySearch(TimeSpan time) const;
 
 		TimeSpan GetLastCalculatedTime() const;
+		TimeSpan GetMaxTickDuration() const;
+
 		void Rebuild(const SortedTempoMap& tempoMap);
+		// NOTE: Only recalculates the segments starting at (and following) the specified tempo change index,
+		//		 the segment count is always resized to match the tempo map so this works for insertions and removals as well
+		void RebuildFrom(const SortedTempoMap& tempoMap, size_t firstChangedIndex);
+
+	private:
+		size_t FindSegmentIndexForTick(BeatTick tick) const;
+		size_t FindSegmentIndexForTime(TimeSpan time) const;
 
 	private:
-		// NOTE: Pre calculated tick times up to the last tempo change
-		std::vector<TimeSpan> tickTimes;
-		f64 firstTempoBPM = 0.0, lastTempoBPM = 0.0;
+		// NOTE: One piecewise linear segment per tempo change with the first and last segment extending infinitely towards negative and positive ticks
+		struct TempoSegment
+		{
+			i32 StartTick;
+			f64 StartTime;
+			f64 TickDuration;
+		};
+
+		std::vector<TempoSegment> segments;
 		bool applyFlyingTimeFactor = false;
 	};
 
@@ -164,6 +179,8 @@ namespace Comfy::Studio::Editor
 
 		// NOTE: Needs to be called every time a TempoChange has been edited
 		void RebuildAccelerationStructure();
+		// NOTE: Cheaper alternative if only the TempoChanges starting at the specified index have been edited
+		void RebuildAccelerationStructureFrom(size_t firstChangedIndex);
 
 		TimeSpan TickToTime(BeatTick tick) const;
 		BeatTick TimeToTick(TimeSpan tick) const;
@@ -171,6 +188,10 @@ namespace Comfy::Studio::Editor
 		// NOTE: Adjusted for FlyingTimeFactor. Should be used instead of "buttonTick - BeatTick::FromBars(1)" calculations whenever appropriate
 		TimelineTargetSpawnTimes GetTargetSpawnTimes(const TimelineTarget& target) const;
 
+		// NOTE: Conservative (inclusive) range of button ticks that could possibly be on screen at the cursor tick, including the post hit linger duration.
+		//		 Intended for culling via SortedTargetList::TargetsInTickRange() before checking the exact spawn times of each target
+		std::pair<BeatTick, BeatTick> GetOnScreenButtonTickRange(BeatTick cursorTick, BeatTick postHitLingerDuration) const;
+
 	public:
 		template <typename Func>
 		void ForEachNewOrInheritedInRange(size_t start, size_t end, Func perTempoChangeFunc) const;
@@ -187,13 +208,27 @@ namespace Comfy::Studio::Editor
 	public:
 		// TODO: Maybe replace with explicit "MoveAssignRawVectorForDeserialization()" function or something similar..?
 		void operator=(std::vector<TempoChange>&& newTempoChanges);
-		const std::vector<TempoChange>& GetRawView() const { return tempoChanges; }
+		const std::vector<TempoChange>& GetRawView() const { return *sharedTempoChanges; }
+
+		// NOTE: Constant time immutable copy of the current tempo changes, copied on the next write just like SortedTargetList::GetSnapshot()
+		std::shared_ptr<const std::vector<TempoChange>> GetSnapshot() const;
 
 	private:
+		// NOTE: Must only be used by the functions that actually modify the tempo changes, all reads go through GetRawView() so that they never detach a snapshot
+		std::vector<TempoChange>& MutableTempoChanges()
+		{
+			if (sharedTempoChanges.use_count() > 1)
+				DetachSharedTempoChanges();
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return *sharedTempoChanges;
+		}
+
+		void DetachSharedTempoChanges();
 		size_t InternalFindSortedInsertionIndex(BeatTick tick) const;
 
 	private:
-		std::vector<TempoChange> tempoChanges;
+		std::shared_ptr<std::vector<TempoChange>> sharedTempoChanges;
 		TempoMapAccelerationStructure accelerationStructure;
 		TempoMapAccelerationStructure accelerationStructureFlyingTimeFactor;
 	};
@@ -201,6 +236,7 @@ namespace Comfy::Studio::Editor
 	template<typename Func>
 	void SortedTempoMap::ForEachNewOrInheritedInRange(size_t start, size_t end, Func perTempoChangeFunc) const
 	{
+		const auto& tempoChanges = GetRawView();
 		assert(start < tempoChanges.size() && end <= tempoChanges.size() && !tempoChanges.empty());
 
 		NewOrInheritedTempoChange newOrInherited = {};
@@ -228,12 +264,13 @@ namespace Comfy::Studio::Editor
 	template<typename Func>
 	void SortedTempoMap::ForEachNewOrInherited(Func perTempoChangeFunc) const
 	{
-		return ForEachNewOrInheritedInRange(static_cast<size_t>(0), tempoChanges.size(), perTempoChangeFunc);
+		return ForEachNewOrInheritedInRange(static_cast<size_t>(0), GetRawView().size(), perTempoChangeFunc);
 	}
 
 	template<typename Func>
 	void SortedTempoMap::ForEachBar(Func perBarFunc) const
 	{
+		const auto& tempoChanges = GetRawView();
 		assert(!tempoChanges.empty());
 		TimeSignature newOrInheritedSignature = tempoChanges[0].Signature.value_or(TempoChange::DefaultSignature);
 
@@ -267,6 +304,7 @@ namespace Comfy::Studio::Editor
 	template <typename Func>
 	void SortedTempoMap::ForEachBeatBar(Func perBeatBarFunc) const
 	{
+		const auto& tempoChanges = GetRawView();
 		assert(!tempoChanges.empty());
 		TimeSignature newOrInheritedSignature = tempoChanges[0].Signature.value_or(TempoChange::DefaultSignature);
 
@@ -147,11 +147,8 @@ namespace Comfy::Studio::Editor
 
 	void TargetInspector::Gui(Chart& chart)
 	{
-		for (auto& target : chart.Targets)
-		{
-			if (target.IsSelected)
-				selectedTargets.push_back({ &target, Rules::TryGetProperties(target) });
-		}
+		for (auto& target : chart.Targets.SelectedTargets())
+			selectedTargets.push_back({ &target, Rules::TryGetProperties(target) });
 
 		GuiPropertyRAII::PropertyValueColumns columns;
 		GuiSelectedTargets(chart);
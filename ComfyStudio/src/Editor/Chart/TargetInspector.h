@@ -32,19 +32,17 @@ namespace Comfy::Studio::Editor
 
 		struct TargetViewProperties
 		{
-			TimelineTarget* Target;
+			const TimelineTarget* Target;
 			TargetProperties PropertiesOrPreset;
 
-			TimelineTarget& operator*() { return *Target; }
 			const TimelineTarget& operator*() const { return *Target; }
-			TimelineTarget* operator->() { return Target; }
 			const TimelineTarget* operator->() const { return Target; }
 		};
 
 		// NOTE: All of these are only valid between the begin and end of Gui()
 		std::vector<TargetViewProperties> selectedTargets;
 
-		TimelineTarget* frontSelectedTarget;
+		const TimelineTarget* frontSelectedTarget;
 		TargetProperties frontSelectedProperties;
 	};
 }
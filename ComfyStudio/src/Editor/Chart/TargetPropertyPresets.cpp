@@ -5,17 +5,20 @@ namespace Comfy::Studio::Editor
 {
 	namespace
 	{
-		constexpr bool IsAnyTargetWithinSyncPairSelected(const TimelineTarget* const syncPair, const i32 pairCount)
+		// NOTE: Start index of the next sync pair after the one starting at the previous index that contains any selected target or -1 if there are none left
+		i32 FindNextSelectedSyncPairStartIndex(const SortedTargetList& targets, const i32 previousPairStartIndex)
 		{
-			assert(syncPair != nullptr && pairCount > 1 && syncPair[0].Flags.IndexWithinSyncPair == 0);
+			const auto& selectedIndices = targets.GetSelectedIndices();
+			const i32 searchStartIndex = (previousPairStartIndex < 0) ? 0 : (previousPairStartIndex + targets[previousPairStartIndex].Flags.SyncPairCount);
 
-			for (i32 i = 0; i < pairCount; i++)
+			for (auto it = std::lower_bound(selectedIndices.begin(), selectedIndices.end(), searchStartIndex); it != selectedIndices.end(); it++)
 			{
-				if (syncPair[i].IsSelected)
-					return true;
+				const auto& target = targets[*it];
+				if (target.Flags.IsSync)
+					return (*it - target.Flags.IndexWithinSyncPair);
 			}
 
-			return false;
+			return -1;
 		}
 
 		constexpr vec2 AngleCornerTypeToSquarePlacementAreaCorner(Rules::AngleCorner corner, const DynamicSyncPresetSettings& settings)
@@ -105,7 +108,7 @@ namespace Comfy::Studio::Editor
 			//		 then the furthest from the center should be chosen to avoid creating a minimum sized square (?)
 			for (i32 i = pairCount - 1; i >= 0; i--)
 			{
-				if (syncPair[i].IsSelected)
+				if (syncPair[i].GetIsSelected())
 					return i;
 			}
 
@@ -317,24 +320,8 @@ namespace Comfy::Studio::Editor
 	void ApplyDynamicSyncPresetToSelectedTargets(Undo::UndoManager& undoManager, Chart& chart, const DynamicSyncPreset preset, const DynamicSyncPresetSettings& settings)
 	{
 		size_t syncSelectionCount = 0;
-		for (i32 i = 0; i < static_cast<i32>(chart.Targets.size());)
-		{
-			const auto& firstTargetOfPair = chart.Targets[i];
-			if (firstTargetOfPair.Flags.IsSync)
-			{
-				for (i32 pair = 0; pair < firstTargetOfPair.Flags.SyncPairCount; pair++)
-				{
-					if (chart.Targets[i + pair].IsSelected)
-					{
-						syncSelectionCount += firstTargetOfPair.Flags.SyncPairCount;
-						break;
-					}
-				}
-			}
-
-			assert(firstTargetOfPair.Flags.SyncPairCount >= 1);
-			i += firstTargetOfPair.Flags.SyncPairCount;
-		}
+		for (i32 i = FindNextSelectedSyncPairStartIndex(chart.Targets, -1); i > -1; i = FindNextSelectedSyncPairStartIndex(chart.Targets, i))
+			syncSelectionCount += chart.Targets[i].Flags.SyncPairCount;
 
 		if (syncSelectionCount < 1)
 			return;
@@ -342,29 +329,23 @@ namespace Comfy::Studio::Editor
 		std::vector<ApplySyncPreset::Data> targetData;
 		targetData.reserve(syncSelectionCount);
 
-		for (i32 i = 0; i < static_cast<i32>(chart.Targets.size());)
+		for (i32 i = FindNextSelectedSyncPairStartIndex(chart.Targets, -1); i > -1; i = FindNextSelectedSyncPairStartIndex(chart.Targets, i))
 		{
 			const auto& firstTargetOfPair = chart.Targets[i];
-			if (firstTargetOfPair.Flags.IsSync && IsAnyTargetWithinSyncPairSelected(&firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount))
+			const auto targetDataStartIndex = targetData.size();
+			for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
 			{
-				const auto targetDataStartIndex = targetData.size();
-				for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
-				{
-					auto& data = targetData.emplace_back();
-					data.ID = chart.Targets[i + j].ID;
-					data.NewValue = Rules::TryGetProperties(chart.Targets[i + j]);
-				}
-
-				const bool failedToApply = !ApplyDynamicSyncPresetToSyncPair(preset, settings, &firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount, &targetData[targetDataStartIndex]);
-				if (failedToApply)
-				{
-					for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
-						targetData.pop_back();
-				}
+				auto& data = targetData.emplace_back();
+				data.ID = chart.Targets[i + j].ID;
+				data.NewValue = Rules::TryGetProperties(chart.Targets[i + j]);
 			}
 
-			assert(firstTargetOfPair.Flags.SyncPairCount >= 1);
-			i += firstTargetOfPair.Flags.SyncPairCount;
+			const bool failedToApply = !ApplyDynamicSyncPresetToSyncPair(preset, settings, &firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount, &targetData[targetDataStartIndex]);
+			if (failedToApply)
+			{
+				for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
+					targetData.pop_back();
+			}
 		}
 
 		if (!targetData.empty())
@@ -377,15 +358,8 @@ namespace Comfy::Studio::Editor
 	void ApplyStaticSyncPresetToSelectedTargets(Undo::UndoManager& undoManager, Chart& chart, const StaticSyncPreset& preset)
 	{
 		size_t syncSelectionCount = 0;
-		for (i32 i = 0; i < static_cast<i32>(chart.Targets.size());)
-		{
-			const auto& firstTargetOfPair = chart.Targets[i];
-			if (firstTargetOfPair.Flags.IsSync && IsAnyTargetWithinSyncPairSelected(&firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount))
-				syncSelectionCount += firstTargetOfPair.Flags.SyncPairCount;
-
-			assert(firstTargetOfPair.Flags.SyncPairCount >= 1);
-			i += firstTargetOfPair.Flags.SyncPairCount;
-		}
+		for (i32 i = FindNextSelectedSyncPairStartIndex(chart.Targets, -1); i > -1; i = FindNextSelectedSyncPairStartIndex(chart.Targets, i))
+			syncSelectionCount += chart.Targets[i].Flags.SyncPairCount;
 
 		if (syncSelectionCount < 1)
 			return;
@@ -393,29 +367,23 @@ namespace Comfy::Studio::Editor
 		std::vector<ApplySyncPreset::Data> targetData;
 		targetData.reserve(syncSelectionCount);
 
-		for (i32 i = 0; i < static_cast<i32>(chart.Targets.size());)
+		for (i32 i = FindNextSelectedSyncPairStartIndex(chart.Targets, -1); i > -1; i = FindNextSelectedSyncPairStartIndex(chart.Targets, i))
 		{
 			const auto& firstTargetOfPair = chart.Targets[i];
-			if (firstTargetOfPair.Flags.IsSync && IsAnyTargetWithinSyncPairSelected(&firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount))
+			const auto targetDataStartIndex = targetData.size();
+			for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
 			{
-				const auto targetDataStartIndex = targetData.size();
-				for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
-				{
-					auto& data = targetData.emplace_back();
-					data.ID = chart.Targets[i + j].ID;
-					data.NewValue = Rules::TryGetProperties(chart.Targets[i + j]);
-				}
-
-				const bool failedToApply = !ApplyStaticSyncPresetToSyncPair(preset, &firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount, &targetData[targetDataStartIndex]);
-				if (failedToApply)
-				{
-					for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
-						targetData.pop_back();
-				}
+				auto& data = targetData.emplace_back();
+				data.ID = chart.Targets[i + j].ID;
+				data.NewValue = Rules::TryGetProperties(chart.Targets[i + j]);
 			}
 
-			assert(firstTargetOfPair.Flags.SyncPairCount >= 1);
-			i += firstTargetOfPair.Flags.SyncPairCount;
+			const bool failedToApply = !ApplyStaticSyncPresetToSyncPair(preset, &firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount, &targetData[targetDataStartIndex]);
+			if (failedToApply)
+			{
+				for (i32 j = 0; j < firstTargetOfPair.Flags.SyncPairCount; j++)
+					targetData.pop_back();
+			}
 		}
 
 		if (!targetData.empty())
@@ -427,35 +395,29 @@ namespace Comfy::Studio::Editor
 
 	u32 FindFirstApplicableDynamicSyncPresetDataForSelectedTargets(const Chart& chart, const DynamicSyncPreset preset, const DynamicSyncPresetSettings& settings, std::array<PresetTargetData, Rules::MaxSyncPairCount>& outPresetTargets)
 	{
-		for (i32 i = 0; i < static_cast<i32>(chart.Targets.size());)
+		for (i32 i = FindNextSelectedSyncPairStartIndex(chart.Targets, -1); i > -1; i = FindNextSelectedSyncPairStartIndex(chart.Targets, i))
 		{
 			const auto& firstTargetOfPair = chart.Targets[i];
-			if (firstTargetOfPair.Flags.IsSync && IsAnyTargetWithinSyncPairSelected(&firstTargetOfPair, firstTargetOfPair.Flags.SyncPairCount))
+			std::array<ApplySyncPreset::Data, Rules::MaxSyncPairCount> tempProperties;
+			const auto syncPairCount = Min<i32>(firstTargetOfPair.Flags.SyncPairCount, Rules::MaxSyncPairCount);
+
+			for (i32 j = 0; j < syncPairCount; j++)
 			{
-				std::array<ApplySyncPreset::Data, Rules::MaxSyncPairCount> tempProperties;
-				const auto syncPairCount = Min<i32>(firstTargetOfPair.Flags.SyncPairCount, Rules::MaxSyncPairCount);
+				auto& data = tempProperties[j];
+				data.ID = chart.Targets[i + j].ID;
+				data.NewValue = Rules::TryGetProperties(chart.Targets[i + j]);
+			}
 
+			if (ApplyDynamicSyncPresetToSyncPair(preset, settings, &firstTargetOfPair, syncPairCount, tempProperties.data()))
+			{
 				for (i32 j = 0; j < syncPairCount; j++)
 				{
-					auto& data = tempProperties[j];
-					data.ID = chart.Targets[i + j].ID;
-					data.NewValue = Rules::TryGetProperties(chart.Targets[i + j]);
+					outPresetTargets[j].Type = chart.Targets[chart.Targets.FindIndex(tempProperties[j].ID)].Type;
+					outPresetTargets[j].Properties = tempProperties[j].NewValue;
 				}
 
-				if (ApplyDynamicSyncPresetToSyncPair(preset, settings, &firstTargetOfPair, syncPairCount, tempProperties.data()))
-				{
-					for (i32 j = 0; j < syncPairCount; j++)
-					{
-						outPresetTargets[j].Type = chart.Targets[chart.Targets.FindIndex(tempProperties[j].ID)].Type;
-						outPresetTargets[j].Properties = tempProperties[j].NewValue;
-					}
-
-					return syncPairCount;
-				}
+				return syncPairCount;
 			}
-
-			assert(firstTargetOfPair.Flags.SyncPairCount >= 1);
-			i += firstTargetOfPair.Flags.SyncPairCount;
 		}
 
 		return 0;
@@ -465,7 +427,7 @@ namespace Comfy::Studio::Editor
 	{
 		// TODO: ...
 
-		const size_t selectionCount = std::count_if(chart.Targets.begin(), chart.Targets.end(), [](const auto& t) { return t.IsSelected; });
+		const size_t selectionCount = chart.Targets.GetSelectionCount();
 		if (selectionCount < 1)
 			return;
 
@@ -475,13 +437,10 @@ namespace Comfy::Studio::Editor
 		if (preset.Type == SequencePresetType::Circle)
 		{
 			const BeatTick tickOffset = ((settings.ApplyFirstTargetTickAsOffset) ?
-				std::find_if(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { return t.IsSelected; })->Tick : BeatTick::Zero()) - settings.TickOffset;
+				chart.Targets.SelectedTargets().front().Tick : BeatTick::Zero()) - settings.TickOffset;
 
-			for (const auto& target : chart.Targets)
+			for (const auto& target : chart.Targets.SelectedTargets())
 			{
-				if (!target.IsSelected)
-					continue;
-
 				auto& data = targetData.emplace_back();
 				data.ID = target.ID;
 				data.NewValue = Rules::TryGetProperties(target);
@@ -140,6 +140,17 @@ namespace Comfy::Studio::Editor
 		return clamped;
 	}
 
+	std::pair<BeatTick, BeatTick> TargetTimeline::GetVisibleTickRange() const
+	{
+		const f32 minVisiblePosition = (GetScrollX() - visibilityThreshold);
+		const f32 maxVisiblePosition = (GetScrollX() + baseWindow->Size.x + visibilityThreshold);
+
+		// NOTE: Extend by a single tick to account for the tick rounding of the time to tick conversion
+		const BeatTick startTick = GetBeatTick(minVisiblePosition) - BeatTick::FromTicks(1);
+		const BeatTick endTick = GetBeatTick(maxVisiblePosition) + BeatTick::FromTicks(1);
+		return { startTick, endTick };
+	}
+
 	f32 TargetTimeline::GetButtonEdgeFadeOpacity(f32 screenX) const
 	{
 		constexpr f32 fadeSpan = 35.0f;
@@ -252,8 +263,12 @@ namespace Comfy::Studio::Editor
 			metronome.UpdatePlaySounds(*workingChart, thisFrameButtonSoundCursorTime, lastFrameButtonSoundCursorTime, futureOffset);
 		}
 
+		// NOTE: Only targets with their button tick inside the (tick rounding extended) offset cursor range of this frame could possibly be played
+		const BeatTick soundRangeStartTick = TimeToTick(lastFrameButtonSoundCursorTime + futureOffset) - BeatTick::FromTicks(1);
+		const BeatTick soundRangeEndTick = TimeToTick(thisFrameButtonSoundCursorTime + futureOffset) + BeatTick::FromTicks(1);
+
 		// NOTE: Play back button sounds in the future with a negative offset to achieve sample perfect accuracy
-		for (const auto& target : workingChart->Targets)
+		for (const auto& target : workingChart->Targets.TargetsInTickRange(soundRangeStartTick, soundRangeEndTick))
 		{
 			// NOTE: Stacked button sounds should be handled by the button sound controller automatically 
 			//		 but doing an additional sync check here has the advantage of offloading audio engine work
@@ -1119,7 +1134,8 @@ namespace Comfy::Studio::Editor
 	{
 		auto* windowDrawList = Gui::GetWindowDrawList();
 
-		for (const auto& target : workingChart->Targets)
+		const auto[visibleStartTick, visibleEndTick] = GetVisibleTickRange();
+		for (const auto& target : workingChart->Targets.TargetsInTickRange(visibleStartTick, visibleEndTick))
 		{
 			const auto buttonTime = TickToTime(target.Tick);
 			const f32 screenX = glm::round(GetTimelinePosition(buttonTime) - GetScrollX());
@@ -1135,14 +1151,14 @@ namespace Comfy::Studio::Editor
 			const f32 scale = GetTimelineTargetScaleFactor(target, buttonTime) * iconScale;
 
 			const bool tooEarly = (target.Tick < BeatTick::FromBars(1));
-			const bool isSelected = target.IsSelected;
+			const bool isSelected = target.GetIsSelected();
 
 			constexpr f32 tooEarlyOpacity = 0.5f, selectionOpacity = 0.75f;
 			const f32 edgeFadeOpacity = GetButtonEdgeFadeOpacity(screenX);
 			const f32 finalOpacity = tooEarly ? tooEarlyOpacity : isSelected ? (edgeFadeOpacity * selectionOpacity) : edgeFadeOpacity;
 
 			renderHelper.DrawButtonIcon(windowDrawList, target, center, scale, finalOpacity);
-			if (target.IsSelected)
+			if (target.GetIsSelected())
 				tempSelectedTargetPositionBuffer.push_back(center);
 		}
 
@@ -1443,7 +1459,7 @@ namespace Comfy::Studio::Editor
 					blockingTarget = &syncPairBaseTarget[i];
 			}
 
-			if (blockingTarget == nullptr || !blockingTarget->IsSelected)
+			if (blockingTarget == nullptr || !blockingTarget->GetIsSelected())
 				return blockingTarget;
 
 			if (const auto newType = GetNextClampedButtonType(*blockingTarget, incrementDirection); newType == type)
@@ -1476,11 +1492,11 @@ namespace Comfy::Studio::Editor
 		selectionDrag.IsHovering = false;
 		if (!selectionDrag.IsDragging && Gui::IsWindowHovered())
 		{
-			// TODO: Min max visible tick range check optimization 
 			const f32 iconHitboxHalfSize = (iconHitboxSize / 2.0f);
-			for (const auto& target : chart.Targets)
+			const auto[visibleStartTick, visibleEndTick] = GetVisibleTickRange();
+			for (const auto& target : chart.Targets.TargetsInTickRange(visibleStartTick, visibleEndTick))
 			{
-				if (!target.IsSelected)
+				if (!target.GetIsSelected())
 					continue;
 
 				const vec2 center = vec2(GetTimelinePosition(target.Tick) - GetScrollX() + regions.Content.GetTL().x, targetYPositions[static_cast<size_t>(target.Type)]);
@@ -1539,11 +1555,8 @@ namespace Comfy::Studio::Editor
 					std::vector<ChangeTargetListTypes::Data> targetTypeData;
 					targetTypeData.reserve(selectedTargetCount);
 
-					for (const auto& target : chart.Targets)
+					for (const auto& target : chart.Targets.SelectedTargets())
 					{
-						if (!target.IsSelected)
-							continue;
-
 						const auto newType = GetNextClampedButtonType(target, typeIncrementDirection);
 						auto& data = targetTypeData.emplace_back();
 						data.ID = target.ID;
@@ -1567,11 +1580,8 @@ namespace Comfy::Studio::Editor
 					std::vector<IncrementTargetListTicks::Data> targetData;
 					targetData.reserve(CountSelectedTargets());
 
-					for (const auto& target : chart.Targets)
+					for (const auto& target : chart.Targets.SelectedTargets())
 					{
-						if (!target.IsSelected)
-							continue;
-
 						auto& data = targetData.emplace_back();
 						data.ID = target.ID;
 						data.NewValue = target.Tick + dragTickIncrement;
@@ -1592,14 +1602,14 @@ namespace Comfy::Studio::Editor
 		return false;
 #endif
 
-		for (size_t i = 0; i < workingChart->Targets.size(); i++)
+		for (const i32 i : workingChart->Targets.GetSelectedIndices())
 		{
 			const auto& target = workingChart->Targets[i];
-			if (target.IsSelected && target.Flags.IsSync)
+			if (target.Flags.IsSync)
 			{
 				bool entireSyncPairSelected = true;
-				for (size_t s = 0; s < target.Flags.SyncPairCount; s++)
-					entireSyncPairSelected &= workingChart->Targets[i - target.Flags.IndexWithinSyncPair + s].IsSelected;
+				for (i32 s = 0; s < target.Flags.SyncPairCount; s++)
+					entireSyncPairSelected &= workingChart->Targets[i - target.Flags.IndexWithinSyncPair + s].GetIsSelected();
 
 				if (!entireSyncPairSelected)
 					return true;
@@ -1617,12 +1627,12 @@ namespace Comfy::Studio::Editor
 
 		if (increment > BeatTick::Zero())
 		{
-			for (i32 i = 0; i < static_cast<i32>(workingChart->Targets.size()); i++)
+			for (const i32 i : workingChart->Targets.GetSelectedIndices())
 			{
 				auto& target = workingChart->Targets[i];
 				auto* nextTarget = IndexOrNull(i + 1, workingChart->Targets);
 
-				if (target.IsSelected && nextTarget != nullptr && !nextTarget->IsSelected)
+				if (nextTarget != nullptr && !nextTarget->GetIsSelected())
 				{
 					if (target.Tick + increment >= nextTarget->Tick)
 						return false;
@@ -1631,21 +1641,18 @@ namespace Comfy::Studio::Editor
 		}
 		else
 		{
-			for (i32 i = static_cast<i32>(workingChart->Targets.size()) - 1; i >= 0; i--)
+			for (const i32 i : workingChart->Targets.GetSelectedIndices())
 			{
 				auto& target = workingChart->Targets[i];
 				auto* prevTarget = IndexOrNull(i - 1, workingChart->Targets);
 
-				if (target.IsSelected)
+				if (target.Tick + increment < BeatTick::Zero())
+					return false;
+
+				if (prevTarget != nullptr && !prevTarget->GetIsSelected())
 				{
-					if (target.Tick + increment < BeatTick::Zero())
+					if (target.Tick + increment <= prevTarget->Tick)
 						return false;
-
-					if (prevTarget != nullptr && !prevTarget->IsSelected)
-					{
-						if (target.Tick + increment <= prevTarget->Tick)
-							return false;
-					}
 				}
 			}
 		}
@@ -1838,8 +1845,8 @@ namespace Comfy::Studio::Editor
 
 			Gui::Separator();
 
-			auto isTargetSelectedAndHoldToggable = [](const TimelineTarget& t) -> bool { return t.IsSelected && !IsSlideButtonType(t.Type); };
-			const bool anyHoldToggableTargetSelected = (selectionCount > 0) && std::any_of(workingChart->Targets.begin(), workingChart->Targets.end(), isTargetSelectedAndHoldToggable);
+			const auto selectedTargets = workingChart->Targets.SelectedTargets();
+			const bool anyHoldToggableTargetSelected = std::any_of(selectedTargets.begin(), selectedTargets.end(), [](const TimelineTarget& t) { return !IsSlideButtonType(t.Type); });
 
 			if (Gui::MenuItem("Toggle Target Holds", Input::ToString(GlobalUserData.Input.TargetTimeline_ToggleTargetHolds).data(), nullptr, anyHoldToggableTargetSelected))
 				ToggleSelectedTargetsHolds(undoManager, *workingChart);
@@ -1969,27 +1976,20 @@ namespace Comfy::Studio::Editor
 					return (y >= minY && y <= maxY) && (target.Tick >= minTick && target.Tick <= maxTick);
 				};
 
+				auto& targets = workingChart->Targets;
 				switch (boxSelection.Action)
 				{
 				case BoxSelectionData::ActionType::Clean:
-					for (auto& target : workingChart->Targets)
-						target.IsSelected = isTargetInSelectionRange(target);
+					targets.DeselectAll();
+					targets.SelectInTickRangeIf(minTick, maxTick, isTargetInSelectionRange);
 					break;
 
 				case BoxSelectionData::ActionType::Add:
-					for (auto& target : workingChart->Targets)
-					{
-						if (isTargetInSelectionRange(target))
-							target.IsSelected = true;
-					}
+					targets.SelectInTickRangeIf(minTick, maxTick, isTargetInSelectionRange);
 					break;
 
 				case BoxSelectionData::ActionType::Remove:
-					for (auto& target : workingChart->Targets)
-					{
-						if (isTargetInSelectionRange(target))
-							target.IsSelected = false;
-					}
+					targets.DeselectIf(isTargetInSelectionRange);
 					break;
 
 				default:
@@ -2004,10 +2004,7 @@ namespace Comfy::Studio::Editor
 
 	size_t TargetTimeline::CountSelectedTargets() const
 	{
-		return std::count_if(
-			workingChart->Targets.begin(),
-			workingChart->Targets.end(),
-			[](const auto& t) { return t.IsSelected; });
+		return workingChart->Targets.GetSelectionCount();
 	}
 
 	void TargetTimeline::ToggleSelectedTargetsHolds(Undo::UndoManager& undoManager, Chart& chart)
@@ -2022,9 +2019,9 @@ namespace Comfy::Studio::Editor
 		std::vector<ToggleTargetListIsHold::Data> commandData;
 		commandData.reserve(selectedTargetCount);
 
-		for (const auto& target : workingChart->Targets)
+		for (const auto& target : workingChart->Targets.SelectedTargets())
 		{
-			if (!target.IsSelected || IsSlideButtonType(target.Type))
+			if (IsSlideButtonType(target.Type))
 				continue;
 
 			auto& data = commandData.emplace_back();
@@ -2059,95 +2056,69 @@ namespace Comfy::Studio::Editor
 
 	void TargetTimeline::SelectAllTargets(Chart& chart)
 	{
-		std::for_each(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { t.IsSelected = true; });
+		chart.Targets.SelectAll();
 	}
 
 	void TargetTimeline::DeselectAllTargets(Chart& chart)
 	{
-		std::for_each(chart.Targets.begin(), chart.Targets.end(), [](auto& t) { t.IsSelected = false; });
+		chart.Targets.DeselectAll();
 	}
 
 	void TargetTimeline::SelectEveryNthTarget(Chart& chart, size_t n)
 	{
-		for (size_t i = 0, selectionIndex = 0; i < chart.Targets.size(); i++)
-		{
-			if (auto& target = chart.Targets[i]; target.IsSelected)
-			{
-				if (++selectionIndex % n != 0)
-					target.IsSelected = false;
-			}
-		}
+		size_t selectionIndex = 0;
+		chart.Targets.DeselectIf([&](const TimelineTarget& target) { return (++selectionIndex % n != 0); });
 	}
 
 	void TargetTimeline::ShiftTargetSelection(Chart& chart, i32 direction)
 	{
-		if (direction > 0)
-		{
-			for (i32 i = static_cast<i32>(chart.Targets.size()) - 1; i >= 0; i--)
-			{
-				auto& target = chart.Targets[i];
-				auto* nextTarget = IndexOrNull(i + 1, chart.Targets);
+		const i32 indexIncrement = (direction > 0) ? +1 : -1;
 
-				if (nextTarget != nullptr && target.IsSelected)
-					nextTarget->IsSelected = true;
-				target.IsSelected = false;
-			}
-		}
-		else
-		{
-			for (i32 i = 0; i < static_cast<i32>(chart.Targets.size()); i++)
-			{
-				auto& target = chart.Targets[i];
-				auto* prevTarget = IndexOrNull(i - 1, chart.Targets);
+		std::vector<i32> shiftedIndices;
+		shiftedIndices.reserve(chart.Targets.GetSelectionCount());
 
-				if (prevTarget != nullptr && target.IsSelected)
-					prevTarget->IsSelected = true;
-				target.IsSelected = false;
-			}
+		for (const i32 i : chart.Targets.GetSelectedIndices())
+		{
+			if (InBounds(i + indexIncrement, chart.Targets))
+				shiftedIndices.push_back(i + indexIncrement);
 		}
+
+		// NOTE: Still in ascending order so each insertion simply appends to the selection index
+		chart.Targets.DeselectAll();
+		for (const i32 i : shiftedIndices)
+			chart.Targets.SetIsSelected(i, true);
 	}
 
 	void TargetTimeline::RefineTargetSelectionBySingleTargetsOnly(Chart& chart)
 	{
-		for (auto& target : chart.Targets)
-		{
-			if (target.IsSelected && target.Flags.IsSync)
-				target.IsSelected = false;
-		}
+		chart.Targets.DeselectIf([](const TimelineTarget& target) { return target.Flags.IsSync; });
 	}
 
 	void TargetTimeline::RefineTargetSelectionBySyncPairsOnly(Chart& chart)
 	{
-		for (auto& target : chart.Targets)
-		{
-			if (target.IsSelected && !target.Flags.IsSync)
-				target.IsSelected = false;
-		}
+		chart.Targets.DeselectIf([](const TimelineTarget& target) { return !target.Flags.IsSync; });
 	}
 
 	void TargetTimeline::SelectAllParticallySelectedSyncPairs(Chart& chart)
 	{
-		for (i32 i = 0; i < static_cast<i32>(chart.Targets.size());)
-		{
-			const auto& target = chart.Targets[i];
+		auto& targets = chart.Targets;
+		if (targets.GetSelectionCount() < 1)
+			return;
 
-			const bool anyWithinPairSelected = [&]()
-			{
-				for (i32 j = i; j < (i + target.Flags.SyncPairCount); j++)
-					if (chart.Targets[j].IsSelected)
-						return true;
-				return false;
-			}();
+		const i32 firstSelectedIndex = targets.GetSelectedIndices().front();
+		const i32 lastSelectedIndex = targets.GetSelectedIndices().back();
 
-			if (anyWithinPairSelected)
-			{
-				for (i32 j = i; j < (i + target.Flags.SyncPairCount); j++)
-					chart.Targets[j].IsSelected = true;
-			}
+		const auto& firstSelectedTarget = targets[firstSelectedIndex];
+		const auto& lastSelectedTarget = targets[lastSelectedIndex];
+		const i32 rangeStartIndex = (firstSelectedIndex - firstSelectedTarget.Flags.IndexWithinSyncPair);
+		const i32 rangeEndIndex = (lastSelectedIndex - lastSelectedTarget.Flags.IndexWithinSyncPair + lastSelectedTarget.Flags.SyncPairCount);
 
-			assert(target.Flags.SyncPairCount > 0);
-			i += target.Flags.SyncPairCount;
-		}
+		// NOTE: Sync pairs are always stored contiguously so the pair of each target can be found relative to its own address
+		targets.SelectInIndexRangeIf(rangeStartIndex, rangeEndIndex, [](const TimelineTarget& target)
+		{
+			const TimelineTarget* syncPairBegin = (&target - target.Flags.IndexWithinSyncPair);
+			return std::any_of(syncPairBegin, syncPairBegin + target.Flags.SyncPairCount, [](const TimelineTarget& pairTarget) { return pairTarget.GetIsSelected(); });
+		});
 	}
 
 	void TargetTimeline::ClipboardCutSelection(Undo::UndoManager& undoManager, Chart& chart)
@@ -2156,9 +2127,8 @@ namespace Comfy::Studio::Editor
 		if (selectionCount < 1)
 			return;
 
-		std::vector<TimelineTarget> selectedTargets;
-		selectedTargets.reserve(selectionCount);
-		std::copy_if(chart.Targets.begin(), chart.Targets.end(), std::back_inserter(selectedTargets), [&](auto& t) { return t.IsSelected; });
+		const auto selectedTargetsView = chart.Targets.SelectedTargets();
+		std::vector<TimelineTarget> selectedTargets(selectedTargetsView.begin(), selectedTargetsView.end());
 
 		clipboardHelper.TimelineCopySelectedTargets(selectedTargets);
 		undoManager.Execute<CutTargetList>(chart, std::move(selectedTargets));
@@ -2170,9 +2140,8 @@ namespace Comfy::Studio::Editor
 		if (selectionCount < 1)
 			return;
 
-		std::vector<TimelineTarget> selectedTargets;
-		selectedTargets.reserve(selectionCount);
-		std::copy_if(chart.Targets.begin(), chart.Targets.end(), std::back_inserter(selectedTargets), [&](auto& t) { return t.IsSelected; });
+		const auto selectedTargetsView = chart.Targets.SelectedTargets();
+		std::vector<TimelineTarget> selectedTargets(selectedTargetsView.begin(), selectedTargetsView.end());
 
 		clipboardHelper.TimelineCopySelectedTargets(selectedTargets);
 	}
@@ -2311,14 +2280,8 @@ namespace Comfy::Studio::Editor
 		if (selectionCount < 1)
 			return;
 
-		std::vector<TimelineTarget> targetsToRemove;
-		targetsToRemove.reserve(selectionCount);
-
-		std::copy_if(
-			chart.Targets.begin(),
-			chart.Targets.end(),
-			std::back_inserter(targetsToRemove),
-			[](const auto& t) { return t.IsSelected; });
+		const auto selectedTargets = chart.Targets.SelectedTargets();
+		std::vector<TimelineTarget> targetsToRemove(selectedTargets.begin(), selectedTargets.end());
 
 		assert(targetsToRemove.size() == selectionCount);
 		undoManager.Execute<RemoveTargetList>(chart, std::move(targetsToRemove));
@@ -2333,15 +2296,12 @@ namespace Comfy::Studio::Editor
 		std::vector<MirrorTargetListTypes::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			const auto mirroredType = MirrorButtonType(target.Type);
 
 			const auto* existingTarget = IndexOrNull(chart.Targets.FindIndex(target.Tick, mirroredType), chart.Targets);
-			if (existingTarget != nullptr && !existingTarget->IsSelected)
+			if (existingTarget != nullptr && !existingTarget->GetIsSelected())
 				continue;
 
 			auto& data = targetData.emplace_back();
@@ -2369,11 +2329,8 @@ namespace Comfy::Studio::Editor
 		std::vector<ChangeTargetListTicks::Data> targetData;
 		targetData.reserve(selectionCount);
 
-		for (const auto& target : chart.Targets)
+		for (const auto& target : chart.Targets.SelectedTargets())
 		{
-			if (!target.IsSelected)
-				continue;
-
 			if (!firstTick.has_value())
 				firstTick = target.Tick;
 
@@ -2408,11 +2365,8 @@ namespace Comfy::Studio::Editor
 
 	void TargetTimeline::PlayCursorButtonSoundsAndAnimation(BeatTick cursorTick)
 	{
-		for (const auto& target : workingChart->Targets)
-		{
-			if (target.Tick == cursorTick)
-				PlaySingleTargetButtonSoundAndAnimation(target);
-		}
+		for (const auto& target : workingChart->Targets.TargetsInTickRange(cursorTick, cursorTick))
+			PlaySingleTargetButtonSoundAndAnimation(target);
 	}
 
 	void TargetTimeline::PlaySingleTargetButtonSoundAndAnimation(const TimelineTarget& target)
@@ -105,6 +105,9 @@ namespace Comfy::Studio::Editor
 
 		BeatTick GetCursorMouseXTick(bool floorToGrid = true) const;
 
+		// NOTE: Inclusive tick range covering the visible timeline area plus the visibility threshold on either side
+		std::pair<BeatTick, BeatTick> GetVisibleTickRange() const;
+
 	public:
 		TimeSpan GetCursorTime() const override;
 		void SetCursorTime(const TimeSpan newTime);
@@ -27,6 +27,9 @@ namespace Comfy::Studio::Editor
 			Gui::Columns(1);
 		}
 
+		if (memoryStatisticsHeader)
+			MemoryStatisticsGui();
+
 		if (Gui::BeginListBox("##HistoryWindow::UndoRedoListBox", Gui::GetContentRegionAvail()))
 		{
 			SingleColumnListBoxGui();
@@ -36,12 +39,43 @@ namespace Comfy::Studio::Editor
 		return false;
 	}
 
+	void UndoHistoryWindow::MemoryStatisticsGui()
+	{
+		constexpr f64 bytesPerMB = (1024.0 * 1024.0);
+		const auto& statistics = undoManager.GetMemoryStatistics();
+		const f64 totalUsageMB = static_cast<f64>(statistics.UndoStackMemoryUsage + statistics.RedoStackMemoryUsage) / bytesPerMB;
+
+		if (statistics.MemoryBudget > 0)
+			Gui::Text("Memory: %.2f / %.0f MB", totalUsageMB, static_cast<f64>(statistics.MemoryBudget) / bytesPerMB);
+		else
+			Gui::Text("Memory: %.2f MB (Unlimited)", totalUsageMB);
+
+		if (Gui::IsItemHovered())
+		{
+			Gui::BeginTooltip();
+			Gui::Text("Undo Stack: %.2f MB", static_cast<f64>(statistics.UndoStackMemoryUsage) / bytesPerMB);
+			Gui::Text("Redo Stack: %.2f MB", static_cast<f64>(statistics.RedoStackMemoryUsage) / bytesPerMB);
+			Gui::Separator();
+			Gui::Text("Compacted: %zu commands (%.2f MB saved)", statistics.CompactedCommandCount, static_cast<f64>(statistics.CompactedBytesSaved) / bytesPerMB);
+			Gui::Text("Evicted: %zu commands (%.2f MB freed)", statistics.EvictedCommandCount, static_cast<f64>(statistics.EvictedBytes) / bytesPerMB);
+			Gui::EndTooltip();
+		}
+
+		if (statistics.EvictedCommandCount > 0)
+		{
+			Gui::SameLine();
+			Gui::TextDisabled("(%zu evicted)", statistics.EvictedCommandCount);
+		}
+	}
+
 	void UndoHistoryWindow::SingleColumnListBoxGui()
 	{
 		const auto& undoStack = undoManager.GetUndoStackView();
 		const auto& redoStack = undoManager.GetRedoStackView();
 
-		if (CommandSelectableGui("Initial State", undoStack.empty()))
+		// NOTE: Once the oldest commands have been evicted the true initial state can no longer be reached
+		const bool anyCommandsEvicted = (undoManager.GetMemoryStatistics().EvictedCommandCount > 0);
+		if (CommandSelectableGui(anyCommandsEvicted ? "Oldest Retained State" : "Initial State", undoStack.empty()))
 			undoManager.Undo(undoStack.size());
 
 		int undoClickedIndex = -1, redoClickedIndex = -1;
@@ -16,6 +16,7 @@ namespace Comfy::Studio::Editor
 
 	private:
 		bool SingleColumnGui();
+		void MemoryStatisticsGui();
 		void SingleColumnListBoxGui();
 
 	private:
@@ -28,6 +29,7 @@ namespace Comfy::Studio::Editor
 		Undo::UndoManager& undoManager;
 
 		bool undoRedoHeaderButtons = false;
+		bool memoryStatisticsHeader = true;
 		bool thisFrameIsAtBottom = false, lastFrameIsAtBottom = false;
 		size_t thisFrameUndoCount = 0, lastFrameUndoCount = 0;
 	};
@@ -3,6 +3,7 @@
 #include "Graphics/Auth3D/A3D/A3D.h"
 #include "Graphics/Auth3D/A3D/A3DMgr.h"
 #include "Graphics/Auth3D/Misc/DebugObj.h"
+#include "Graphics/Auth3D/Misc/MeshOptimization.h"
 #include "IO/Archive/FArc.h"
 #include "IO/Shell.h"
 #include "ImGui/Extensions/TexExtensions.h"
@@ -30,7 +31,12 @@ namespace Comfy::Studio::Editor
 
 	SceneEditor::SceneEditor(ComfyStudioApplication& parent, EditorManager& editor) : IEditorComponent(parent, editor)
 	{
-		auto texGetter = [&](const Cached_TexID* texID) { return sceneGraph.TexIDMap.Find(texID); };
+		auto texGetter = [&](const Cached_TexID* texID) -> Tex*
+		{
+			if (auto tex = sceneGraph.TexIDMap.Find(texID); tex != nullptr)
+				return tex;
+			return resourceStreamer.GetPlaceholderTex(texID);
+		};
 		renderer3D = std::make_unique<Render::Renderer3D>(texGetter);
 
 		mainViewport.RenderWindow = std::make_unique<SceneRenderWindow>(sceneGraph, mainViewport.Camera, *renderer3D, scene, mainViewport.CameraController);
@@ -47,7 +53,6 @@ namespace Comfy::Studio::Editor
 			LoadStageObjects(StageType::STGTST, 6, 0);
 			// LoadStageObjects(StageType::STGTST, 7, 0);
 			// LoadStageObjects(StageType::STGNS, 8, 0);
-			SetStageVisibility(StageVisibilityType::GroundSky);
 		}
 	}
 
@@ -65,6 +70,8 @@ namespace Comfy::Studio::Editor
 	{
 		Gui::GetCurrentWindow()->Hidden = true;
 
+		resourceStreamer.Update(mainViewport.Camera);
+
 		auto viewportGui = [&](ViewportContext& viewport, const char* name)
 		{
 			viewport.RenderWindow->BeginEndGui(name, &viewport.IsOpen);
@@ -148,7 +155,7 @@ namespace Comfy::Studio::Editor
 		Gui::End();
 	}
 
-	bool SceneEditor::LoadRegisterObjSet(std::string_view objSetPath, std::string_view texSetPath, EntityTag tag)
+	bool SceneEditor::LoadRegisterObjSet(std::string_view objSetPath, std::string_view texSetPath, EntityTag tag, ResourceStreamPriority priority, SceneResourceStreamer::OnLoadedFunc onLoaded)
 	{
 		if (!IO::File::Exists(objSetPath) || !IO::File::Exists(texSetPath))
 			return false;
@@ -156,31 +163,7 @@ namespace Comfy::Studio::Editor
 		if (objSetPath == texSetPath)
 			return false;
 
-		std::shared_ptr<ObjSet> objSet = IO::File::Load<ObjSet>(objSetPath);
-		if (objSet == nullptr)
-			return false;
-
-		objSet->Name = IO::Path::GetFileName(objSetPath, false);
-		objSet->TexSet = TexSet::LoadSetTextureIDs(texSetPath, objSet.get());
-		sceneGraph.LoadObjSet(objSet, tag);
-		sceneGraph.RegisterTextures(objSet->TexSet.get());
-
-		if (sceneGraph.TexDB == nullptr)
-		{
-			constexpr std::string_view texDBPath = "dev_rom/db/tex_db.bin";
-			sceneGraph.TexDB = IO::File::Load<Database::TexDB>(texDBPath);
-		}
-
-		if (sceneGraph.TexDB != nullptr && objSet->TexSet != nullptr)
-		{
-			for (auto& tex : objSet->TexSet->Textures)
-			{
-				// TODO: Linear search yikesydoodles
-				if (const auto matchingEntry = FindIfOrNull(sceneGraph.TexDB->Entries, [&](const auto& e) { return e.ID == tex->ID; }); matchingEntry != nullptr)
-					tex->Name.emplace(matchingEntry->Name);
-			}
-		}
-
+		resourceStreamer.RequestObjSet(objSetPath, texSetPath, tag, priority, std::move(onLoaded));
 		return true;
 	}
 
@@ -206,29 +189,32 @@ namespace Comfy::Studio::Editor
 		return true;
 	}
 
-	bool SceneEditor::LoadStageObjects(StageType type, int id, int subID, bool loadLightParam)
+	bool SceneEditor::LoadStageObjects(StageType type, int id, int subID, bool loadLightParam, StageVisibilityType visibility)
 	{
 		if (loadLightParam)
 			Debug::LoadStageLightParamFiles(scene, type, id, subID);
 
 		auto objPath = Debug::GetDebugFilePath(Debug::PathType::StageObj, type, id, subID);
 		auto texPath = Debug::GetDebugFilePath(Debug::PathType::StageTex, type, id, subID);
-		if (!LoadRegisterObjSet(objPath.data(), texPath.data(), StageTag))
-			return false;
-
-		auto& newlyAddedStageObjSet = sceneGraph.LoadedObjSets.back();
-		for (auto& obj : newlyAddedStageObjSet.ObjSet->Objects)
+		const bool requested = LoadRegisterObjSet(objPath.data(), texPath.data(), StageTag, ResourceStreamPriority::Default, [this, visibility](ObjSetResource& loadedResource)
 		{
-			auto& entity = sceneGraph.AddEntityFromObj(obj, StageTag);
-			entity.IsReflection = Debug::IsReflectionObj(obj);
-		}
+			for (auto& obj : loadedResource.ObjSet->Objects)
+			{
+				auto& entity = sceneGraph.AddEntityFromObj(obj, StageTag);
+				entity.IsReflection = Debug::IsReflectionObj(obj);
+				ApplyStageVisibility(entity, visibility);
+			}
+		});
+
+		if (!requested)
+			return false;
 
 		if (type == StageType::STGPV && subID != 0)
 		{
 			objPath = Debug::GetDebugFilePath(Debug::PathType::StageObj, type, id, 0);
 			texPath = Debug::GetDebugFilePath(Debug::PathType::StageTex, type, id, 0);
 
-			LoadRegisterObjSet(objPath.data(), texPath.data(), StageTag);
+			LoadRegisterObjSet(objPath.data(), texPath.data(), StageTag, ResourceStreamPriority::Background);
 		}
 
 		return true;
@@ -244,32 +230,34 @@ namespace Comfy::Studio::Editor
 	{
 		std::for_each(sceneGraph.Entities.begin(), sceneGraph.Entities.end(), [visibility](auto& e)
 		{
-			if (e->Tag != StageTag)
-				return;
-
-			if (visibility == StageVisibilityType::None)
-				e->IsVisible = false;
-			else if (visibility == StageVisibilityType::All)
-				e->IsVisible = true;
-			else if (visibility == StageVisibilityType::GroundSky)
-				e->IsVisible = (e->Obj != nullptr) && (Debug::IsGroundOrSkyObj(*e->Obj) || Debug::IsReflectionObj(*e->Obj));
+			if (e->Tag == StageTag)
+				ApplyStageVisibility(*e, visibility);
 		});
 	}
 
+	void SceneEditor::ApplyStageVisibility(ObjectEntity& entity, StageVisibilityType visibility)
+	{
+		if (visibility == StageVisibilityType::None)
+			entity.IsVisible = false;
+		else if (visibility == StageVisibilityType::All)
+			entity.IsVisible = true;
+		else if (visibility == StageVisibilityType::GroundSky)
+			entity.IsVisible = (entity.Obj != nullptr) && (Debug::IsGroundOrSkyObj(*entity.Obj) || Debug::IsReflectionObj(*entity.Obj));
+	}
+
 	void SceneEditor::EraseByTag(EntityTag tag, EraseFlags flags)
 	{
 		if (flags & EraseFlags_Entities)
 		{
 			auto checkTag = [tag](auto& entity) { return entity->Tag == tag; };
 
-			sceneGraph.Entities.erase(
-				std::remove_if(sceneGraph.Entities.begin(), sceneGraph.Entities.end(),
-					checkTag),
-				sceneGraph.Entities.end());
+			sceneGraph.EraseEntitiesIf(checkTag);
 		}
 
 		if (flags & EraseFlags_ObjSets)
 		{
+			resourceStreamer.CancelByTag(tag);
+
 			auto checkTagUnregisterTex = [&](ObjSetResource& objSetResource)
 			{
 				if (objSetResource.Tag == tag)
@@ -436,15 +424,14 @@ namespace Comfy::Studio::Editor
 		{
 			EraseByTag(ObjectTag, static_cast<EraseFlags>(EraseFlags_Entities | EraseFlags_ObjSets));
 
-			if (LoadRegisterObjSet(objSetFileViewer.GetFileToOpen(), Debug::GetTexSetPathForObjSet(objSetFileViewer.GetFileToOpen()), ObjectTag))
+			LoadRegisterObjSet(objSetFileViewer.GetFileToOpen(), Debug::GetTexSetPathForObjSet(objSetFileViewer.GetFileToOpen()), ObjectTag, ResourceStreamPriority::UserRequest, [this](ObjSetResource& loadedResource)
 			{
-				auto& newlyAddedStageObjSet = sceneGraph.LoadedObjSets.back();
-				for (auto& obj : newlyAddedStageObjSet.ObjSet->Objects)
+				for (auto& obj : loadedResource.ObjSet->Objects)
 				{
 					auto& entity = sceneGraph.AddEntityFromObj(obj, ObjectTag);
 					entity.CastsShadow = true;
 				}
-			}
+			});
 		}
 		Gui::EndChild();
 	}
@@ -878,6 +865,8 @@ namespace Comfy::Studio::Editor
 				return;
 
 			ObjSet& objSet = *sceneGraph.LoadedObjSets[objTestData.ObjSetIndex].ObjSet;
+			DrawMeshOptimizationGui(objSet);
+
 			if (!collectionComboDebugMaterialHover("Obj", objSet.Objects, objTestData.ObjIndex))
 				return;
 
@@ -932,6 +921,43 @@ namespace Comfy::Studio::Editor
 		});
 	}
 
+	void SceneEditor::DrawMeshOptimizationGui(ObjSet& objSet)
+	{
+		GuiProperty::PropertyLabelValueFunc("Mesh Optimization", [&]
+		{
+			if (Gui::Button("Optimize Meshes", vec2(Gui::GetContentRegionAvail().x, 0.0f)))
+			{
+				objTestData.MeshOptimization.ObjSetName = objSet.Name;
+				objTestData.MeshOptimization.Report = OptimizeObjSet(objSet);
+			}
+			return false;
+		});
+
+		if (!objTestData.MeshOptimization.Report.has_value())
+			return;
+
+		const auto& report = objTestData.MeshOptimization.Report.value();
+		GuiProperty::TreeNode("Mesh Optimization Report", objTestData.MeshOptimization.ObjSetName.c_str(), ImGuiTreeNodeFlags_None, [&]
+		{
+			auto reportText = [](const char* label, auto&& textFunc)
+			{
+				GuiProperty::PropertyLabelValueFunc(label, [&] { textFunc(); return false; });
+			};
+
+			reportText("Meshes", [&] { Gui::Text("%u (%u sub meshes, %u triangles)", report.MeshCount, report.SubMeshCount, report.TriangleCount); });
+			reportText("Vertices", [&] { Gui::Text("%u -> %u", report.VertexCountBefore, report.VertexCountAfter); });
+			reportText("Indices", [&] { Gui::Text("%u -> %u", report.IndexCountBefore, report.IndexCountAfter); });
+			reportText("Vertex Data", [&] { Gui::Text("%.2f KB -> %.2f KB", report.VertexBytesBefore / 1024.0, report.VertexBytesAfter / 1024.0); });
+			reportText("Index Data", [&] { Gui::Text("%.2f KB -> %.2f KB", report.IndexBytesBefore / 1024.0, report.IndexBytesAfter / 1024.0); });
+			reportText("Quantized Vertex Data", [&] { Gui::Text("%.2f KB", report.QuantizedVertexBytes / 1024.0); });
+			reportText("ACMR", [&] { Gui::Text("%.3f -> %.3f", report.GetACMRBefore(), report.GetACMRAfter()); });
+			reportText("ATVR", [&] { Gui::Text("%.3f -> %.3f", report.GetATVRBefore(), report.GetATVRAfter()); });
+			reportText("Max Normal Error", [&] { Gui::Text("%.6f", report.MaxNormalQuantizationError); });
+			reportText("Max UV Error", [&] { Gui::Text("%.6f", report.MaxTextureCoordinateQuantizationError); });
+			reportText("Max Color Error", [&] { Gui::Text("%.6f", report.MaxColorQuantizationError); });
+		});
+	}
+
 	void SceneEditor::DrawStageTestGui()
 	{
 		GuiPropertyRAII::PropertyValueColumns columns;
@@ -946,8 +972,7 @@ namespace Comfy::Studio::Editor
 				if (stageTestData.Settings.LoadObj)
 				{
 					UnLoadStageObjects();
-					LoadStageObjects(stageTypeData.Type, stageTypeData.ID, stageTypeData.SubID, stageTestData.Settings.LoadLightParam);
-					SetStageVisibility(StageVisibilityType::GroundSky);
+					LoadStageObjects(stageTypeData.Type, stageTypeData.ID, stageTypeData.SubID, stageTestData.Settings.LoadLightParam, StageVisibilityType::GroundSky);
 				}
 				else if (stageTestData.Settings.LoadLightParam)
 				{
@@ -1004,6 +1029,39 @@ namespace Comfy::Studio::Editor
 			if (GuiProperty::PropertyLabelValueFunc("Set Visibility", [&] { return Gui::Button(button.first, vec2(Gui::GetContentRegionAvail().x * 0.8f, 0.0f)); }))
 				SetStageVisibility(button.second);
 		}
+
+		DrawResourceStreamingGui();
+	}
+
+	void SceneEditor::DrawResourceStreamingGui()
+	{
+		GuiProperty::TreeNode("Resource Streaming", [&]
+		{
+			i32 uploadBudgetKB = static_cast<i32>(resourceStreamer.GetUploadBudgetBytesPerFrame() / 1024);
+			if (GuiProperty::Input("Upload Budget (KB / Frame)", uploadBudgetKB, 256.0f, ivec2(64, 512 * 1024)))
+				resourceStreamer.SetUploadBudgetBytesPerFrame(static_cast<size_t>(uploadBudgetKB) * 1024);
+
+			const auto statistics = resourceStreamer.GetStatistics();
+			auto statisticText = [](const char* label, auto&& textFunc)
+			{
+				GuiProperty::PropertyLabelValueFunc(label, [&] { textFunc(); return false; });
+			};
+
+			auto latencyText = [&](const char* label, const ResourceStreamLatency& latency)
+			{
+				statisticText(label, [&] { Gui::Text("avg %.2f ms, max %.2f ms", latency.GetAverage().TotalMilliseconds(), latency.Max.TotalMilliseconds()); });
+			};
+
+			statisticText("Queued / Loading", [&] { Gui::Text("%u / %u", statistics.QueuedCount, statistics.LoadingCount); });
+			statisticText("Pending Upload", [&] { Gui::Text("%u", statistics.PendingUploadCount); });
+			statisticText("Completed / Failed", [&] { Gui::Text("%u / %u", statistics.CompletedCount, statistics.FailedCount); });
+			statisticText("Cancelled", [&] { Gui::Text("%u", statistics.CancelledCount); });
+			statisticText("Uploaded", [&] { Gui::Text("%.2f MB (last frame %.2f KB)", statistics.UploadedBytes / (1024.0 * 1024.0), statistics.LastFrameUploadedBytes / 1024.0); });
+			latencyText("Queue Wait", statistics.QueueWait);
+			latencyText("Parse", statistics.Parse);
+			latencyText("Upload Wait", statistics.UploadWait);
+			latencyText("Request To Ready", statistics.RequestToReady);
+		});
 	}
 
 	void SceneEditor::DrawCharaTestGui()
@@ -1021,10 +1079,8 @@ namespace Comfy::Studio::Editor
 				auto objSetPath = Debug::GetDebugFilePath(objPathType, StageType::STGTST, id, 0, charaTestData.IDs.Character.data());
 				auto texSetPath = Debug::GetDebugFilePath(texPathType, StageType::STGTST, id, 0, charaTestData.IDs.Character.data());
 
-				if (LoadRegisterObjSet(objSetPath.data(), texSetPath.data(), CharacterTag))
+				LoadRegisterObjSet(objSetPath.data(), texSetPath.data(), CharacterTag, ResourceStreamPriority::UserRequest, [this, exclusiveObjIndex](ObjSetResource& loadedResource)
 				{
-					auto& loadedResource = sceneGraph.LoadedObjSets.back();
-
 					if (InBounds(exclusiveObjIndex, loadedResource.ObjSet->Objects))
 					{
 						auto& entity = sceneGraph.AddEntityFromObj(loadedResource.ObjSet->Objects[exclusiveObjIndex], CharacterTag);
@@ -1040,7 +1096,7 @@ namespace Comfy::Studio::Editor
 							entity.IgnoreShadowCastObjFlags = true;
 						}
 					}
-				}
+				});
 			};
 
 			unloadCharaItems();
@@ -1,10 +1,12 @@
 #pragma once
 #include "Types.h"
 #include "SceneGraph.h"
+#include "SceneResourceStreamer.h"
 #include "SceneRenderWindow.h"
 #include "Editor/Core/IEditorComponent.h"
 #include "Editor/Common/CameraController3D.h"
 #include "Graphics/Auth2D/SprSet.h"
+#include "Graphics/Auth3D/Misc/MeshOptimization.h"
 #include "ImGui/Widgets/FileViewer.h"
 #include "StageTest.h"
 #include "CharaTest.h"
@@ -26,14 +28,17 @@ namespace Comfy::Studio::Editor
 		void Gui() override;
 
 	private:
-		bool LoadRegisterObjSet(std::string_view objSetPath, std::string_view texSetPath, EntityTag tag);
+		// NOTE: Only queues the load, the callback is called on the main thread once the ObjSet has been added to the SceneGraph
+		bool LoadRegisterObjSet(std::string_view objSetPath, std::string_view texSetPath, EntityTag tag, ResourceStreamPriority priority, SceneResourceStreamer::OnLoadedFunc onLoaded = nullptr);
 		bool UnLoadUnRegisterObjSet(const Graphics::ObjSet* objSetToRemove);
 
-		bool LoadStageObjects(StageType type, int id, int subID, bool loadLightParam = true);
+		enum class StageVisibilityType { None, All, GroundSky };
+
+		bool LoadStageObjects(StageType type, int id, int subID, bool loadLightParam = true, StageVisibilityType visibility = StageVisibilityType::GroundSky);
 		bool UnLoadStageObjects();
 
-		enum class StageVisibilityType { None, All, GroundSky };
 		void SetStageVisibility(StageVisibilityType visibility);
+		static void ApplyStageVisibility(ObjectEntity& entity, StageVisibilityType visibility);
 
 		enum EraseFlags
 		{
@@ -67,7 +72,9 @@ namespace Comfy::Studio::Editor
 		void DrawSceneGraphGui(ViewportContext& activeViewport);
 		void DrawEntityInspectorGui();
 		void DrawObjectTestGui();
+		void DrawMeshOptimizationGui(Graphics::ObjSet& objSet);
 		void DrawStageTestGui();
+		void DrawResourceStreamingGui();
 		void DrawCharaTestGui();
 		void DrawA3DTestGui(ViewportContext& activeViewport);
 		void DrawExternalProcessTestGui(ViewportContext& activeViewport);
@@ -79,6 +86,7 @@ namespace Comfy::Studio::Editor
 
 	private:
 		SceneGraph sceneGraph;
+		SceneResourceStreamer resourceStreamer = { sceneGraph };
 
 		Render::SceneParam3D scene;
 		std::unique_ptr<Render::Renderer3D> renderer3D = nullptr;
@@ -125,6 +133,12 @@ namespace Comfy::Studio::Editor
 			int ObjIndex = 0;
 			int MaterialIndex = 0;
 			int MeshIndex = 0;
+
+			struct MeshOptimizationData
+			{
+				std::string ObjSetName;
+				std::optional<Graphics::MeshOptimizationReport> Report;
+			} MeshOptimization;
 		} objTestData;
 	};
 }
@@ -3,6 +3,7 @@
 #include "Graphics/Auth3D/Transform.h"
 #include "Graphics/Auth3D/ObjSet.h"
 #include "Render/Core/Renderer3D/Renderer3D.h"
+#include "Render/Core/BoundingVolumeHierarchy.h"
 #include "Database/TexDB.h"
 #include "Resource/ResourceIDMap.h"
 
@@ -10,6 +11,15 @@ namespace Comfy::Studio::Editor
 {
 	using EntityTag = i64;
 
+	using EntityBoundsMask = u32;
+	enum EntityBoundsMaskBits : EntityBoundsMask
+	{
+		EntityBoundsMask_None = 0,
+		EntityBoundsMask_Visible = (1 << 0),
+		EntityBoundsMask_ShadowCaster = (1 << 1),
+		EntityBoundsMask_Reflection = (1 << 2),
+	};
+
 	struct ObjectEntity
 	{
 	public:
@@ -31,6 +41,12 @@ namespace Comfy::Studio::Editor
 		bool SilhouetteOutline = false;
 
 		std::unique_ptr<Render::RenderCommand3D::DynamicData> Dynamic = nullptr;
+
+	public:
+		// NOTE: Managed by the SceneGraph, used to detect changes since the last bounding volume hierarchy update
+		Render::BoundingVolumeHierarchy::ProxyID BoundsProxy = Render::BoundingVolumeHierarchy::InvalidProxyID;
+		const Graphics::Obj* BoundsObj = nullptr;
+		Graphics::Transform BoundsTransform = Graphics::Transform(vec3(0.0f));
 	};
 
 	struct ObjSetResource
@@ -42,11 +58,15 @@ namespace Comfy::Studio::Editor
 	struct SceneGraph
 	{
 		ResourceIDMap<TexID, Graphics::Tex> TexIDMap;
-		std::unique_ptr<Database::TexDB> TexDB = nullptr;
+		// NOTE: Shared with the SceneResourceStreamer which loads it on demand
+		std::shared_ptr<Database::TexDB> TexDB = nullptr;
 
 		std::vector<ObjSetResource> LoadedObjSets;
 		std::vector<std::unique_ptr<ObjectEntity>> Entities;
 
+		// NOTE: World space bounds of all entities indexed by their position inside the Entities vector, brought up to date by UpdateEntityBounds()
+		Render::BoundingVolumeHierarchy EntityBVH;
+
 		inline ObjSetResource& LoadObjSet(const std::shared_ptr<Graphics::ObjSet>& objSet, EntityTag tag)
 		{
 			return LoadedObjSets.emplace_back(ObjSetResource { objSet, tag });
@@ -55,11 +75,7 @@ namespace Comfy::Studio::Editor
 		inline void RegisterTextures(Graphics::TexSet* texSet)
 		{
 			if (texSet != nullptr)
-			{
-				TexIDMap.ReservedAdditional(texSet->Textures.size());
-				for (auto& tex : texSet->Textures)
-					TexIDMap.Add(tex->ID, tex);
-			}
+				TexIDMap.AddRange(texSet->Textures, [](auto& tex) { return tex->ID; });
 		}
 
 		inline ObjectEntity& AddEntityFromObj(const Graphics::Obj& obj, EntityTag tag)
@@ -74,5 +90,73 @@ namespace Comfy::Studio::Editor
 
 			return *Entities.emplace_back(std::move(entity));
 		}
+
+		template <typename Predicate>
+		inline void EraseEntitiesIf(Predicate predicate)
+		{
+			for (auto& entity : Entities)
+			{
+				if (entity->BoundsProxy != Render::BoundingVolumeHierarchy::InvalidProxyID && predicate(entity))
+				{
+					EntityBVH.Remove(entity->BoundsProxy);
+					entity->BoundsProxy = Render::BoundingVolumeHierarchy::InvalidProxyID;
+				}
+			}
+
+			Entities.erase(std::remove_if(Entities.begin(), Entities.end(), predicate), Entities.end());
+		}
+
+		inline EntityBoundsMask GetEntityBoundsMask(const ObjectEntity& entity) const
+		{
+			EntityBoundsMask mask = EntityBoundsMask_None;
+			if (entity.IsVisible)
+				mask |= EntityBoundsMask_Visible;
+			if (entity.IsVisible && entity.CastsShadow)
+				mask |= EntityBoundsMask_ShadowCaster;
+			if (entity.IsReflection)
+				mask |= EntityBoundsMask_Reflection;
+			return mask;
+		}
+
+		// NOTE: Has to be called after modifying any entity and before querying the EntityBVH.
+		//		 Only entities whose obj or transform changed since the last call are refit and most small movements are absorbed by the fat bounds
+		inline void UpdateEntityBounds()
+		{
+			for (size_t i = 0; i < Entities.size(); i++)
+			{
+				auto& entity = *Entities[i];
+				const auto userIndex = static_cast<u32>(i);
+				const auto mask = GetEntityBoundsMask(entity);
+
+				if (entity.BoundsProxy == Render::BoundingVolumeHierarchy::InvalidProxyID)
+				{
+					entity.BoundsProxy = EntityBVH.Add(GetEntityWorldBounds(entity), userIndex, mask);
+					entity.BoundsObj = entity.Obj;
+					entity.BoundsTransform = entity.Transform;
+					continue;
+				}
+
+				if (entity.BoundsObj != entity.Obj || entity.BoundsTransform != entity.Transform)
+				{
+					EntityBVH.Update(entity.BoundsProxy, GetEntityWorldBounds(entity));
+					entity.BoundsObj = entity.Obj;
+					entity.BoundsTransform = entity.Transform;
+				}
+
+				// NOTE: Erasing entities shifts the indices of all following ones
+				if (EntityBVH.GetUserIndex(entity.BoundsProxy) != userIndex)
+					EntityBVH.SetUserIndex(entity.BoundsProxy, userIndex);
+
+				EntityBVH.SetMask(entity.BoundsProxy, mask);
+			}
+		}
+
+		static inline Graphics::AxisAlignedBox GetEntityWorldBounds(const ObjectEntity& entity)
+		{
+			if (entity.Obj == nullptr)
+				return Graphics::AxisAlignedBox::FromSphere(Graphics::Sphere { entity.Transform.Translation, 0.0f });
+
+			return Graphics::AxisAlignedBox::FromSphere(entity.Obj->BoundingSphere * entity.Transform);
+		}
 	};
 }
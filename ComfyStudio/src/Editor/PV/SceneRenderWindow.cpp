@@ -47,6 +47,21 @@ namespace Comfy::Studio::Editor
 			return command;
 		}
 
+		// NOTE: Matches the depth range of the orthographic shadow map projection, a shadow can't be cast any further away from its caster than this
+		constexpr float ShadowCasterExtrusionDistance = 20.0f;
+
+		// NOTE: Swept along the light direction so that casters outside the view frustum whose shadows can still fall inside of it are kept
+		AxisAlignedBox ExtrudeBoundsAlongDirection(const AxisAlignedBox& bounds, const vec3& extrusion)
+		{
+			return AxisAlignedBox::Union(bounds, AxisAlignedBox { bounds.Min + extrusion, bounds.Max + extrusion });
+		}
+
+		// NOTE: Same approximation as the debug character reflection hack which simply flips the translation around the ground plane
+		AxisAlignedBox MirrorBoundsAroundGroundPlane(const AxisAlignedBox& bounds)
+		{
+			return AxisAlignedBox { vec3(bounds.Min.x, -bounds.Max.y, bounds.Min.z), vec3(bounds.Max.x, -bounds.Min.y, bounds.Max.z) };
+		}
+
 		void RenderDebugBoundingSpheres(Renderer3D& renderer3D, const ObjectEntity& entity)
 		{
 			if (entity.Obj->Debug.RenderBoundingSphere)
@@ -79,14 +94,63 @@ namespace Comfy::Studio::Editor
 	{
 		cameraController.Update(camera);
 
-		renderer.Begin(camera, *renderTarget, sceneParam);
+		sceneGraph.UpdateEntityBounds();
+		camera.UpdateMatrices();
+
+		const bool isAnyReflection = (sceneGraph.EntityBVH.GetCombinedMask() & EntityBoundsMask_Reflection);
+		const bool cullEntities = renderTarget->Param.FrustumCulling;
+
+		const vec3 lightPosition = sceneParam.Light.Character.Position;
+		const bool cullShadowCasters = (glm::length(lightPosition) > 0.0f);
+		const vec3 shadowExtrusion = cullShadowCasters ? (-glm::normalize(lightPosition) * ShadowCasterExtrusionDistance) : vec3(0.0f);
+
+		visibleEntityIndices.clear();
+		if (cullEntities)
 		{
-			auto isAnyReflection = std::any_of(sceneGraph.Entities.begin(), sceneGraph.Entities.end(), [](auto& e) { return e->IsReflection; });
+			// NOTE: Non reflection entities are culled against the view frustum, shadow casters against their bounds extruded away from the light.
+			//		 This also means the shadow frustum the renderer fits around all submitted shadow casters only covers casters that can affect the view
+			sceneGraph.EntityBVH.Query(EntityBoundsMask_Visible, [&](const AxisAlignedBox& bounds, EntityBoundsMask mask)
+			{
+				if (camera.IntersectsViewFrustum(bounds))
+					return true;
+
+				if ((mask & EntityBoundsMask_ShadowCaster) && (!cullShadowCasters || camera.IntersectsViewFrustum(ExtrudeBoundsAlongDirection(bounds, shadowExtrusion))))
+					return true;
 
-			for (auto& entity : sceneGraph.Entities)
+				// NOTE: The debug reflection hack below mirrors characters that can themselves be outside the view frustum
+				return (isAnyReflection && camera.IntersectsViewFrustum(MirrorBoundsAroundGroundPlane(bounds)));
+			}, [&](u32 entityIndex)
 			{
-				if (!entity->IsVisible)
-					continue;
+				if (!sceneGraph.Entities[entityIndex]->IsReflection)
+					visibleEntityIndices.push_back(entityIndex);
+			});
+
+			// NOTE: The screen reflection pass renders using the same camera so reflection entities are culled against the very same view frustum
+			if (isAnyReflection)
+			{
+				sceneGraph.EntityBVH.QueryFrustum(camera, EntityBoundsMask_Reflection, [&](u32 entityIndex)
+				{
+					if (sceneGraph.Entities[entityIndex]->IsVisible)
+						visibleEntityIndices.push_back(entityIndex);
+				});
+			}
+		}
+		else
+		{
+			sceneGraph.EntityBVH.QueryMask(EntityBoundsMask_Visible, [&](u32 entityIndex)
+			{
+				visibleEntityIndices.push_back(entityIndex);
+			});
+		}
+
+		// NOTE: Keep submitting in scene graph order independent of the tree layout
+		std::sort(visibleEntityIndices.begin(), visibleEntityIndices.end());
+
+		renderer.Begin(camera, *renderTarget, sceneParam);
+		{
+			for (const auto entityIndex : visibleEntityIndices)
+			{
+				auto& entity = sceneGraph.Entities[entityIndex];
 
 				RenderCommand3D renderCommand;
 				renderCommand.SourceObj = entity->Obj;
@@ -132,22 +196,52 @@ namespace Comfy::Studio::Editor
 
 	SceneRenderWindow::RayPickResult SceneRenderWindow::RayPickSceneRay(const Ray& ray, float nearPlane) const
 	{
+		sceneGraph.UpdateEntityBounds();
+
+		struct PickCandidate
+		{
+			u32 EntityIndex;
+			float EntryDistance;
+		};
+
+		std::vector<PickCandidate> candidates;
+		sceneGraph.EntityBVH.QueryRay(ray, EntityBoundsMask_Visible, [&](u32 entityIndex, float entryDistance)
+		{
+			if (!sceneGraph.Entities[entityIndex]->IsReflection)
+				candidates.push_back({ entityIndex, entryDistance });
+		});
+
+		// NOTE: Test the closest candidates first so that the more expensive per triangle tests can stop as soon as no remaining bounds can contain a closer hit
+		std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.EntryDistance < b.EntryDistance; });
+
 		ObjectEntity* closestEntity = nullptr;
 		RayObjIntersectionResult closestIntersection = {};
+		float closestWorldDistance = std::numeric_limits<float>::max();
 
-		for (auto& entity : sceneGraph.Entities)
+		for (const auto& candidate : candidates)
 		{
-			if (!entity->IsVisible || entity->IsReflection)
-				continue;
+			if (candidate.EntryDistance > closestWorldDistance)
+				break;
+
+			auto& entity = sceneGraph.Entities[candidate.EntityIndex];
 
 			const auto intersectionResult = RayIntersectsObj(ray, nearPlane, *entity->Obj, entity->Transform);
 			if (intersectionResult.SubMesh == nullptr)
 				continue;
 
-			if (intersectionResult.Distance < closestIntersection.Distance || closestEntity == nullptr)
+			// NOTE: The intersection distance is in object space so it has to be transformed back before it can be compared across differently scaled entities
+			const mat4 transform = entity->Transform.CalculateMatrix();
+			const mat4 inverseTransform = glm::inverse(transform);
+			const vec3 objectSpaceOrigin = (inverseTransform * vec4(ray.Origin, 1.0f));
+			const vec3 objectSpaceDirection = glm::normalize(vec3(inverseTransform * vec4(ray.Direction, 0.0f)));
+			const vec3 worldSpaceHit = (transform * vec4(objectSpaceOrigin + objectSpaceDirection * intersectionResult.Distance, 1.0f));
+			const float worldDistance = glm::distance(ray.Origin, worldSpaceHit);
+
+			if (worldDistance < closestWorldDistance)
 			{
 				closestEntity = entity.get();
 				closestIntersection = intersectionResult;
+				closestWorldDistance = worldDistance;
 			}
 		}
 
@@ -56,6 +56,7 @@ namespace Comfy::Studio::Editor
 		i64 lastFocusedFrameCount = 0;
 
 		std::optional<RayPickResult> rayPickRequest = {};
+		std::vector<u32> visibleEntityIndices;
 
 		std::unique_ptr<Render::RenderTarget3D> renderTarget = nullptr;
 
@@ -0,0 +1,439 @@
+#include "SceneResourceStreamer.h"
+#include "IO/File.h"
+#include "IO/Path.h"
+
+namespace Comfy::Studio::Editor
+{
+	using namespace Graphics;
+
+	namespace
+	{
+		constexpr std::string_view TexDBPath = "dev_rom/db/tex_db.bin";
+
+		size_t GetGeometryByteSize(const ObjSet& objSet)
+		{
+			size_t byteSize = 0;
+			for (const auto& obj : objSet.Objects)
+			{
+				for (const auto& mesh : obj.Meshes)
+				{
+					const auto& vertexData = mesh.VertexData;
+					byteSize += vertexData.Positions.size() * sizeof(vec3) + vertexData.Normals.size() * sizeof(vec3) + vertexData.Tangents.size() * sizeof(vec4);
+					for (const auto& textureCoordinates : vertexData.TextureCoordinates)
+						byteSize += textureCoordinates.size() * sizeof(vec2);
+					for (const auto& colors : vertexData.Colors)
+						byteSize += colors.size() * sizeof(vec4);
+					byteSize += vertexData.BoneWeights.size() * sizeof(vec4) + vertexData.BoneIndices.size() * sizeof(vec4);
+
+					for (const auto& subMesh : mesh.SubMeshes)
+						byteSize += subMesh.GetRawIndicesByteSize();
+				}
+			}
+			return byteSize;
+		}
+
+		size_t GetTexByteSize(const Tex& tex)
+		{
+			size_t byteSize = 0;
+			for (const auto& mipMaps : tex.MipMapsArray)
+			{
+				for (const auto& mipMap : mipMaps)
+					byteSize += mipMap.DataSize;
+			}
+			return byteSize;
+		}
+
+		float GetCameraDistance(const ObjSet& objSet, const Render::Camera3D& camera)
+		{
+			if (objSet.Objects.empty())
+				return 0.0f;
+
+			float closestDistance = std::numeric_limits<float>::max();
+			for (const auto& obj : objSet.Objects)
+				closestDistance = std::min(closestDistance, glm::distance(camera.ViewPoint, obj.BoundingSphere.Center) - obj.BoundingSphere.Radius);
+
+			return std::max(closestDistance, 0.0f);
+		}
+
+		std::unique_ptr<Tex> CreatePlaceholderTex()
+		{
+			// NOTE: Neutral gray so that the material colors and lighting of not yet loaded objects are still roughly recognizable
+			constexpr std::array<u8, 4> placeholderColor = { 0x80, 0x80, 0x80, 0xFF };
+
+			auto tex = std::make_unique<Tex>();
+			tex->Name.emplace("F_COMFY_STREAMING_PLACEHOLDER");
+
+			auto& mipMap = tex->MipMapsArray.emplace_back().emplace_back();
+			mipMap.Size = ivec2(1, 1);
+			mipMap.Format = TextureFormat::RGBA8;
+			mipMap.DataSize = static_cast<u32>(placeholderColor.size());
+			mipMap.Data = std::make_unique<u8[]>(mipMap.DataSize);
+			std::memcpy(mipMap.Data.get(), placeholderColor.data(), mipMap.DataSize);
+
+			return tex;
+		}
+	}
+
+	void ResourceStreamLatency::AddSample(TimeSpan value)
+	{
+		SampleCount++;
+		Total += value;
+		Max = std::max(Max, value);
+	}
+
+	TimeSpan ResourceStreamLatency::GetAverage() const
+	{
+		return (SampleCount > 0) ? TimeSpan::FromSeconds(Total.TotalSeconds() / static_cast<f64>(SampleCount)) : TimeSpan::Zero();
+	}
+
+	SceneResourceStreamer::SceneResourceStreamer(SceneGraph& sceneGraph) : sceneGraph(sceneGraph), placeholderTex(CreatePlaceholderTex())
+	{
+		const size_t ioThreadCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MaxIOThreadCount);
+
+		ioThreads.reserve(ioThreadCount);
+		for (size_t i = 0; i < ioThreadCount; i++)
+			ioThreads.emplace_back([this] { IOThreadEntryPoint(); });
+	}
+
+	SceneResourceStreamer::~SceneResourceStreamer()
+	{
+		// NOTE: Unlike saving, dropping still queued loads on exit is fine. Requests that are already being parsed are finished first
+		std::vector<StreamRequest> droppedRequests;
+		{
+			std::scoped_lock lock(mutex);
+			droppedRequests = std::move(queuedRequests);
+			queuedRequests.clear();
+			exitRequested = true;
+		}
+		requestAvailableCondition.notify_all();
+
+		for (auto& thread : ioThreads)
+		{
+			if (thread.joinable())
+				thread.join();
+		}
+	}
+
+	SceneResourceStreamer::RequestID SceneResourceStreamer::RequestObjSet(std::string_view objSetPath, std::string_view texSetPath, EntityTag tag, ResourceStreamPriority priority, OnLoadedFunc onLoaded)
+	{
+		StreamRequest request = {};
+		request.ObjSetPath = std::string(objSetPath);
+		request.TexSetPath = std::string(texSetPath);
+		request.Tag = tag;
+		request.Priority = priority;
+		request.OnLoaded = std::move(onLoaded);
+		request.RequestTime = TimeSpan::GetTimeNow();
+
+		RequestID requestID = InvalidRequestID;
+		{
+			std::scoped_lock lock(mutex);
+			requestID = request.ID = ++lastRequestID;
+			queuedRequests.push_back(std::move(request));
+		}
+		requestAvailableCondition.notify_one();
+
+		return requestID;
+	}
+
+	void SceneResourceStreamer::SetPriority(RequestID requestID, ResourceStreamPriority priority)
+	{
+		std::scoped_lock lock(mutex);
+		if (auto request = FindIfOrNull(queuedRequests, [&](const auto& request) { return (request.ID == requestID); }); request != nullptr)
+			request->Priority = priority;
+	}
+
+	void SceneResourceStreamer::CancelByTag(EntityTag tag)
+	{
+		// NOTE: The cancelled ObjSets are destroyed outside of the lock
+		std::vector<StreamRequest> cancelledRequests;
+		{
+			std::scoped_lock lock(mutex);
+
+			auto moveOutMatchingTag = [&](std::vector<StreamRequest>& requests)
+			{
+				auto partitionPoint = std::stable_partition(requests.begin(), requests.end(), [&](const auto& request) { return (request.Tag != tag); });
+				std::move(partitionPoint, requests.end(), std::back_inserter(cancelledRequests));
+				requests.erase(partitionPoint, requests.end());
+			};
+
+			moveOutMatchingTag(queuedRequests);
+			moveOutMatchingTag(parsedRequests);
+
+			for (auto& loadingRequest : loadingRequests)
+			{
+				if (loadingRequest.Tag == tag && !loadingRequest.Cancelled)
+				{
+					loadingRequest.Cancelled = true;
+					statistics.CancelledCount++;
+				}
+			}
+
+			statistics.CancelledCount += static_cast<u32>(cancelledRequests.size());
+		}
+
+		u32 cancelledUploadCount = 0;
+		for (auto& upload : pendingUploads)
+		{
+			if (upload.Request.Tag == tag)
+			{
+				RemovePlaceholderTexIDs(upload);
+				cancelledUploadCount++;
+			}
+		}
+
+		pendingUploads.erase(std::remove_if(pendingUploads.begin(), pendingUploads.end(), [&](const auto& upload) { return (upload.Request.Tag == tag); }), pendingUploads.end());
+
+		std::scoped_lock lock(mutex);
+		statistics.CancelledCount += cancelledUploadCount;
+	}
+
+	void SceneResourceStreamer::Update(const Render::Camera3D& camera)
+	{
+		std::vector<StreamRequest> newlyParsedRequests;
+		{
+			std::scoped_lock lock(mutex);
+			newlyParsedRequests = std::move(parsedRequests);
+			parsedRequests.clear();
+			statistics.LastFrameUploadedBytes = 0;
+		}
+
+		for (auto& request : newlyParsedRequests)
+		{
+			// NOTE: Safe to access because the request could only have been parsed after the TexDB load had completed
+			if (sceneGraph.TexDB == nullptr && texDB != nullptr)
+				sceneGraph.TexDB = texDB;
+
+			const size_t geometryByteSize = GetGeometryByteSize(*request.ObjSet);
+			pendingUploads.push_back(PendingUpload { std::move(request), false, 0, geometryByteSize, 0.0f });
+		}
+
+		if (pendingUploads.empty())
+			return;
+
+		for (auto& upload : pendingUploads)
+			upload.CameraDistance = GetCameraDistance(*upload.Request.ObjSet, camera);
+
+		std::stable_sort(pendingUploads.begin(), pendingUploads.end(), [](const auto& a, const auto& b)
+		{
+			if (a.Request.Priority != b.Request.Priority)
+				return (a.Request.Priority < b.Request.Priority);
+			return (a.CameraDistance < b.CameraDistance);
+		});
+
+		size_t remainingBudget = uploadBudgetBytesPerFrame;
+		bool anyUploaded = false;
+
+		// NOTE: Every upload before the one that ran out of budget has been fully uploaded.
+		//		 The loaded callbacks may add new requests but must not cancel any because that would modify the pending uploads while iterating
+		size_t uploadIndex = 0;
+		for (; uploadIndex < pendingUploads.size(); uploadIndex++)
+		{
+			if (!UploadWithinBudget(pendingUploads[uploadIndex], remainingBudget, anyUploaded))
+				break;
+		}
+
+		const TimeSpan now = TimeSpan::GetTimeNow();
+		auto completedEnd = pendingUploads.begin() + uploadIndex;
+		{
+			std::scoped_lock lock(mutex);
+			for (auto it = pendingUploads.begin(); it != completedEnd; it++)
+			{
+				statistics.CompletedCount++;
+				statistics.UploadWait.AddSample(now - it->Request.ParseEndTime);
+				statistics.RequestToReady.AddSample(now - it->Request.RequestTime);
+			}
+		}
+		pendingUploads.erase(pendingUploads.begin(), completedEnd);
+	}
+
+	void SceneResourceStreamer::WaitUntilParsed()
+	{
+		std::unique_lock lock(mutex);
+		parsedCondition.wait(lock, [this] { return (queuedRequests.empty() && loadingRequests.empty()); });
+	}
+
+	bool SceneResourceStreamer::IsIdle() const
+	{
+		std::scoped_lock lock(mutex);
+		return (queuedRequests.empty() && loadingRequests.empty() && parsedRequests.empty() && pendingUploads.empty());
+	}
+
+	Tex* SceneResourceStreamer::GetPlaceholderTex(const Cached_TexID* texID) const
+	{
+		if (texID == nullptr || placeholderTexIDs.empty())
+			return nullptr;
+
+		return (placeholderTexIDs.find(texID->ID) != placeholderTexIDs.end()) ? placeholderTex.get() : nullptr;
+	}
+
+	size_t SceneResourceStreamer::GetUploadBudgetBytesPerFrame() const
+	{
+		return uploadBudgetBytesPerFrame;
+	}
+
+	void SceneResourceStreamer::SetUploadBudgetBytesPerFrame(size_t value)
+	{
+		uploadBudgetBytesPerFrame = value;
+	}
+
+	ResourceStreamStatistics SceneResourceStreamer::GetStatistics() const
+	{
+		std::scoped_lock lock(mutex);
+		ResourceStreamStatistics result = statistics;
+		result.QueuedCount = static_cast<u32>(queuedRequests.size());
+		result.LoadingCount = static_cast<u32>(loadingRequests.size());
+		result.PendingUploadCount = static_cast<u32>(parsedRequests.size() + pendingUploads.size());
+		return result;
+	}
+
+	void SceneResourceStreamer::IOThreadEntryPoint()
+	{
+		while (true)
+		{
+			StreamRequest request = {};
+			{
+				std::unique_lock lock(mutex);
+				requestAvailableCondition.wait(lock, [this] { return (!queuedRequests.empty() || exitRequested); });
+
+				if (exitRequested)
+					return;
+
+				auto highestPriorityRequest = std::min_element(queuedRequests.begin(), queuedRequests.end(), [](const auto& a, const auto& b)
+				{
+					if (a.Priority != b.Priority)
+						return (a.Priority < b.Priority);
+					return (a.ID < b.ID);
+				});
+
+				request = std::move(*highestPriorityRequest);
+				queuedRequests.erase(highestPriorityRequest);
+				loadingRequests.push_back(LoadingRequest { request.ID, request.Tag, false });
+			}
+
+			request.ParseStartTime = TimeSpan::GetTimeNow();
+			ParseRequest(request);
+			request.ParseEndTime = TimeSpan::GetTimeNow();
+
+			{
+				std::scoped_lock lock(mutex);
+
+				auto loadingRequest = std::find_if(loadingRequests.begin(), loadingRequests.end(), [&](const auto& loading) { return (loading.ID == request.ID); });
+				const bool wasCancelled = loadingRequest->Cancelled;
+				loadingRequests.erase(loadingRequest);
+
+				statistics.QueueWait.AddSample(request.ParseStartTime - request.RequestTime);
+				statistics.Parse.AddSample(request.ParseEndTime - request.ParseStartTime);
+
+				// NOTE: Cancelled requests have already been counted and their ObjSet is destroyed outside of the lock at the end of the iteration
+				if (!wasCancelled && request.ObjSet == nullptr)
+					statistics.FailedCount++;
+				else if (!wasCancelled)
+					parsedRequests.push_back(std::move(request));
+			}
+			parsedCondition.notify_all();
+		}
+	}
+
+	void SceneResourceStreamer::ParseRequest(StreamRequest& request)
+	{
+		std::shared_ptr<ObjSet> objSet = IO::File::Load<ObjSet>(request.ObjSetPath);
+		if (objSet == nullptr)
+			return;
+
+		objSet->Name = IO::Path::GetFileName(request.ObjSetPath, false);
+		objSet->TexSet = TexSet::LoadSetTextureIDs(request.TexSetPath, objSet.get());
+
+		LoadTexDBIfNeeded();
+		if (texDB != nullptr && objSet->TexSet != nullptr)
+		{
+			for (auto& tex : objSet->TexSet->Textures)
+			{
+				if (const auto matchingEntry = texDB->GetTexEntry(tex->ID); matchingEntry != nullptr)
+					tex->Name.emplace(matchingEntry->Name);
+			}
+		}
+
+		request.ObjSet = std::move(objSet);
+	}
+
+	void SceneResourceStreamer::LoadTexDBIfNeeded()
+	{
+		std::call_once(texDBLoadFlag, [&]
+		{
+			std::shared_ptr<Database::TexDB> loadedTexDB = IO::File::Load<Database::TexDB>(TexDBPath);
+			if (loadedTexDB == nullptr)
+				return;
+
+			loadedTexDB->BuildIndices();
+			texDB = std::move(loadedTexDB);
+		});
+	}
+
+	bool SceneResourceStreamer::UploadWithinBudget(PendingUpload& upload, size_t& inOutRemainingBudget, bool& inOutAnyUploaded)
+	{
+		// NOTE: Always upload at least one item per frame so that a single item larger than the entire budget can't stall the queue forever
+		auto tryConsumeBudget = [&](size_t byteSize)
+		{
+			if (inOutAnyUploaded && byteSize > inOutRemainingBudget)
+				return false;
+
+			inOutRemainingBudget -= std::min(byteSize, inOutRemainingBudget);
+			inOutAnyUploaded = true;
+
+			std::scoped_lock lock(mutex);
+			statistics.UploadedBytes += byteSize;
+			statistics.LastFrameUploadedBytes += byteSize;
+			return true;
+		};
+
+		const auto& objSet = upload.Request.ObjSet;
+		if (!upload.ObjSetRegistered)
+		{
+			if (!tryConsumeBudget(upload.GeometryByteSize))
+				return false;
+
+			AddPlaceholderTexIDs(*objSet);
+			upload.ObjSetRegistered = true;
+
+			auto& loadedResource = sceneGraph.LoadObjSet(objSet, upload.Request.Tag);
+			if (upload.Request.OnLoaded)
+				upload.Request.OnLoaded(loadedResource);
+		}
+
+		if (objSet->TexSet != nullptr)
+		{
+			auto& textures = objSet->TexSet->Textures;
+			while (upload.NextTexIndex < textures.size())
+			{
+				const auto& tex = textures[upload.NextTexIndex];
+				if (!tryConsumeBudget(GetTexByteSize(*tex)))
+					return false;
+
+				sceneGraph.TexIDMap.Add(tex->ID, tex);
+				placeholderTexIDs.erase(tex->ID);
+				upload.NextTexIndex++;
+			}
+		}
+
+		return true;
+	}
+
+	void SceneResourceStreamer::AddPlaceholderTexIDs(const ObjSet& objSet)
+	{
+		if (objSet.TexSet == nullptr)
+			return;
+
+		for (const auto& tex : objSet.TexSet->Textures)
+			placeholderTexIDs.insert(tex->ID);
+	}
+
+	void SceneResourceStreamer::RemovePlaceholderTexIDs(const PendingUpload& upload)
+	{
+		if (!upload.ObjSetRegistered || upload.Request.ObjSet->TexSet == nullptr)
+			return;
+
+		const auto& textures = upload.Request.ObjSet->TexSet->Textures;
+		for (size_t i = upload.NextTexIndex; i < textures.size(); i++)
+			placeholderTexIDs.erase(textures[i]->ID);
+	}
+}
@@ -0,0 +1,167 @@
+#pragma once
+#include "Types.h"
+#include "SceneGraph.h"
+#include "Render/Core/Camera.h"
+#include "Time/TimeSpan.h"
+#include <functional>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Comfy::Studio::Editor
+{
+	// NOTE: Lower values are loaded first, requests of the same priority are loaded in the order they were made
+	enum class ResourceStreamPriority : u8
+	{
+		UserRequest,
+		Default,
+		Background,
+		Count
+	};
+
+	struct ResourceStreamLatency
+	{
+		u32 SampleCount;
+		TimeSpan Total, Max;
+
+		void AddSample(TimeSpan value);
+		TimeSpan GetAverage() const;
+	};
+
+	struct ResourceStreamStatistics
+	{
+		u32 QueuedCount;
+		u32 LoadingCount;
+		u32 PendingUploadCount;
+
+		u32 CompletedCount;
+		u32 FailedCount;
+		u32 CancelledCount;
+
+		// NOTE: Time spent waiting for an IO thread, reading and parsing on the IO thread, waiting for the main thread upload budget and the sum of all three
+		ResourceStreamLatency QueueWait;
+		ResourceStreamLatency Parse;
+		ResourceStreamLatency UploadWait;
+		ResourceStreamLatency RequestToReady;
+
+		size_t UploadedBytes;
+		size_t LastFrameUploadedBytes;
+	};
+
+	// NOTE: Loads and parses ObjSets and their TexSets on a small pool of background IO threads so that the UI never blocks on file IO.
+	//		 Finished sets are handed over to the SceneGraph by Update() on the main thread, limited by a per frame byte budget so that the lazily created GPU resources
+	//		 of a large stage are spread across multiple frames. Sets closer to the camera are handed over first and textures that have yet to be registered
+	//		 are substituted with a placeholder texture in the meantime
+	class SceneResourceStreamer : NonCopyable
+	{
+	public:
+		using RequestID = u32;
+		static constexpr RequestID InvalidRequestID = 0;
+
+		// NOTE: File IO bound so there is little to gain from more threads, also keeps the memory of in flight sets bounded
+		static constexpr size_t MaxIOThreadCount = 2;
+		static constexpr size_t DefaultUploadBudgetBytesPerFrame = 32 * 1024 * 1024;
+
+		// NOTE: Called on the main thread once the ObjSet has been added to the SceneGraph, its textures may still be pending at this point
+		using OnLoadedFunc = std::function<void(ObjSetResource& loadedResource)>;
+
+	public:
+		SceneResourceStreamer(SceneGraph& sceneGraph);
+		~SceneResourceStreamer();
+
+	public:
+		RequestID RequestObjSet(std::string_view objSetPath, std::string_view texSetPath, EntityTag tag, ResourceStreamPriority priority, OnLoadedFunc onLoaded);
+
+		// NOTE: Only affects requests that haven't been picked up by an IO thread yet
+		void SetPriority(RequestID requestID, ResourceStreamPriority priority);
+
+		// NOTE: Drops all queued, in flight and not yet fully uploaded requests with a matching tag. Already registered sets have to be erased by the caller
+		void CancelByTag(EntityTag tag);
+
+		// NOTE: Must be called once per frame on the main thread
+		void Update(const Render::Camera3D& camera);
+
+		// NOTE: Blocks until all requests have been parsed, the results are still only handed over by the next Update()
+		void WaitUntilParsed();
+		bool IsIdle() const;
+
+		// NOTE: Returns the placeholder texture if the ID belongs to a texture that is still being streamed in, otherwise null
+		Graphics::Tex* GetPlaceholderTex(const Cached_TexID* texID) const;
+
+		size_t GetUploadBudgetBytesPerFrame() const;
+		void SetUploadBudgetBytesPerFrame(size_t value);
+
+		ResourceStreamStatistics GetStatistics() const;
+
+	private:
+		struct StreamRequest
+		{
+			RequestID ID;
+			std::string ObjSetPath, TexSetPath;
+			EntityTag Tag;
+			ResourceStreamPriority Priority;
+			OnLoadedFunc OnLoaded;
+
+			TimeSpan RequestTime;
+			TimeSpan ParseStartTime;
+			TimeSpan ParseEndTime;
+
+			std::shared_ptr<Graphics::ObjSet> ObjSet;
+		};
+
+		struct LoadingRequest
+		{
+			RequestID ID;
+			EntityTag Tag;
+			bool Cancelled;
+		};
+
+		struct PendingUpload
+		{
+			StreamRequest Request;
+
+			bool ObjSetRegistered;
+			size_t NextTexIndex;
+			size_t GeometryByteSize;
+
+			// NOTE: Recalculated every Update() from the bounding spheres of all objects
+			float CameraDistance;
+		};
+
+		void IOThreadEntryPoint();
+		void ParseRequest(StreamRequest& request);
+		void LoadTexDBIfNeeded();
+
+		bool UploadWithinBudget(PendingUpload& upload, size_t& inOutRemainingBudget, bool& inOutAnyUploaded);
+		void AddPlaceholderTexIDs(const Graphics::ObjSet& objSet);
+		void RemovePlaceholderTexIDs(const PendingUpload& upload);
+
+	private:
+		SceneGraph& sceneGraph;
+
+		mutable std::mutex mutex;
+		std::condition_variable requestAvailableCondition;
+		std::condition_variable parsedCondition;
+
+		std::vector<StreamRequest> queuedRequests;
+		std::vector<StreamRequest> parsedRequests;
+		std::vector<LoadingRequest> loadingRequests;
+		bool exitRequested = false;
+
+		RequestID lastRequestID = InvalidRequestID;
+		ResourceStreamStatistics statistics = {};
+
+		// NOTE: Loaded by the first IO thread that needs it and then shared with the SceneGraph, never modified afterwards
+		std::once_flag texDBLoadFlag;
+		std::shared_ptr<Database::TexDB> texDB = nullptr;
+
+		// NOTE: Only accessed by the main thread
+		std::vector<PendingUpload> pendingUploads;
+		std::unordered_set<TexID> placeholderTexIDs;
+		std::unique_ptr<Graphics::Tex> placeholderTex = nullptr;
+		size_t uploadBudgetBytesPerFrame = DefaultUploadBudgetBytesPerFrame;
+
+		std::vector<std::thread> ioThreads;
+	};
+}